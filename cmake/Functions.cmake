@@ -478,6 +478,18 @@ macro(dune_probe_functions)
     "sys/types.h;sys/socket.h;winsock2.h"
     DUNE_SYS_HAS_SOCKET)
 
+  dune_test_function(recvmmsg
+    "int"
+    "int;struct mmsghdr*;unsigned int;int;struct timespec*"
+    "sys/types.h;sys/socket.h;time.h"
+    DUNE_SYS_HAS_RECVMMSG)
+
+  dune_test_function(sendmmsg
+    "int"
+    "int;struct mmsghdr*;unsigned int;int"
+    "sys/types.h;sys/socket.h"
+    DUNE_SYS_HAS_SENDMMSG)
+
   dune_test_function(WSAStartup
     "int"
     "WORD;WSADATA*"
@@ -688,6 +700,18 @@ macro(dune_probe_functions)
     "sched.h"
     DUNE_SYS_HAS_SCHED_GET_PRIORITY_MAX)
 
+  dune_test_function(pthread_setaffinity_np
+    "int"
+    "pthread_t;size_t;cpu_set_t*"
+    "pthread.h;sched.h"
+    DUNE_SYS_HAS_PTHREAD_SETAFFINITY_NP)
+
+  dune_test_function(pthread_attr_setaffinity_np
+    "int"
+    "pthread_attr_t*;size_t;cpu_set_t*"
+    "pthread.h;sched.h"
+    DUNE_SYS_HAS_PTHREAD_ATTR_SETAFFINITY_NP)
+
   dune_test_function(__sync_add_and_fetch
     "int"
     "int*;int"
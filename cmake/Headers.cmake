@@ -144,6 +144,8 @@ macro(dune_probe_headers)
   dune_test_header(linux/videodev2.h)
   dune_test_header(sched.h)
   dune_test_header(poll.h)
+  dune_test_header(sys/epoll.h)
+  dune_test_header(sys/eventfd.h)
   dune_test_header(ifaddrs.h)
   dune_test_header(semaphore.h)
   dune_test_header(libintl.h)
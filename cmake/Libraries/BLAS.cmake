@@ -0,0 +1,38 @@
+############################################################################
+# Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      #
+# Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  #
+############################################################################
+# This file is part of DUNE: Unified Navigation Environment.               #
+#                                                                          #
+# Commercial Licence Usage                                                 #
+# Licencees holding valid commercial DUNE licences may use this file in    #
+# accordance with the commercial licence agreement provided with the       #
+# Software or, alternatively, in accordance with the terms contained in a  #
+# written agreement between you and Faculdade de Engenharia da             #
+# Universidade do Porto. For licensing terms, conditions, and further      #
+# information contact lsts@fe.up.pt.                                       #
+#                                                                          #
+# Modified European Union Public Licence - EUPL v.1.1 Usage                #
+# Alternatively, this file may be used under the terms of the Modified     #
+# EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md #
+# included in the packaging of this file. You may not use this work        #
+# except in compliance with the Licence. Unless required by applicable     #
+# law or agreed to in writing, software distributed under the Licence is   #
+# distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     #
+# ANY KIND, either express or implied. See the Licence for the specific    #
+# language governing permissions and limitations at                        #
+# https://github.com/LSTS/dune/blob/master/LICENCE.md and                  #
+# http://ec.europa.eu/idabc/eupl.html.                                     #
+############################################################################
+
+if(BLAS)
+  dune_test_lib(blas dgemm_)
+  dune_test_lib(lapack dgetrf_)
+
+  if(DUNE_SYS_HAS_LIB_BLAS AND DUNE_SYS_HAS_LIB_LAPACK)
+    set(DUNE_USING_BLAS 1 CACHE INTERNAL "BLAS/LAPACK libraries")
+  else(DUNE_SYS_HAS_LIB_BLAS AND DUNE_SYS_HAS_LIB_LAPACK)
+    message(SEND_ERROR "BLAS/LAPACK libraries were not found on the system.")
+    set(DUNE_USING_BLAS 0 CACHE INTERNAL "BLAS/LAPACK libraries")
+  endif(DUNE_SYS_HAS_LIB_BLAS AND DUNE_SYS_HAS_LIB_LAPACK)
+endif(BLAS)
@@ -73,153 +73,213 @@ const float c_max_speed = 6.0;
 // Timestep
 const float c_timestep = 0.5;
 
-int
-main(int32_t argc, char** argv)
+//! Check if a message is used by this program.
+static bool
+isRelevant(uint16_t id)
 {
-  if (argc <= 1)
+  switch (id)
   {
-    std::cerr << "Usage: " << argv[0] << " <path_to_log_1/Data.lsf[.gz]> ... <path_to_log_n/Data.lsf[.gz]>"
-              << std::endl;
-    return 1;
+    case DUNE_IMC_ANNOUNCE:
+    case DUNE_IMC_LOGGINGCONTROL:
+    case DUNE_IMC_ESTIMATEDSTATE:
+    case DUNE_IMC_RPM:
+    case DUNE_IMC_SIMULATEDSTATE:
+      return true;
+    default:
+      return false;
   }
+}
 
-  std::map<std::string, Vehicle> vehicles;
-
-  for (int32_t i = 1; i < argc; ++i)
-  {
-    std::istream* is = 0;
-    Compression::Methods method = Compression::Factory::detect(argv[i]);
-    if (method == METHOD_UNKNOWN)
-      is = new std::ifstream(argv[i], std::ios::binary);
-    else
-      is = new Compression::FileInput(argv[i], method);
-
-    IMC::Message* msg = NULL;
-
-    uint16_t curr_rpm = 0;
+//! Per log state.
+struct LogState
+{
+  uint16_t curr_rpm;
+  bool got_state;
+  IMC::EstimatedState estate;
+  double last_lat;
+  double last_lon;
+  // Accumulated travelled distance
+  double distance;
+  // Accumulated travelled time
+  double duration;
+  bool got_name;
+  std::string log_name;
+  bool ignore;
+  std::string reason;
+  uint16_t sys_id;
+  std::string sys_name;
+  std::string error;
+
+  LogState(void):
+    curr_rpm(0),
+    got_state(false),
+    last_lat(0),
+    last_lon(0),
+    distance(0.0),
+    duration(0.0),
+    got_name(false),
+    log_name("unknown"),
+    ignore(false),
+    sys_id(0xffff)
+  { }
+};
 
-    bool got_state = false;
-    IMC::EstimatedState estate;
-    double last_lat;
-    double last_lon;
+//! Integrates the distance travelled in each log.
+class DistanceVisitor: public IMC::LsfScanner::Visitor
+{
+public:
+  DistanceVisitor(size_t count):
+    m_logs(count)
+  { }
 
-    // Accumulated travelled distance
-    double distance = 0.0;
-    // Accumulated travelled time
-    double duration = 0.0;
+  const LogState&
+  getLog(size_t log) const
+  {
+    return m_logs[log];
+  }
 
-    bool got_name = false;
-    std::string log_name = "unknown";
+  bool
+  onRecord(size_t log, const IMC::LsfMappedFile::Record& record)
+  {
+    if (!isRelevant(record.header.mgid))
+      return true;
 
-    bool ignore = false;
-    uint16_t sys_id = 0xffff;
-    std::string sys_name;
+    LogState& s = m_logs[log];
+    IMC::Message* msg = record.decode(NULL, true);
 
-    try
+    if (msg->getId() == DUNE_IMC_ANNOUNCE)
+    {
+      IMC::Announce* ptr = static_cast<IMC::Announce*>(msg);
+      if (s.sys_id == ptr->getSource())
+      {
+        s.sys_name = ptr->sys_name;
+      }
+    }
+    else if (msg->getId() == DUNE_IMC_LOGGINGCONTROL)
     {
-      while ((msg = IMC::Packet::deserialize(*is)) != 0)
+      if (!s.got_name)
       {
-        if (msg->getId() == DUNE_IMC_ANNOUNCE)
+        IMC::LoggingControl* ptr = static_cast<IMC::LoggingControl*>(msg);
+
+        if (ptr->op == IMC::LoggingControl::COP_STARTED)
         {
-          IMC::Announce* ptr = static_cast<IMC::Announce*>(msg);
-          if (sys_id == ptr->getSource())
-          {
-            sys_name = ptr->sys_name;
-          }
+          s.sys_id = ptr->getSource();
+          s.log_name = ptr->name;
+          s.got_name = true;
         }
-        else if (msg->getId() == DUNE_IMC_LOGGINGCONTROL)
+      }
+    }
+    else if (msg->getId() == DUNE_IMC_ESTIMATEDSTATE)
+    {
+      if (msg->getTimeStamp() - s.estate.getTimeStamp() > c_timestep)
+      {
+        IMC::EstimatedState* ptr = static_cast<IMC::EstimatedState*>(msg);
+
+        if (!s.got_state)
         {
-          if (!got_name)
-          {
-            IMC::LoggingControl* ptr = static_cast<IMC::LoggingControl*>(msg);
-
-            if (ptr->op == IMC::LoggingControl::COP_STARTED)
-            {
-              sys_id = ptr->getSource();
-              log_name = ptr->name;
-              got_name = true;
-            }
-          }
+          s.estate = *ptr;
+          Coordinates::toWGS84(*ptr, s.last_lat, s.last_lon);
+
+          s.got_state = true;
         }
-        else if (msg->getId() == DUNE_IMC_ESTIMATEDSTATE)
+        else if (s.curr_rpm > c_min_rpm)
         {
-          if (msg->getTimeStamp() - estate.getTimeStamp() > c_timestep)
+          double lat, lon;
+          Coordinates::toWGS84(*ptr, lat, lon);
+
+          double dist = Coordinates::WGS84::distance(s.last_lat, s.last_lon, 0.0,
+                                                     lat, lon, 0.0);
+
+          // Not faster than maximum considered speed
+          if (dist / (ptr->getTimeStamp() - s.estate.getTimeStamp()) < c_max_speed)
           {
-            IMC::EstimatedState* ptr = static_cast<IMC::EstimatedState*>(msg);
-
-            if (!got_state)
-            {
-              estate = *ptr;
-              Coordinates::toWGS84(*ptr, last_lat, last_lon);
-
-              got_state = true;
-            }
-            else if (curr_rpm > c_min_rpm)
-            {
-              double lat, lon;
-              Coordinates::toWGS84(*ptr, lat, lon);
-
-              double dist = Coordinates::WGS84::distance(last_lat, last_lon, 0.0,
-                                                         lat, lon, 0.0);
-
-              // Not faster than maximum considered speed
-              if (dist / (ptr->getTimeStamp() - estate.getTimeStamp()) < c_max_speed)
-              {
-                distance += dist;
-                duration += msg->getTimeStamp() - estate.getTimeStamp();
-              }
-
-              estate = *ptr;
-              last_lat = lat;
-              last_lon = lon;
-            }
+            s.distance += dist;
+            s.duration += msg->getTimeStamp() - s.estate.getTimeStamp();
           }
-        }
-        else if (msg->getId() == DUNE_IMC_RPM)
-        {
-          IMC::Rpm* ptr = static_cast<IMC::Rpm*>(msg);
-          curr_rpm = ptr->value;
-        }
-        else if (msg->getId() == DUNE_IMC_SIMULATEDSTATE)
-        {
-          // since it has simulated state let us ignore this log
-          ignore = true;
-          delete msg;
-          std::cerr << "this is a simulated log";
-          break;
-        }
-
-        delete msg;
 
-        // ignore idles
-        // either has the string _idle or has only the time.
-        if (log_name.find("_idle") != std::string::npos ||
-            log_name.size() == 15)
-        {
-          ignore = true;
-          std::cerr << "this is an idle log";
-          break;
+          s.estate = *ptr;
+          s.last_lat = lat;
+          s.last_lon = lon;
         }
       }
     }
-    catch (std::runtime_error& e)
+    else if (msg->getId() == DUNE_IMC_RPM)
+    {
+      IMC::Rpm* ptr = static_cast<IMC::Rpm*>(msg);
+      s.curr_rpm = ptr->value;
+    }
+    else if (msg->getId() == DUNE_IMC_SIMULATEDSTATE)
     {
-      std::cerr << "ERROR: " << e.what() << std::endl;
+      // since it has simulated state let us ignore this log
+      s.ignore = true;
+      s.reason = "this is a simulated log";
+      delete msg;
+      return false;
     }
 
-    delete is;
+    delete msg;
+
+    // ignore idles
+    // either has the string _idle or has only the time.
+    if (s.log_name.find("_idle") != std::string::npos ||
+        s.log_name.size() == 15)
+    {
+      s.ignore = true;
+      s.reason = "this is an idle log";
+      return false;
+    }
+
+    return true;
+  }
+
+  void
+  onLogError(size_t log, const std::string& error)
+  {
+    m_logs[log].error = error;
+  }
+
+private:
+  std::vector<LogState> m_logs;
+};
+
+int
+main(int32_t argc, char** argv)
+{
+  if (argc <= 1)
+  {
+    std::cerr << "Usage: " << argv[0] << " <path_to_log_1/Data.lsf[.gz]> ... <path_to_log_n/Data.lsf[.gz]>"
+              << std::endl;
+    return 1;
+  }
+
+  // Logs are scanned concurrently, results are gathered in order.
+  std::vector<std::string> paths(argv + 1, argv + argc);
+  DistanceVisitor visitor(paths.size());
+  IMC::LsfScanner::scan(paths, visitor);
+
+  std::map<std::string, Vehicle> vehicles;
+
+  for (size_t i = 0; i < paths.size(); ++i)
+  {
+    const LogState& log = visitor.getLog(i);
+
+    if (log.ignore)
+      std::cerr << log.reason;
+
+    if (!log.error.empty())
+      std::cerr << "ERROR: " << log.error << std::endl;
 
-    if (ignore)
+    if (log.ignore)
     {
       std::cerr << "... ignoring" << std::endl;
       continue;
     }
 
-    if (distance > 0)
+    if (log.distance > 0)
     {
-      vehicles[sys_name].duration += duration;
-      vehicles[sys_name].distance += distance;
-      vehicles[sys_name].logs.push_back(Log(log_name, distance, duration));
+      vehicles[log.sys_name].duration += log.duration;
+      vehicles[log.sys_name].distance += log.distance;
+      vehicles[log.sys_name].logs.push_back(Log(log.log_name, log.distance, log.duration));
     }
   }
 
@@ -50,6 +50,24 @@ const unsigned c_samples = 7;
 // Minimum number of samples before starting to count energy
 const unsigned c_min_samples = 20;
 
+//! Check if a message is used by this program.
+static bool
+isRelevant(uint16_t id)
+{
+  switch (id)
+  {
+    case DUNE_IMC_LOGGINGCONTROL:
+    case DUNE_IMC_ENTITYINFO:
+    case DUNE_IMC_VOLTAGE:
+    case DUNE_IMC_CURRENT:
+    case DUNE_IMC_RPM:
+    case DUNE_IMC_SIMULATEDSTATE:
+      return true;
+    default:
+      return false;
+  }
+}
+
 int
 main(int32_t argc, char** argv)
 {
@@ -99,12 +117,7 @@ main(int32_t argc, char** argv)
 
   for (int32_t i = start_index; i < argc; ++i)
   {
-    std::istream* is = 0;
-    DUNE::Compression::Methods method = DUNE::Compression::Factory::detect(argv[i]);
-    if (method == DUNE::Compression::METHOD_UNKNOWN)
-      is = new std::ifstream(argv[i], std::ios::binary);
-    else
-      is = new DUNE::Compression::FileInput(argv[i], method);
+    DUNE::IMC::LsfReader reader(argv[i]);
 
     DUNE::IMC::Message* msg = NULL;
 
@@ -129,8 +142,12 @@ main(int32_t argc, char** argv)
 
     try
     {
-      while ((msg = DUNE::IMC::Packet::deserialize(*is)) != 0)
+      while (reader.next())
       {
+        if (!isRelevant(reader.getHeader().mgid))
+          continue;
+
+        msg = reader.decode(NULL, true);
 
         if (msg->getId() == DUNE_IMC_LOGGINGCONTROL)
         {
@@ -217,8 +234,6 @@ main(int32_t argc, char** argv)
       std::cerr << "ERROR: " << e.what() << std::endl;
     }
 
-    delete is;
-
     if (ignore)
     {
       std::cerr << "... ignoring" << std::endl;
@@ -58,8 +58,6 @@ main(int32_t argc, char** argv)
   ByteBuffer buffer;
   std::ofstream lsf("FilteredData.lsf", std::ios::binary);
 
-  IMC::Message* msg;
-
   uint32_t accum = 0;
 
   bool done_first = false;
@@ -76,41 +74,35 @@ main(int32_t argc, char** argv)
 
   for (uint32_t j = 2; j < (uint32_t)argc; ++j)
   {
-    std::istream* is = 0;
-    Compression::Methods method = Compression::Factory::detect(argv[j]);
-    if (method == METHOD_UNKNOWN)
-      is = new std::ifstream(argv[j], std::ios::binary);
-    else
-      is = new Compression::FileInput(argv[j], method);
+    IMC::LsfReader reader(argv[j]);
 
     uint32_t i = 0;
 
     try
     {
-      while ((msg = IMC::Packet::deserialize(*is)) != 0)
+      while (reader.next())
       {
+        const IMC::Header& hdr = reader.getHeader();
+
         if (!done_first)
         {
           // place an empty estimatedstate message in the log
           IMC::EstimatedState state;
-          state.setTimeStamp(msg->getTimeStamp());
+          state.setTimeStamp(hdr.timestamp);
           IMC::Packet::serialize(&state, buffer);
           lsf.write(buffer.getBufferSigned(), buffer.getSize());
           done_first = true;
         }
 
-        std::set<uint32_t>::const_iterator it;
-        it = ids.find(msg->getId());
+        if (ids.find(hdr.mgid) == ids.end())
+          continue;
 
-        if (it != ids.end())
-        {
-          IMC::Packet::serialize(msg, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
+        // Records are copied verbatim, only checking their integrity.
+        if (!reader.verify())
+          throw IMC::InvalidCrc();
 
-          ++i;
-        }
-
-        delete msg;
+        lsf.write((const char*)reader.getData(), reader.getSize());
+        ++i;
       }
     }
     catch (std::runtime_error& e)
@@ -121,8 +113,6 @@ main(int32_t argc, char** argv)
 
     std::cerr << i << " messages in " << argv[j] << std::endl;
     accum += i;
-
-    delete is;
   }
 
   lsf.close();
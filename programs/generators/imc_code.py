@@ -141,9 +141,27 @@ class Message:
         f.add_body('return true;')
         public.append(f);
 
+        # Messages whose fields all have a fixed size are serialized
+        # at constant offsets after a single bounds check.
+        fixed_layout = self.has_fields() and self.is_fixed_size()
+
+        # isFixedSize()
+        f = Function('isFixedSize', 'constexpr bool', static = True, inline = True)
+        f.body('return %s;' % ('true' if self.is_fixed_size() else 'false'))
+        public.append(f)
+
+        # fixedSize()
+        f = Function('fixedSize', 'constexpr unsigned', static = True, inline = True)
+        f.body('return %d;' % self.get_fixed_size())
+        public.append(f)
+
         # serializeFields()
         f = Function('serializeFields', 'uint8_t*', [Var('bfr__', 'uint8_t*')], const = True)
-        if self.has_fields():
+        if fixed_layout:
+            for field, offset in self.get_offsets():
+                f.add_body('IMC::serialize(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return bfr__ + %d;' % self.get_fixed_size())
+        elif self.has_fields():
             f.add_body('uint8_t* ptr__ = bfr__;')
             for field in node.findall('field'):
                 if field.get('type').startswith('message'):
@@ -157,7 +175,12 @@ class Message:
 
         # deserializeFields()
         f = Function('deserializeFields', 'uint16_t', [Var('bfr__', 'const uint8_t*'), Var('size__', 'uint16_t')])
-        if self.has_fields():
+        if fixed_layout:
+            f.add_body('if (size__ < %d)\n{\nthrow BufferTooShort();\n}' % self.get_fixed_size())
+            for field, offset in self.get_offsets():
+                f.add_body('IMC::deserializeFixed(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return %d;' % self.get_fixed_size())
+        elif self.has_fields():
             f.add_body('const uint8_t* start__ = bfr__;')
             for field in node.findall('field'):
                 if field.get('type').startswith('message'):
@@ -172,7 +195,15 @@ class Message:
 
         # reverseDeserializeFields()
         f = Function('reverseDeserializeFields', 'uint16_t', [Var('bfr__', 'const uint8_t*'), Var('size__', 'uint16_t')])
-        if self.has_fields():
+        if fixed_layout:
+            f.add_body('if (size__ < %d)\n{\nthrow BufferTooShort();\n}' % self.get_fixed_size())
+            for field, offset in self.get_offsets():
+                if consts['sizes'][field.get('type')] == 1:
+                    f.add_body('IMC::deserializeFixed(%s, bfr__ + %d);' % (get_name(field), offset))
+                else:
+                    f.add_body('IMC::reverseDeserializeFixed(%s, bfr__ + %d);' % (get_name(field), offset))
+            f.add_body('return %d;' % self.get_fixed_size())
+        elif self.has_fields():
             f.add_body('const uint8_t* start__ = bfr__;')
             for field in node.findall('field'):
                 if consts['sizes'][field.get('type')] == 1:
@@ -339,6 +370,22 @@ class Message:
             size += self._consts['sizes'][field.get('type')]
         return size;
 
+    # True if all fields have a fixed serialization size.
+    def is_fixed_size(self):
+        for field in self._node.findall('field'):
+            if not is_fixed(field):
+                return False
+        return True
+
+    # Retrieve a list of (field, offset) pairs of a fixed layout.
+    def get_offsets(self):
+        offsets = []
+        offset = 0
+        for field in self._node.findall('field'):
+            offsets.append((field, offset))
+            offset += self._consts['sizes'][field.get('type')]
+        return offsets
+
     def get_variable_size(self):
         size = []
         for field in self._node.findall('field'):
@@ -0,0 +1,176 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Compare the optimized matrix kernels with the reference implementation.  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+//! Matrix inversion using Gauss elimination with total pivoting, as
+//! implemented before the LU kernels.
+static Matrix
+inverseReference(const Matrix& a)
+{
+  int n = a.rows();
+  std::vector<double> M(2 * n * n);
+  std::vector<int> index(n);
+
+  for (int i = 0; i < n; i++)
+  {
+    for (int j = 0; j < n; j++)
+    {
+      M[i * 2 * n + j] = a(i, j);
+      M[i * 2 * n + n + j] = (i == j) ? 1 : 0;
+    }
+    index[i] = i;
+  }
+
+  if (Matrix::upper_triangular_tp(&M[0], &index[0], n, n + n, 1e-10))
+    throw Matrix::Error("Inversion error!");
+
+  Matrix s(n, n);
+  int n2 = n + n;
+
+  for (int j = 0; j < n; j++)
+  {
+    for (int i = n - 1; i >= 0; i--)
+    {
+      double v = M[i * n2 + n + j];
+      for (int ii = i + 1; ii < n; ii++)
+        v -= M[n2 * i + ii] * s(index[ii], j);
+      s(index[i], j) = v / M[n2 * i + i];
+    }
+  }
+
+  return s;
+}
+
+//! Create a well conditioned random matrix.
+static Matrix
+randomMatrix(size_t n)
+{
+  Matrix m(n, n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    for (size_t j = 0; j < n; ++j)
+      m(i, j) = (double)std::rand() / RAND_MAX - 0.5;
+    m(i, i) += n;
+  }
+
+  return m;
+}
+
+//! Number of repetitions for a given dimension.
+static unsigned
+getRepetitions(size_t n)
+{
+  return std::max(1u, (unsigned)(20000000 / (n * n * n)));
+}
+
+int
+main(int argc, char** argv)
+{
+  size_t max_dimension = 256;
+
+  if (argc > 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " [maximum dimension]" << std::endl;
+    return 1;
+  }
+
+  if (argc == 2)
+    max_dimension = std::max(2, std::atoi(argv[1]));
+
+  std::cout << "Implementation: " << MatrixKernels::getImplementation() << std::endl
+            << std::endl
+            << std::setw(6) << "size"
+            << std::setw(14) << "mul ref (us)"
+            << std::setw(14) << "mul (us)"
+            << std::setw(10) << "speedup"
+            << std::setw(14) << "inv ref (us)"
+            << std::setw(14) << "inv (us)"
+            << std::setw(10) << "speedup"
+            << std::setw(12) << "max error"
+            << std::endl;
+
+  for (size_t n = 3; n <= max_dimension; n *= 2)
+  {
+    Matrix a = randomMatrix(n);
+    Matrix b = randomMatrix(n);
+    Matrix c_ref(n, n);
+    Matrix c(n, n);
+    Matrix i_ref;
+    Matrix i;
+    unsigned reps = getRepetitions(n);
+
+    double t0 = Clock::get();
+    for (unsigned r = 0; r < reps; ++r)
+      MatrixKernels::multiplyReference(&a(0, 0), &b(0, 0), &c_ref(0, 0), n, n, n);
+    double mul_ref = (Clock::get() - t0) / reps;
+
+    t0 = Clock::get();
+    for (unsigned r = 0; r < reps; ++r)
+      MatrixKernels::multiply(&a(0, 0), &b(0, 0), &c(0, 0), n, n, n);
+    double mul = (Clock::get() - t0) / reps;
+
+    t0 = Clock::get();
+    for (unsigned r = 0; r < reps; ++r)
+      i_ref = inverseReference(a);
+    double inv_ref = (Clock::get() - t0) / reps;
+
+    t0 = Clock::get();
+    for (unsigned r = 0; r < reps; ++r)
+      i = inverse(a);
+    double inv = (Clock::get() - t0) / reps;
+
+    double error = std::max(max(abs(c - c_ref)), max(abs(i - i_ref)));
+
+    std::cout << std::fixed
+              << std::setw(6) << n
+              << std::setprecision(2)
+              << std::setw(14) << mul_ref * 1e6
+              << std::setw(14) << mul * 1e6
+              << std::setw(10) << mul_ref / mul
+              << std::setw(14) << inv_ref * 1e6
+              << std::setw(14) << inv * 1e6
+              << std::setw(10) << inv_ref / inv
+              << std::scientific << std::setprecision(1)
+              << std::setw(12) << error
+              << std::endl;
+  }
+
+  return 0;
+}
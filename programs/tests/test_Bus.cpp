@@ -0,0 +1,340 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Test program for DUNE::IMC::Bus subscriptions.                           *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdarg>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Maximum time to wait for a thread that should not be blocked (s).
+static const double c_wait_timeout = 5.0;
+
+//! Task that counts received messages.
+class Sink: public Tasks::AbstractTask
+{
+public:
+  Sink(void):
+    count(0)
+  { }
+
+  void
+  receive(const IMC::Message*)
+  {
+    ++count;
+  }
+
+  void
+  receive(const IMC::SharedMessage&)
+  {
+    ++count;
+  }
+
+  const char*
+  getName(void) const
+  {
+    return "Sink";
+  }
+
+  void
+  run(void)
+  { }
+
+  void
+  inf(const char*, ...)
+  { }
+
+  void
+  war(const char*, ...)
+  { }
+
+  void
+  err(const char*, ...)
+  { }
+
+  void
+  cri(const char*, ...)
+  { }
+
+  void
+  debug(const char*, ...)
+  { }
+
+  void
+  trace(const char*, ...)
+  { }
+
+  void
+  spew(const char*, ...)
+  { }
+
+  unsigned count;
+};
+
+//! Task that takes some time to receive each message.
+class SlowSink: public Sink
+{
+public:
+  void
+  receive(const IMC::SharedMessage&)
+  {
+    busy.add(1);
+    Delay::wait(0.002);
+    delivered.add(1);
+    busy.sub(1);
+  }
+
+  //! Number of deliveries in progress.
+  Concurrency::AtomicCounter busy;
+  //! Number of messages delivered.
+  Concurrency::AtomicCounter delivered;
+};
+
+//! Task whose queue stays full until it is closed, so deliveries
+//! block as with the blocking overflow policy.
+class BlockedSink: public Sink
+{
+public:
+  BlockedSink(void):
+    m_closed(false)
+  { }
+
+  void
+  receive(const IMC::SharedMessage&)
+  {
+    Concurrency::ScopedCondition l(m_cond);
+    blocked.add(1);
+    while (!m_closed)
+      m_cond.wait();
+    blocked.sub(1);
+    delivered.add(1);
+  }
+
+  //! Release blocked deliveries.
+  void
+  close(void)
+  {
+    Concurrency::ScopedCondition l(m_cond);
+    m_closed = true;
+    m_cond.broadcast();
+  }
+
+  //! Number of blocked deliveries.
+  Concurrency::AtomicCounter blocked;
+  //! Number of messages delivered.
+  Concurrency::AtomicCounter delivered;
+
+private:
+  Concurrency::Condition m_cond;
+  bool m_closed;
+};
+
+//! Thread that registers or unregisters a task.
+class Registration: public Concurrency::Thread
+{
+public:
+  Registration(IMC::Bus& bus, Tasks::AbstractTask& task, uint16_t id, bool add):
+    m_bus(bus),
+    m_task(task),
+    m_id(id),
+    m_add(add)
+  { }
+
+  //! Wait for the registration to finish.
+  //! @param[in] timeout maximum time to wait (s).
+  //! @return true if the registration finished, false otherwise.
+  bool
+  waitDone(double timeout)
+  {
+    Time::Counter<double> counter(timeout);
+    while (m_done.value() == 0)
+    {
+      if (counter.overflow())
+        return false;
+      Delay::wait(0.001);
+    }
+
+    return true;
+  }
+
+private:
+  IMC::Bus& m_bus;
+  Tasks::AbstractTask& m_task;
+  uint16_t m_id;
+  bool m_add;
+  Concurrency::AtomicCounter m_done;
+
+  void
+  run(void)
+  {
+    if (m_add)
+      m_bus.registerRecipient(&m_task, m_id);
+    else
+      m_bus.unregisterRecipient(&m_task, m_id);
+
+    m_done.add(1);
+  }
+};
+
+//! Thread that dispatches heartbeats until stopped.
+class Dispatcher: public Concurrency::Thread
+{
+public:
+  Dispatcher(IMC::Bus& bus):
+    m_bus(bus)
+  { }
+
+private:
+  IMC::Bus& m_bus;
+
+  void
+  run(void)
+  {
+    IMC::Heartbeat hb;
+    while (!isStopping())
+      m_bus.dispatch(&hb);
+  }
+};
+
+//! Dispatch a heartbeat with a given source and entity.
+static void
+send(IMC::Bus& bus, uint16_t src, uint8_t ent)
+{
+  IMC::Heartbeat hb;
+  hb.setSource(src);
+  hb.setSourceEntity(ent);
+  bus.dispatch(&hb);
+}
+
+int
+main(void)
+{
+  Test test("IMC::Bus");
+
+  IMC::Bus bus;
+  Sink all;
+  Sink filtered;
+  uint16_t id = IMC::Heartbeat::getIdStatic();
+
+  IMC::Subscription sub;
+  sub.source(1).sourceEntity(5).sourceEntity(6);
+
+  bus.registerRecipient(&all, id);
+  bus.registerRecipient(&filtered, id, &sub);
+
+  send(bus, 1, 5);
+  send(bus, 1, 6);
+  send(bus, 1, 7);
+  send(bus, 2, 5);
+  test.boolean("unfiltered recipient", all.count == 4);
+  test.boolean("source and entity", filtered.count == 2);
+
+  IMC::Subscription rate;
+  rate.minimumPeriod(1000.0);
+  bus.registerRecipient(&filtered, id, &rate);
+  filtered.count = 0;
+
+  send(bus, 1, 5);
+  send(bus, 1, 5);
+  send(bus, 1, 6);
+  send(bus, 2, 6);
+  test.boolean("minimum period per entity", filtered.count == 2);
+
+  bus.registerRecipient(&filtered, id);
+  filtered.count = 0;
+  send(bus, 3, 9);
+  test.boolean("subscription removed", filtered.count == 1);
+
+  bus.unregisterRecipient(&filtered, id);
+  all.count = 0;
+  filtered.count = 0;
+  send(bus, 1, 5);
+  test.boolean("unregistered", all.count == 1 && filtered.count == 0);
+
+  // Unregistration waits for dispatchers delivering to the task.
+  {
+    SlowSink slow;
+    bus.registerRecipient(&slow, id);
+
+    Dispatcher dispatcher(bus);
+    dispatcher.start();
+    while (slow.delivered.value() < 5)
+      Delay::wait(0.001);
+
+    bus.unregisterRecipient(&slow, id);
+    bool idle = slow.busy.value() == 0;
+    int delivered = slow.delivered.value();
+    Delay::wait(0.05);
+    dispatcher.stopAndJoin();
+
+    test.boolean("unregistered while dispatching", idle && slow.delivered.value() == delivered);
+  }
+
+  // Unregistration waits for a dispatcher blocked on the task's
+  // full queue without stopping other registrations.
+  {
+    BlockedSink blocked;
+    Sink other;
+    bus.registerRecipient(&blocked, id);
+
+    Dispatcher dispatcher(bus);
+    dispatcher.start();
+    while (blocked.blocked.value() == 0)
+      Delay::wait(0.001);
+
+    Registration unregister(bus, blocked, id, false);
+    unregister.start();
+    Delay::wait(0.05);
+    bool waiting = !unregister.waitDone(0);
+
+    Registration reg(bus, other, IMC::Abort::getIdStatic(), true);
+    reg.start();
+    bool registered = reg.waitDone(c_wait_timeout);
+
+    blocked.close();
+    bool unregistered = unregister.waitDone(c_wait_timeout);
+    int delivered = blocked.delivered.value();
+    Delay::wait(0.05);
+    dispatcher.stopAndJoin();
+    unregister.stopAndJoin();
+    reg.stopAndJoin();
+    bus.unregisterRecipient(&other, IMC::Abort::getIdStatic());
+
+    test.boolean("registered while unregistering", waiting && registered);
+    test.boolean("unregistered blocked recipient", unregistered && blocked.delivered.value() == delivered);
+  }
+
+  return test.getReturnValue();
+}
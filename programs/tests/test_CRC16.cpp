@@ -0,0 +1,70 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Test program for DUNE::Algorithms::CRC16 class.                          *
+//***************************************************************************
+// ISO C++ headers
+#include <cstdlib>
+#include <vector>
+
+// DUNE headers
+#include <DUNE/Algorithms/CRC16.hpp>
+#include "Test.hpp"
+
+using namespace DUNE::Algorithms;
+
+int
+main(int argc, char** argv)
+{
+  Test test("DUNE::Algorithms::CRC16");
+
+  // CRC-16/ARC check value.
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  test.boolean("Check value", CRC16::compute(check, sizeof(check)) == 0xBB3D);
+  test.boolean("Check value (Modbus)", CRC16::compute(check, sizeof(check), 0xFFFF) == 0x4B37);
+
+  // Compare optimized implementation against the reference.
+  std::vector<uint8_t> data(4096 + 16);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = (uint8_t)std::rand();
+
+  bool match = true;
+  for (uint16_t offset = 0; offset < 16; ++offset)
+  {
+    for (uint16_t len = 0; len <= 4096; len += (len < 256) ? 1 : 61)
+    {
+      uint16_t ref = CRC16::computeReference(&data[offset], len, 0xFFFF);
+      if (CRC16::compute(&data[offset], len, 0xFFFF) != ref)
+        match = false;
+      if (CRC16::computeSlicing8(&data[offset], len, 0xFFFF) != ref)
+        match = false;
+    }
+  }
+
+  test.boolean("Slicing-by-8", match);
+
+  return 0;
+}
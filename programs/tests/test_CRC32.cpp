@@ -29,8 +29,10 @@
 // Test program for DUNE::Algorithms::CRC32 class.                          *
 //***************************************************************************
 // ISO C++ headers
+#include <cstdlib>
 #include <cstring>
 #include <string>
+#include <vector>
 
 // DUNE headers
 #include <DUNE/Algorithms/CRC32.hpp>
@@ -106,5 +108,31 @@ main(int argc, char** argv)
     testname = "No data reflection, " + std::string(input_strings[i]);
     test.boolean(testname.c_str(), crc == results_no_reflect_data[i]);
   }
+
+  // Compare optimized implementations against the reference.
+  std::vector<uint8_t> data(4096 + 16);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = (uint8_t)std::rand();
+
+  for (int reflect = 0; reflect < 2; ++reflect)
+  {
+    bool match = true;
+    for (size_t offset = 0; offset < 16; ++offset)
+    {
+      for (size_t len = 0; len <= 4096; len += (len < 256) ? 1 : 61)
+      {
+        uint32_t ref = CRC32::computeReference(&data[offset], len, reflect != 0, 0x12345678);
+        if (CRC32::compute(&data[offset], len, reflect != 0, 0x12345678) != ref)
+          match = false;
+        if (CRC32::computeSlicing8(&data[offset], len, reflect != 0, 0x12345678) != ref)
+          match = false;
+      }
+    }
+
+    testname = std::string("Optimized (") + CRC32::getImplementation() + "), "
+    + (reflect ? "no data reflection" : "standard");
+    test.boolean(testname.c_str(), match);
+  }
+
   return 0;
 }
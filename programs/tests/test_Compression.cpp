@@ -0,0 +1,343 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Test program for DUNE::Compression classes.                              *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Build compressible test data of a given size.
+static std::vector<char>
+buildText(size_t size)
+{
+  std::vector<char> data;
+  data.reserve(size);
+
+  unsigned i = 0;
+  while (data.size() < size)
+  {
+    std::string line = String::str("%u,%0.3f,Navigation.Sample\n", i, i * 0.125);
+    data.insert(data.end(), line.begin(), line.end());
+    ++i;
+  }
+
+  data.resize(size);
+  return data;
+}
+
+//! Build incompressible test data of a given size.
+static std::vector<char>
+buildNoise(size_t size)
+{
+  std::vector<char> data(size);
+  uint32_t state = 0x12345678;
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    state = state * 1103515245 + 12345;
+    data[i] = (char)(state >> 24);
+  }
+
+  return data;
+}
+
+//! Compress a buffer and decompress it feeding the decompressor
+//! a given number of bytes at a time into an output buffer of a
+//! given size.
+static bool
+roundTrip(Methods method, int level, const std::vector<char>& data, size_t in_chunk, size_t out_chunk)
+{
+  Compressor* com = Compression::Factory::compressor(method);
+  Decompressor* dec = Compression::Factory::decompressor(method);
+  com->level(level);
+
+  ByteBuffer packed;
+  com->compress(packed, const_cast<char*>(&data[0]), data.size());
+
+  std::vector<char> out;
+  std::vector<char> bfr(out_chunk);
+  size_t idx = 0;
+
+  while (idx < packed.getSize() || dec->hasPendingOutput())
+  {
+    size_t len = std::min(in_chunk, packed.getSize() - idx);
+    dec->decompress(&bfr[0], bfr.size(), packed.getBufferSigned() + idx, len);
+    out.insert(out.end(), bfr.begin(), bfr.begin() + dec->decompressed());
+    idx += dec->processed();
+
+    if (dec->processed() == 0 && dec->decompressed() == 0)
+      break;
+  }
+
+  delete com;
+  delete dec;
+
+  return out == data;
+}
+
+//! Write data through a compressed output stream and read it back.
+static bool
+streamTrip(Methods method, const std::vector<char>& data)
+{
+  std::stringstream packed;
+
+  {
+    FilterOutput ofs(packed, method);
+    ofs.write(&data[0], data.size());
+  }
+
+  FilterInput ifs(packed, method);
+  std::vector<char> out;
+  std::vector<char> bfr(4096);
+
+  while (ifs.read(&bfr[0], bfr.size()) || ifs.gcount() > 0)
+    out.insert(out.end(), bfr.begin(), bfr.begin() + ifs.gcount());
+
+  return out == data;
+}
+
+//! Compress data in chunks with a pool of threads and check that the
+//! result matches sequential compression of the same chunks.
+static bool
+parallelTrip(Methods method, bool blocks, const std::vector<char>& data)
+{
+  size_t chunk = 16 * 1024;
+  std::stringstream packed;
+
+  {
+    ParallelCompressor pool(&packed, method, 4, 3 * chunk, blocks);
+    for (size_t i = 0; i < data.size(); i += chunk)
+      pool.write(&data[i], std::min(chunk, data.size() - i), i, i + 1, 1);
+  }
+
+  std::string serial;
+  for (size_t i = 0; i < data.size(); i += chunk)
+  {
+    Compressor* com = blocks ? new BlockCompressor(method) : Compression::Factory::compressor(method);
+    if (blocks)
+      static_cast<BlockCompressor*>(com)->setRecords(i, i + 1, 1);
+
+    ByteBuffer bfr;
+    com->compress(bfr, const_cast<char*>(&data[i]), std::min(chunk, data.size() - i));
+    serial.append(bfr.getBufferSigned(), bfr.getSize());
+    delete com;
+  }
+
+  if (packed.str() != serial)
+    return false;
+
+  FilterInput ifs(packed, blocks ? METHOD_BLOCK : method);
+  std::vector<char> out;
+  std::vector<char> bfr(4096);
+
+  while (ifs.read(&bfr[0], bfr.size()) || ifs.gcount() > 0)
+    out.insert(out.end(), bfr.begin(), bfr.begin() + ifs.gcount());
+
+  return out == data;
+}
+
+//! Compress to a stream that rejects writes and check that the
+//! error is reported by the compressor.
+static bool
+parallelFailure(const std::vector<char>& data)
+{
+  std::ofstream closed;
+  ParallelCompressor pool(&closed, METHOD_ZLIB, 2, data.size(), true);
+  pool.write(&data[0], data.size(), 0, 1, 1);
+
+  try
+  {
+    pool.flush();
+    return false;
+  }
+  catch (std::runtime_error& e)
+  {
+    (void)e;
+  }
+
+  return pool.failed();
+}
+
+//! Read a damaged block container file as a stream and check that
+//! intact blocks are delivered in order and can be seeked.
+static bool
+blockStream(const Path& path, unsigned threads, const std::vector<std::vector<char> >& blocks)
+{
+  BlockBuffer bfr(path.c_str(), threads);
+  std::istream is(&bfr);
+
+  std::vector<char> expected;
+  for (size_t i = 0; i < blocks.size(); ++i)
+  {
+    if (i != 2)
+      expected.insert(expected.end(), blocks[i].begin(), blocks[i].end());
+  }
+
+  std::vector<char> out;
+  std::vector<char> chunk(5000);
+  while (is.read(&chunk[0], chunk.size()) || is.gcount() > 0)
+    out.insert(out.end(), chunk.begin(), chunk.begin() + is.gcount());
+
+  bool ok = out == expected && bfr.getCorrupted() == 1;
+
+  // Seek into the fifth block, then into the damaged third block.
+  const BlockReader::Block& fifth = bfr.getReader().getBlocks()[4];
+  is.clear();
+  is.seekg(fifth.raw_offset + 100);
+  ok = ok && bfr.getOffset() == fifth.raw_offset + 100 && is.get() == blocks[4][100];
+
+  is.seekg(bfr.getReader().getBlocks()[2].raw_offset + 10);
+  ok = ok && bfr.getOffset() == bfr.getReader().getBlocks()[3].raw_offset;
+
+  ok = ok && bfr.seekBlock(fifth.offset) && !bfr.seekBlock(fifth.offset + 1);
+  ok = ok && bfr.getOffset() == fifth.raw_offset && is.get() == blocks[4][0];
+
+  return ok;
+}
+
+//! Write a block container file with several compression methods,
+//! damage it and check that every intact block is recovered.
+static bool
+blockRecovery(const std::vector<char>& text, const std::vector<char>& noise)
+{
+  Methods methods[] = {METHOD_ZLIB, METHOD_GZIP, METHOD_BZIP2, METHOD_LZ4};
+  size_t count = 8;
+  size_t size = 16 * 1024;
+  std::vector<std::vector<char> > blocks;
+  std::string file;
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    const std::vector<char>& src = (i == 3) ? noise : text;
+    blocks.push_back(std::vector<char>(src.begin() + i * size, src.begin() + (i + 1) * size));
+
+    BlockCompressor com(methods[i % 4]);
+    com.setRecords(i, i + 0.5, i + 1);
+
+    ByteBuffer packed;
+    com.compress(packed, &blocks[i][0], size);
+    std::string block(packed.getBufferSigned(), packed.getSize());
+
+    // Damage the data of the third block.
+    if (i == 2)
+      block[BlockHeader::c_size + 10] ^= 0x55;
+
+    // Garbage between the fifth and sixth blocks.
+    if (i == 5)
+      file += "garbage";
+
+    // Interrupted writer.
+    if (i == count - 1)
+      block.resize(block.size() - 10);
+
+    file += block;
+  }
+
+  Path path = Path::current() / "test_Compression.blk";
+  std::ofstream ofs(path.c_str(), std::ios::binary);
+  ofs.write(file.data(), file.size());
+  ofs.close();
+
+  BlockReader reader(path.c_str());
+  bool ok = reader.getBlocks().size() == count - 1 && reader.isTruncated();
+
+  for (size_t i = 0; ok && i < reader.getBlocks().size(); ++i)
+  {
+    const BlockHeader& header = reader.getBlocks()[i].header;
+    ok = header.records == i + 1 && header.time_first == i && header.time_last == i + 0.5;
+    ok = ok && (header.method == METHOD_UNKNOWN) == (i == 3);
+
+    std::vector<char> out;
+    try
+    {
+      reader.read(i, out);
+      ok = ok && (i != 2) && out == blocks[i];
+    }
+    catch (CorruptedData& e)
+    {
+      (void)e;
+      ok = ok && (i == 2);
+    }
+  }
+
+  blocks.pop_back();
+  ok = ok && blockStream(path, 1, blocks) && blockStream(path, 3, blocks);
+
+  path.remove();
+  return ok;
+}
+
+int
+main(void)
+{
+  Test test("Compression");
+
+  std::vector<char> text = buildText(300 * 1024);
+  std::vector<char> noise = buildNoise(100 * 1024);
+
+  // Zlib and bzip2 decompressors cannot flush pending output without
+  // input, hence the large output buffer.
+  test.boolean("zlib round trip", roundTrip(METHOD_ZLIB, -1, text, text.size(), text.size()));
+  test.boolean("gzip round trip", roundTrip(METHOD_GZIP, -1, text, text.size(), text.size()));
+  test.boolean("bzip2 round trip", roundTrip(METHOD_BZIP2, -1, text, text.size(), text.size()));
+
+  test.boolean("lz4 round trip", roundTrip(METHOD_LZ4, -1, text, text.size(), text.size()));
+  test.boolean("lz4 high compression round trip", roundTrip(METHOD_LZ4, 9, text, text.size(), text.size()));
+  test.boolean("lz4 incompressible round trip", roundTrip(METHOD_LZ4, -1, noise, noise.size(), noise.size()));
+  test.boolean("lz4 small input chunks", roundTrip(METHOD_LZ4, -1, text, 13, text.size()));
+  test.boolean("lz4 small output chunks", roundTrip(METHOD_LZ4, -1, text, text.size(), 1000));
+  test.boolean("lz4 small chunks", roundTrip(METHOD_LZ4, -1, text, 777, 333));
+
+  test.boolean("zlib stream", streamTrip(METHOD_ZLIB, text));
+  test.boolean("lz4 stream", streamTrip(METHOD_LZ4, text));
+
+  test.boolean("block round trip", roundTrip(METHOD_BLOCK, -1, text, text.size(), text.size()));
+  test.boolean("block small chunks", roundTrip(METHOD_BLOCK, -1, text, 777, 333));
+  test.boolean("block stream", streamTrip(METHOD_BLOCK, text));
+  test.boolean("block recovery", blockRecovery(text, noise));
+
+  test.boolean("zlib parallel", parallelTrip(METHOD_ZLIB, false, text));
+  test.boolean("zlib parallel blocks", parallelTrip(METHOD_ZLIB, true, text));
+  test.boolean("gzip parallel", parallelTrip(METHOD_GZIP, false, text));
+  test.boolean("bzip2 parallel", parallelTrip(METHOD_BZIP2, false, text));
+  test.boolean("lz4 parallel blocks", parallelTrip(METHOD_LZ4, true, text));
+  test.boolean("parallel write failure", parallelFailure(text));
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,237 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Maximum time to wait for jobs to make progress (s). Only reached
+//! if the executor is broken, tests do not depend on timing.
+static const double c_progress_timeout = 20.0;
+
+//! Job counting its steps, optionally at a fixed period.
+class CountJob: public Tasks::Executor::Job
+{
+public:
+  CountJob(double period):
+    m_period(period),
+    m_steps(0),
+    m_running(false),
+    m_overlaps(0),
+    m_last_start(-1.0),
+    m_min_gap(-1.0)
+  { }
+
+  unsigned
+  getSteps(void)
+  {
+    Concurrency::ScopedMutex l(m_lock);
+    return m_steps;
+  }
+
+  unsigned
+  getOverlaps(void)
+  {
+    Concurrency::ScopedMutex l(m_lock);
+    return m_overlaps;
+  }
+
+  //! Retrieve the shortest time between the start of consecutive
+  //! steps.
+  double
+  getMinimumGap(void)
+  {
+    Concurrency::ScopedMutex l(m_lock);
+    return m_min_gap;
+  }
+
+  //! Wait until the job performed a number of steps.
+  bool
+  waitSteps(unsigned steps)
+  {
+    double deadline = Time::Clock::get() + c_progress_timeout;
+    while (getSteps() < steps)
+    {
+      if (Time::Clock::get() > deadline)
+        return false;
+
+      Time::Delay::wait(0.01);
+    }
+
+    return true;
+  }
+
+private:
+  double m_period;
+  unsigned m_steps;
+  bool m_running;
+  unsigned m_overlaps;
+  double m_last_start;
+  double m_min_gap;
+  Concurrency::Mutex m_lock;
+
+  double
+  onStep(void)
+  {
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      if (m_running)
+        ++m_overlaps;
+      m_running = true;
+      ++m_steps;
+
+      double now = Time::Clock::get();
+      if (m_last_start >= 0 && (m_min_gap < 0 || now - m_last_start < m_min_gap))
+        m_min_gap = now - m_last_start;
+      m_last_start = now;
+    }
+
+    Time::Delay::wait(0.0005);
+
+    Concurrency::ScopedMutex l(m_lock);
+    m_running = false;
+
+    if (m_period <= 0)
+      return -1.0;
+
+    return Time::Clock::get() + m_period;
+  }
+};
+
+//! Job that throws something other than a std::exception on its
+//! first step and asks never to run again.
+class FailJob: public Tasks::Executor::Job
+{
+public:
+  FailJob(void):
+    m_steps(0)
+  { }
+
+  unsigned
+  getSteps(void)
+  {
+    Concurrency::ScopedMutex l(m_lock);
+    return m_steps;
+  }
+
+private:
+  unsigned m_steps;
+  Concurrency::Mutex m_lock;
+
+  double
+  onStep(void)
+  {
+    Concurrency::ScopedMutex l(m_lock);
+    if (++m_steps == 1)
+      throw 1;
+
+    return -1.0;
+  }
+};
+
+int
+main(void)
+{
+  Test test("Tasks::Executor");
+
+  {
+    Tasks::Executor executor(2);
+    CountJob job(0.02);
+    executor.add(&job);
+    bool ok = job.waitSteps(10);
+    executor.remove(&job);
+
+    // Timers never fire early.
+    unsigned steps = job.getSteps();
+    test.boolean("periodic job", ok && job.getMinimumGap() >= 0.02);
+    Time::Delay::wait(0.1);
+    test.boolean("removed job", job.getSteps() == steps);
+  }
+
+  {
+    Tasks::Executor executor(4);
+    CountJob job(-1.0);
+    executor.add(&job);
+
+    // Wakes while the job is queued are coalesced, but a wake is
+    // never lost.
+    for (unsigned i = 0; i < 1000; ++i)
+      job.wake();
+
+    unsigned steps = job.getSteps();
+    job.wake();
+    bool ok = job.waitSteps(steps + 1);
+    executor.remove(&job);
+    test.boolean("woken job", ok && job.getSteps() <= 1002 && job.getOverlaps() == 0);
+  }
+
+  {
+    Tasks::Executor executor(2);
+    std::vector<CountJob*> jobs;
+    for (unsigned i = 0; i < 200; ++i)
+    {
+      jobs.push_back(new CountJob(0.1));
+      executor.add(jobs.back());
+    }
+
+    bool ok = true;
+    for (unsigned i = 0; i < jobs.size(); ++i)
+      ok = ok && jobs[i]->waitSteps(3);
+
+    for (unsigned i = 0; i < jobs.size(); ++i)
+    {
+      executor.remove(jobs[i]);
+      ok = ok && jobs[i]->getOverlaps() == 0 && jobs[i]->getMinimumGap() >= 0.1;
+      delete jobs[i];
+    }
+
+    test.boolean("many jobs", ok);
+  }
+
+  {
+    Tasks::Executor executor(1);
+    FailJob job;
+    executor.add(&job);
+
+    // The failed job runs again without being woken.
+    double deadline = Time::Clock::get() + c_progress_timeout;
+    while (job.getSteps() < 2 && Time::Clock::get() < deadline)
+      Time::Delay::wait(0.01);
+
+    executor.remove(&job);
+    test.boolean("failed job retried", job.getSteps() == 2);
+  }
+
+  return test.getReturnValue();
+}
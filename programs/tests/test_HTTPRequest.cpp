@@ -0,0 +1,323 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Test program for the HTTP request parser.                               *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// The HTTP server is part of its task, its sources are built here.
+#include <Transports/HTTP/Connection.cpp>
+#include <Transports/HTTP/RequestHandler.cpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+using Transports::HTTP::Connection;
+using Transports::HTTP::RequestHandler;
+
+//! Maximum time to wait for data on the loopback interface (s).
+static const double c_io_timeout = 5.0;
+
+//! Handler answering GET with the URI, POST with the content and
+//! sending a file for any GET below /file/.
+class EchoHandler: public RequestHandler
+{
+public:
+  EchoHandler(const std::string& file):
+    m_file(file)
+  { }
+
+  void
+  handleGET(Connection* conn, Utils::TupleList& headers, const char* uri)
+  {
+    (void)headers;
+
+    long long beg = -1;
+    long long end = -1;
+    if (std::sscanf(uri, "/file/%lld-%lld", &beg, &end) == 2)
+    {
+      HeaderFieldsMap fields;
+      sendFile(conn, m_file, fields, beg, end);
+      return;
+    }
+
+    sendData(conn, std::string(uri));
+  }
+
+  void
+  handlePOST(Connection* conn, Utils::TupleList& headers, const char* uri)
+  {
+    (void)headers;
+    (void)uri;
+    sendData(conn, conn->getContent());
+  }
+
+private:
+  std::string m_file;
+};
+
+//! Connection of the server to a local client.
+class Peer
+{
+public:
+  Peer(TCPSocket& listener):
+    m_client(new TCPSocket)
+  {
+    m_client->connect(Address::Loopback, listener.getBoundPort());
+    TCPSocket* sock = listener.accept();
+    sock->setNonBlocking(true);
+    m_conn = new Connection(sock);
+  }
+
+  ~Peer(void)
+  {
+    delete m_conn;
+    delete m_client;
+  }
+
+  Connection*
+  getConnection(void)
+  {
+    return m_conn;
+  }
+
+  //! Send data to the server and read it into the connection.
+  bool
+  send(const std::string& data)
+  {
+    m_client->write(data.c_str(), data.size());
+    if (!IO::Poll::poll(m_conn->getNative(), c_io_timeout))
+      return false;
+
+    return m_conn->receive();
+  }
+
+  //! Flush the server responses and read the next one.
+  //! @param[out] status status code.
+  //! @param[out] body response body.
+  //! @return true if a response was read, false otherwise.
+  bool
+  response(int& status, std::string& body)
+  {
+    m_conn->flush();
+
+    size_t eoh = std::string::npos;
+    size_t length = 0;
+    while (true)
+    {
+      eoh = m_input.find("\r\n\r\n");
+      if (eoh != std::string::npos)
+      {
+        size_t pos = m_input.find("Content-Length: ");
+        if (pos == std::string::npos || pos > eoh)
+          return false;
+
+        length = std::atoi(m_input.c_str() + pos + 16);
+        if (m_input.size() >= eoh + 4 + length)
+          break;
+      }
+
+      if (!IO::Poll::poll(*m_client, c_io_timeout))
+        return false;
+
+      char bfr[1024];
+      size_t rv = m_client->read(bfr, sizeof(bfr));
+      if (rv == 0)
+        return false;
+
+      m_input.append(bfr, rv);
+    }
+
+    if (std::sscanf(m_input.c_str(), "HTTP/1.1 %d", &status) != 1)
+      return false;
+
+    m_header = m_input.substr(0, eoh);
+    body = m_input.substr(eoh + 4, length);
+    m_input.erase(0, eoh + 4 + length);
+    return true;
+  }
+
+  //! Retrieve the header of the last response.
+  const std::string&
+  getHeader(void) const
+  {
+    return m_header;
+  }
+
+  //! Test if all responses were read.
+  bool
+  drained(void) const
+  {
+    return m_input.empty();
+  }
+
+private:
+  //! Client socket.
+  TCPSocket* m_client;
+  //! Server side of the connection.
+  Connection* m_conn;
+  //! Data received by the client.
+  std::string m_input;
+  //! Header of the last response.
+  std::string m_header;
+};
+
+//! Send a single request and read its response.
+static bool
+request(TCPSocket& listener, RequestHandler& handler, const std::string& data,
+        int& status, std::string& body, bool& keep_alive)
+{
+  Peer peer(listener);
+  if (!peer.send(data) || !handler.handleRequest(peer.getConnection()))
+    return false;
+
+  keep_alive = peer.getConnection()->getKeepAlive();
+  return peer.response(status, body);
+}
+
+int
+main(void)
+{
+  Test test("HTTP Request Parser");
+
+  Path file = Path::current() / "test_HTTPRequest.dat";
+  {
+    std::FILE* fd = std::fopen(file.c_str(), "wb");
+    std::fputs("0123456789", fd);
+    std::fclose(fd);
+  }
+
+  TCPSocket listener;
+  listener.bind(0, Address::Loopback);
+  listener.listen(16);
+
+  EchoHandler handler(file.str());
+  int status = 0;
+  std::string body;
+  bool keep_alive = false;
+
+  {
+    Peer peer(listener);
+    Connection* conn = peer.getConnection();
+    bool ok = peer.send("GET /partial HTTP/1.1\r\nHost: test\r\n");
+    ok = ok && !handler.handleRequest(conn) && conn->getOutputSize() == 0;
+    ok = ok && peer.send("\r\n") && handler.handleRequest(conn);
+    ok = ok && peer.response(status, body);
+    test.boolean("partial header", ok && status == 200 && body == "/partial");
+  }
+
+  {
+    Peer peer(listener);
+    Connection* conn = peer.getConnection();
+    bool ok = peer.send("GET /a HTTP/1.1\r\n\r\nGET /b HTTP/1.1\r\n\r\nGET /c HTTP/1.1\r\n");
+    ok = ok && handler.handleRequest(conn) && handler.handleRequest(conn);
+    ok = ok && !handler.handleRequest(conn);
+
+    std::string a;
+    std::string b;
+    ok = ok && peer.response(status, a) && peer.response(status, b);
+    test.boolean("pipelined requests", ok && a == "/a" && b == "/b" && peer.drained());
+  }
+
+  {
+    Peer peer(listener);
+    Connection* conn = peer.getConnection();
+    bool ok = peer.send("POST / HTTP/1.1\r\nContent-Length: 11\r\n\r\nhello");
+    ok = ok && !handler.handleRequest(conn);
+    ok = ok && peer.send(" worldGET /next HTTP/1.1\r\n\r\n");
+    ok = ok && handler.handleRequest(conn) && handler.handleRequest(conn);
+
+    std::string next;
+    ok = ok && peer.response(status, body) && peer.response(status, next);
+    test.boolean("content length", ok && body == "hello world" && next == "/next");
+  }
+
+  {
+    bool ok = request(listener, handler, "GET\r\n\r\n", status, body, keep_alive);
+    test.boolean("invalid request line", ok && status == 400 && !keep_alive);
+
+    std::string data = "GET / HTTP/1.1\r\nContent-Length: 100000\r\n\r\n";
+    ok = request(listener, handler, data, status, body, keep_alive);
+    test.boolean("invalid content length", ok && status == 400 && !keep_alive);
+
+    data = "GET / HTTP/1.1\r\nX-Padding: " + std::string(4096, 'x') + "\r\n\r\n";
+    ok = request(listener, handler, data, status, body, keep_alive);
+    test.boolean("header too long", ok && status == 400 && !keep_alive);
+  }
+
+  {
+    bool ok = request(listener, handler, "GET /file/2-5 HTTP/1.1\r\n\r\n", status, body, keep_alive);
+    test.boolean("partial content", ok && status == 206 && body == "2345");
+
+    ok = request(listener, handler, "GET /file/5-20 HTTP/1.1\r\n\r\n", status, body, keep_alive);
+    test.boolean("range not satisfiable", ok && status == 416);
+
+    ok = request(listener, handler, "DELETE / HTTP/1.1\r\n\r\n", status, body, keep_alive);
+    test.boolean("method not implemented", ok && status == 501 && keep_alive);
+  }
+
+  {
+    bool ok = request(listener, handler, "GET / HTTP/1.1\r\n\r\n", status, body, keep_alive);
+    test.boolean("HTTP/1.1 persistent", ok && keep_alive);
+
+    ok = request(listener, handler, "GET / HTTP/1.1\r\nConnection: Close\r\n\r\n", status, body, keep_alive);
+    test.boolean("HTTP/1.1 close", ok && !keep_alive);
+
+    ok = request(listener, handler, "GET / HTTP/1.0\r\n\r\n", status, body, keep_alive);
+    test.boolean("HTTP/1.0 not persistent", ok && !keep_alive);
+
+    ok = request(listener, handler, "GET / HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n", status, body, keep_alive);
+    test.boolean("HTTP/1.0 keep-alive", ok && keep_alive);
+  }
+
+  {
+    Peer peer(listener);
+    Connection* conn = peer.getConnection();
+    conn->writeFile("/nonexistent/file", 0, 10);
+    bool failed = false;
+    try
+    {
+      conn->flush();
+    }
+    catch (std::runtime_error&)
+    {
+      failed = true;
+    }
+
+    test.boolean("missing file", failed && conn->getOutputSize() == 10);
+  }
+
+  file.remove();
+  return test.getReturnValue();
+}
@@ -0,0 +1,160 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Test program for DUNE::IMC::Parser class.                                *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Number of messages in the test stream.
+static const unsigned c_count = 64;
+
+//! Build a stream of messages interleaved with noise, including
+//! stray synchronization bytes and corrupted packets.
+static void
+buildStream(std::vector<uint8_t>& stream, std::vector<IMC::Message*>& msgs)
+{
+  for (unsigned i = 0; i < c_count; ++i)
+  {
+    IMC::Message* msg = 0;
+
+    if (i % 2)
+    {
+      IMC::EntityState* es = new IMC::EntityState;
+      es->state = i;
+      es->description.assign(i * 7, 'a' + (i % 26));
+      msg = es;
+    }
+    else
+    {
+      IMC::Heartbeat* hb = new IMC::Heartbeat;
+      msg = hb;
+    }
+
+    msg->setTimeStamp(i);
+    msg->setSource(i);
+
+    Utils::ByteBuffer bfr;
+    IMC::Packet::serialize(msg, bfr);
+
+    if (i % 5 == 0)
+    {
+      // Corrupted copy which must be skipped.
+      std::vector<uint8_t> bad(bfr.getBuffer(), bfr.getBuffer() + bfr.getSize());
+      bad.back() ^= 0xff;
+      stream.insert(stream.end(), bad.begin(), bad.end());
+    }
+
+    if (i % 3 == 0)
+    {
+      // Noise with stray synchronization bytes.
+      uint8_t noise[] = {0x00, 0xfe, 0x11, 0x54, 0x22};
+      stream.insert(stream.end(), noise, noise + sizeof(noise));
+    }
+
+    stream.insert(stream.end(), bfr.getBuffer(), bfr.getBuffer() + bfr.getSize());
+    msgs.push_back(msg);
+  }
+}
+
+//! Parse the stream in chunks of a given size and compare the result.
+static bool
+parseChunks(const std::vector<uint8_t>& stream, const std::vector<IMC::Message*>& msgs, size_t chunk)
+{
+  IMC::Parser parser;
+  std::vector<IMC::Message*> out;
+
+  for (size_t i = 0; i < stream.size(); i += chunk)
+  {
+    const uint8_t* p = &stream[i];
+    const uint8_t* end = p + std::min(chunk, stream.size() - i);
+
+    while (IMC::Message* m = parser.parse(p, end))
+      out.push_back(m);
+  }
+
+  bool ok = out.size() == msgs.size();
+  for (size_t i = 0; i < out.size(); ++i)
+  {
+    if (ok && !(*out[i] == *msgs[i]))
+      ok = false;
+    delete out[i];
+  }
+
+  return ok;
+}
+
+int
+main(void)
+{
+  Test test("IMC::Parser");
+
+  std::vector<uint8_t> stream;
+  std::vector<IMC::Message*> msgs;
+  buildStream(stream, msgs);
+
+  {
+    IMC::Parser parser;
+    std::vector<IMC::Message*> out;
+
+    for (size_t i = 0; i < stream.size(); ++i)
+    {
+      IMC::Message* m = parser.parse(stream[i]);
+      if (m)
+        out.push_back(m);
+    }
+
+    bool ok = out.size() == msgs.size();
+    for (size_t i = 0; i < out.size(); ++i)
+    {
+      if (ok && !(*out[i] == *msgs[i]))
+        ok = false;
+      delete out[i];
+    }
+
+    test.boolean("byte at a time", ok);
+  }
+
+  test.boolean("whole block", parseChunks(stream, msgs, stream.size()));
+  test.boolean("chunks of 1 byte", parseChunks(stream, msgs, 1));
+  test.boolean("chunks of 7 bytes", parseChunks(stream, msgs, 7));
+  test.boolean("chunks of 21 bytes", parseChunks(stream, msgs, 21));
+  test.boolean("chunks of 1000 bytes", parseChunks(stream, msgs, 1000));
+
+  for (size_t i = 0; i < msgs.size(); ++i)
+    delete msgs[i];
+
+  return test.getReturnValue();
+}
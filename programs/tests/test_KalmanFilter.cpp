@@ -0,0 +1,135 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Test program for DUNE::Navigation::KalmanFilter class.                   *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+static const short c_states = 6;
+static const short c_outputs = 4;
+
+//! Configure a constant velocity model with position measurements.
+static void
+setup(Navigation::KalmanFilter& kal, bool diagonal)
+{
+  kal.reset(c_states, c_outputs);
+
+  Math::Matrix a(c_states);
+  for (short i = 0; i < c_states / 2; ++i)
+    a(i, i + c_states / 2) = 0.1;
+
+  kal.setTransitions(a);
+  kal.setProcessNoise(0.01);
+  kal.setCovariance(10.0);
+
+  for (short i = 0; i < c_outputs; ++i)
+    kal.setMeasurementNoise(i, 0.5 + i);
+
+  if (!diagonal)
+  {
+    kal.setMeasurementNoise(0, 1, 0.2);
+    kal.setMeasurementNoise(1, 0, 0.2);
+  }
+}
+
+//! Run a sequence of steps and compare with the explicit inverse.
+static bool
+compare(Navigation::KalmanFilter::UpdateMethod method, bool joseph,
+        bool diagonal, float threshold)
+{
+  Navigation::KalmanFilter ref;
+  Navigation::KalmanFilter kal;
+  setup(ref, diagonal);
+  setup(kal, diagonal);
+  kal.setUpdateMethod(method);
+  kal.setJosephForm(joseph);
+
+  for (unsigned step = 0; step < 50; ++step)
+  {
+    ref.predict();
+    kal.predict();
+
+    for (short i = 0; i < c_outputs; ++i)
+    {
+      short state = i % 3;
+      double z = std::sin(step * 0.1 + i) * 10;
+
+      // Leave one output unobserved now and then.
+      double c = ((step + i) % 7 == 0) ? 0.0 : 1.0 + 0.1 * i;
+
+      ref.setObservation(i, state, c);
+      kal.setObservation(i, state, c);
+      ref.setInnovation(i, z - c * ref.getState(state));
+      kal.setInnovation(i, z - c * kal.getState(state));
+    }
+
+    if (ref.update(threshold) != kal.update(threshold))
+      return false;
+
+    ref.normalize();
+    kal.normalize();
+
+    for (short i = 0; i < c_states; ++i)
+    {
+      if (std::fabs(ref.getState(i) - kal.getState(i)) > 1e-6)
+        return false;
+
+      for (short j = 0; j < c_states; ++j)
+      {
+        if (std::fabs(ref.getCovariance(i, j) - kal.getCovariance(i, j)) > 1e-6)
+          return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+int
+main(void)
+{
+  Test test("Navigation::KalmanFilter");
+
+  test.boolean("Cholesky", compare(Navigation::KalmanFilter::UPDATE_CHOLESKY, false, false, 0));
+  test.boolean("Cholesky, Joseph", compare(Navigation::KalmanFilter::UPDATE_CHOLESKY, true, false, 0));
+  test.boolean("Cholesky, threshold", compare(Navigation::KalmanFilter::UPDATE_CHOLESKY, false, true, 2.0));
+  test.boolean("sequential", compare(Navigation::KalmanFilter::UPDATE_SEQUENTIAL, false, true, 0));
+  test.boolean("sequential, Joseph", compare(Navigation::KalmanFilter::UPDATE_SEQUENTIAL, true, true, 0));
+  test.boolean("sequential, threshold", compare(Navigation::KalmanFilter::UPDATE_SEQUENTIAL, true, true, 2.0));
+  test.boolean("sequential, full noise", compare(Navigation::KalmanFilter::UPDATE_SEQUENTIAL, true, false, 0));
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,503 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Test program for LSF access classes.                                    *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Number of records in test logs.
+static const unsigned c_records = 500;
+
+//! Write a log whose records carry their index as time stamp.
+//! @param[in] path file path.
+//! @param[in] method compression method.
+//! @param[in] count number of records.
+//! @param[in] interval time span of index entries or zero to
+//! write no index.
+static void
+writeLog(const Path& path, Compression::Methods method, unsigned count, double interval = 0)
+{
+  std::ostream* os = NULL;
+  if (method == Compression::METHOD_UNKNOWN)
+    os = new std::ofstream(path.c_str(), std::ios::binary);
+  else
+    os = new Compression::FileOutput(path.c_str(), method);
+
+  IMC::LsfIndex::Writer* index = NULL;
+  if (interval > 0)
+    index = new IMC::LsfIndex::Writer(IMC::LsfIndex::getPath(path.str()), interval,
+                                      method != Compression::METHOD_UNKNOWN);
+
+  IMC::EntityState msg;
+  msg.description = "LSF test record";
+  Utils::ByteBuffer bfr;
+  for (unsigned i = 0; i < count; ++i)
+  {
+    msg.setTimeStamp(i);
+    msg.setSourceEntity(i % 4);
+    IMC::Packet::serialize(&msg, bfr);
+    os->write(bfr.getBufferSigned(), bfr.getSize());
+
+    if (index != NULL)
+      index->add(msg.getId(), i, bfr.getSize());
+  }
+
+  delete index;
+  delete os;
+}
+
+//! Write a log as a sequence of container blocks, as done by the
+//! logging task, whose records carry their index as time stamp. The
+//! index has one entry per container block.
+//! @param[in] path file path.
+//! @param[in] count number of records.
+//! @param[in] per_block number of records per block.
+static void
+writeBlockLog(const Path& path, unsigned count, unsigned per_block)
+{
+  std::ofstream ofs(path.c_str(), std::ios::binary);
+  Compression::ParallelCompressor com(&ofs, Compression::METHOD_ZLIB, 2, 64 * 1024, true);
+  IMC::LsfIndex::Writer* index = new IMC::LsfIndex::Writer(IMC::LsfIndex::getPath(path.str()),
+                                                           per_block, &com);
+
+  IMC::EntityState msg;
+  msg.description = "LSF test record";
+  Utils::ByteBuffer bfr;
+  std::vector<char> block;
+
+  for (unsigned i = 0; i < count; ++i)
+  {
+    msg.setTimeStamp(i);
+    msg.setSourceEntity(i % 4);
+    IMC::Packet::serialize(&msg, bfr);
+    block.insert(block.end(), bfr.getBufferSigned(), bfr.getBufferSigned() + bfr.getSize());
+    index->add(msg.getId(), i, bfr.getSize());
+
+    if ((i + 1) % per_block == 0 || i + 1 == count)
+    {
+      com.write(&block[0], block.size(), i + 1 - block.size() / bfr.getSize(), i, block.size() / bfr.getSize());
+      block.clear();
+    }
+
+    // Entries are written as soon as their block is.
+    if (i == count / 2)
+    {
+      com.flush();
+      index->flush();
+    }
+  }
+
+  com.flush();
+  delete index;
+}
+
+//! Damage the data of a container block.
+//! @param[in] path file path.
+//! @param[in] index block number.
+static void
+damageBlock(const Path& path, size_t index)
+{
+  uint64_t offset = 0;
+  {
+    Compression::BlockReader reader(path.c_str());
+    offset = reader.getBlocks()[index].offset + Compression::BlockHeader::c_size + 10;
+  }
+
+  std::fstream fs(path.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+  fs.seekg(offset);
+  char c = fs.get() ^ 0x55;
+  fs.seekp(offset);
+  fs.put(c);
+}
+
+//! Check the entries of the index of a log written by writeLog() or
+//! writeBlockLog().
+//! @param[in] index loaded index.
+//! @param[in] count number of records.
+//! @param[in] per_block number of records per entry.
+//! @param[in] size record size.
+//! @return true if the entries describe the log.
+static bool
+checkIndex(const IMC::LsfIndex& index, unsigned count, unsigned per_block, unsigned size)
+{
+  const std::vector<IMC::LsfIndex::Block>& blocks = index.getBlocks();
+  if (blocks.size() != (count + per_block - 1) / per_block)
+    return false;
+
+  for (unsigned i = 0; i < blocks.size(); ++i)
+  {
+    const IMC::LsfIndex::Block& block = blocks[i];
+    unsigned records = std::min(per_block, count - i * per_block);
+    if (block.time_begin != i * per_block || block.time_end != i * per_block + records - 1
+        || block.records != records || block.offset != (uint64_t)i * per_block * size
+        || block.size != records * size)
+      return false;
+
+    if (!block.contains(DUNE_IMC_ENTITYSTATE) || block.contains(DUNE_IMC_ENTITYINFO))
+      return false;
+  }
+
+  return index.find(per_block * 2.5) == 2 && index.find(count) == blocks.size()
+    && index.find(1, DUNE_IMC_ENTITYSTATE) == 1 && index.find(0, DUNE_IMC_ENTITYINFO) == blocks.size();
+}
+
+//! Seek to index entries of a log and check the first record.
+//! @param[in] reader log reader.
+//! @param[in] index loaded index.
+//! @param[in] entries entry numbers, in increasing order.
+//! @return true if every seek lands on the first record of the entry.
+static bool
+checkSeek(IMC::LsfReader& reader, const IMC::LsfIndex& index, const std::vector<size_t>& entries)
+{
+  for (size_t i = 0; i < entries.size(); ++i)
+  {
+    const IMC::LsfIndex::Block& block = index.getBlocks()[entries[i]];
+    reader.seek(block);
+
+    if (reader.getNextOffset() != block.offset || !reader.next())
+      return false;
+
+    IMC::Message* msg = reader.decode(NULL, true);
+    bool ok = msg->getTimeStamp() == block.time_begin && reader.getOffset() == block.offset;
+    delete msg;
+
+    if (!ok)
+      return false;
+  }
+
+  return true;
+}
+
+//! Check every record of a mapped file.
+//! @param[in] file mapped file.
+//! @param[in] count expected number of records.
+//! @return true if all records are present and in order.
+static bool
+checkRecords(IMC::LsfMappedFile& file, unsigned count)
+{
+  if (file.getRecordCount() != count)
+    return false;
+
+  // Random access, backwards.
+  for (unsigned i = count; i > 0; --i)
+  {
+    IMC::LsfMappedFile::Record record;
+    if (!file.getRecord(i - 1, record) || !record.verify())
+      return false;
+
+    IMC::Message* msg = record.decode(NULL, true);
+    bool ok = msg->getTimeStamp() == i - 1 && msg->getSourceEntity() == (i - 1) % 4;
+    delete msg;
+
+    if (!ok)
+      return false;
+  }
+
+  IMC::LsfMappedFile::Record record;
+  return !file.getRecord(count, record);
+}
+
+//! Visitor recording the time stamps of every log.
+class Recorder: public IMC::LsfScanner::Visitor
+{
+public:
+  Recorder(size_t logs, size_t stop_log, unsigned stop_record):
+    stamps(logs),
+    begun(logs, 0),
+    ended(logs, 0),
+    errors(logs, 0),
+    m_stop_log(stop_log),
+    m_stop_record(stop_record)
+  { }
+
+  void
+  onLogBegin(size_t log, IMC::LsfMappedFile& file)
+  {
+    (void)file;
+    ++begun[log];
+  }
+
+  bool
+  onRecord(size_t log, const IMC::LsfMappedFile::Record& record)
+  {
+    stamps[log].push_back((unsigned)record.header.timestamp);
+    return log != m_stop_log || stamps[log].size() <= m_stop_record;
+  }
+
+  void
+  onLogEnd(size_t log)
+  {
+    ++ended[log];
+  }
+
+  void
+  onLogError(size_t log, const std::string& error)
+  {
+    (void)error;
+    ++errors[log];
+  }
+
+  //! Time stamps per log.
+  std::vector<std::vector<unsigned> > stamps;
+  //! Number of onLogBegin() calls per log.
+  std::vector<unsigned> begun;
+  //! Number of onLogEnd() calls per log.
+  std::vector<unsigned> ended;
+  //! Number of onLogError() calls per log.
+  std::vector<unsigned> errors;
+
+private:
+  size_t m_stop_log;
+  unsigned m_stop_record;
+};
+
+//! Test if a sequence of time stamps is 0, 1, ..., count - 1.
+static bool
+isSequence(const std::vector<unsigned>& stamps, unsigned count)
+{
+  if (stamps.size() != count)
+    return false;
+
+  for (unsigned i = 0; i < count; ++i)
+  {
+    if (stamps[i] != i)
+      return false;
+  }
+
+  return true;
+}
+
+int
+main(void)
+{
+  Test test("IMC::Lsf");
+
+  Path plain = Path::current() / "test_Lsf.lsf";
+  Path gzip = Path::current() / "test_Lsf.lsf.gz";
+  writeLog(plain, Compression::METHOD_UNKNOWN, c_records, 30);
+  writeLog(gzip, Compression::METHOD_GZIP, c_records, 30);
+
+  std::vector<size_t> entries;
+  entries.push_back(2);
+  entries.push_back(3);
+  entries.push_back(9);
+  entries.push_back(16);
+
+  unsigned record_size = 0;
+  {
+    IMC::LsfReader reader(plain.str());
+    reader.next();
+    record_size = reader.getSize();
+  }
+
+  {
+    IMC::LsfIndex index;
+    bool loaded = index.load(IMC::LsfIndex::getPath(plain.str()));
+    test.boolean("index: plain entries", loaded && checkIndex(index, c_records, 30, record_size));
+
+    bool offsets = true;
+    for (size_t i = 0; i < index.getBlocks().size(); ++i)
+      offsets = offsets && index.getBlocks()[i].block_offset == index.getBlocks()[i].offset;
+
+    test.boolean("index: plain block offsets", offsets);
+
+    IMC::LsfReader reader(plain.str());
+    test.boolean("index: plain seek", checkSeek(reader, index, entries));
+  }
+
+  {
+    IMC::LsfIndex index;
+    bool loaded = index.load(IMC::LsfIndex::getPath(gzip.str()));
+    test.boolean("index: compressed entries", loaded && checkIndex(index, c_records, 30, record_size));
+    test.boolean("index: compressed block offsets",
+                 index.getBlocks()[1].block_offset == IMC::LsfIndex::c_no_block_offset);
+
+    IMC::LsfReader reader(gzip.str());
+    test.boolean("index: compressed seek", checkSeek(reader, index, entries));
+  }
+
+  {
+    Path path = IMC::LsfIndex::getPath(plain.str());
+    std::string data;
+    {
+      std::ifstream ifs(path.c_str(), std::ios::binary);
+      data.assign((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    }
+
+    std::ofstream ofs(path.c_str(), std::ios::binary | std::ios::trunc);
+    ofs.write(data.data(), data.size() - 3);
+    ofs.close();
+
+    IMC::LsfIndex index;
+    index.load(path.str());
+    test.boolean("index: incomplete entry ignored", index.getBlocks().size() == (c_records + 29) / 30 - 1);
+
+    IMC::LsfIndex missing;
+    test.boolean("index: missing file", !missing.load(path.str() + ".missing"));
+    path.remove();
+    Path(IMC::LsfIndex::getPath(gzip.str())).remove();
+  }
+
+  {
+    IMC::LsfMappedFile file(plain.str());
+    test.boolean("mapped file: plain records", checkRecords(file, c_records));
+    test.boolean("mapped file: plain not truncated", !file.isTruncated());
+  }
+
+  {
+    IMC::LsfMappedFile file(gzip.str());
+    test.boolean("mapped file: compressed records", checkRecords(file, c_records));
+    test.boolean("mapped file: compressed not truncated", !file.isTruncated());
+  }
+
+  {
+    std::ofstream ofs(plain.c_str(), std::ios::binary | std::ios::app);
+    ofs.write("\xfe\x54\x01\x00", 4);
+    ofs.close();
+
+    IMC::LsfMappedFile file(plain.str());
+    test.boolean("mapped file: truncated record", checkRecords(file, c_records) && file.isTruncated());
+  }
+
+  {
+    Path missing = Path::current() / "test_Lsf.missing.lsf";
+    Path small = Path::current() / "test_Lsf.small.lsf";
+    writeLog(small, Compression::METHOD_UNKNOWN, 7);
+
+    std::vector<std::string> paths;
+    paths.push_back(plain.str());
+    paths.push_back(missing.str());
+    paths.push_back(gzip.str());
+    paths.push_back(small.str());
+    paths.push_back(plain.str());
+
+    Recorder recorder(paths.size(), 4, 9);
+    IMC::LsfScanner::scan(paths, recorder, 3);
+
+    test.boolean("scanner: records in order",
+                 isSequence(recorder.stamps[0], c_records)
+                 && isSequence(recorder.stamps[2], c_records)
+                 && isSequence(recorder.stamps[3], 7));
+    test.boolean("scanner: stop early", isSequence(recorder.stamps[4], 10));
+    test.boolean("scanner: missing log",
+                 recorder.errors[1] == 1 && recorder.begun[1] == 0
+                 && recorder.ended[1] == 0 && recorder.stamps[1].empty());
+
+    bool once = true;
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+      if (i != 1)
+        once = once && recorder.begun[i] == 1 && recorder.ended[i] == 1 && recorder.errors[i] == 0;
+    }
+
+    test.boolean("scanner: callbacks once per log", once);
+    small.remove();
+  }
+
+  {
+    Path blocks = Path::current() / "test_Lsf.lsf.blk";
+    writeBlockLog(blocks, c_records, 50);
+
+    IMC::LsfIndex index;
+    index.load(IMC::LsfIndex::getPath(blocks.str()));
+    bool offsets = checkIndex(index, c_records, 50, record_size);
+    {
+      Compression::BlockReader file(blocks.c_str());
+      offsets = offsets && file.getBlocks().size() == index.getBlocks().size();
+      for (size_t i = 0; offsets && i < file.getBlocks().size(); ++i)
+        offsets = index.getBlocks()[i].block_offset == file.getBlocks()[i].offset;
+    }
+
+    test.boolean("index: container block offsets", offsets);
+
+    damageBlock(blocks, 3);
+
+    std::vector<size_t> block_entries;
+    block_entries.push_back(1);
+    block_entries.push_back(4);
+    block_entries.push_back(8);
+
+    {
+      IMC::LsfReader reader(blocks.str());
+      test.boolean("index: container seek", checkSeek(reader, index, block_entries));
+    }
+
+    // A destroyed block header shifts the offsets of the container
+    // stream, seeking by block keeps record offsets consistent with
+    // the index.
+    {
+      Compression::BlockReader file(blocks.c_str());
+      std::fstream fs(blocks.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+      fs.seekp(file.getBlocks()[5].offset);
+      fs.put('X');
+    }
+
+    {
+      IMC::LsfReader reader(blocks.str());
+      block_entries.erase(block_entries.begin() + 1);
+      test.boolean("index: container seek after lost block", checkSeek(reader, index, block_entries));
+    }
+
+    IMC::LsfReader reader(blocks.str());
+    std::vector<unsigned> stamps;
+    offsets = true;
+    while (reader.next())
+    {
+      IMC::Message* msg = reader.decode(NULL, true);
+      stamps.push_back((unsigned)msg->getTimeStamp());
+      if (stamps.back() < 250)
+        offsets = offsets && reader.getOffset() == stamps.back() * reader.getSize();
+      delete msg;
+    }
+
+    bool ok = stamps.size() == c_records - 100;
+    for (unsigned i = 0; ok && i < stamps.size(); ++i)
+      ok = stamps[i] == (i < 150 ? i : (i < 200 ? i + 50 : i + 100));
+
+    test.boolean("reader: damaged blocks skipped", ok && reader.getCorruptedBlocks() == 1);
+    test.boolean("reader: offsets before lost block", offsets);
+    blocks.remove();
+    Path(IMC::LsfIndex::getPath(blocks.str())).remove();
+  }
+
+  plain.remove();
+  gzip.remove();
+
+  return test.getReturnValue();
+}
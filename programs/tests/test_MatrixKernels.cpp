@@ -0,0 +1,185 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Test program for DUNE::Math::MatrixKernels class.                        *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Create a deterministic, well conditioned matrix.
+static Math::Matrix
+sample(size_t r, size_t c, double seed)
+{
+  Math::Matrix m(r, c);
+  for (size_t i = 0; i < r; ++i)
+  {
+    for (size_t j = 0; j < c; ++j)
+      m(i, j) = std::sin(seed + i * 1.3 + j * 0.7);
+  }
+
+  if (r == c)
+  {
+    for (size_t i = 0; i < r; ++i)
+      m(i, i) += r;
+  }
+
+  return m;
+}
+
+//! Test if two matrices are equal within a tolerance.
+static bool
+near(const Math::Matrix& a, const Math::Matrix& b, double tolerance)
+{
+  if (a.rows() != b.rows() || a.columns() != b.columns())
+    return false;
+
+  return max(abs(a - b)) < tolerance;
+}
+
+int
+main(void)
+{
+  Test test("Math::MatrixKernels");
+
+  // Cover the small, blocked and SIMD remainder paths.
+  const size_t dims[][3] = {{3, 3, 3}, {7, 5, 9}, {33, 130, 21}, {64, 64, 520}};
+  bool mul_ok = true;
+  bool mult_ok = true;
+
+  for (size_t d = 0; d < sizeof(dims) / sizeof(dims[0]); ++d)
+  {
+    size_t n = dims[d][0], k = dims[d][1], m = dims[d][2];
+    Math::Matrix a = sample(n, k, 0.1);
+    Math::Matrix b = sample(k, m, 0.2);
+    Math::Matrix bt = transpose(b);
+    Math::Matrix c_ref(n, m);
+    Math::Matrix c(n, m);
+
+    Math::MatrixKernels::multiplyReference(&a(0, 0), &b(0, 0), &c_ref(0, 0), n, k, m);
+    mul_ok = mul_ok && near(a * b, c_ref, 1e-9);
+
+    Math::MatrixKernels::multiplyTransposed(&a(0, 0), &bt(0, 0), &c(0, 0), n, k, m);
+    mult_ok = mult_ok && near(c, c_ref, 1e-9);
+  }
+
+  test.boolean("multiply()", mul_ok);
+  test.boolean("multiplyTransposed()", mult_ok);
+
+  Math::Matrix a = sample(9, 9, 0.3);
+  Math::Matrix I(9);
+  test.boolean("inverse()", near(a * inverse(a), I, 1e-12));
+
+  Math::Matrix b = sample(9, 2, 0.4);
+  test.boolean("inverse(a, b)", near(a * inverse(a, b), b, 1e-12));
+
+  Math::Matrix L, U, P;
+  a.lup(L, U, P);
+  test.boolean("lup()", near(P * a, L * U, 1e-12));
+
+  Math::Matrix swapped = a;
+  swapped.swapRows(0, 1);
+  test.boolean("det()", std::fabs(a.det() + swapped.det()) < 1e-9 * std::fabs(a.det()));
+  test.boolean("det() singular", Math::Matrix(5, 5, 1.0).det() == 0.0);
+
+  Math::Matrix t = sample(4, 9, 0.5);
+  Math::Matrix s = transform(t, a);
+  test.boolean("transform()", near(s, t * a * transpose(t), 1e-9));
+
+  Math::Matrix spd = transform(a, Math::Matrix(9));
+  Math::Matrix C;
+  spd.cholesky(C);
+  test.boolean("cholesky()", near(C * transpose(C), spd, 1e-9) && C(0, 8) == 0.0);
+
+  // Expressions are evaluated into the destination and aliased
+  // operands go through a temporary.
+  {
+    Math::Matrix x = sample(6, 6, 0.1);
+    Math::Matrix y = sample(6, 6, 0.9);
+    Math::Matrix xy(6, 6, 0.0);
+    Math::Matrix yx(6, 6, 0.0);
+    for (size_t i = 0; i < 6; ++i)
+    {
+      for (size_t j = 0; j < 6; ++j)
+      {
+        for (size_t k = 0; k < 6; ++k)
+        {
+          xy(i, j) += x(i, k) * y(k, j);
+          yx(i, j) += y(i, k) * x(k, j);
+        }
+      }
+    }
+
+    Math::Matrix ref(6, 6);
+    for (size_t i = 0; i < 6; ++i)
+    {
+      for (size_t j = 0; j < 6; ++j)
+        ref(i, j) = xy(i, j) + 2.0 * x(j, i) - y(i, j) / 4.0;
+    }
+
+    Math::Matrix e = x * y + 2.0 * transpose(x) - y / 4.0;
+    test.boolean("expression", near(e, ref, 1e-12));
+
+    Math::Matrix z = x;
+    z = y * z;
+    test.boolean("expression aliasing", near(z, yx, 1e-12));
+
+    z = x;
+    z += transpose(z);
+    test.boolean("expression aliasing transpose", z == transpose(z));
+  }
+
+  try
+  {
+    inverse(Math::Matrix(4, 4, 1.0));
+    test.failed("inverse() singular");
+  }
+  catch (Math::Matrix::Error& e)
+  {
+    test.passed("inverse() singular");
+  }
+
+  try
+  {
+    (-Math::Matrix(3)).cholesky(C);
+    test.failed("cholesky() not positive definite");
+  }
+  catch (Math::Matrix::Error& e)
+  {
+    test.passed("cholesky() not positive definite");
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,106 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Test program for DUNE::Math::MatrixN class.                              *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+//! Compare a fixed-size matrix with a dynamic one.
+template <size_t R, size_t C>
+static bool
+same(const Math::MatrixN<R, C>& a, const Math::Matrix& b)
+{
+  return a.toMatrix() == b;
+}
+
+int
+main(void)
+{
+  Test test("Math::MatrixN");
+
+  double da[12];
+  double db[12];
+  for (unsigned i = 0; i < 12; ++i)
+  {
+    da[i] = std::sin(i + 1.0);
+    db[i] = std::cos(i * 0.5);
+  }
+
+  Math::MatrixN<3, 4> a(da);
+  Math::MatrixN<4, 3> b(db);
+  Math::Matrix ma(da, 3, 4);
+  Math::Matrix mb(db, 4, 3);
+
+  test.boolean("MatrixN(Matrix)", Math::MatrixN<3, 4>(ma) == a);
+  test.boolean("operator*", same(a * b, ma * mb));
+  test.boolean("transpose()", same(transpose(a), transpose(ma)));
+  test.boolean("operator+/-", same(a + a * 2.0 - a / 2.0, ma + ma * 2.0 - ma / 2.0));
+
+  Math::MatrixN<4, 4> p = b * transpose(b) + Math::MatrixN<4, 4>::identity();
+  test.boolean("transform()", same(transform(a, p), ma * p.toMatrix() * transpose(ma)));
+
+  try
+  {
+    Math::MatrixN<3, 3> bad(ma);
+    test.failed("MatrixN(Matrix) dimensions");
+  }
+  catch (Math::Matrix::Error& e)
+  {
+    test.passed("MatrixN(Matrix) dimensions");
+  }
+
+  Math::VectorN<3> u(da);
+  Math::VectorN<3> v(db);
+  test.boolean("cross()", same(cross(u, v), Math::Matrix::cross(u.toMatrix(), v.toMatrix())));
+  test.boolean("dot()", std::fabs(dot(u, v) - Math::Matrix::dot(u.toMatrix(), v.toMatrix())) < 1e-12);
+  test.boolean("skew()", same(skew(u) * v, Math::Matrix(cross(u, v).toMatrix())));
+
+  double angles[3] = {0.3, -0.4, 2.5};
+  Math::VectorN<3> ea(angles);
+  Math::Matrix mea(angles, 3, 1);
+
+  Math::MatrixN<3, 3> dcm = toDCM(ea);
+  test.boolean("toDCM(Euler)", same(dcm, mea.toDCM()));
+  test.boolean("toEulerAngles(DCM)", toEulerAngles(dcm) == ea);
+
+  Math::VectorN<4> q = toQuaternion(ea);
+  test.boolean("toQuaternion(Euler)", same(q, mea.toQuaternion()));
+  test.boolean("toDCM(quaternion)", toDCM(q) == dcm);
+  test.boolean("toQuaternion(DCM)", toQuaternion(dcm) == q);
+  test.boolean("toEulerAngles(quaternion)", toEulerAngles(q * 3.0) == ea);
+
+  return test.getReturnValue();
+}
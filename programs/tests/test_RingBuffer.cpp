@@ -0,0 +1,190 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Test program for DUNE::Concurrency::RingBuffer class.                    *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::Concurrency;
+
+typedef RingBuffer<unsigned> Buffer;
+
+//! Number of producer threads.
+static const unsigned c_producers = 4;
+//! Number of elements pushed by each producer.
+static const unsigned c_count = 10000;
+
+class Producer: public Thread
+{
+public:
+  Producer(Buffer& buffer, unsigned id):
+    m_buffer(buffer),
+    m_id(id)
+  { }
+
+  void
+  run(void)
+  {
+    for (unsigned i = 0; i < c_count; ++i)
+      m_buffer.push(m_id * c_count + i);
+  }
+
+private:
+  Buffer& m_buffer;
+  unsigned m_id;
+};
+
+static bool
+isSequence(const std::vector<unsigned>& items, unsigned first)
+{
+  for (unsigned i = 0; i < items.size(); ++i)
+  {
+    if (items[i] != first + i)
+      return false;
+  }
+
+  return true;
+}
+
+int
+main(void)
+{
+  Test test("Concurrency::RingBuffer");
+
+  {
+    Buffer buffer(8, Buffer::OVERFLOW_DROP_OLDEST);
+    for (unsigned i = 0; i < 12; ++i)
+      buffer.push(i);
+
+    std::vector<unsigned> items;
+    test.boolean("drop oldest: size()", buffer.size() == 8);
+    test.boolean("drop oldest: pop()", buffer.pop(items) == 8 && isSequence(items, 4));
+    test.boolean("drop oldest: counters", buffer.getCounters().dropped == 4);
+    test.boolean("drop oldest: empty()", buffer.empty());
+  }
+
+  {
+    Buffer buffer(8, Buffer::OVERFLOW_DROP_NEWEST);
+    for (unsigned i = 0; i < 12; ++i)
+      buffer.push(i);
+
+    std::vector<unsigned> items;
+    test.boolean("drop newest: pop()", buffer.pop(items) == 8 && isSequence(items, 0));
+    test.boolean("drop newest: counters", buffer.getCounters().dropped == 4);
+  }
+
+  {
+    Buffer buffer(8, Buffer::OVERFLOW_GROW);
+    std::vector<unsigned> items;
+    for (unsigned i = 0; i < 3; ++i)
+      buffer.push(i);
+    buffer.pop(items);
+
+    items.clear();
+    for (unsigned i = 0; i < 20; ++i)
+      buffer.push(i);
+
+    test.boolean("grow: capacity", buffer.getCapacity() == 32);
+    test.boolean("grow: pop()", buffer.pop(items) == 20 && isSequence(items, 0));
+    test.boolean("grow: counters", buffer.getCounters().dropped == 0);
+  }
+
+  {
+    Buffer buffer(4, Buffer::OVERFLOW_BLOCK);
+    for (unsigned i = 0; i < 6; ++i)
+      buffer.push(i, false);
+
+    std::vector<unsigned> items;
+    test.boolean("block: push() without waiting", buffer.pop(items) == 4 && isSequence(items, 0));
+    test.boolean("block: counters without waiting", buffer.getCounters().dropped == 2);
+  }
+
+  {
+    Buffer buffer(8);
+    for (unsigned i = 0; i < 8; ++i)
+      buffer.push(i);
+
+    std::vector<unsigned> items;
+    test.boolean("pop(max)", buffer.pop(items, 3) == 3 && isSequence(items, 0));
+    buffer.setCapacity(2);
+    items.clear();
+    test.boolean("setCapacity()", buffer.pop(items) == 2 && isSequence(items, 6));
+    test.boolean("high water mark", buffer.getCounters().high_water == 8);
+  }
+
+  {
+    Buffer buffer(16, Buffer::OVERFLOW_BLOCK);
+    std::vector<Producer*> producers;
+    for (unsigned i = 0; i < c_producers; ++i)
+    {
+      producers.push_back(new Producer(buffer, i));
+      producers.back()->start();
+    }
+
+    std::vector<unsigned> items;
+    std::vector<unsigned> next(c_producers, 0);
+    bool ordered = true;
+    unsigned total = 0;
+
+    while (total < c_producers * c_count)
+    {
+      if (!buffer.waitForItems(1.0))
+        break;
+
+      items.clear();
+      total += buffer.pop(items);
+
+      for (unsigned i = 0; i < items.size(); ++i)
+      {
+        unsigned id = items[i] / c_count;
+        if (items[i] % c_count != next[id]++)
+          ordered = false;
+      }
+    }
+
+    for (unsigned i = 0; i < producers.size(); ++i)
+    {
+      producers[i]->join();
+      delete producers[i];
+    }
+
+    Buffer::Counters counters = buffer.getCounters();
+    test.boolean("block: all elements delivered", total == c_producers * c_count);
+    test.boolean("block: per-producer order", ordered);
+    test.boolean("block: no drops", counters.dropped == 0);
+    test.boolean("block: bounded", counters.high_water <= 16);
+  }
+
+  return test.getReturnValue();
+}
@@ -33,11 +33,37 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+#if defined(DUNE_SYS_HAS_SCHED_H)
+#  include <sched.h>
+#endif
+
 // Local headers.
 #include "Test.hpp"
 
 using namespace DUNE::Concurrency;
 
+//! Pick a CPU the process is allowed to run on, the test may be
+//! confined to a subset of the CPUs (containers, taskset).
+//! @return CPU number.
+static unsigned
+getAllowedCpu(void)
+{
+#if defined(DUNE_SYS_HAS_SCHED_H) && defined(DUNE_SYS_HAS_PTHREAD_SETAFFINITY_NP)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0)
+  {
+    for (unsigned i = 0; i < CPU_SETSIZE; ++i)
+    {
+      if (CPU_ISSET(i, &set))
+        return i;
+    }
+  }
+#endif
+
+  return 0;
+}
+
 class ThreadA: public Thread
 {
 public:
@@ -57,6 +83,17 @@ public:
   }
 };
 
+class ThreadB: public Thread
+{
+public:
+  void
+  run(void)
+  {
+    while (!isStopping())
+      DUNE::Time::Delay::wait(0.1);
+  }
+};
+
 int
 main(void)
 {
@@ -77,6 +114,23 @@ main(void)
     }
   }
 
+  {
+    try
+    {
+      ThreadB thread;
+      unsigned cpu = getAllowedCpu();
+      std::vector<unsigned> cpus(1, cpu);
+      thread.setAffinity(cpus);
+      thread.start();
+      thread.getAffinity(cpus);
+      thread.stopAndJoin();
+      test.boolean("setAffinity()", cpus.size() == 1 && cpus[0] == cpu);
+    }
+    catch (std::exception& e)
+    {
+      test.failed(DUNE::Utils::String::str("affinity: %s", e.what()).c_str());
+    }
+  }
 
   // {
   //   try
@@ -192,7 +192,6 @@ main(int argc, char** argv)
   for (; *argv != 0; argv++)
   {
     Path file(*argv);
-    std::istream* is;
 
     if (file.isDirectory())
     {
@@ -207,19 +206,13 @@ main(int argc, char** argv)
       return 1;
     }
 
-    Compression::Methods method = Compression::Factory::detect(file.c_str());
-    if (method == METHOD_UNKNOWN)
-      is = new std::ifstream(file.c_str(), std::ios::binary);
-    else
-      is = new Compression::FileInput(file.c_str(), method);
-
+    IMC::LsfReader reader(file.str());
     IMC::Message* m;
 
-    m = IMC::Packet::deserialize(*is);
+    m = reader.read();
     if (!m)
     {
       std::cerr << file << " contains no messages\n";
-      delete is;
       continue;
     }
 
@@ -228,14 +221,31 @@ main(int argc, char** argv)
     double time_origin = m->getTimeStamp();
     if (begin >= 0)
     {
-      do
+      // Use the index, if any, to jump close to the begin time.
+      IMC::LsfIndex index;
+      if (begin > 0 && index.load(IMC::LsfIndex::getPath(file.str())) && !index.getBlocks().empty())
+      {
+        const std::vector<IMC::LsfIndex::Block>& blocks = index.getBlocks();
+        size_t target = index.find(time_origin + begin);
+        uint64_t offset = blocks.back().offset + blocks.back().size;
+        if (target < blocks.size())
+          offset = blocks[target].offset;
+
+        if (offset > reader.getNextOffset())
+        {
+          delete m;
+          reader.seek(offset);
+          m = reader.read();
+        }
+      }
+
+      while (m)
       {
         if (m->getTimeStamp() - time_origin >= begin)
           break;
         delete m;
-        m = IMC::Packet::deserialize(*is);
+        m = reader.read();
       }
-      while (m);
 
       if (!m)
       {
@@ -287,8 +297,7 @@ main(int argc, char** argv)
       if (end >= 0 && vtime >= end)
         break;
     }
-    while ((m = IMC::Packet::deserialize(*is)) != 0);
-    delete is;
+    while ((m = reader.read()) != 0);
   }
   return 0;
 }
@@ -69,5 +69,45 @@ namespace DUNE
       0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
       0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
     };
+
+    //! Slicing-by-8 tables. Entry k of a table holds the CRC of a
+    //! byte followed by k zero bytes.
+    struct CRC16Tables
+    {
+      uint16_t table[8][256];
+
+      CRC16Tables(void)
+      {
+        for (unsigned i = 0; i < 256; ++i)
+          table[0][i] = c_crc16_ibm_table[i];
+
+        for (unsigned k = 1; k < 8; ++k)
+        {
+          for (unsigned i = 0; i < 256; ++i)
+          {
+            uint16_t prev = table[k - 1][i];
+            table[k][i] = (prev >> 8) ^ c_crc16_ibm_table[prev & 0xff];
+          }
+        }
+      }
+    };
+
+    uint16_t
+    CRC16::computeSlicing8(const uint8_t* buffer, uint16_t len, uint16_t crc)
+    {
+      static const CRC16Tables tables;
+      const uint16_t (*t)[256] = tables.table;
+
+      for (; len >= 8; len -= 8, buffer += 8)
+      {
+        crc ^= buffer[0] | (buffer[1] << 8);
+        crc = t[7][crc & 0xff] ^ t[6][crc >> 8]
+        ^ t[5][buffer[2]] ^ t[4][buffer[3]]
+        ^ t[3][buffer[4]] ^ t[2][buffer[5]]
+        ^ t[1][buffer[6]] ^ t[0][buffer[7]];
+      }
+
+      return computeReference(buffer, len, crc);
+    }
   }
 }
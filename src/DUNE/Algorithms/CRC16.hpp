@@ -47,7 +47,9 @@ namespace DUNE
     class CRC16
     {
     public:
-      //! Compute the CRC-16-IBM of a given data buffer.
+      //! Compute the CRC-16-IBM of a given data buffer. Buffers
+      //! longer than a few bytes are processed eight bytes at a time
+      //! (slicing-by-8).
       //! @param buffer data buffer.
       //! @param len data buffer length.
       //! @param crc CRC-16-IBM value to update.
@@ -55,10 +57,10 @@ namespace DUNE
       static inline uint16_t
       compute(const uint8_t* buffer, uint16_t len, uint16_t crc = 0)
       {
-        while (len--)
-          crc = (crc >> 8) ^ c_crc16_ibm_table[(crc ^ *buffer++) & 0xff];
+        if (len < c_slicing_min)
+          return computeReference(buffer, len, crc);
 
-        return crc;
+        return computeSlicing8(buffer, len, crc);
       }
 
       //! Compute the CRC-16-IBM of a given byte.
@@ -70,6 +72,34 @@ namespace DUNE
       {
         return (crc >> 8) ^ c_crc16_ibm_table[(crc ^ byte) & 0xff];
       }
+
+      //! Compute the CRC-16-IBM of a given data buffer one byte at a
+      //! time. This is the reference implementation.
+      //! @param buffer data buffer.
+      //! @param len data buffer length.
+      //! @param crc CRC-16-IBM value to update.
+      //! @return computed CRC-16-IBM.
+      static inline uint16_t
+      computeReference(const uint8_t* buffer, uint16_t len, uint16_t crc = 0)
+      {
+        while (len--)
+          crc = (crc >> 8) ^ c_crc16_ibm_table[(crc ^ *buffer++) & 0xff];
+
+        return crc;
+      }
+
+      //! Compute the CRC-16-IBM of a given data buffer eight bytes at
+      //! a time.
+      //! @param buffer data buffer.
+      //! @param len data buffer length.
+      //! @param crc CRC-16-IBM value to update.
+      //! @return computed CRC-16-IBM.
+      static uint16_t
+      computeSlicing8(const uint8_t* buffer, uint16_t len, uint16_t crc = 0);
+
+    private:
+      //! Minimum length processed with slicing-by-8.
+      static const uint16_t c_slicing_min = 16;
     };
   }
 }
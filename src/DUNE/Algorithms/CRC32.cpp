@@ -28,9 +28,26 @@
 // http://c.snippets.org/snip_lister.php?fname=crc_32.c                     *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cstring>
+
 // DUNE headers.
 #include <DUNE/Algorithms/CRC32.hpp>
 
+// Carry-less multiplication (x86).
+#if defined(DUNE_CPU_X86) && (defined(DUNE_CXX_GNU) || defined(DUNE_CXX_CLANG))
+#  define DUNE_CRC32_CLMUL
+#  include <cpuid.h>
+#  include <wmmintrin.h>
+#  include <smmintrin.h>
+#endif
+
+// CRC32 instructions (ARMv8).
+#if defined(__ARM_FEATURE_CRC32) && defined(DUNE_CPU_LITTLE_ENDIAN)
+#  define DUNE_CRC32_ARMV8
+#  include <arm_acle.h>
+#endif
+
 namespace DUNE
 {
   namespace Algorithms
@@ -71,5 +88,265 @@ namespace DUNE
       0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
       0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
     };
+
+    //! Function updating a CRC register (i.e., without the initial
+    //! and final inversions) with a data buffer.
+    typedef uint32_t (*UpdateFunction)(uint32_t crc, const uint8_t* buf, size_t len);
+
+    //! Slicing-by-8 tables. Entry k of a table holds the CRC of a
+    //! byte followed by k zero bytes.
+    struct CRC32Tables
+    {
+      uint32_t table[8][256];
+      //! Bit reflection of every byte.
+      uint8_t reflected[256];
+
+      CRC32Tables(void)
+      {
+        for (unsigned i = 0; i < 256; ++i)
+        {
+          table[0][i] = c_crc32_table[i];
+          reflected[i] = (uint8_t)CRC32::reflect(i, 8);
+        }
+
+        for (unsigned k = 1; k < 8; ++k)
+        {
+          for (unsigned i = 0; i < 256; ++i)
+          {
+            uint32_t prev = table[k - 1][i];
+            table[k][i] = (prev >> 8) ^ c_crc32_table[prev & 0xff];
+          }
+        }
+      }
+    };
+
+    static const CRC32Tables&
+    getTables(void)
+    {
+      static const CRC32Tables tables;
+      return tables;
+    }
+
+    //! Fetch an input byte, optionally reflected.
+    template <bool t_reflect>
+    static inline uint32_t
+    fetch(const CRC32Tables& tables, uint8_t byte)
+    {
+      return t_reflect ? tables.reflected[byte] : byte;
+    }
+
+    template <bool t_reflect>
+    static uint32_t
+    updateSlicing8(uint32_t crc, const uint8_t* buf, size_t len)
+    {
+      const CRC32Tables& tables = getTables();
+      const uint32_t (*t)[256] = tables.table;
+
+      for (; len >= 8; len -= 8, buf += 8)
+      {
+        uint32_t one = crc
+        ^ fetch<t_reflect>(tables, buf[0])
+        ^ (fetch<t_reflect>(tables, buf[1]) << 8)
+        ^ (fetch<t_reflect>(tables, buf[2]) << 16)
+        ^ (fetch<t_reflect>(tables, buf[3]) << 24);
+
+        crc = t[7][one & 0xff] ^ t[6][(one >> 8) & 0xff]
+        ^ t[5][(one >> 16) & 0xff] ^ t[4][one >> 24]
+        ^ t[3][fetch<t_reflect>(tables, buf[4])]
+        ^ t[2][fetch<t_reflect>(tables, buf[5])]
+        ^ t[1][fetch<t_reflect>(tables, buf[6])]
+        ^ t[0][fetch<t_reflect>(tables, buf[7])];
+      }
+
+      for (; len > 0; --len, ++buf)
+        crc = t[0][(crc ^ fetch<t_reflect>(tables, *buf)) & 0xff] ^ (crc >> 8);
+
+      return crc;
+    }
+
+#if defined(DUNE_CRC32_CLMUL)
+    //! Test if the CPU supports the instructions used by updateCLMUL().
+    static bool
+    hasCLMUL(void)
+    {
+      unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+      if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return false;
+
+      return (ecx & bit_PCLMUL) && (ecx & bit_SSE4_1);
+    }
+
+    //! Fold 64 bytes at a time using carry-less multiplication, as
+    //! described in "Fast CRC Computation for Generic Polynomials
+    //! Using PCLMULQDQ Instruction" (Intel, 2009).
+    __attribute__((target("pclmul,sse4.1")))
+    static uint32_t
+    updateCLMUL(uint32_t crc, const uint8_t* buf, size_t len)
+    {
+      if (len < 64)
+        return updateSlicing8<false>(crc, buf, len);
+
+      size_t tail = len & 15;
+      len -= tail;
+
+      __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+      x1 = _mm_loadu_si128((const __m128i*)(buf + 0x00));
+      x2 = _mm_loadu_si128((const __m128i*)(buf + 0x10));
+      x3 = _mm_loadu_si128((const __m128i*)(buf + 0x20));
+      x4 = _mm_loadu_si128((const __m128i*)(buf + 0x30));
+      x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc));
+
+      // Fold by four.
+      x0 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+      buf += 64;
+      len -= 64;
+
+      while (len >= 64)
+      {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i*)(buf + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i*)(buf + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i*)(buf + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i*)(buf + 0x30)));
+
+        buf += 64;
+        len -= 64;
+      }
+
+      // Fold into 128 bits.
+      x0 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+
+      x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+      x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+      x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+      x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+      x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+      x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+      x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+      x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+      x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+      // Fold remaining 16 byte blocks.
+      while (len >= 16)
+      {
+        x2 = _mm_loadu_si128((const __m128i*)buf);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+        buf += 16;
+        len -= 16;
+      }
+
+      // Fold 128 bits to 64 bits.
+      x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+      x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+      x1 = _mm_srli_si128(x1, 8);
+      x1 = _mm_xor_si128(x1, x2);
+
+      x0 = _mm_set_epi64x(0, 0x0163cd6124LL);
+      x2 = _mm_srli_si128(x1, 4);
+      x1 = _mm_and_si128(x1, x3);
+      x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+      x1 = _mm_xor_si128(x1, x2);
+
+      // Barrett reduction to 32 bits.
+      x0 = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+      x2 = _mm_and_si128(x1, x3);
+      x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+      x2 = _mm_and_si128(x2, x3);
+      x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+      x1 = _mm_xor_si128(x1, x2);
+
+      crc = (uint32_t)_mm_extract_epi32(x1, 1);
+      return updateSlicing8<false>(crc, buf, tail);
+    }
+#endif
+
+#if defined(DUNE_CRC32_ARMV8)
+    static uint32_t
+    updateARMv8(uint32_t crc, const uint8_t* buf, size_t len)
+    {
+      for (; len >= 8; len -= 8, buf += 8)
+      {
+        uint64_t word;
+        std::memcpy(&word, buf, 8);
+        crc = __crc32d(crc, word);
+      }
+
+      for (; len > 0; --len, ++buf)
+        crc = __crc32b(crc, *buf);
+
+      return crc;
+    }
+#endif
+
+    //! Implementation selected at run time.
+    struct CRC32Implementation
+    {
+      UpdateFunction update;
+      const char* name;
+
+      CRC32Implementation(void):
+        update(updateSlicing8<false>),
+        name("slicing-by-8")
+      {
+#if defined(DUNE_CRC32_CLMUL)
+        if (hasCLMUL())
+        {
+          update = updateCLMUL;
+          name = "pclmulqdq";
+        }
+#endif
+
+#if defined(DUNE_CRC32_ARMV8)
+        update = updateARMv8;
+        name = "armv8-crc";
+#endif
+      }
+    };
+
+    static const CRC32Implementation&
+    getSelected(void)
+    {
+      static const CRC32Implementation impl;
+      return impl;
+    }
+
+    uint32_t
+    CRC32::compute(const uint8_t* buf, size_t len, bool do_reflect, uint32_t crc)
+    {
+      if (do_reflect)
+        return ~updateSlicing8<true>(~crc, buf, len);
+
+      return ~getSelected().update(~crc, buf, len);
+    }
+
+    uint32_t
+    CRC32::computeSlicing8(const uint8_t* buf, size_t len, bool do_reflect, uint32_t crc)
+    {
+      if (do_reflect)
+        return ~updateSlicing8<true>(~crc, buf, len);
+
+      return ~updateSlicing8<false>(~crc, buf, len);
+    }
+
+    const char*
+    CRC32::getImplementation(void)
+    {
+      return getSelected().name;
+    }
   }
 }
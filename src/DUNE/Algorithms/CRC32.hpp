@@ -31,6 +31,9 @@
 #ifndef DUNE_ALGORITHMS_CRC32_HPP_INCLUDED_
 #define DUNE_ALGORITHMS_CRC32_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <cstddef>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 
@@ -68,27 +71,55 @@ namespace DUNE
 
           return reflection;
       }
-      //! Compute the CRC-32 of a given data buffer.
-      //! @param buffer data buffer.
+
+      //! Compute the CRC-32 of a given data buffer. The fastest
+      //! implementation supported by the CPU is selected on first
+      //! use (see getImplementation()).
+      //! @param buf data buffer.
       //! @param len data buffer length.
-      //! @param do_reflect if true, the intermediate results are reflected
+      //! @param do_reflect if true, the input bytes are reflected.
       //! @param crc CRC-32 value to update.
       //! @return computed CRC-32.
-      static inline uint32_t 
-      compute(const uint8_t *buf, const uint8_t len, bool do_reflect, uint32_t crc=0)
-      {
+      static uint32_t
+      compute(const uint8_t* buf, size_t len, bool do_reflect, uint32_t crc = 0);
 
-        const uint8_t *end;
+      //! Compute the CRC-32 of a given data buffer one byte at a
+      //! time. This is the reference implementation.
+      //! @param buf data buffer.
+      //! @param len data buffer length.
+      //! @param do_reflect if true, the input bytes are reflected.
+      //! @param crc CRC-32 value to update.
+      //! @return computed CRC-32.
+      static inline uint32_t
+      computeReference(const uint8_t* buf, size_t len, bool do_reflect, uint32_t crc = 0)
+      {
+        const uint8_t* end;
         uint8_t data;
 
         crc = ~crc;
         for (end = buf + len; buf < end; ++buf)
         {
-          data = do_reflect? reflect(*buf,8) : *buf;
+          data = do_reflect ? reflect(*buf, 8) : *buf;
           crc = c_crc32_table[(crc ^ data) & 0xff] ^ (crc >> 8);
         }
         return ~crc;
       }
+
+      //! Compute the CRC-32 of a given data buffer eight bytes at a
+      //! time (slicing-by-8).
+      //! @param buf data buffer.
+      //! @param len data buffer length.
+      //! @param do_reflect if true, the input bytes are reflected.
+      //! @param crc CRC-32 value to update.
+      //! @return computed CRC-32.
+      static uint32_t
+      computeSlicing8(const uint8_t* buf, size_t len, bool do_reflect, uint32_t crc = 0);
+
+      //! Retrieve the name of the implementation used by compute()
+      //! for non-reflected input.
+      //! @return implementation name.
+      static const char*
+      getImplementation(void);
     };
   }
 }
@@ -44,8 +44,16 @@ namespace DUNE
 #include <DUNE/Compression/Factory.hpp>
 #include <DUNE/Compression/GzipCompressor.hpp>
 #include <DUNE/Compression/Bzip2Compressor.hpp>
+#include <DUNE/Compression/Lz4Compressor.hpp>
+#include <DUNE/Compression/BlockCompressor.hpp>
 #include <DUNE/Compression/ZlibCompressor.hpp>
 #include <DUNE/Compression/Bzip2Decompressor.hpp>
+#include <DUNE/Compression/Lz4Decompressor.hpp>
+#include <DUNE/Compression/BlockDecompressor.hpp>
+#include <DUNE/Compression/BlockHeader.hpp>
+#include <DUNE/Compression/BlockReader.hpp>
+#include <DUNE/Compression/BlockBuffer.hpp>
+#include <DUNE/Compression/ParallelCompressor.hpp>
 #include <DUNE/Compression/ZlibDecompressor.hpp>
 #include <DUNE/Compression/StreamBuffer.hpp>
 #include <DUNE/Compression/FilterInput.hpp>
@@ -0,0 +1,325 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <exception>
+
+// DUNE headers.
+#include <DUNE/Compression/BlockBuffer.hpp>
+#include <DUNE/Concurrency/Scheduler.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! Worker thread decompressing blocks ahead of the reader.
+    class BlockBufferWorker: public Concurrency::Thread
+    {
+    public:
+      BlockBufferWorker(BlockBuffer& parent):
+        m_parent(parent)
+      { }
+
+    private:
+      //! Parent buffer.
+      BlockBuffer& m_parent;
+
+      void
+      run(void)
+      {
+        size_t index = 0;
+        unsigned generation = 0;
+
+        while (m_parent.take(index, generation))
+          m_parent.complete(index, generation, m_parent.decode(index));
+      }
+    };
+
+    //! Compare a block with an offset in the uncompressed data.
+    static bool
+    rawOffsetLess(uint64_t offset, const BlockReader::Block& block)
+    {
+      return offset < block.raw_offset;
+    }
+
+    //! Compare a block with an offset in the file.
+    static bool
+    fileOffsetLess(const BlockReader::Block& block, uint64_t offset)
+    {
+      return block.offset < offset;
+    }
+
+    //! Retrieve the size of the uncompressed data of a file.
+    static uint64_t
+    getRawSize(const std::vector<BlockReader::Block>& blocks)
+    {
+      if (blocks.empty())
+        return 0;
+
+      return blocks.back().raw_offset + blocks.back().header.raw_size;
+    }
+
+    BlockBuffer::BlockBuffer(const std::string& path, unsigned threads):
+      m_reader(path),
+      m_window(0),
+      m_read(0),
+      m_assign(0),
+      m_generation(0),
+      m_stopping(false),
+      m_base(0),
+      m_corrupted(0)
+    {
+      if (threads == 0)
+        threads = Concurrency::Scheduler::getProcessorCount();
+
+      if (threads <= 1)
+        return;
+
+      m_window = threads * 2;
+      for (unsigned i = 0; i < threads; ++i)
+      {
+        m_workers.push_back(new BlockBufferWorker(*this));
+        m_workers.back()->start();
+      }
+    }
+
+    BlockBuffer::~BlockBuffer(void)
+    {
+      m_cond.lock();
+      m_stopping = true;
+      m_cond.broadcast();
+      m_cond.unlock();
+
+      for (unsigned i = 0; i < m_workers.size(); ++i)
+      {
+        m_workers[i]->stopAndJoin();
+        delete m_workers[i];
+      }
+
+      std::map<size_t, Slot*>::iterator itr = m_done.begin();
+      for (; itr != m_done.end(); ++itr)
+        delete itr->second;
+    }
+
+    bool
+    BlockBuffer::seekBlock(uint64_t offset)
+    {
+      const std::vector<BlockReader::Block>& blocks = m_reader.getBlocks();
+      std::vector<BlockReader::Block>::const_iterator itr
+        = std::lower_bound(blocks.begin(), blocks.end(), offset, fileOffsetLess);
+
+      if (itr == blocks.end() || itr->offset != offset)
+        return false;
+
+      restart(itr - blocks.begin());
+      return true;
+    }
+
+    BlockBuffer::int_type
+    BlockBuffer::underflow(void)
+    {
+      if (gptr() < egptr())
+        return traits_type::to_int_type(*gptr());
+
+      if (!loadBlock())
+        return traits_type::eof();
+
+      return traits_type::to_int_type(*gptr());
+    }
+
+    BlockBuffer::pos_type
+    BlockBuffer::seekoff(off_type off, std::ios_base::seekdir way, std::ios_base::openmode which)
+    {
+      if (way == std::ios_base::cur)
+        off += getOffset();
+      else if (way == std::ios_base::end)
+        off += getRawSize(m_reader.getBlocks());
+
+      return seekpos(pos_type(off), which);
+    }
+
+    BlockBuffer::pos_type
+    BlockBuffer::seekpos(pos_type pos, std::ios_base::openmode which)
+    {
+      if (!(which & std::ios_base::in) || off_type(pos) < 0)
+        return pos_type(off_type(-1));
+
+      uint64_t target = off_type(pos);
+
+      // No need to restart when moving within the current block.
+      if (eback() != NULL && target >= m_base && target < m_base + m_data.size())
+      {
+        setg(eback(), eback() + (target - m_base), egptr());
+        return pos;
+      }
+
+      const std::vector<BlockReader::Block>& blocks = m_reader.getBlocks();
+      size_t index = std::upper_bound(blocks.begin(), blocks.end(), target, rawOffsetLess) - blocks.begin();
+      restart(index > 0 ? index - 1 : 0);
+
+      // Positions inside damaged blocks move to the next intact one.
+      if (loadBlock() && target > m_base)
+        gbump((int)std::min(target - m_base, (uint64_t)m_data.size()));
+
+      return pos_type(off_type(getOffset()));
+    }
+
+    bool
+    BlockBuffer::loadBlock(void)
+    {
+      const std::vector<BlockReader::Block>& blocks = m_reader.getBlocks();
+
+      while (true)
+      {
+        Slot* slot = NULL;
+        size_t index = 0;
+
+        if (m_workers.empty())
+        {
+          if (m_read >= blocks.size())
+            break;
+
+          index = m_read++;
+          slot = decode(index);
+        }
+        else
+        {
+          Concurrency::ScopedCondition l(m_cond);
+          if (m_read >= blocks.size())
+            break;
+
+          index = m_read;
+          std::map<size_t, Slot*>::iterator itr;
+          while ((itr = m_done.find(index)) == m_done.end())
+            m_cond.wait();
+
+          slot = itr->second;
+          m_done.erase(itr);
+          ++m_read;
+          m_cond.broadcast();
+        }
+
+        m_base = blocks[index].raw_offset;
+        if (slot->corrupted)
+          ++m_corrupted;
+        else
+          m_data.swap(slot->data);
+
+        bool skip = slot->corrupted || m_data.empty();
+        delete slot;
+
+        if (skip)
+          continue;
+
+        setg(&m_data[0], &m_data[0], &m_data[0] + m_data.size());
+        return true;
+      }
+
+      m_data.clear();
+      m_base = getRawSize(blocks);
+      setg(NULL, NULL, NULL);
+      return false;
+    }
+
+    void
+    BlockBuffer::restart(size_t index)
+    {
+      {
+        Concurrency::ScopedCondition l(m_cond);
+
+        std::map<size_t, Slot*>::iterator itr = m_done.begin();
+        for (; itr != m_done.end(); ++itr)
+          delete itr->second;
+
+        m_done.clear();
+        m_read = index;
+        m_assign = index;
+        ++m_generation;
+        m_cond.broadcast();
+      }
+
+      const std::vector<BlockReader::Block>& blocks = m_reader.getBlocks();
+      m_data.clear();
+      m_base = (index < blocks.size()) ? blocks[index].raw_offset : getRawSize(blocks);
+      setg(NULL, NULL, NULL);
+    }
+
+    bool
+    BlockBuffer::take(size_t& index, unsigned& generation)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      size_t count = m_reader.getBlocks().size();
+
+      while (!m_stopping && (m_assign >= count || m_assign >= m_read + m_window))
+        m_cond.wait();
+
+      if (m_stopping)
+        return false;
+
+      index = m_assign++;
+      generation = m_generation;
+      return true;
+    }
+
+    void
+    BlockBuffer::complete(size_t index, unsigned generation, Slot* slot)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      if (generation != m_generation)
+      {
+        delete slot;
+        return;
+      }
+
+      m_done[index] = slot;
+      m_cond.broadcast();
+    }
+
+    BlockBuffer::Slot*
+    BlockBuffer::decode(size_t index)
+    {
+      Slot* slot = new Slot;
+      slot->corrupted = false;
+
+      try
+      {
+        m_reader.read(index, slot->data);
+      }
+      catch (std::exception&)
+      {
+        slot->corrupted = true;
+        slot->data.clear();
+      }
+
+      return slot;
+    }
+  }
+}
@@ -0,0 +1,194 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_BLOCK_BUFFER_HPP_INCLUDED_
+#define DUNE_COMPRESSION_BLOCK_BUFFER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/BlockReader.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Forward declarations.
+    class BlockBufferWorker;
+
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM BlockBuffer;
+
+    //! Input stream buffer over a block container file (see
+    //! BlockHeader). Blocks are located with a BlockReader and
+    //! decompressed ahead of the reader by a pool of threads.
+    //! Damaged blocks are skipped instead of ending the stream, the
+    //! data of every intact block is delivered in order. The stream
+    //! position is the offset in the uncompressed data and can be
+    //! set with seekg() or moved to the start of a block.
+    class BlockBuffer: public std::streambuf
+    {
+    public:
+      //! Open a block container file.
+      //! @param[in] path file path.
+      //! @param[in] threads number of decompression threads, zero
+      //! for one per processor. With one thread blocks are
+      //! decompressed on the reader's thread.
+      BlockBuffer(const std::string& path, unsigned threads = 0);
+
+      //! Destructor.
+      ~BlockBuffer(void);
+
+      //! Retrieve the block reader.
+      //! @return block reader.
+      const BlockReader&
+      getReader(void) const
+      {
+        return m_reader;
+      }
+
+      //! Retrieve the number of damaged blocks skipped so far.
+      //! @return number of blocks.
+      unsigned
+      getCorrupted(void) const
+      {
+        return m_corrupted;
+      }
+
+      //! Retrieve the offset of the next byte to be read in the
+      //! uncompressed data.
+      //! @return offset in bytes.
+      uint64_t
+      getOffset(void) const
+      {
+        return m_base + (gptr() - eback());
+      }
+
+      //! Move to the start of a block.
+      //! @param[in] offset offset of the block in the file.
+      //! @return true if a block starts at the given offset, false
+      //! otherwise.
+      bool
+      seekBlock(uint64_t offset);
+
+    protected:
+      virtual int_type
+      underflow(void);
+
+      virtual pos_type
+      seekoff(off_type off, std::ios_base::seekdir way, std::ios_base::openmode which);
+
+      virtual pos_type
+      seekpos(pos_type pos, std::ios_base::openmode which);
+
+    private:
+      //! Decompressed block.
+      struct Slot
+      {
+        //! Uncompressed data.
+        std::vector<char> data;
+        //! True if the block is damaged.
+        bool corrupted;
+      };
+
+      //! Block reader.
+      BlockReader m_reader;
+      //! Worker threads.
+      std::vector<BlockBufferWorker*> m_workers;
+      //! Number of blocks decompressed ahead of the reader.
+      size_t m_window;
+      //! Number of the next block to deliver.
+      size_t m_read;
+      //! Number of the next block to hand to a worker.
+      size_t m_assign;
+      //! Decompressed blocks waiting to be delivered.
+      std::map<size_t, Slot*> m_done;
+      //! Incremented on every seek, results of older requests are
+      //! discarded.
+      unsigned m_generation;
+      //! True if workers must terminate.
+      bool m_stopping;
+      //! Lock and condition protecting the above.
+      Concurrency::Condition m_cond;
+      //! Data of the current block.
+      std::vector<char> m_data;
+      //! Offset of the current block in the uncompressed data.
+      uint64_t m_base;
+      //! Number of damaged blocks skipped.
+      unsigned m_corrupted;
+
+      //! Load the next intact block.
+      //! @return true if a block was loaded, false at the end of the
+      //! file.
+      bool
+      loadBlock(void);
+
+      //! Restart reading at a given block.
+      //! @param[in] index block number.
+      void
+      restart(size_t index);
+
+      //! Wait for a block to decompress.
+      //! @param[out] index block number.
+      //! @param[out] generation seek generation of the request.
+      //! @return true if a block was assigned, false if the worker
+      //! must terminate.
+      bool
+      take(size_t& index, unsigned& generation);
+
+      //! Store a decompressed block.
+      //! @param[in] index block number.
+      //! @param[in] generation seek generation of the request.
+      //! @param[in] slot decompressed block.
+      void
+      complete(size_t index, unsigned generation, Slot* slot);
+
+      //! Decompress a block.
+      //! @param[in] index block number.
+      //! @return decompressed block.
+      Slot*
+      decode(size_t index);
+
+      friend class BlockBufferWorker;
+
+      //! Non - copyable.
+      BlockBuffer(const BlockBuffer&);
+
+      //! Non - assignable.
+      BlockBuffer&
+      operator=(const BlockBuffer&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,103 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Algorithms/CRC32.hpp>
+#include <DUNE/Compression/BlockCompressor.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/Factory.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    BlockCompressor::BlockCompressor(Methods method, int a_level):
+      Compressor(a_level)
+    {
+      if (method == METHOD_BLOCK)
+        throw UnknownMethod(Factory::method(method));
+
+      m_com = Factory::compressor(method);
+      if (m_com == NULL)
+        throw UnknownMethod(Factory::method(method));
+
+      m_com->level(a_level);
+      m_header.method = method;
+    }
+
+    BlockCompressor::~BlockCompressor(void)
+    {
+      delete m_com;
+    }
+
+    void
+    BlockCompressor::setRecords(fp64_t time_first, fp64_t time_last, uint32_t records)
+    {
+      m_header.time_first = time_first;
+      m_header.time_last = time_last;
+      m_header.records = records;
+    }
+
+    unsigned long
+    BlockCompressor::compressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len)
+    {
+      if (src_len == 0)
+        return 0;
+
+      if (dst_len < compressBound(src_len))
+        throw BufferTooShort(dst_len);
+
+      BlockHeader header = m_header;
+      char* data = dst + BlockHeader::c_size;
+
+      m_com->compress(m_bfr, src, src_len);
+      if (m_bfr.getSize() < src_len)
+      {
+        header.data_size = m_bfr.getSize();
+        std::memcpy(data, m_bfr.getBuffer(), header.data_size);
+      }
+      else
+      {
+        header.method = METHOD_UNKNOWN;
+        header.data_size = src_len;
+        std::memcpy(data, src, src_len);
+      }
+
+      header.raw_size = src_len;
+      header.crc = Algorithms::CRC32::compute((const uint8_t*)data, header.data_size, false);
+      header.encode((uint8_t*)dst);
+
+      // Record information applies to a single block.
+      setRecords(0, 0, 0);
+
+      return BlockHeader::c_size + header.data_size;
+    }
+  }
+}
@@ -0,0 +1,96 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_BLOCK_COMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_BLOCK_COMPRESSOR_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Compressor.hpp>
+#include <DUNE/Compression/BlockHeader.hpp>
+#include <DUNE/Compression/Methods.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM BlockCompressor;
+
+    //! Block container compressor. Each call produces one block of
+    //! the block container format (see BlockHeader) with data
+    //! compressed by another method. Data that does not shrink is
+    //! stored uncompressed. Callers that know the contents of the
+    //! block (e.g., LSF records) can describe it with setRecords()
+    //! before compressing.
+    class BlockCompressor: public Compressor
+    {
+    public:
+      //! Constructor.
+      //! @param[in] method compression method of the block data.
+      //! @param[in] a_level compression level.
+      BlockCompressor(Methods method = METHOD_LZ4, int a_level = -1);
+
+      ~BlockCompressor(void);
+
+      //! Describe the records of the next block.
+      //! @param[in] time_first timestamp of the first record.
+      //! @param[in] time_last timestamp of the last record.
+      //! @param[in] records number of records.
+      void
+      setRecords(fp64_t time_first, fp64_t time_last, uint32_t records);
+
+    protected:
+      virtual unsigned long
+      compressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len);
+
+      virtual unsigned long
+      compressBound(unsigned long length) const
+      {
+        return length + BlockHeader::c_size;
+      }
+
+    private:
+      //! Block data compressor.
+      Compressor* m_com;
+      //! Block data compression buffer.
+      Utils::ByteBuffer m_bfr;
+      //! Header of the next block.
+      BlockHeader m_header;
+
+      //! Non - copyable.
+      BlockCompressor(const BlockCompressor&);
+
+      //! Non - assignable.
+      BlockCompressor&
+      operator=(const BlockCompressor&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,161 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Compression/BlockDecompressor.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/Factory.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    BlockDecompressor::BlockDecompressor(void):
+      Decompressor(),
+      m_in_header(true),
+      m_need(BlockHeader::c_size),
+      m_out_idx(0)
+    { }
+
+    void
+    BlockDecompressor::decodeBlock(const BlockHeader& header, const char* data, char* dst)
+    {
+      if (header.method == METHOD_UNKNOWN)
+      {
+        if (header.data_size != header.raw_size)
+          throw CorruptedData();
+
+        std::memcpy(dst, data, header.raw_size);
+        return;
+      }
+
+      // Blocks are independent, use a fresh decompressor for each
+      // one so errors in a block do not propagate to the next.
+      Decompressor* dec = NULL;
+      if (header.method != METHOD_BLOCK)
+        dec = Factory::decompressor(header.method);
+
+      if (dec == NULL)
+        throw CorruptedData();
+
+      char* src = const_cast<char*>(data);
+      unsigned long src_len = header.data_size;
+      unsigned long produced = 0;
+
+      try
+      {
+        while (src_len > 0 || dec->hasPendingOutput())
+        {
+          dec->decompress(dst + produced, header.raw_size - produced, src, src_len);
+          if (dec->processed() == 0 && dec->decompressed() == 0)
+            break;
+
+          src += dec->processed();
+          src_len -= dec->processed();
+          produced += dec->decompressed();
+        }
+      }
+      catch (...)
+      {
+        delete dec;
+        throw;
+      }
+
+      delete dec;
+
+      if (produced != header.raw_size)
+        throw CorruptedData();
+    }
+
+    unsigned long
+    BlockDecompressor::decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len)
+    {
+      unsigned long produced = 0;
+
+      while (true)
+      {
+        // Deliver pending output.
+        if (m_out_idx < m_out.size())
+        {
+          size_t amount = std::min((size_t)(dst_len - produced), m_out.size() - m_out_idx);
+          std::memcpy(dst + produced, &m_out[m_out_idx], amount);
+          m_out_idx += amount;
+          produced += amount;
+
+          if (m_out_idx < m_out.size())
+            break;
+        }
+
+        if (src_len == 0)
+          break;
+
+        size_t amount = std::min((size_t)src_len, (size_t)(m_need - m_in.size()));
+        m_in.insert(m_in.end(), src, src + amount);
+        if (m_in.size() == m_need)
+          process();
+
+        src += amount;
+        src_len -= amount;
+      }
+
+      unprocessed_len = src_len;
+      return produced;
+    }
+
+    void
+    BlockDecompressor::process(void)
+    {
+      if (m_in_header)
+      {
+        if (!m_header.decode((const uint8_t*)&m_in[0]))
+          throw CorruptedData();
+
+        m_in_header = false;
+        m_need = m_header.data_size;
+      }
+      else
+      {
+        if (!m_header.verify((const uint8_t*)&m_in[0]))
+          throw CorruptedData();
+
+        m_out.resize(m_header.raw_size);
+        if (!m_out.empty())
+          decodeBlock(m_header, &m_in[0], &m_out[0]);
+
+        m_out_idx = 0;
+        m_in_header = true;
+        m_need = BlockHeader::c_size;
+      }
+
+      m_in.clear();
+    }
+  }
+}
@@ -0,0 +1,96 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_BLOCK_DECOMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_BLOCK_DECOMPRESSOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Decompressor.hpp>
+#include <DUNE/Compression/BlockHeader.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM BlockDecompressor;
+
+    //! Block container decompressor. Accepts a sequence of blocks
+    //! as produced by BlockCompressor (see BlockHeader). The
+    //! checksum of each block is verified before decompression. An
+    //! incomplete last block, as left by an interrupted writer,
+    //! produces no output.
+    class BlockDecompressor: public Decompressor
+    {
+    public:
+      BlockDecompressor(void);
+
+      virtual bool
+      hasPendingOutput(void) const
+      {
+        return m_out_idx < m_out.size();
+      }
+
+      //! Decompress the data of a block. This function is reentrant
+      //! and can be used to decompress blocks in parallel.
+      //! @param[in] header block header.
+      //! @param[in] data compressed data (header.data_size bytes).
+      //! @param[out] dst destination buffer (header.raw_size bytes).
+      static void
+      decodeBlock(const BlockHeader& header, const char* data, char* dst);
+
+    protected:
+      virtual unsigned long
+      decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len);
+
+    private:
+      //! True if waiting for a block header, false if waiting for
+      //! block data.
+      bool m_in_header;
+      //! Number of bytes needed to leave the current state.
+      unsigned long m_need;
+      //! Header of the current block.
+      BlockHeader m_header;
+      //! Input gathered for the current state.
+      std::vector<char> m_in;
+      //! Data of the last decoded block.
+      std::vector<char> m_out;
+      //! Index of the first undelivered byte in m_out.
+      size_t m_out_idx;
+
+      //! Process a complete input unit for the current state.
+      void
+      process(void);
+    };
+  }
+}
+
+#endif
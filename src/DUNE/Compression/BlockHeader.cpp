@@ -0,0 +1,159 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Algorithms/CRC32.hpp>
+#include <DUNE/Compression/BlockHeader.hpp>
+
+//! Magic number.
+static const uint8_t c_magic[] = {'D', 'B', 'L', 'K'};
+//! Format version.
+static const uint8_t c_version = 1;
+//! Offset of the header checksum.
+static const unsigned c_crc_offset = 40;
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! Method codes, the index of each method is its code.
+    static const Methods c_methods[] =
+    {
+      METHOD_UNKNOWN,
+      METHOD_ZLIB,
+      METHOD_GZIP,
+      METHOD_BZIP2,
+      METHOD_LZ4
+    };
+
+    //! Number of method codes.
+    static const unsigned c_methods_count = sizeof(c_methods) / sizeof(c_methods[0]);
+
+    static void
+    encodeLE(uint8_t* dst, uint64_t value, unsigned size)
+    {
+      for (unsigned i = 0; i < size; ++i)
+        dst[i] = (uint8_t)(value >> (8 * i));
+    }
+
+    static uint64_t
+    decodeLE(const uint8_t* src, unsigned size)
+    {
+      uint64_t value = 0;
+      for (unsigned i = 0; i < size; ++i)
+        value |= (uint64_t)src[i] << (8 * i);
+      return value;
+    }
+
+    static void
+    encodeDouble(uint8_t* dst, fp64_t value)
+    {
+      uint64_t bits = 0;
+      std::memcpy(&bits, &value, sizeof(bits));
+      encodeLE(dst, bits, sizeof(bits));
+    }
+
+    static fp64_t
+    decodeDouble(const uint8_t* src)
+    {
+      uint64_t bits = decodeLE(src, sizeof(bits));
+      fp64_t value = 0;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+
+    BlockHeader::BlockHeader(void):
+      method(METHOD_UNKNOWN),
+      raw_size(0),
+      data_size(0),
+      time_first(0),
+      time_last(0),
+      records(0),
+      crc(0)
+    { }
+
+    bool
+    BlockHeader::isMagic(const uint8_t* bfr)
+    {
+      return std::memcmp(bfr, c_magic, sizeof(c_magic)) == 0;
+    }
+
+    void
+    BlockHeader::encode(uint8_t* bfr) const
+    {
+      uint8_t code = 0;
+      for (unsigned i = 0; i < c_methods_count; ++i)
+      {
+        if (c_methods[i] == method)
+          code = i;
+      }
+
+      std::memcpy(bfr, c_magic, sizeof(c_magic));
+      bfr[4] = c_version;
+      bfr[5] = code;
+      bfr[6] = 0;
+      bfr[7] = 0;
+      encodeLE(bfr + 8, raw_size, 4);
+      encodeLE(bfr + 12, data_size, 4);
+      encodeDouble(bfr + 16, time_first);
+      encodeDouble(bfr + 24, time_last);
+      encodeLE(bfr + 32, records, 4);
+      encodeLE(bfr + 36, crc, 4);
+      encodeLE(bfr + c_crc_offset, Algorithms::CRC32::compute(bfr, c_crc_offset, false), 4);
+    }
+
+    bool
+    BlockHeader::decode(const uint8_t* bfr)
+    {
+      if (!isMagic(bfr) || bfr[4] != c_version || bfr[5] >= c_methods_count)
+        return false;
+
+      if (decodeLE(bfr + c_crc_offset, 4) != Algorithms::CRC32::compute(bfr, c_crc_offset, false))
+        return false;
+
+      method = c_methods[bfr[5]];
+      raw_size = (uint32_t)decodeLE(bfr + 8, 4);
+      data_size = (uint32_t)decodeLE(bfr + 12, 4);
+      time_first = decodeDouble(bfr + 16);
+      time_last = decodeDouble(bfr + 24);
+      records = (uint32_t)decodeLE(bfr + 32, 4);
+      crc = (uint32_t)decodeLE(bfr + 36, 4);
+
+      // Empty blocks are never written.
+      return data_size > 0;
+    }
+
+    bool
+    BlockHeader::verify(const uint8_t* data) const
+    {
+      return Algorithms::CRC32::compute(data, data_size, false) == crc;
+    }
+  }
+}
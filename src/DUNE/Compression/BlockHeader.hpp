@@ -0,0 +1,106 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_BLOCK_HEADER_HPP_INCLUDED_
+#define DUNE_COMPRESSION_BLOCK_HEADER_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Methods.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    struct DUNE_DLL_SYM BlockHeader;
+
+    //! Header of a block of the block container format. The
+    //! container is a sequence of blocks, each made of this header
+    //! followed by data compressed independently of other blocks,
+    //! so blocks can be located without decompressing the file,
+    //! decompressed in parallel and recovered individually if the
+    //! file is damaged or truncated.
+    //!
+    //! The header is made of the following little endian fields:
+    //! magic number ("DBLK", 4 bytes), version (1 byte), compression
+    //! method (1 byte, zero if stored), reserved (2 bytes),
+    //! uncompressed size (4 bytes), compressed size (4 bytes),
+    //! timestamp of the first and last records (8 bytes each),
+    //! number of records (4 bytes), CRC-32 of the compressed data (4
+    //! bytes) and CRC-32 of the previous fields (4 bytes).
+    struct BlockHeader
+    {
+      //! Size of an encoded header.
+      static const unsigned c_size = 44;
+
+      //! Compression method or METHOD_UNKNOWN if the data is stored
+      //! uncompressed.
+      Methods method;
+      //! Size of the uncompressed data.
+      uint32_t raw_size;
+      //! Size of the compressed data.
+      uint32_t data_size;
+      //! Timestamp of the first record.
+      fp64_t time_first;
+      //! Timestamp of the last record.
+      fp64_t time_last;
+      //! Number of records.
+      uint32_t records;
+      //! CRC-32 of the compressed data.
+      uint32_t crc;
+
+      BlockHeader(void);
+
+      //! Test if a buffer starts with the block magic number.
+      //! @param[in] bfr buffer with at least four bytes.
+      //! @return true if the magic number is present, false otherwise.
+      static bool
+      isMagic(const uint8_t* bfr);
+
+      //! Encode the header.
+      //! @param[out] bfr buffer with at least c_size bytes.
+      void
+      encode(uint8_t* bfr) const;
+
+      //! Decode a header.
+      //! @param[in] bfr buffer with at least c_size bytes.
+      //! @return true if the header is valid, false otherwise.
+      bool
+      decode(const uint8_t* bfr);
+
+      //! Verify the compressed data of the block.
+      //! @param[in] data compressed data (data_size bytes).
+      //! @return true if the data matches the checksum, false
+      //! otherwise.
+      bool
+      verify(const uint8_t* data) const;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,147 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cerrno>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Compression/BlockReader.hpp>
+#include <DUNE/Compression/BlockDecompressor.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/System/Error.hpp>
+
+//! Size of the chunks read while searching for headers.
+static const size_t c_search_size = 64 * 1024;
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    BlockReader::BlockReader(const std::string& path):
+      m_ifs(path.c_str(), std::ios::binary),
+      m_size(0),
+      m_skipped(0),
+      m_truncated(false)
+    {
+      if (!m_ifs.is_open())
+        throw System::Error(errno, "unable to open file", path);
+
+      m_ifs.seekg(0, std::ios::end);
+      m_size = m_ifs.tellg();
+      scan();
+    }
+
+    void
+    BlockReader::read(size_t index, std::vector<char>& data)
+    {
+      const Block& block = m_blocks[index];
+      std::vector<char> bfr(block.header.data_size);
+
+      if (readAt(block.offset + BlockHeader::c_size, &bfr[0], bfr.size()) != bfr.size())
+        throw CorruptedData();
+
+      if (!block.header.verify((const uint8_t*)&bfr[0]))
+        throw CorruptedData();
+
+      data.resize(block.header.raw_size);
+      if (!data.empty())
+        BlockDecompressor::decodeBlock(block.header, &bfr[0], &data[0]);
+    }
+
+    void
+    BlockReader::scan(void)
+    {
+      uint64_t offset = 0;
+      uint64_t raw_offset = 0;
+
+      while (offset < m_size)
+      {
+        Block block;
+        uint64_t next = findHeader(offset, block.header);
+        m_skipped += next - offset;
+
+        if (next == m_size)
+          break;
+
+        uint64_t end = next + BlockHeader::c_size + block.header.data_size;
+        if (end > m_size)
+        {
+          // Block being written when the file was closed.
+          m_truncated = true;
+          m_skipped += m_size - next;
+          break;
+        }
+
+        block.offset = next;
+        block.raw_offset = raw_offset;
+        m_blocks.push_back(block);
+
+        raw_offset += block.header.raw_size;
+        offset = end;
+      }
+    }
+
+    uint64_t
+    BlockReader::findHeader(uint64_t offset, BlockHeader& header)
+    {
+      std::vector<char> bfr(c_search_size + BlockHeader::c_size);
+
+      while (offset + BlockHeader::c_size <= m_size)
+      {
+        size_t size = readAt(offset, &bfr[0], bfr.size());
+        size_t last = size - BlockHeader::c_size;
+
+        for (size_t i = 0; i <= last; ++i)
+        {
+          const uint8_t* ptr = (const uint8_t*)&bfr[i];
+          if (BlockHeader::isMagic(ptr) && header.decode(ptr))
+            return offset + i;
+        }
+
+        offset += last + 1;
+      }
+
+      // Trailing bytes too short to hold a header.
+      if (offset < m_size)
+        m_truncated = true;
+
+      return m_size;
+    }
+
+    size_t
+    BlockReader::readAt(uint64_t offset, char* bfr, size_t size)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      m_ifs.clear();
+      m_ifs.seekg(offset);
+      m_ifs.read(bfr, size);
+      return m_ifs.gcount();
+    }
+  }
+}
@@ -0,0 +1,149 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_BLOCK_READER_HPP_INCLUDED_
+#define DUNE_COMPRESSION_BLOCK_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/BlockHeader.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM BlockReader;
+
+    //! Random access reader of block container files (see
+    //! BlockHeader). Blocks are located by walking the headers,
+    //! without reading the data. Damaged regions are skipped by
+    //! searching for the next valid header and an incomplete last
+    //! block is ignored, so every intact block of a damaged or
+    //! truncated file can be recovered. Blocks can be read by
+    //! multiple threads concurrently, only file access is
+    //! serialized.
+    class BlockReader
+    {
+    public:
+      //! Block location.
+      struct Block
+      {
+        //! Block header.
+        BlockHeader header;
+        //! Offset of the block in the file.
+        uint64_t offset;
+        //! Offset of the block data in the uncompressed stream.
+        uint64_t raw_offset;
+      };
+
+      //! Open a file and locate its blocks.
+      //! @param[in] path file path.
+      BlockReader(const std::string& path);
+
+      //! Retrieve located blocks.
+      //! @return blocks.
+      const std::vector<Block>&
+      getBlocks(void) const
+      {
+        return m_blocks;
+      }
+
+      //! Retrieve the number of bytes that did not belong to any
+      //! valid block.
+      //! @return number of bytes.
+      uint64_t
+      getSkipped(void) const
+      {
+        return m_skipped;
+      }
+
+      //! Test if the last block of the file is incomplete.
+      //! @return true if the file is truncated, false otherwise.
+      bool
+      isTruncated(void) const
+      {
+        return m_truncated;
+      }
+
+      //! Read and decompress a block. This function is thread safe.
+      //! @param[in] index block number.
+      //! @param[out] data uncompressed block data.
+      //! @throw CorruptedData if the block data is damaged.
+      void
+      read(size_t index, std::vector<char>& data);
+
+    private:
+      //! File.
+      std::ifstream m_ifs;
+      //! Mutex serializing file access.
+      Concurrency::Mutex m_mutex;
+      //! File size.
+      uint64_t m_size;
+      //! Located blocks.
+      std::vector<Block> m_blocks;
+      //! Number of bytes outside of valid blocks.
+      uint64_t m_skipped;
+      //! True if the last block is incomplete.
+      bool m_truncated;
+
+      //! Locate blocks.
+      void
+      scan(void);
+
+      //! Find the next valid header.
+      //! @param[in] offset offset where to start searching.
+      //! @param[out] header header found.
+      //! @return offset of the header or the file size if none.
+      uint64_t
+      findHeader(uint64_t offset, BlockHeader& header);
+
+      //! Read from the file.
+      //! @param[in] offset file offset.
+      //! @param[out] bfr destination buffer.
+      //! @param[in] size number of bytes to read.
+      //! @return number of bytes read.
+      size_t
+      readAt(uint64_t offset, char* bfr, size_t size);
+
+      //! Non - copyable.
+      BlockReader(const BlockReader&);
+
+      //! Non - assignable.
+      BlockReader&
+      operator=(const BlockReader&);
+    };
+  }
+}
+
+#endif
@@ -95,6 +95,16 @@ namespace DUNE
         return m_unprocessed;
       }
 
+      //! Test if the decompressor holds output that could not be
+      //! delivered in previous calls, i.e., more data can be
+      //! obtained without supplying further input.
+      //! @return true if there is pending output, false otherwise.
+      virtual bool
+      hasPendingOutput(void) const
+      {
+        return false;
+      }
+
     protected:
       virtual unsigned long
       decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len) = 0;
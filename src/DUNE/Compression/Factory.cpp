@@ -36,8 +36,13 @@
 #include <DUNE/Compression/ZlibCompressor.hpp>
 #include <DUNE/Compression/GzipCompressor.hpp>
 #include <DUNE/Compression/Bzip2Compressor.hpp>
+#include <DUNE/Compression/Lz4Compressor.hpp>
+#include <DUNE/Compression/BlockCompressor.hpp>
 #include <DUNE/Compression/ZlibDecompressor.hpp>
 #include <DUNE/Compression/Bzip2Decompressor.hpp>
+#include <DUNE/Compression/Lz4Decompressor.hpp>
+#include <DUNE/Compression/BlockDecompressor.hpp>
+#include <DUNE/Compression/BlockHeader.hpp>
 #include <DUNE/Compression/Factory.hpp>
 
 namespace DUNE
@@ -56,6 +61,12 @@ namespace DUNE
       if (name == "bzip2")
         return METHOD_BZIP2;
 
+      if (name == "lz4")
+        return METHOD_LZ4;
+
+      if (name == "block")
+        return METHOD_BLOCK;
+
       return METHOD_UNKNOWN;
     }
 
@@ -70,6 +81,10 @@ namespace DUNE
           return "gzip";
         case METHOD_BZIP2:
           return "bzip2";
+        case METHOD_LZ4:
+          return "lz4";
+        case METHOD_BLOCK:
+          return "block";
         case METHOD_UNKNOWN:
           break;
       }
@@ -88,6 +103,10 @@ namespace DUNE
           return ".gz";
         case METHOD_BZIP2:
           return ".bz2";
+        case METHOD_LZ4:
+          return ".lz4";
+        case METHOD_BLOCK:
+          return ".blk";
         case METHOD_UNKNOWN:
           break;
       }
@@ -105,9 +124,9 @@ namespace DUNE
     Factory::detect(const char* fname)
     {
       std::ifstream ifs(fname, std::ios::binary);
-      uint8_t bfr[2] = {0};
+      uint8_t bfr[4] = {0};
 
-      ifs.read((char*)bfr, 2);
+      ifs.read((char*)bfr, 4);
 
       if (std::memcmp("\x1f\x8b", bfr, 2) == 0)
         return METHOD_GZIP;
@@ -118,6 +137,12 @@ namespace DUNE
       if (std::memcmp("BZ", bfr, 2) == 0)
         return METHOD_BZIP2;
 
+      if (std::memcmp("\x04\x22\x4d\x18", bfr, 4) == 0)
+        return METHOD_LZ4;
+
+      if (BlockHeader::isMagic(bfr))
+        return METHOD_BLOCK;
+
       return METHOD_UNKNOWN;
     }
 
@@ -132,6 +157,10 @@ namespace DUNE
           return new GzipCompressor;
         case METHOD_BZIP2:
           return new Bzip2Compressor;
+        case METHOD_LZ4:
+          return new Lz4Compressor;
+        case METHOD_BLOCK:
+          return new BlockCompressor;
         default:
           break;
       }
@@ -156,6 +185,10 @@ namespace DUNE
           return new ZlibDecompressor(true);
         case METHOD_BZIP2:
           return new Bzip2Decompressor;
+        case METHOD_LZ4:
+          return new Lz4Decompressor;
+        case METHOD_BLOCK:
+          return new BlockDecompressor;
         default:
           break;
       }
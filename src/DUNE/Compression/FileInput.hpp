@@ -35,6 +35,7 @@
 #include <fstream>
 
 // DUNE headers.
+#include <DUNE/Compression/BlockBuffer.hpp>
 #include <DUNE/Compression/StreamBuffer.hpp>
 #include <DUNE/Compression/Methods.hpp>
 
@@ -42,21 +43,41 @@ namespace DUNE
 {
   namespace Compression
   {
+    //! Decompressing file input stream. Block container files are
+    //! read with a BlockBuffer, which decompresses blocks in
+    //! parallel and skips damaged ones.
     class FileInput: public std::istream
     {
     public:
       FileInput(const char* filename, Methods method):
         std::istream(0),
         m_method(method),
-        m_stream(filename, std::ios::binary | std::ios::in),
-        m_buffer(0)
+        m_buffer(0),
+        m_blocks(0)
       {
-        attach(m_stream);
+        if (method != METHOD_BLOCK)
+        {
+          m_stream.open(filename, std::ios::binary | std::ios::in);
+          attach(m_stream);
+          return;
+        }
+
+        try
+        {
+          m_blocks = new BlockBuffer(filename);
+          rdbuf(m_blocks);
+        }
+        catch (std::exception&)
+        {
+          setstate(std::ios::badbit);
+        }
       }
 
       ~FileInput(void)
       {
+        rdbuf(0);
         delete m_buffer;
+        delete m_blocks;
       }
 
       void
@@ -73,6 +94,7 @@ namespace DUNE
       Methods m_method;
       std::ifstream m_stream;
       StreamBuffer* m_buffer;
+      BlockBuffer* m_blocks;
     };
   }
 }
@@ -48,6 +48,26 @@ namespace DUNE
       FileOutput(const char* filename, Methods method):
         std::ostream(0),
         m_method(method),
+        m_threads(1),
+        m_budget(0),
+        m_stream(filename, std::ios::binary | std::ios::out),
+        m_buffer(0)
+      {
+        attach(m_stream);
+      }
+
+      //! Create a compressed file written by a pool of compression
+      //! threads.
+      //! @param[in] filename file name.
+      //! @param[in] method compression method.
+      //! @param[in] threads number of compression threads.
+      //! @param[in] budget maximum number of uncompressed bytes in
+      //! flight, zero for a default based on the number of threads.
+      FileOutput(const char* filename, Methods method, unsigned threads, size_t budget = 0):
+        std::ostream(0),
+        m_method(method),
+        m_threads(threads),
+        m_budget(budget),
         m_stream(filename, std::ios::binary | std::ios::out),
         m_buffer(0)
       {
@@ -65,12 +85,14 @@ namespace DUNE
         if (m_buffer)
           delete m_buffer;
 
-        m_buffer = new StreamBuffer(&stream, m_method);
+        m_buffer = new StreamBuffer(&stream, m_method, m_threads, m_budget);
         rdbuf(m_buffer);
       }
 
     protected:
       Methods m_method;
+      unsigned m_threads;
+      size_t m_budget;
       std::ofstream m_stream;
       StreamBuffer* m_buffer;
     };
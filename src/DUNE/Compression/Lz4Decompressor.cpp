@@ -0,0 +1,269 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/Lz4Decompressor.hpp>
+
+// LZ4 headers.
+#include <lz4/lz4.h>
+#include <lz4/xxhash.h>
+
+//! Frame magic number.
+static const uint32_t c_magic = 0x184D2204;
+//! Skippable frame magic number (lower four bits are user defined).
+static const uint32_t c_magic_skip = 0x184D2A50;
+//! Flag used to signal uncompressed blocks.
+static const uint32_t c_raw_flag = 0x80000000;
+//! Size of the history kept for linked blocks.
+static const unsigned long c_dict_size = 64 * 1024;
+//! Frame descriptor: block independence flag.
+static const uint8_t c_flag_indep = 0x20;
+//! Frame descriptor: block checksum flag.
+static const uint8_t c_flag_block_sum = 0x10;
+//! Frame descriptor: content size flag.
+static const uint8_t c_flag_size = 0x08;
+//! Frame descriptor: content checksum flag.
+static const uint8_t c_flag_content_sum = 0x04;
+//! Frame descriptor: dictionary id flag.
+static const uint8_t c_flag_dict = 0x01;
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    static uint32_t
+    decodeLE(const char* src)
+    {
+      const uint8_t* p = (const uint8_t*)src;
+      return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    Lz4Decompressor::Lz4Decompressor(void):
+      Decompressor(),
+      m_state(ST_MAGIC),
+      m_need(4),
+      m_flags(0),
+      m_block_max(0),
+      m_block_raw(false),
+      m_out(c_dict_size, 0),
+      m_out_idx(c_dict_size)
+    { }
+
+    unsigned long
+    Lz4Decompressor::decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len)
+    {
+      unsigned long produced = 0;
+
+      while (true)
+      {
+        // Deliver pending output.
+        if (m_out_idx < m_out.size())
+        {
+          size_t amount = std::min((size_t)(dst_len - produced), m_out.size() - m_out_idx);
+          std::memcpy(dst + produced, &m_out[m_out_idx], amount);
+          m_out_idx += amount;
+          produced += amount;
+
+          if (m_out_idx < m_out.size())
+            break;
+        }
+
+        if (src_len == 0)
+          break;
+
+        size_t amount = std::min((size_t)src_len, (size_t)(m_need - m_in.size()));
+
+        if (m_state == ST_SKIP_DATA)
+        {
+          m_need -= amount;
+          if (m_need == 0)
+          {
+            m_state = ST_MAGIC;
+            m_need = 4;
+          }
+        }
+        else
+        {
+          m_in.insert(m_in.end(), src, src + amount);
+          if (m_in.size() == m_need)
+            process();
+        }
+
+        src += amount;
+        src_len -= amount;
+      }
+
+      unprocessed_len = src_len;
+      return produced;
+    }
+
+    void
+    Lz4Decompressor::process(void)
+    {
+      switch (m_state)
+      {
+        case ST_MAGIC:
+          {
+            uint32_t magic = decodeLE(&m_in[0]);
+            if (magic == c_magic)
+            {
+              m_state = ST_DESCRIPTOR;
+              m_need = 2;
+            }
+            else if ((magic & 0xfffffff0) == c_magic_skip)
+            {
+              m_state = ST_SKIP_SIZE;
+              m_need = 4;
+            }
+            else
+            {
+              throw CorruptedData();
+            }
+          }
+          break;
+
+        case ST_DESCRIPTOR:
+          {
+            uint8_t flags = (uint8_t)m_in[0];
+            unsigned long size = 3;
+            if (flags & c_flag_size)
+              size += 8;
+            if (flags & c_flag_dict)
+              size += 4;
+
+            // Wait for the remainder of the descriptor.
+            if (m_need < size)
+            {
+              m_need = size;
+              return;
+            }
+
+            if ((flags >> 6) != 1 || (flags & c_flag_dict))
+              throw CorruptedData();
+
+            uint8_t hc = (uint8_t)((XXH32(&m_in[0], size - 1, 0) >> 8) & 0xff);
+            if (hc != (uint8_t)m_in[size - 1])
+              throw CorruptedData();
+
+            unsigned bsid = ((uint8_t)m_in[1] >> 4) & 0x07;
+            if (bsid < 4)
+              throw CorruptedData();
+
+            m_flags = flags;
+            m_block_max = 1UL << (8 + 2 * bsid);
+            m_state = ST_BLOCK_SIZE;
+            m_need = 4;
+          }
+          break;
+
+        case ST_BLOCK_SIZE:
+          {
+            uint32_t size = decodeLE(&m_in[0]);
+            if (size == 0)
+            {
+              m_state = (m_flags & c_flag_content_sum) ? ST_CHECKSUM : ST_MAGIC;
+              m_need = 4;
+              break;
+            }
+
+            m_block_raw = (size & c_raw_flag) != 0;
+            size &= ~c_raw_flag;
+            if (size > m_block_max)
+              throw CorruptedData();
+
+            m_state = ST_BLOCK_DATA;
+            m_need = size;
+            if (m_flags & c_flag_block_sum)
+              m_need += 4;
+          }
+          break;
+
+        case ST_BLOCK_DATA:
+          {
+            unsigned long size = m_need;
+            if (m_flags & c_flag_block_sum)
+            {
+              size -= 4;
+              if (XXH32(&m_in[0], size, 0) != decodeLE(&m_in[size]))
+                throw CorruptedData();
+            }
+
+            // Keep the last 64 KiB of output as history for linked
+            // blocks; the output buffer has been fully delivered.
+            std::memmove(&m_out[0], &m_out[m_out.size() - c_dict_size], c_dict_size);
+            m_out.resize(c_dict_size + m_block_max);
+
+            int rv = 0;
+            if (m_block_raw)
+            {
+              std::memcpy(&m_out[c_dict_size], &m_in[0], size);
+              rv = size;
+            }
+            else if (m_flags & c_flag_indep)
+            {
+              rv = LZ4_decompress_safe(&m_in[0], &m_out[c_dict_size], size, m_block_max);
+            }
+            else
+            {
+              rv = LZ4_decompress_safe_withPrefix64k(&m_in[0], &m_out[c_dict_size], size, m_block_max);
+            }
+
+            if (rv < 0)
+              throw CorruptedData();
+
+            m_out.resize(c_dict_size + rv);
+            m_out_idx = c_dict_size;
+            m_state = ST_BLOCK_SIZE;
+            m_need = 4;
+          }
+          break;
+
+        case ST_CHECKSUM:
+          m_state = ST_MAGIC;
+          m_need = 4;
+          break;
+
+        case ST_SKIP_SIZE:
+          m_need = decodeLE(&m_in[0]);
+          m_state = (m_need == 0) ? ST_MAGIC : ST_SKIP_DATA;
+          if (m_need == 0)
+            m_need = 4;
+          break;
+
+        case ST_SKIP_DATA:
+          break;
+      }
+
+      m_in.clear();
+    }
+  }
+}
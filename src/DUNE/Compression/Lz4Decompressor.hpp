@@ -0,0 +1,110 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_LZ4_DECOMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_LZ4_DECOMPRESSOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Decompressor.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Lz4Decompressor;
+
+    //! LZ4 decompressor. Accepts concatenated LZ4 frames, as
+    //! produced by Lz4Compressor and the lz4 command line tool, with
+    //! either independent or linked blocks. Block checksums are
+    //! verified, content checksums are skipped and skippable frames
+    //! are ignored.
+    class Lz4Decompressor: public Decompressor
+    {
+    public:
+      Lz4Decompressor(void);
+
+      virtual bool
+      hasPendingOutput(void) const
+      {
+        return m_out_idx < m_out.size();
+      }
+
+    protected:
+      virtual unsigned long
+      decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len);
+
+    private:
+      //! Parser states.
+      enum State
+      {
+        //! Waiting for the magic number.
+        ST_MAGIC,
+        //! Waiting for the frame descriptor.
+        ST_DESCRIPTOR,
+        //! Waiting for a block size.
+        ST_BLOCK_SIZE,
+        //! Waiting for block data.
+        ST_BLOCK_DATA,
+        //! Waiting for the content checksum.
+        ST_CHECKSUM,
+        //! Waiting for the size of a skippable frame.
+        ST_SKIP_SIZE,
+        //! Skipping frame data.
+        ST_SKIP_DATA
+      };
+
+      //! Current state.
+      State m_state;
+      //! Number of bytes needed to leave the current state.
+      unsigned long m_need;
+      //! Frame descriptor flags.
+      uint8_t m_flags;
+      //! Maximum block size of the current frame.
+      unsigned long m_block_max;
+      //! True if the current block is stored uncompressed.
+      bool m_block_raw;
+      //! Input gathered for the current state.
+      std::vector<char> m_in;
+      //! Decompression history (first 64 KiB) followed by the
+      //! last decoded block.
+      std::vector<char> m_out;
+      //! Index of the first undelivered byte in m_out.
+      size_t m_out_idx;
+
+      //! Process a complete input unit for the current state.
+      void
+      process(void);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,392 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Compression/ParallelCompressor.hpp>
+#include <DUNE/Compression/BlockCompressor.hpp>
+#include <DUNE/Compression/Compressor.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! Worker thread owning a compressor.
+    class ParallelCompressorWorker: public Concurrency::Thread
+    {
+    public:
+      ParallelCompressorWorker(ParallelCompressor& parent, Methods method, bool blocks):
+        m_parent(parent),
+        m_block(NULL)
+      {
+        if (blocks)
+        {
+          m_block = new BlockCompressor(method);
+          m_com = m_block;
+        }
+        else
+        {
+          m_com = Factory::compressor(method);
+          if (m_com == NULL)
+            throw UnknownMethod(Factory::method(method));
+        }
+      }
+
+      ~ParallelCompressorWorker(void)
+      {
+        delete m_com;
+      }
+
+    private:
+      //! Parent compressor.
+      ParallelCompressor& m_parent;
+      //! Compressor.
+      Compressor* m_com;
+      //! Compressor, if writing container blocks.
+      BlockCompressor* m_block;
+
+      void
+      run(void)
+      {
+        ParallelCompressor::Job* job = NULL;
+        while ((job = m_parent.take()) != NULL)
+        {
+          std::string error;
+
+          try
+          {
+            if (m_block != NULL)
+              m_block->setRecords(job->time_first, job->time_last, job->records);
+
+            m_com->compress(job->output, &job->input[0], job->input.size());
+          }
+          catch (std::exception& e)
+          {
+            error = e.what();
+          }
+
+          m_parent.complete(job, error);
+        }
+      }
+    };
+
+    ParallelCompressor::ParallelCompressor(std::ostream* os, Methods method, unsigned threads,
+                                           size_t budget, bool blocks):
+      m_os(os),
+      m_budget(budget),
+      m_in_flight(0),
+      m_written(0),
+      m_raw_written(0),
+      m_track(false),
+      m_writing(false),
+      m_stopping(false)
+    {
+      if (threads == 0)
+        threads = 1;
+
+      try
+      {
+        for (unsigned i = 0; i < threads; ++i)
+          m_workers.push_back(new ParallelCompressorWorker(*this, method, blocks));
+      }
+      catch (...)
+      {
+        for (unsigned i = 0; i < m_workers.size(); ++i)
+          delete m_workers[i];
+        throw;
+      }
+
+      for (unsigned i = 0; i < m_workers.size(); ++i)
+        m_workers[i]->start();
+    }
+
+    ParallelCompressor::~ParallelCompressor(void)
+    {
+      try
+      {
+        flush();
+      }
+      catch (...)
+      { }
+
+      m_cond.lock();
+      m_stopping = true;
+      m_cond.broadcast();
+      m_cond.unlock();
+
+      for (unsigned i = 0; i < m_workers.size(); ++i)
+      {
+        m_workers[i]->stopAndJoin();
+        delete m_workers[i];
+      }
+
+      // Jobs left behind by errors.
+      for (unsigned i = 0; i < m_jobs.size(); ++i)
+        delete m_jobs[i];
+
+      for (unsigned i = 0; i < m_free.size(); ++i)
+        delete m_free[i];
+    }
+
+    void
+    ParallelCompressor::write(const char* data, size_t size)
+    {
+      write(data, size, 0, 0, 0);
+    }
+
+    void
+    ParallelCompressor::write(const char* data, size_t size, fp64_t time_first, fp64_t time_last, uint32_t records)
+    {
+      if (size == 0)
+        return;
+
+      Concurrency::ScopedCondition l(m_cond);
+      checkError();
+
+      // A chunk larger than the budget is accepted when nothing else
+      // is in flight.
+      while (m_in_flight > 0 && m_in_flight + size > m_budget && m_error.empty())
+        m_cond.wait();
+
+      checkError();
+      queue(data, size, time_first, time_last, records);
+    }
+
+    void
+    ParallelCompressor::flush(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      while ((!m_jobs.empty() || m_writing) && m_error.empty())
+        m_cond.wait();
+
+      checkError();
+
+      // Flush outside the lock, workers stay away from the stream
+      // while m_writing is set.
+      m_writing = true;
+      m_cond.unlock();
+
+      std::string error;
+      try
+      {
+        m_os->flush();
+        if (!m_os->good())
+          error = "failed to flush compressed data";
+      }
+      catch (std::exception& e)
+      {
+        error = e.what();
+      }
+
+      m_cond.lock();
+      m_writing = false;
+      if (!error.empty() && m_error.empty())
+        m_error = error;
+
+      m_cond.broadcast();
+      checkError();
+    }
+
+    size_t
+    ParallelCompressor::getInFlight(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      return m_in_flight;
+    }
+
+    uint64_t
+    ParallelCompressor::getWritten(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      return m_written;
+    }
+
+    bool
+    ParallelCompressor::failed(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      return !m_error.empty();
+    }
+
+    void
+    ParallelCompressor::trackBlocks(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      m_track = true;
+    }
+
+    bool
+    ParallelCompressor::getBlockOffset(uint64_t raw_offset, uint64_t& offset)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      while (!m_offsets.empty() && m_offsets.front().first < raw_offset)
+        m_offsets.pop_front();
+
+      if (!m_offsets.empty() && m_offsets.front().first == raw_offset)
+      {
+        offset = m_offsets.front().second;
+        return true;
+      }
+
+      if (m_offsets.empty() && m_raw_written <= raw_offset)
+        return false;
+
+      offset = c_no_block;
+      return true;
+    }
+
+    void
+    ParallelCompressor::queue(const char* data, size_t size, fp64_t time_first, fp64_t time_last, uint32_t records)
+    {
+      Job* job = NULL;
+      if (m_free.empty())
+      {
+        job = new Job;
+      }
+      else
+      {
+        job = m_free.back();
+        m_free.pop_back();
+      }
+
+      job->input.assign(data, data + size);
+      job->time_first = time_first;
+      job->time_last = time_last;
+      job->records = records;
+      job->done = false;
+
+      m_jobs.push_back(job);
+      m_pending.push_back(job);
+      m_in_flight += size;
+      m_cond.broadcast();
+    }
+
+    ParallelCompressor::Job*
+    ParallelCompressor::take(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      while (m_pending.empty() && !m_stopping)
+        m_cond.wait();
+
+      if (m_pending.empty())
+        return NULL;
+
+      Job* job = m_pending.front();
+      m_pending.pop_front();
+      return job;
+    }
+
+    void
+    ParallelCompressor::complete(Job* job, const std::string& error)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      job->done = true;
+      if (!error.empty() && m_error.empty())
+        m_error = error;
+
+      // Only one thread writes at a time, which keeps the output in
+      // submission order.
+      if (m_writing)
+        return;
+
+      m_writing = true;
+
+      while (m_error.empty() && !m_jobs.empty() && m_jobs.front()->done)
+      {
+        std::vector<Job*> ready;
+        while (!m_jobs.empty() && m_jobs.front()->done)
+        {
+          ready.push_back(m_jobs.front());
+          m_jobs.pop_front();
+        }
+
+        uint64_t raw_offset = m_raw_written;
+        uint64_t offset = m_written;
+
+        // Write outside the lock so other workers can keep going.
+        m_cond.unlock();
+
+        std::string werror;
+        size_t written = 0;
+        try
+        {
+          for (unsigned i = 0; i < ready.size(); ++i)
+          {
+            m_os->write(ready[i]->output.getBufferSigned(), ready[i]->output.getSize());
+            written += ready[i]->output.getSize();
+          }
+
+          if (!m_os->good())
+            werror = "failed to write compressed data";
+        }
+        catch (std::exception& e)
+        {
+          werror = e.what();
+        }
+
+        m_cond.lock();
+
+        for (unsigned i = 0; i < ready.size(); ++i)
+        {
+          if (m_track)
+            m_offsets.push_back(std::make_pair(raw_offset, offset));
+
+          raw_offset += ready[i]->input.size();
+          offset += ready[i]->output.getSize();
+          m_in_flight -= ready[i]->input.size();
+          m_free.push_back(ready[i]);
+        }
+
+        m_raw_written = raw_offset;
+        m_written += written;
+        if (!werror.empty() && m_error.empty())
+          m_error = werror;
+      }
+
+      m_writing = false;
+      m_cond.broadcast();
+    }
+
+    void
+    ParallelCompressor::checkError(void)
+    {
+      if (!m_error.empty())
+        throw Error(m_error);
+    }
+  }
+}
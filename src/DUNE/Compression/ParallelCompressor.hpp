@@ -0,0 +1,228 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_PARALLEL_COMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_PARALLEL_COMPRESSOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <deque>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Methods.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Forward declarations.
+    class ParallelCompressorWorker;
+
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ParallelCompressor;
+
+    //! Pipelined compressor. Chunks of data are compressed
+    //! independently by a pool of worker threads and the compressed
+    //! chunks are written to the output stream in submission order.
+    //! Since every compressor produces a self-contained unit per
+    //! chunk (a gzip member, a zlib or bzip2 stream, an LZ4 frame or
+    //! a container block) the output is a concatenation that
+    //! standard tools and the decompressors of this library read as
+    //! a single stream.
+    //!
+    //! The amount of uncompressed data queued or being compressed is
+    //! bounded by a memory budget, callers block when it is
+    //! exhausted.
+    class ParallelCompressor
+    {
+    public:
+      //! Block offset reported when no block starts at a given
+      //! offset (see getBlockOffset()).
+      static const uint64_t c_no_block = ~(uint64_t)0;
+
+      //! Constructor.
+      //! @param[in] os output stream, not owned.
+      //! @param[in] method compression method.
+      //! @param[in] threads number of worker threads.
+      //! @param[in] budget maximum number of uncompressed bytes in
+      //! flight.
+      //! @param[in] blocks true to write containers blocks (see
+      //! BlockHeader) with data compressed by the given method.
+      ParallelCompressor(std::ostream* os, Methods method, unsigned threads,
+                         size_t budget, bool blocks = false);
+
+      //! Destructor. Pending chunks are compressed and written.
+      ~ParallelCompressor(void);
+
+      //! Queue a chunk of data for compression. Blocks while the
+      //! memory budget is exhausted.
+      //! @param[in] data chunk data.
+      //! @param[in] size chunk size.
+      void
+      write(const char* data, size_t size);
+
+      //! Queue a chunk of records for compression as a container
+      //! block. Blocks while the memory budget is exhausted.
+      //! @param[in] data chunk data.
+      //! @param[in] size chunk size.
+      //! @param[in] time_first timestamp of the first record.
+      //! @param[in] time_last timestamp of the last record.
+      //! @param[in] records number of records.
+      void
+      write(const char* data, size_t size, fp64_t time_first, fp64_t time_last, uint32_t records);
+
+      //! Wait until all queued chunks are written and flush the
+      //! output stream.
+      void
+      flush(void);
+
+      //! Retrieve the number of uncompressed bytes in flight.
+      //! @return number of bytes.
+      size_t
+      getInFlight(void);
+
+      //! Retrieve the number of compressed bytes written.
+      //! @return number of bytes.
+      uint64_t
+      getWritten(void);
+
+      //! Test if compressing or writing to the output stream failed.
+      //! The output stream is only accessed by the compressor, so
+      //! this is the way for other threads to learn its state.
+      //! @return true if an error occurred, false otherwise.
+      bool
+      failed(void);
+
+      //! Start recording the file offset of each written chunk, so
+      //! that it can be retrieved with getBlockOffset().
+      void
+      trackBlocks(void);
+
+      //! Retrieve the file offset of the chunk that starts at a
+      //! given offset of the uncompressed data. Offsets must be
+      //! requested in increasing order, records of earlier chunks
+      //! are discarded.
+      //! @param[in] raw_offset offset in the uncompressed data.
+      //! @param[out] offset file offset of the chunk or c_no_block
+      //! if no chunk starts at raw_offset.
+      //! @return true if the offset is known, false if the chunk
+      //! was not written yet.
+      bool
+      getBlockOffset(uint64_t raw_offset, uint64_t& offset);
+
+    private:
+      //! Unit of work.
+      struct Job
+      {
+        //! Uncompressed data.
+        std::vector<char> input;
+        //! Compressed data.
+        Utils::ByteBuffer output;
+        //! Timestamp of the first record.
+        fp64_t time_first;
+        //! Timestamp of the last record.
+        fp64_t time_last;
+        //! Number of records.
+        uint32_t records;
+        //! True if compressed.
+        bool done;
+      };
+
+      //! Output stream.
+      std::ostream* m_os;
+      //! Memory budget.
+      size_t m_budget;
+      //! Worker threads.
+      std::vector<ParallelCompressorWorker*> m_workers;
+      //! Jobs in submission order, waiting to be written.
+      std::deque<Job*> m_jobs;
+      //! Jobs waiting for a worker.
+      std::deque<Job*> m_pending;
+      //! Reusable jobs.
+      std::vector<Job*> m_free;
+      //! Uncompressed bytes in flight.
+      size_t m_in_flight;
+      //! Compressed bytes written.
+      uint64_t m_written;
+      //! Uncompressed bytes written.
+      uint64_t m_raw_written;
+      //! True if chunk offsets are recorded.
+      bool m_track;
+      //! Offsets of written chunks in the uncompressed data and in
+      //! the file.
+      std::deque<std::pair<uint64_t, uint64_t> > m_offsets;
+      //! True while a thread is writing compressed jobs or flushing
+      //! the output stream.
+      bool m_writing;
+      //! True if workers must terminate.
+      bool m_stopping;
+      //! First error raised by a worker or by the output stream.
+      std::string m_error;
+      //! Lock and condition protecting the above.
+      Concurrency::Condition m_cond;
+
+      //! Queue a job. Must be called with the condition locked.
+      void
+      queue(const char* data, size_t size, fp64_t time_first, fp64_t time_last, uint32_t records);
+
+      //! Wait for a job to compress.
+      //! @return job or NULL if the worker must terminate.
+      Job*
+      take(void);
+
+      //! Mark a job as compressed and write compressed jobs in
+      //! order, unless another thread is already doing it.
+      //! @param[in] job job.
+      //! @param[in] error error message or empty string.
+      void
+      complete(Job* job, const std::string& error);
+
+      //! Throw pending errors. Must be called with the condition
+      //! locked.
+      void
+      checkError(void);
+
+      friend class ParallelCompressorWorker;
+
+      //! Non - copyable.
+      ParallelCompressor(const ParallelCompressor&);
+
+      //! Non - assignable.
+      ParallelCompressor&
+      operator=(const ParallelCompressor&);
+    };
+  }
+}
+
+#endif
@@ -40,6 +40,7 @@
 #include <DUNE/Compression/Factory.hpp>
 #include <DUNE/Compression/Compressor.hpp>
 #include <DUNE/Compression/Decompressor.hpp>
+#include <DUNE/Compression/ParallelCompressor.hpp>
 
 static const unsigned c_put_bfr_size = 128 * 1024;
 static const unsigned c_get_bfr_size = 256 * 1024;
@@ -52,16 +53,38 @@ namespace DUNE
       m_method(method),
       m_ostream(stream),
       m_istream(0),
+      m_pool(0),
       m_dec(0)
     {
       m_com = Factory::compressor(method);
     }
 
+    StreamBuffer::StreamBuffer(std::ostream* stream, Methods method, unsigned threads, size_t budget):
+      m_method(method),
+      m_ostream(stream),
+      m_istream(0),
+      m_com(0),
+      m_pool(0),
+      m_dec(0)
+    {
+      if (threads <= 1)
+      {
+        m_com = Factory::compressor(method);
+        return;
+      }
+
+      if (budget == 0)
+        budget = 2 * threads * c_put_bfr_size;
+
+      m_pool = new ParallelCompressor(stream, method, threads, budget);
+    }
+
     StreamBuffer::StreamBuffer(std::istream* stream, Methods method):
       m_method(method),
       m_ostream(0),
       m_istream(stream),
       m_com(0),
+      m_pool(0),
       m_get_bfr_idx(0),
       m_get_bfr_rem(0)
     {
@@ -74,7 +97,10 @@ namespace DUNE
       sync();
 
       if (m_ostream)
+      {
+        delete m_pool;
         delete m_com;
+      }
 
       if (m_istream)
         delete m_dec;
@@ -83,6 +109,14 @@ namespace DUNE
     int
     StreamBuffer::sync(void)
     {
+      if (m_ostream && m_pool)
+      {
+        m_pool->write(m_bfr.getBufferSigned(), m_bfr.getSize());
+        m_bfr.setSize(0);
+        m_pool->flush();
+        return 1;
+      }
+
       if (m_ostream)
       {
         m_com->compress(m_com_bfr, m_bfr);
@@ -113,7 +147,18 @@ namespace DUNE
       m_bfr.appendSigned(bfr, length);
 
       if (m_bfr.getSize() >= c_put_bfr_size)
-        sync();
+      {
+        // Full chunks are handed to the pool without waiting.
+        if (m_pool)
+        {
+          m_pool->write(m_bfr.getBufferSigned(), m_bfr.getSize());
+          m_bfr.setSize(0);
+        }
+        else
+        {
+          sync();
+        }
+      }
 
       return length;
     }
@@ -126,7 +171,7 @@ namespace DUNE
 
       while (chunk_rem > 0)
       {
-        if (m_get_bfr_rem == 0)
+        if (m_get_bfr_rem == 0 && !m_dec->hasPendingOutput())
         {
           if (m_istream->eof())
           {
@@ -47,6 +47,7 @@ namespace DUNE
     // Forward declarations.
     class Compressor;
     class Decompressor;
+    class ParallelCompressor;
 
     // Export DLL Symbol.
     class DUNE_DLL_SYM StreamBuffer;
@@ -56,6 +57,16 @@ namespace DUNE
     public:
       StreamBuffer(std::ostream* stream, Methods method);
 
+      //! Create an output buffer that compresses chunks of data with
+      //! a pool of threads (see ParallelCompressor).
+      //! @param[in] stream output stream.
+      //! @param[in] method compression method.
+      //! @param[in] threads number of threads, one or less to
+      //! compress on the caller's thread.
+      //! @param[in] budget maximum number of uncompressed bytes in
+      //! flight, zero for two chunks per thread.
+      StreamBuffer(std::ostream* stream, Methods method, unsigned threads, size_t budget);
+
       StreamBuffer(std::istream* stream, Methods method);
 
       virtual
@@ -97,6 +108,8 @@ namespace DUNE
       std::istream* m_istream;
       //! Compressor.
       Compressor* m_com;
+      //! Parallel compressor.
+      ParallelCompressor* m_pool;
       //! Decompressor.
       Decompressor* m_dec;
       //! Internal buffer.
@@ -96,6 +96,14 @@ namespace DUNE
 #endif
       }
 
+      //! Atomically read the current value.
+      //! @return current value.
+      inline int
+      value(void)
+      {
+        return add(0);
+      }
+
     private:
       //! Internal value.
       volatile int m_value;
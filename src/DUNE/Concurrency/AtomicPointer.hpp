@@ -0,0 +1,142 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_ATOMIC_POINTER_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_ATOMIC_POINTER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+
+#if defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH) && defined(DUNE_SYS_HAS___SYNC_SUB_AND_FETCH)
+#  ifndef DUNE_CONCURRENCY_ATOMIC_POINTER_GCC
+#    define DUNE_CONCURRENCY_ATOMIC_POINTER_GCC
+#  endif
+#endif
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Pointer with atomic load and store operations. Useful to
+    //! publish immutable objects to concurrent readers without
+    //! locking (readers load the pointer, writers build a new
+    //! object and store it).
+    template <typename T>
+    class AtomicPointer
+    {
+    public:
+      //! Constructor.
+      //! @param value initial pointer value.
+      AtomicPointer(T* value = NULL):
+        m_value(value)
+      { }
+
+      //! Atomically read the current pointer value. Writes performed
+      //! before the pointer was stored are visible after this call.
+      //! @return current pointer value.
+      inline T*
+      load(void) const
+      {
+        // GCC implementation.
+#if defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC)
+        T* value = m_value;
+        __sync_synchronize();
+        return value;
+
+        // Generic implementation.
+#else
+        ScopedMutex lock(m_lock);
+        return m_value;
+#endif
+      }
+
+      //! Atomically replace the current pointer value.
+      //! @param value new pointer value.
+      inline void
+      store(T* value)
+      {
+        // GCC implementation.
+#if defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC)
+        __sync_synchronize();
+        m_value = value;
+        __sync_synchronize();
+
+        // Generic implementation.
+#else
+        ScopedMutex lock(m_lock);
+        m_value = value;
+#endif
+      }
+
+      //! Atomically replace the current pointer value if it matches
+      //! an expected value.
+      //! @param expected expected value.
+      //! @param value new pointer value.
+      //! @return true if an exchange took place, false otherwise.
+      inline bool
+      compareAndSwap(T* expected, T* value)
+      {
+        // GCC implementation.
+#if defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC)
+        return __sync_bool_compare_and_swap(&m_value, expected, value);
+
+        // Generic implementation.
+#else
+        ScopedMutex lock(m_lock);
+        if (m_value != expected)
+          return false;
+
+        m_value = value;
+        return true;
+#endif
+      }
+
+    private:
+      //! Internal value.
+      T* volatile m_value;
+
+#if !defined(DUNE_CONCURRENCY_ATOMIC_POINTER_GCC)
+      //! Explicit lock for generic implementation.
+      mutable Mutex m_lock;
+#endif
+
+      //! Non-copyable.
+      AtomicPointer(const AtomicPointer&);
+
+      //! Non-assignable.
+      AtomicPointer&
+      operator=(const AtomicPointer&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,395 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_RING_BUFFER_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_RING_BUFFER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/IO/Notifier.hpp>
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! The RingBuffer is a thread-safe FIFO for multiple producers
+    //! and a single consumer. Storage is preallocated, the consumer
+    //! drains all pending elements with a single lock acquisition,
+    //! and producers only signal the consumer when it is actually
+    //! sleeping. When the buffer is full the configured overflow
+    //! policy decides whether the storage grows, the oldest element
+    //! is discarded, the new element is discarded or the producer
+    //! blocks until there is room.
+    template <typename T>
+    class RingBuffer
+    {
+    public:
+      //! Behaviour when pushing into a full buffer.
+      enum OverflowPolicy
+      {
+        //! Discard the oldest element.
+        OVERFLOW_DROP_OLDEST,
+        //! Discard the element being pushed.
+        OVERFLOW_DROP_NEWEST,
+        //! Block the producer until there is room. A producer
+        //! that is also the consumer, directly or through another
+        //! blocked buffer, will deadlock.
+        OVERFLOW_BLOCK,
+        //! Double the storage, the buffer is unbounded.
+        OVERFLOW_GROW
+      };
+
+      //! Buffer statistics.
+      struct Counters
+      {
+        //! Number of elements pushed.
+        unsigned long pushed;
+        //! Number of elements popped.
+        unsigned long popped;
+        //! Number of elements discarded due to overflow.
+        unsigned long dropped;
+        //! Number of times a producer had to block.
+        unsigned long blocked;
+        //! Highest number of elements ever stored.
+        unsigned high_water;
+      };
+
+      //! Constructor.
+      //! @param[in] capacity maximum number of elements.
+      //! @param[in] policy overflow policy.
+      RingBuffer(unsigned capacity = 1024, OverflowPolicy policy = OVERFLOW_DROP_OLDEST):
+        m_items(NULL),
+        m_capacity(0),
+        m_head(0),
+        m_size(0),
+        m_policy(policy),
+        m_waiting(false),
+        m_blocked(0),
+        m_closed(false),
+        m_notifier(NULL)
+      {
+        m_counters.pushed = 0;
+        m_counters.popped = 0;
+        m_counters.dropped = 0;
+        m_counters.blocked = 0;
+        m_counters.high_water = 0;
+        setCapacity(capacity);
+      }
+
+      //! Destructor.
+      ~RingBuffer(void)
+      {
+        delete [] m_items;
+      }
+
+      //! Change the capacity of the buffer. If the new capacity is
+      //! smaller than the number of stored elements, the oldest ones
+      //! are discarded.
+      //! @param[in] capacity maximum number of elements.
+      void
+      setCapacity(unsigned capacity)
+      {
+        if (capacity == 0)
+          capacity = 1;
+
+        ScopedCondition l(m_cond);
+        if (capacity == m_capacity)
+          return;
+
+        resize(capacity);
+
+        if (m_blocked > 0)
+          m_cond.broadcast();
+      }
+
+      //! Retrieve the capacity of the buffer.
+      //! @return maximum number of elements.
+      unsigned
+      getCapacity(void)
+      {
+        ScopedCondition l(m_cond);
+        return m_capacity;
+      }
+
+      //! Change the overflow policy.
+      //! @param[in] policy overflow policy.
+      void
+      setOverflowPolicy(OverflowPolicy policy)
+      {
+        ScopedCondition l(m_cond);
+        m_policy = policy;
+
+        if (m_blocked > 0)
+          m_cond.broadcast();
+      }
+
+      //! Set a notifier to be signaled whenever the buffer stops
+      //! being empty or is closed. This allows the consumer to wait
+      //! for elements and I/O handles at the same time, in which case
+      //! it must clear the notifier before removing elements.
+      //! @param[in] notifier notifier or NULL to disable.
+      void
+      setNotifier(IO::Notifier* notifier)
+      {
+        ScopedCondition l(m_cond);
+        m_notifier = notifier;
+
+        if (m_notifier != NULL && (m_size > 0 || m_closed))
+          m_notifier->signal();
+      }
+
+      //! Add an element to the end of the buffer, waking the consumer
+      //! if it is waiting.
+      //! @param[in] v element to insert.
+      //! @param[in] wait if false, a full buffer with the blocking
+      //! policy discards the new element instead of waiting.
+      //! @return true if the element was stored without discarding
+      //! other elements, false otherwise.
+      bool
+      push(const T& v, bool wait = true)
+      {
+        ScopedCondition l(m_cond);
+        bool clean = true;
+
+        if (m_size == m_capacity)
+        {
+          if (m_policy == OVERFLOW_GROW)
+          {
+            resize(m_capacity * 2);
+          }
+          else if (m_policy == OVERFLOW_BLOCK && wait)
+          {
+            ++m_counters.blocked;
+            ++m_blocked;
+            while (m_size == m_capacity && m_policy == OVERFLOW_BLOCK && !m_closed)
+              m_cond.wait();
+            --m_blocked;
+          }
+
+          if (m_size == m_capacity)
+          {
+            ++m_counters.dropped;
+            clean = false;
+
+            if (m_policy == OVERFLOW_DROP_OLDEST)
+            {
+              m_items[m_head] = T();
+              m_head = (m_head + 1) % m_capacity;
+              --m_size;
+            }
+            else
+            {
+              return false;
+            }
+          }
+        }
+
+        m_items[(m_head + m_size) % m_capacity] = v;
+        ++m_size;
+        ++m_counters.pushed;
+
+        if (m_size > m_counters.high_water)
+          m_counters.high_water = m_size;
+
+        if (m_waiting)
+          m_cond.broadcast();
+
+        if (m_size == 1 && m_notifier != NULL)
+          m_notifier->signal();
+
+        return clean;
+      }
+
+      //! Remove pending elements from the buffer, appending them to a
+      //! vector in FIFO order.
+      //! @param[out] items vector that receives the elements.
+      //! @param[in] max maximum number of elements to remove, zero
+      //! to remove all pending elements.
+      //! @return number of elements removed.
+      unsigned
+      pop(std::vector<T>& items, unsigned max = 0)
+      {
+        ScopedCondition l(m_cond);
+
+        unsigned count = m_size;
+        if (max != 0 && max < count)
+          count = max;
+
+        for (unsigned i = 0; i < count; ++i)
+        {
+          items.push_back(m_items[m_head]);
+          m_items[m_head] = T();
+          m_head = (m_head + 1) % m_capacity;
+        }
+
+        m_size -= count;
+        m_counters.popped += count;
+
+        if (count > 0 && m_blocked > 0)
+          m_cond.broadcast();
+
+        return count;
+      }
+
+      //! Wait for elements to be available. Must only be called by
+      //! the consumer.
+      //! @param[in] timeout timeout in seconds, use a negative number
+      //! to wait forever.
+      //! @return true if at least one element is available, false
+      //! otherwise.
+      bool
+      waitForItems(double timeout = -1.0)
+      {
+        ScopedCondition l(m_cond);
+        if (m_size > 0)
+          return true;
+
+        if (m_closed)
+          return false;
+
+        m_waiting = true;
+        m_cond.wait(timeout);
+        m_waiting = false;
+
+        return m_size > 0;
+      }
+
+      //! Verify if the buffer has elements.
+      //! @return true if the buffer has no elements, false otherwise.
+      bool
+      empty(void)
+      {
+        ScopedCondition l(m_cond);
+        return m_size == 0;
+      }
+
+      //! Retrieve the number of elements currently in the buffer.
+      //! @return number of elements.
+      unsigned
+      size(void)
+      {
+        ScopedCondition l(m_cond);
+        return m_size;
+      }
+
+      //! Retrieve buffer statistics.
+      //! @return buffer counters.
+      Counters
+      getCounters(void)
+      {
+        ScopedCondition l(m_cond);
+        return m_counters;
+      }
+
+      //! Reset the high-water mark to the current number of elements.
+      void
+      resetHighWater(void)
+      {
+        ScopedCondition l(m_cond);
+        m_counters.high_water = m_size;
+      }
+
+      //! Close the buffer, waking the consumer and all blocked
+      //! producers. Pushing into a full closed buffer never blocks.
+      void
+      close(void)
+      {
+        ScopedCondition l(m_cond);
+        m_closed = true;
+        m_cond.broadcast();
+
+        if (m_notifier != NULL)
+          m_notifier->signal();
+      }
+
+      //! Test if the buffer is closed.
+      //! @return true if the buffer is closed, false otherwise.
+      bool
+      closed(void)
+      {
+        ScopedCondition l(m_cond);
+        return m_closed;
+      }
+
+    private:
+      //! Reallocate storage, discarding the oldest elements if they
+      //! do not fit. Must be called with the lock held.
+      //! @param[in] capacity new maximum number of elements.
+      void
+      resize(unsigned capacity)
+      {
+        T* items = new T[capacity];
+        unsigned skip = (m_size > capacity) ? m_size - capacity : 0;
+        for (unsigned i = skip; i < m_size; ++i)
+          items[i - skip] = m_items[(m_head + i) % m_capacity];
+
+        m_counters.dropped += skip;
+        delete [] m_items;
+        m_items = items;
+        m_capacity = capacity;
+        m_head = 0;
+        m_size -= skip;
+      }
+
+      //! Element storage.
+      T* m_items;
+      //! Maximum number of elements.
+      unsigned m_capacity;
+      //! Index of the oldest element.
+      unsigned m_head;
+      //! Number of stored elements.
+      unsigned m_size;
+      //! Overflow policy.
+      OverflowPolicy m_policy;
+      //! True if the consumer is waiting for elements.
+      bool m_waiting;
+      //! Number of producers waiting for room.
+      unsigned m_blocked;
+      //! True if the buffer is closed.
+      bool m_closed;
+      //! Notifier signaled when elements become available.
+      IO::Notifier* m_notifier;
+      //! Statistics.
+      Counters m_counters;
+      //! Buffer condition.
+      Condition m_cond;
+
+      //! Non-copyable.
+      RingBuffer(const RingBuffer&);
+
+      //! Non-assignable.
+      RingBuffer&
+      operator=(const RingBuffer&);
+    };
+  }
+}
+
+#endif
@@ -44,6 +44,10 @@
 #  include <pthread.h>
 #endif
 
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
 namespace DUNE
 {
   namespace Concurrency
@@ -90,6 +94,20 @@ namespace DUNE
       return SCHED_OTHER;
     }
 
+    Scheduler::Policy
+    Scheduler::policy(unsigned native)
+    {
+      switch (native)
+      {
+        case SCHED_RR:
+          return POLICY_RR;
+        case SCHED_FIFO:
+          return POLICY_FIFO;
+        default:
+          return POLICY_OTHER;
+      }
+    }
+
     unsigned
     Scheduler::minimumPriority(void)
     {
@@ -112,6 +130,18 @@ namespace DUNE
       return 0;
     }
 
+    unsigned
+    Scheduler::getProcessorCount(void)
+    {
+#if defined(_SC_NPROCESSORS_ONLN)
+      long count = sysconf(_SC_NPROCESSORS_ONLN);
+      if (count > 0)
+        return (unsigned)count;
+#endif
+
+      return 1;
+    }
+
     void
     Scheduler::yield(void)
     {
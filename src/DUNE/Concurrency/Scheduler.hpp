@@ -77,6 +77,13 @@ namespace DUNE
       static unsigned
       native(Policy policy);
 
+      //! Translate a native scheduling policy identifier to a DUNE
+      //! scheduling policy.
+      //! @param native native scheduling policy identifier.
+      //! @return scheduling policy.
+      static Policy
+      policy(unsigned native);
+
       //! Force the running thread to relinquish the processor until
       //! it becomes the head of its thread list.
       static void
@@ -95,6 +102,11 @@ namespace DUNE
       //! policy.
       static unsigned
       maximumPriority(void);
+
+      //! Get the number of online processors.
+      //! @return number of processors (at least one).
+      static unsigned
+      getProcessorCount(void);
     };
   }
 }
@@ -29,6 +29,8 @@
 
 // ISO C++ 98 headers.
 #include <cassert>
+#include <cerrno>
+#include <cstring>
 #include <iostream>
 #include <limits>
 
@@ -46,6 +48,10 @@
 #  include <pthread.h>
 #endif
 
+#if defined(DUNE_SYS_HAS_SCHED_H)
+#  include <sched.h>
+#endif
+
 #if defined(DUNE_SYS_HAS_SIGNAL_H)
 #  include <signal.h>
 #endif
@@ -226,6 +232,95 @@ namespace DUNE
       return 0;
     }
 
+    void
+    Thread::setAffinity(const std::vector<unsigned>& cpus)
+    {
+#if defined(DUNE_SYS_HAS_PTHREAD_SETAFFINITY_NP) && defined(DUNE_SYS_HAS_PTHREAD_ATTR_SETAFFINITY_NP)
+      cpu_set_t set;
+      CPU_ZERO(&set);
+
+      if (cpus.empty())
+      {
+        for (unsigned i = 0; i < CPU_SETSIZE; ++i)
+          CPU_SET(i, &set);
+      }
+
+      for (size_t i = 0; i < cpus.size(); ++i)
+      {
+        if (cpus[i] >= CPU_SETSIZE)
+          throw ThreadError("invalid processor", EINVAL);
+
+        CPU_SET(cpus[i], &set);
+      }
+
+      int rv = 0;
+      if (isRunning())
+        rv = pthread_setaffinity_np(m_handle, sizeof(set), &set);
+      else
+        rv = pthread_attr_setaffinity_np(&m_attr, sizeof(set), &set);
+
+      if (rv != 0)
+        throw ThreadError("unable to set thread affinity", rv);
+#else
+      if (!cpus.empty())
+        throw ThreadError("unable to set thread affinity", ENOSYS);
+#endif
+    }
+
+    void
+    Thread::getAffinity(std::vector<unsigned>& cpus)
+    {
+      cpus.clear();
+
+#if defined(DUNE_SYS_HAS_PTHREAD_SETAFFINITY_NP) && defined(DUNE_SYS_HAS_PTHREAD_ATTR_SETAFFINITY_NP)
+      cpu_set_t set;
+      CPU_ZERO(&set);
+
+      int rv = 0;
+      if (isRunning())
+        rv = pthread_getaffinity_np(m_handle, sizeof(set), &set);
+      else
+        rv = pthread_attr_getaffinity_np(&m_attr, sizeof(set), &set);
+
+      if (rv != 0)
+        throw ThreadError("unable to get thread affinity", rv);
+
+      unsigned count = Scheduler::getProcessorCount();
+      for (unsigned i = 0; i < CPU_SETSIZE && i < count; ++i)
+      {
+        if (CPU_ISSET(i, &set))
+          cpus.push_back(i);
+      }
+#else
+      unsigned count = Scheduler::getProcessorCount();
+      for (unsigned i = 0; i < count; ++i)
+        cpus.push_back(i);
+#endif
+    }
+
+    Scheduler::Policy
+    Thread::getPolicy(void)
+    {
+#if defined(DUNE_SYS_HAS_PTHREAD)
+      int native_policy;
+      sched_param sparam;
+      std::memset(&sparam, 0, sizeof(sparam));
+
+      int rv = 0;
+      if (isRunning())
+        rv = pthread_getschedparam(m_handle, &native_policy, &sparam);
+      else
+        rv = pthread_attr_getschedpolicy(&m_attr, &native_policy);
+
+      if (rv != 0)
+        throw ThreadError("unable to get thread scheduling policy", rv);
+
+      return Scheduler::policy(native_policy);
+#endif
+
+      return Scheduler::POLICY_OTHER;
+    }
+
     Runnable::State
     Thread::getStateImpl(void)
     {
@@ -32,6 +32,7 @@
 
 // ISO C++ 98 headers.
 #include <string>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -74,6 +75,25 @@ namespace DUNE
       int
       getProcessorUsage(void);
 
+      //! Restrict the processors the thread may run on. If the
+      //! thread is not running the setting applies when it starts.
+      //! @param[in] cpus processor indexes, empty for all processors.
+      //! @throw ThreadError if the affinity cannot be set.
+      void
+      setAffinity(const std::vector<unsigned>& cpus);
+
+      //! Retrieve the processors the thread may run on.
+      //! @param[out] cpus processor indexes.
+      //! @throw ThreadError if the affinity cannot be retrieved.
+      void
+      getAffinity(std::vector<unsigned>& cpus);
+
+      //! Retrieve the scheduling policy of the thread.
+      //! @return scheduling policy.
+      //! @throw ThreadError if the policy cannot be retrieved.
+      Scheduler::Policy
+      getPolicy(void);
+
     protected:
       void
       startImpl(void);
@@ -90,6 +110,12 @@ namespace DUNE
       unsigned
       getPriorityImpl(void);
 
+      void
+      setStateImpl(Runnable::State state);
+
+      Runnable::State
+      getStateImpl(void);
+
     private:
       //! Thread state.
       Runnable::State m_state;
@@ -117,12 +143,6 @@ namespace DUNE
       std::string m_proc_file;
 #endif
 
-      void
-      setStateImpl(Runnable::State state);
-
-      Runnable::State
-      getStateImpl(void);
-
       //! Non - copyable.
       Thread(const Thread&);
 
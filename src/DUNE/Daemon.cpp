@@ -50,6 +50,7 @@ namespace DUNE
     DUNE::Tasks::Task("Daemon", ctx),
     m_tman(NULL),
     m_fs_capacity(0),
+    m_stats_period(0),
     call_reboot(false)
   {
     // Retrieve known IMC addresses.
@@ -136,6 +137,9 @@ namespace DUNE
     m_ctx.config.get("General", "CPU Usage - Moving Average Samples", "10", m_cpu_avg_samples);
     m_cpu_avg = new Math::MovingAverage<double>(m_cpu_avg_samples);
 
+    // Task statistics.
+    m_ctx.config.get("General", "Task Statistics - Period", "10.0", m_stats_period);
+
     m_tman = new DUNE::Tasks::Manager(m_ctx);
 
     bind<IMC::RestartSystem>(this);
@@ -174,6 +178,7 @@ namespace DUNE
     m_ctx.mbus.resume();
     m_tman->start();
     m_periodic_counter.setTop(1.0);
+    m_stats_counter.setTop(m_stats_period);
     setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
   }
 
@@ -332,6 +337,12 @@ namespace DUNE
         m_periodic_counter.reset();
         dispatchPeriodic();
       }
+
+      if (m_stats_period > 0 && m_stats_counter.overflow())
+      {
+        m_stats_counter.reset();
+        m_tman->reportStatistics();
+      }
     }
   }
 }
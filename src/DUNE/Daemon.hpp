@@ -56,8 +56,8 @@ namespace DUNE
   //! After this steps DUNE::Daemon starts DUNE::Tasks::Manager
   //! which will then start all other dune's tasks.
   //! Finally, DUNE::Daemon is reponsible for dispatching the
-  //! system's heartbeat, cpu usage, query entity state and
-  //! query power channel state, until DUNE is closed.
+  //! system's heartbeat, cpu usage, task statistics, query entity
+  //! state and query power channel state, until DUNE is closed.
   class Daemon: public Tasks::Task
   {
   public:
@@ -98,6 +98,10 @@ namespace DUNE
     uint64_t m_fs_capacity;
     //! Periodic counter.
     Time::Counter<double> m_periodic_counter;
+    //! Task statistics period.
+    double m_stats_period;
+    //! Task statistics counter.
+    Time::Counter<double> m_stats_counter;
     //! Save configuration file name.
     std::string m_scfg_file;
     //! Saved configuration parameters.
@@ -38,12 +38,18 @@ namespace DUNE
 }
 
 #include <DUNE/IMC/Bus.hpp>
+#include <DUNE/IMC/Subscription.hpp>
 #include <DUNE/IMC/Serialization.hpp>
 #include <DUNE/IMC/InlineMessage.hpp>
 #include <DUNE/IMC/MessageList.hpp>
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/IMC/Packet.hpp>
+#include <DUNE/IMC/LsfReader.hpp>
+#include <DUNE/IMC/LsfMappedFile.hpp>
+#include <DUNE/IMC/LsfScanner.hpp>
+#include <DUNE/IMC/LsfIndex.hpp>
 #include <DUNE/IMC/Macros.hpp>
 #include <DUNE/IMC/AddressResolver.hpp>
 #include <DUNE/IMC/Parser.hpp>
@@ -37,6 +37,7 @@
 #include <DUNE/IMC/Bus.hpp>
 #include <DUNE/IMC/Message.hpp>
 #include <DUNE/IMC/Definitions.hpp>
+#include <DUNE/Concurrency/Scheduler.hpp>
 
 namespace DUNE
 {
@@ -49,19 +50,31 @@ namespace DUNE
         exclude(exc)
       {  }
 
-      ~BackLogEntry(void)
-      {
-        delete message;
-      }
-
       //! Message.
-      Message* message;
+      SharedMessage message;
       //! Exclude this task.
       Tasks::AbstractTask* exclude;
     };
 
+    //! Leaves a dispatch epoch when going out of scope.
+    class EpochGuard
+    {
+    public:
+      EpochGuard(Concurrency::AtomicCounter& readers):
+        m_readers(readers)
+      { }
+
+      ~EpochGuard(void)
+      {
+        m_readers.sub(1);
+      }
+
+    private:
+      Concurrency::AtomicCounter& m_readers;
+    };
+
     Bus::Bus(void):
-      m_paused(false)
+      m_paused(0)
     { }
 
     Bus::~Bus(void)
@@ -75,50 +88,266 @@ namespace DUNE
 
       for (unsigned i = 0; i < m_bind_msgs.size(); ++i)
         delete m_bind_msgs[i];
+
+      for (unsigned i = 0; i < m_retired.size(); ++i)
+      {
+        delete m_retired[i].list;
+        delete m_retired[i].filter;
+      }
+
+      for (unsigned i = 0; i < c_page_count; ++i)
+      {
+        Page* page = m_table[i].load();
+        if (page == NULL)
+          continue;
+
+        for (unsigned j = 0; j < c_page_size; ++j)
+        {
+          const RecipientList* list = page->slots[j].load();
+          if (list == NULL)
+            continue;
+
+          for (unsigned k = 0; k < list->size(); ++k)
+            delete (*list)[k].filter;
+
+          delete list;
+        }
+
+        delete page;
+      }
+    }
+
+    int
+    Bus::find(const RecipientList* list, const Tasks::AbstractTask* task)
+    {
+      if (list == NULL)
+        return -1;
+
+      for (unsigned i = 0; i < list->size(); ++i)
+      {
+        if ((*list)[i].task == task)
+          return i;
+      }
+
+      return -1;
+    }
+
+    Bus::Slot&
+    Bus::getSlot(uint16_t id)
+    {
+      Concurrency::AtomicPointer<Page>& entry = m_table[id / c_page_size];
+
+      Page* page = entry.load();
+      if (page == NULL)
+      {
+        page = new Page;
+        entry.store(page);
+      }
+
+      return page->slots[id % c_page_size];
+    }
+
+    void
+    Bus::publish(Slot& slot, const RecipientList* list, Subscription* filter)
+    {
+      Retired retired;
+      retired.list = slot.load();
+      retired.filter = filter;
+      retired.drained[0] = false;
+      retired.drained[1] = false;
+
+      slot.store(list);
+
+      // Concurrent dispatchers may still be walking the old list.
+      if (retired.list != NULL || retired.filter != NULL)
+        m_retired.push_back(retired);
+
+      // Dispatchers starting from now on use the other counter.
+      m_epoch.add(1);
+      reclaim();
+    }
+
+    void
+    Bus::reclaim(void)
+    {
+      // Dispatchers load lists after announcing themselves, so once
+      // a counter is seen empty none of its dispatchers can be
+      // holding a list that was already retired.
+      for (unsigned p = 0; p < 2; ++p)
+      {
+        if (m_readers[p].value() != 0)
+          continue;
+
+        for (unsigned i = 0; i < m_retired.size(); ++i)
+          m_retired[i].drained[p] = true;
+      }
+
+      unsigned kept = 0;
+      for (unsigned i = 0; i < m_retired.size(); ++i)
+      {
+        if (m_retired[i].drained[0] && m_retired[i].drained[1])
+        {
+          delete m_retired[i].list;
+          delete m_retired[i].filter;
+        }
+        else
+        {
+          m_retired[kept++] = m_retired[i];
+        }
+      }
+
+      m_retired.resize(kept);
     }
 
     void
-    Bus::registerRecipient(Tasks::AbstractTask* task, uint16_t id)
+    Bus::synchronize(void)
     {
-      TransportBindings* bind = new TransportBindings;
-      bind->setSourceEntity(DUNE_IMC_CONST_SYS_EID);
-      bind->setTimeStamp();
-      bind->consumer = task->getName();
-      bind->message_id = id;
-
-      Concurrency::ScopedRWLock l(m_lock, true);
-      m_bind_msgs.push_back(bind);
-      TransportList::iterator itr = std::find(m_recipients[id].begin(), m_recipients[id].end(), task);
-      if (itr == m_recipients[id].end())
-        m_recipients[id].push_back(task);
+      // Each flip moves new dispatchers to the other counter, so the
+      // previous one drains. Two flips cover dispatchers of both
+      // parities.
+      for (unsigned i = 0; i < 2; ++i)
+      {
+        int parity = (m_epoch.add(1) - 1) & 1;
+
+        while (m_readers[parity].value() != 0)
+          Concurrency::Scheduler::yield();
+      }
+    }
+
+    void
+    Bus::registerRecipient(Tasks::AbstractTask* task, uint16_t id, const Subscription* filter)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+
+      Slot& slot = getSlot(id);
+      const RecipientList* old = slot.load();
+      int idx = find(old, task);
+
+      // Already registered without a subscription.
+      if (idx >= 0 && (*old)[idx].filter == NULL && filter == NULL)
+        return;
+
+      Entry entry;
+      entry.task = task;
+      entry.filter = NULL;
+
+      // Entries are shared with concurrent dispatchers, so the bus
+      // keeps its own copy of the subscription.
+      if (filter != NULL && !filter->empty())
+        entry.filter = new Subscription(*filter);
+
+      Subscription* replaced = NULL;
+      RecipientList* list = (old == NULL) ? new RecipientList : new RecipientList(*old);
+      if (idx >= 0)
+      {
+        replaced = (*list)[idx].filter;
+        (*list)[idx] = entry;
+      }
+      else
+      {
+        list->push_back(entry);
+
+        TransportBindings* bind = new TransportBindings;
+        bind->setSourceEntity(DUNE_IMC_CONST_SYS_EID);
+        bind->setTimeStamp();
+        bind->consumer = task->getName();
+        bind->message_id = id;
+        m_bind_msgs.push_back(bind);
+      }
+
+      publish(slot, list, replaced);
     }
 
     void
     Bus::unregisterRecipient(Tasks::AbstractTask* task, uint16_t id)
     {
-      Concurrency::ScopedRWLock l(m_lock, true);
-      m_recipients[id].remove(task);
+      {
+        Concurrency::ScopedMutex l(m_lock);
+        if (!remove(task, id))
+          return;
+      }
+
+      // Dispatchers that loaded the old list may still deliver to
+      // the task.
+      synchronize();
+    }
+
+    bool
+    Bus::remove(Tasks::AbstractTask* task, uint16_t id)
+    {
+      Slot& slot = getSlot(id);
+      const RecipientList* old = slot.load();
+      if (find(old, task) < 0)
+        return false;
+
+      Subscription* removed = NULL;
+      RecipientList* list = new RecipientList;
+      list->reserve(old->size() - 1);
+      for (RecipientList::const_iterator itr = old->begin(); itr != old->end(); ++itr)
+      {
+        if (itr->task != task)
+          list->push_back(*itr);
+        else
+          removed = itr->filter;
+      }
+
+      if (list->empty())
+      {
+        delete list;
+        list = NULL;
+      }
+
+      publish(slot, list, removed);
+      return true;
     }
 
     void
     Bus::dispatch(const Message* msg, Tasks::AbstractTask* task)
     {
+      if (m_paused.value() != 0)
       {
         Concurrency::ScopedMutex lock(m_paused_lock);
-        if (m_paused)
+        if (m_paused.value() != 0)
         {
           m_back_log.push(new BackLogEntry(msg, task));
           return;
         }
       }
 
-      uint16_t id = msg->getId();
-      Concurrency::ScopedRWLock l(m_lock);
-      TransportList& dlst(m_recipients[id]);
-      for (TransportList::iterator itr = dlst.begin(); itr != dlst.end(); ++itr)
+      // Announce this dispatcher in the current epoch. If the epoch
+      // changed meanwhile, a writer may have missed the announcement.
+      int parity = 0;
+      while (true)
+      {
+        int epoch = m_epoch.value();
+        parity = epoch & 1;
+        m_readers[parity].add(1);
+        if (m_epoch.value() == epoch)
+          break;
+        m_readers[parity].sub(1);
+      }
+
+      EpochGuard guard(m_readers[parity]);
+
+      const RecipientList* list = getRecipients(msg->getId());
+      if (list == NULL)
+        return;
+
+      // All recipients share a single copy of the message, which is
+      // only made if at least one subscription accepts it.
+      SharedMessage shared;
+      for (RecipientList::const_iterator itr = list->begin(); itr != list->end(); ++itr)
       {
-        if (*itr != task)
-          (*itr)->receive(msg);
+        if (itr->task == task)
+          continue;
+
+        if (itr->filter != NULL && !itr->filter->matches(msg))
+          continue;
+
+        if (shared.isNull())
+          shared = SharedMessage(msg->clone());
+
+        itr->task->receive(shared);
       }
     }
 
@@ -126,7 +355,8 @@ namespace DUNE
     Bus::resume(void)
     {
       m_paused_lock.lock();
-      m_paused = false;
+      if (m_paused.value() != 0)
+        m_paused.sub(1);
       m_paused_lock.unlock();
 
       while (!m_back_log.empty())
@@ -134,7 +364,7 @@ namespace DUNE
         BackLogEntry* entry = m_back_log.pop();
         if (entry != NULL)
         {
-          dispatch(entry->message, entry->exclude);
+          dispatch(entry->message.get(), entry->exclude);
           delete entry;
         }
       }
@@ -143,7 +373,7 @@ namespace DUNE
     const std::vector<TransportBindings*>
     Bus::getBindings(void)
     {
-      Concurrency::ScopedRWLock l(m_lock);
+      Concurrency::ScopedMutex l(m_lock);
       return m_bind_msgs;
     }
   }
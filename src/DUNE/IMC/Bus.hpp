@@ -32,18 +32,19 @@
 
 // ISO C++ 98 headers.
 #include <cstddef>
-#include <map>
-#include <list>
 #include <string>
 #include <utility>
 #include <vector>
 #include <queue>
 
 // DUNE headers.
+#include <DUNE/IMC/SharedMessage.hpp>
+#include <DUNE/IMC/Subscription.hpp>
 #include <DUNE/Tasks/AbstractTask.hpp>
 #include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/AtomicPointer.hpp>
 #include <DUNE/Concurrency/ScopedMutex.hpp>
-#include <DUNE/Concurrency/ScopedRWLock.hpp>
 
 namespace DUNE
 {
@@ -56,6 +57,19 @@ namespace DUNE
     // Export DLL Symbol.
     class DUNE_DLL_SYM Bus;
 
+    //! The message bus delivers dispatched messages to the tasks
+    //! that registered interest in them. Recipients are kept in a
+    //! table indexed by message identifier whose entries are
+    //! immutable lists: dispatching only loads a pointer and walks a
+    //! vector, while registration builds a new list and publishes it
+    //! atomically. Dispatchers announce themselves in one of two
+    //! epoch counters. Replaced lists are retired and freed once
+    //! both counters were seen empty. Unregistration also waits for
+    //! the dispatchers that started before it, without holding the
+    //! registration lock, so once a task is unregistered no
+    //! dispatcher can deliver messages to it.
+    //! Registrations may carry a subscription that is evaluated
+    //! before a message is copied for the task.
     class Bus
     {
     public:
@@ -66,11 +80,14 @@ namespace DUNE
       ~Bus(void);
 
       //! Register a task as a recipient a given message
-      //! identification number.
+      //! identification number. If the task is already registered
+      //! its subscription is replaced.
       //! @param task task object.
       //! @param id message identification number.
+      //! @param filter subscription messages must match to be
+      //! delivered, or NULL to deliver all messages.
       void
-      registerRecipient(Tasks::AbstractTask* task, uint16_t id);
+      registerRecipient(Tasks::AbstractTask* task, uint16_t id, const Subscription* filter = NULL);
 
       //! Unregister a task as a recipient of a given message
       //! identification number.
@@ -89,7 +106,8 @@ namespace DUNE
       pause(void)
       {
         Concurrency::ScopedMutex lock(m_paused_lock);
-        m_paused = true;
+        if (m_paused.value() == 0)
+          m_paused.add(1);
       }
 
       void
@@ -99,13 +117,54 @@ namespace DUNE
       getBindings(void);
 
     private:
-      typedef std::list<Tasks::AbstractTask*> TransportList;
-      //! Table of recipients.
-      std::map<uint16_t, TransportList> m_recipients;
-      //! Internal list lock.
-      Concurrency::RWLock m_lock;
+      //! Number of message identifiers per table page.
+      static const unsigned c_page_size = 256;
+      //! Number of table pages.
+      static const unsigned c_page_count = 65536 / c_page_size;
+      //! Recipient entry.
+      struct Entry
+      {
+        //! Recipient task.
+        Tasks::AbstractTask* task;
+        //! Subscription or NULL if unfiltered.
+        Subscription* filter;
+      };
+
+      //! Immutable list of recipients.
+      typedef std::vector<Entry> RecipientList;
+      //! Slot of the recipient table.
+      typedef Concurrency::AtomicPointer<const RecipientList> Slot;
+
+      //! Page of the recipient table, allocated on first use.
+      struct Page
+      {
+        Slot slots[c_page_size];
+      };
+
+      //! List replaced while dispatchers may still be using it.
+      struct Retired
+      {
+        //! Replaced list (may be NULL).
+        const RecipientList* list;
+        //! Subscription dropped from the list (may be NULL).
+        Subscription* filter;
+        //! True if no dispatcher of each epoch parity can be
+        //! using the list.
+        bool drained[2];
+      };
+
+      //! Table of recipients indexed by message identifier.
+      Concurrency::AtomicPointer<Page> m_table[c_page_count];
+      //! Current dispatch epoch.
+      Concurrency::AtomicCounter m_epoch;
+      //! Number of dispatchers running in each epoch parity.
+      Concurrency::AtomicCounter m_readers[2];
+      //! Registration lock.
+      Concurrency::Mutex m_lock;
+      //! Lists waiting to be freed.
+      std::vector<Retired> m_retired;
       //! Bus is paused.
-      bool m_paused;
+      Concurrency::AtomicCounter m_paused;
       //! Pause lock.
       Concurrency::Mutex m_paused_lock;
       //! List containing all generated TransportBindings for future logging/reference.
@@ -113,6 +172,64 @@ namespace DUNE
       //! Back log queue. Saves messages when Bus is paused.
       Concurrency::TSQueue<BackLogEntry*> m_back_log;
 
+      //! Retrieve the list of recipients of a given message
+      //! identification number.
+      //! @param id message identification number.
+      //! @return list of recipients or NULL if there are none.
+      const RecipientList*
+      getRecipients(uint16_t id) const
+      {
+        Page* page = m_table[id / c_page_size].load();
+        if (page == NULL)
+          return NULL;
+
+        return page->slots[id % c_page_size].load();
+      }
+
+      //! Retrieve the table slot of a given message identification
+      //! number, allocating its page if needed. Must be called with
+      //! the registration lock held.
+      //! @param id message identification number.
+      //! @return table slot.
+      Slot&
+      getSlot(uint16_t id);
+
+      //! Find the entry of a given task.
+      //! @param list list of recipients (may be NULL).
+      //! @param task task object.
+      //! @return index of the entry or -1 if not found.
+      static int
+      find(const RecipientList* list, const Tasks::AbstractTask* task);
+
+      //! Publish a new list of recipients and retire the old one.
+      //! Must be called with the registration lock held.
+      //! @param slot table slot.
+      //! @param list new list of recipients (may be NULL).
+      //! @param filter subscription dropped from the old list (may be
+      //! NULL).
+      void
+      publish(Slot& slot, const RecipientList* list, Subscription* filter);
+
+      //! Remove a task from the recipients of a given message
+      //! identification number. Must be called with the
+      //! registration lock held.
+      //! @param task task object.
+      //! @param id message identification number.
+      //! @return true if the task was a recipient, false otherwise.
+      bool
+      remove(Tasks::AbstractTask* task, uint16_t id);
+
+      //! Free the retired lists no dispatcher can be using. Must be
+      //! called with the registration lock held.
+      void
+      reclaim(void);
+
+      //! Wait until all dispatchers that started before this call
+      //! have finished. Must be called without the registration
+      //! lock, dispatchers may be blocked on full queues.
+      void
+      synchronize(void);
+
       //! Non - copyable.
       Bus(Bus const&);
 
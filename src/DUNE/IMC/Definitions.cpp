@@ -278,25 +278,30 @@ namespace DUNE
     uint8_t*
     QueryEntityInfo::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     QueryEntityInfo::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     QueryEntityInfo::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
@@ -409,25 +414,30 @@ namespace DUNE
     uint8_t*
     CpuUsage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     CpuUsage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     CpuUsage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 1;
     }
 
     fp64_t
@@ -539,25 +549,30 @@ namespace DUNE
     uint8_t*
     RestartSystem::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(type, ptr__);
-      return ptr__;
+      IMC::serialize(type, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     RestartSystem::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(type, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     RestartSystem::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(type, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -595,25 +610,30 @@ namespace DUNE
     uint8_t*
     DevCalibrationControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     DevCalibrationControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     DevCalibrationControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -875,76 +895,81 @@ namespace DUNE
     uint8_t*
     VehicleOperationalLimits::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(speed_min, ptr__);
-      ptr__ += IMC::serialize(speed_max, ptr__);
-      ptr__ += IMC::serialize(long_accel, ptr__);
-      ptr__ += IMC::serialize(alt_max_msl, ptr__);
-      ptr__ += IMC::serialize(dive_fraction_max, ptr__);
-      ptr__ += IMC::serialize(climb_fraction_max, ptr__);
-      ptr__ += IMC::serialize(bank_max, ptr__);
-      ptr__ += IMC::serialize(p_max, ptr__);
-      ptr__ += IMC::serialize(pitch_min, ptr__);
-      ptr__ += IMC::serialize(pitch_max, ptr__);
-      ptr__ += IMC::serialize(q_max, ptr__);
-      ptr__ += IMC::serialize(g_min, ptr__);
-      ptr__ += IMC::serialize(g_max, ptr__);
-      ptr__ += IMC::serialize(g_lat_max, ptr__);
-      ptr__ += IMC::serialize(rpm_min, ptr__);
-      ptr__ += IMC::serialize(rpm_max, ptr__);
-      ptr__ += IMC::serialize(rpm_rate_max, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(speed_min, bfr__ + 1);
+      IMC::serialize(speed_max, bfr__ + 5);
+      IMC::serialize(long_accel, bfr__ + 9);
+      IMC::serialize(alt_max_msl, bfr__ + 13);
+      IMC::serialize(dive_fraction_max, bfr__ + 17);
+      IMC::serialize(climb_fraction_max, bfr__ + 21);
+      IMC::serialize(bank_max, bfr__ + 25);
+      IMC::serialize(p_max, bfr__ + 29);
+      IMC::serialize(pitch_min, bfr__ + 33);
+      IMC::serialize(pitch_max, bfr__ + 37);
+      IMC::serialize(q_max, bfr__ + 41);
+      IMC::serialize(g_min, bfr__ + 45);
+      IMC::serialize(g_max, bfr__ + 49);
+      IMC::serialize(g_lat_max, bfr__ + 53);
+      IMC::serialize(rpm_min, bfr__ + 57);
+      IMC::serialize(rpm_max, bfr__ + 61);
+      IMC::serialize(rpm_rate_max, bfr__ + 65);
+      return bfr__ + 69;
     }
 
     uint16_t
     VehicleOperationalLimits::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_min, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_max, bfr__, size__);
-      bfr__ += IMC::deserialize(long_accel, bfr__, size__);
-      bfr__ += IMC::deserialize(alt_max_msl, bfr__, size__);
-      bfr__ += IMC::deserialize(dive_fraction_max, bfr__, size__);
-      bfr__ += IMC::deserialize(climb_fraction_max, bfr__, size__);
-      bfr__ += IMC::deserialize(bank_max, bfr__, size__);
-      bfr__ += IMC::deserialize(p_max, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch_min, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch_max, bfr__, size__);
-      bfr__ += IMC::deserialize(q_max, bfr__, size__);
-      bfr__ += IMC::deserialize(g_min, bfr__, size__);
-      bfr__ += IMC::deserialize(g_max, bfr__, size__);
-      bfr__ += IMC::deserialize(g_lat_max, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_rate_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 69)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      IMC::deserializeFixed(speed_min, bfr__ + 1);
+      IMC::deserializeFixed(speed_max, bfr__ + 5);
+      IMC::deserializeFixed(long_accel, bfr__ + 9);
+      IMC::deserializeFixed(alt_max_msl, bfr__ + 13);
+      IMC::deserializeFixed(dive_fraction_max, bfr__ + 17);
+      IMC::deserializeFixed(climb_fraction_max, bfr__ + 21);
+      IMC::deserializeFixed(bank_max, bfr__ + 25);
+      IMC::deserializeFixed(p_max, bfr__ + 29);
+      IMC::deserializeFixed(pitch_min, bfr__ + 33);
+      IMC::deserializeFixed(pitch_max, bfr__ + 37);
+      IMC::deserializeFixed(q_max, bfr__ + 41);
+      IMC::deserializeFixed(g_min, bfr__ + 45);
+      IMC::deserializeFixed(g_max, bfr__ + 49);
+      IMC::deserializeFixed(g_lat_max, bfr__ + 53);
+      IMC::deserializeFixed(rpm_min, bfr__ + 57);
+      IMC::deserializeFixed(rpm_max, bfr__ + 61);
+      IMC::deserializeFixed(rpm_rate_max, bfr__ + 65);
+      return 69;
     }
 
     uint16_t
     VehicleOperationalLimits::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(long_accel, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt_max_msl, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dive_fraction_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(climb_fraction_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bank_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(g_lat_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_rate_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 69)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      IMC::reverseDeserializeFixed(speed_min, bfr__ + 1);
+      IMC::reverseDeserializeFixed(speed_max, bfr__ + 5);
+      IMC::reverseDeserializeFixed(long_accel, bfr__ + 9);
+      IMC::reverseDeserializeFixed(alt_max_msl, bfr__ + 13);
+      IMC::reverseDeserializeFixed(dive_fraction_max, bfr__ + 17);
+      IMC::reverseDeserializeFixed(climb_fraction_max, bfr__ + 21);
+      IMC::reverseDeserializeFixed(bank_max, bfr__ + 25);
+      IMC::reverseDeserializeFixed(p_max, bfr__ + 29);
+      IMC::reverseDeserializeFixed(pitch_min, bfr__ + 33);
+      IMC::reverseDeserializeFixed(pitch_max, bfr__ + 37);
+      IMC::reverseDeserializeFixed(q_max, bfr__ + 41);
+      IMC::reverseDeserializeFixed(g_min, bfr__ + 45);
+      IMC::reverseDeserializeFixed(g_max, bfr__ + 49);
+      IMC::reverseDeserializeFixed(g_lat_max, bfr__ + 53);
+      IMC::reverseDeserializeFixed(rpm_min, bfr__ + 57);
+      IMC::reverseDeserializeFixed(rpm_max, bfr__ + 61);
+      IMC::reverseDeserializeFixed(rpm_rate_max, bfr__ + 65);
+      return 69;
     }
 
     void
@@ -1128,76 +1153,81 @@ namespace DUNE
     uint8_t*
     SimulatedState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(svx, ptr__);
-      ptr__ += IMC::serialize(svy, ptr__);
-      ptr__ += IMC::serialize(svz, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(height, bfr__ + 16);
+      IMC::serialize(x, bfr__ + 20);
+      IMC::serialize(y, bfr__ + 24);
+      IMC::serialize(z, bfr__ + 28);
+      IMC::serialize(phi, bfr__ + 32);
+      IMC::serialize(theta, bfr__ + 36);
+      IMC::serialize(psi, bfr__ + 40);
+      IMC::serialize(u, bfr__ + 44);
+      IMC::serialize(v, bfr__ + 48);
+      IMC::serialize(w, bfr__ + 52);
+      IMC::serialize(p, bfr__ + 56);
+      IMC::serialize(q, bfr__ + 60);
+      IMC::serialize(r, bfr__ + 64);
+      IMC::serialize(svx, bfr__ + 68);
+      IMC::serialize(svy, bfr__ + 72);
+      IMC::serialize(svz, bfr__ + 76);
+      return bfr__ + 80;
     }
 
     uint16_t
     SimulatedState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(svx, bfr__, size__);
-      bfr__ += IMC::deserialize(svy, bfr__, size__);
-      bfr__ += IMC::deserialize(svz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 80)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(lat, bfr__ + 0);
+      IMC::deserializeFixed(lon, bfr__ + 8);
+      IMC::deserializeFixed(height, bfr__ + 16);
+      IMC::deserializeFixed(x, bfr__ + 20);
+      IMC::deserializeFixed(y, bfr__ + 24);
+      IMC::deserializeFixed(z, bfr__ + 28);
+      IMC::deserializeFixed(phi, bfr__ + 32);
+      IMC::deserializeFixed(theta, bfr__ + 36);
+      IMC::deserializeFixed(psi, bfr__ + 40);
+      IMC::deserializeFixed(u, bfr__ + 44);
+      IMC::deserializeFixed(v, bfr__ + 48);
+      IMC::deserializeFixed(w, bfr__ + 52);
+      IMC::deserializeFixed(p, bfr__ + 56);
+      IMC::deserializeFixed(q, bfr__ + 60);
+      IMC::deserializeFixed(r, bfr__ + 64);
+      IMC::deserializeFixed(svx, bfr__ + 68);
+      IMC::deserializeFixed(svy, bfr__ + 72);
+      IMC::deserializeFixed(svz, bfr__ + 76);
+      return 80;
     }
 
     uint16_t
     SimulatedState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(svz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 80)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(lat, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 8);
+      IMC::reverseDeserializeFixed(height, bfr__ + 16);
+      IMC::reverseDeserializeFixed(x, bfr__ + 20);
+      IMC::reverseDeserializeFixed(y, bfr__ + 24);
+      IMC::reverseDeserializeFixed(z, bfr__ + 28);
+      IMC::reverseDeserializeFixed(phi, bfr__ + 32);
+      IMC::reverseDeserializeFixed(theta, bfr__ + 36);
+      IMC::reverseDeserializeFixed(psi, bfr__ + 40);
+      IMC::reverseDeserializeFixed(u, bfr__ + 44);
+      IMC::reverseDeserializeFixed(v, bfr__ + 48);
+      IMC::reverseDeserializeFixed(w, bfr__ + 52);
+      IMC::reverseDeserializeFixed(p, bfr__ + 56);
+      IMC::reverseDeserializeFixed(q, bfr__ + 60);
+      IMC::reverseDeserializeFixed(r, bfr__ + 64);
+      IMC::reverseDeserializeFixed(svx, bfr__ + 68);
+      IMC::reverseDeserializeFixed(svy, bfr__ + 72);
+      IMC::reverseDeserializeFixed(svz, bfr__ + 76);
+      return 80;
     }
 
     void
@@ -1386,31 +1416,36 @@ namespace DUNE
     uint8_t*
     DynamicsSimParam::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(tas2acc_pgain, ptr__);
-      ptr__ += IMC::serialize(bank2p_pgain, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(tas2acc_pgain, bfr__ + 1);
+      IMC::serialize(bank2p_pgain, bfr__ + 5);
+      return bfr__ + 9;
     }
 
     uint16_t
     DynamicsSimParam::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(tas2acc_pgain, bfr__, size__);
-      bfr__ += IMC::deserialize(bank2p_pgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      IMC::deserializeFixed(tas2acc_pgain, bfr__ + 1);
+      IMC::deserializeFixed(bank2p_pgain, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
     DynamicsSimParam::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(tas2acc_pgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bank2p_pgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      IMC::reverseDeserializeFixed(tas2acc_pgain, bfr__ + 1);
+      IMC::reverseDeserializeFixed(bank2p_pgain, bfr__ + 5);
+      return 9;
     }
 
     void
@@ -1453,28 +1488,33 @@ namespace DUNE
     uint8_t*
     StorageUsage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(available, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(available, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     StorageUsage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(available, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(available, bfr__ + 0);
+      IMC::deserializeFixed(value, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     StorageUsage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(available, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(available, bfr__ + 0);
+      IMC::deserializeFixed(value, bfr__ + 4);
+      return 5;
     }
 
     fp64_t
@@ -1941,31 +1981,36 @@ namespace DUNE
     uint8_t*
     ClockControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(clock, ptr__);
-      ptr__ += IMC::serialize(tz, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(clock, bfr__ + 1);
+      IMC::serialize(tz, bfr__ + 9);
+      return bfr__ + 10;
     }
 
     uint16_t
     ClockControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(clock, bfr__, size__);
-      bfr__ += IMC::deserialize(tz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      IMC::deserializeFixed(clock, bfr__ + 1);
+      IMC::deserializeFixed(tz, bfr__ + 9);
+      return 10;
     }
 
     uint16_t
     ClockControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(clock, bfr__, size__);
-      bfr__ += IMC::deserialize(tz, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      IMC::reverseDeserializeFixed(clock, bfr__ + 1);
+      IMC::deserializeFixed(tz, bfr__ + 9);
+      return 10;
     }
 
     void
@@ -2009,31 +2054,36 @@ namespace DUNE
     uint8_t*
     HistoricCTD::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(conductivity, ptr__);
-      ptr__ += IMC::serialize(temperature, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      return ptr__;
+      IMC::serialize(conductivity, bfr__ + 0);
+      IMC::serialize(temperature, bfr__ + 4);
+      IMC::serialize(depth, bfr__ + 8);
+      return bfr__ + 12;
     }
 
     uint16_t
     HistoricCTD::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(conductivity, bfr__, size__);
-      bfr__ += IMC::deserialize(temperature, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(conductivity, bfr__ + 0);
+      IMC::deserializeFixed(temperature, bfr__ + 4);
+      IMC::deserializeFixed(depth, bfr__ + 8);
+      return 12;
     }
 
     uint16_t
     HistoricCTD::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(conductivity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(temperature, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(conductivity, bfr__ + 0);
+      IMC::reverseDeserializeFixed(temperature, bfr__ + 4);
+      IMC::reverseDeserializeFixed(depth, bfr__ + 8);
+      return 12;
     }
 
     void
@@ -2081,37 +2131,42 @@ namespace DUNE
     uint8_t*
     HistoricTelemetry::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(altitude, ptr__);
-      ptr__ += IMC::serialize(roll, ptr__);
-      ptr__ += IMC::serialize(pitch, ptr__);
-      ptr__ += IMC::serialize(yaw, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      return ptr__;
+      IMC::serialize(altitude, bfr__ + 0);
+      IMC::serialize(roll, bfr__ + 4);
+      IMC::serialize(pitch, bfr__ + 6);
+      IMC::serialize(yaw, bfr__ + 8);
+      IMC::serialize(speed, bfr__ + 10);
+      return bfr__ + 12;
     }
 
     uint16_t
     HistoricTelemetry::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(roll, bfr__, size__);
-      bfr__ += IMC::deserialize(pitch, bfr__, size__);
-      bfr__ += IMC::deserialize(yaw, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(altitude, bfr__ + 0);
+      IMC::deserializeFixed(roll, bfr__ + 4);
+      IMC::deserializeFixed(pitch, bfr__ + 6);
+      IMC::deserializeFixed(yaw, bfr__ + 8);
+      IMC::deserializeFixed(speed, bfr__ + 10);
+      return 12;
     }
 
     uint16_t
     HistoricTelemetry::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(roll, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(pitch, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(yaw, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(altitude, bfr__ + 0);
+      IMC::reverseDeserializeFixed(roll, bfr__ + 4);
+      IMC::reverseDeserializeFixed(pitch, bfr__ + 6);
+      IMC::reverseDeserializeFixed(yaw, bfr__ + 8);
+      IMC::reverseDeserializeFixed(speed, bfr__ + 10);
+      return 12;
     }
 
     void
@@ -2309,28 +2364,33 @@ namespace DUNE
     uint8_t*
     ProfileSample::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(avg, ptr__);
-      return ptr__;
+      IMC::serialize(depth, bfr__ + 0);
+      IMC::serialize(avg, bfr__ + 2);
+      return bfr__ + 6;
     }
 
     uint16_t
     ProfileSample::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(avg, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(depth, bfr__ + 0);
+      IMC::deserializeFixed(avg, bfr__ + 2);
+      return 6;
     }
 
     uint16_t
     ProfileSample::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(avg, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(depth, bfr__ + 0);
+      IMC::reverseDeserializeFixed(avg, bfr__ + 2);
+      return 6;
     }
 
     void
@@ -2676,25 +2736,30 @@ namespace DUNE
     uint8_t*
     RSSI::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     RSSI::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     RSSI::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -2744,25 +2809,30 @@ namespace DUNE
     uint8_t*
     VSWR::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     VSWR::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     VSWR::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -2812,25 +2882,30 @@ namespace DUNE
     uint8_t*
     LinkLevel::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     LinkLevel::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     LinkLevel::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -3569,28 +3644,33 @@ namespace DUNE
     uint8_t*
     LinkLatency::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(sys_src, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(sys_src, bfr__ + 4);
+      return bfr__ + 6;
     }
 
     uint16_t
     LinkLatency::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_src, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      IMC::deserializeFixed(sys_src, bfr__ + 4);
+      return 6;
     }
 
     uint16_t
     LinkLatency::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_src, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      IMC::reverseDeserializeFixed(sys_src, bfr__ + 4);
+      return 6;
     }
 
     fp64_t
@@ -3643,28 +3723,33 @@ namespace DUNE
     uint8_t*
     ExtendedRSSI::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(units, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(units, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     ExtendedRSSI::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      IMC::deserializeFixed(units, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     ExtendedRSSI::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      IMC::deserializeFixed(units, bfr__ + 4);
+      return 5;
     }
 
     fp64_t
@@ -4452,28 +4537,33 @@ namespace DUNE
     uint8_t*
     LblRange::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(range, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(range, bfr__ + 1);
+      return bfr__ + 5;
     }
 
     uint16_t
     LblRange::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(range, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::deserializeFixed(range, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
     LblRange::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(range, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::reverseDeserializeFixed(range, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
@@ -5308,25 +5398,30 @@ namespace DUNE
     uint8_t*
     Rpm::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 2;
     }
 
     uint16_t
     Rpm::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 2;
     }
 
     uint16_t
     Rpm::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 2;
     }
 
     fp64_t
@@ -5376,25 +5471,30 @@ namespace DUNE
     uint8_t*
     Voltage::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Voltage::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Voltage::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -5444,25 +5544,30 @@ namespace DUNE
     uint8_t*
     Current::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Current::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Current::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -5544,70 +5649,75 @@ namespace DUNE
     uint8_t*
     GpsFix::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(utc_year, ptr__);
-      ptr__ += IMC::serialize(utc_month, ptr__);
-      ptr__ += IMC::serialize(utc_day, ptr__);
-      ptr__ += IMC::serialize(utc_time, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(satellites, ptr__);
-      ptr__ += IMC::serialize(cog, ptr__);
-      ptr__ += IMC::serialize(sog, ptr__);
-      ptr__ += IMC::serialize(hdop, ptr__);
-      ptr__ += IMC::serialize(vdop, ptr__);
-      ptr__ += IMC::serialize(hacc, ptr__);
-      ptr__ += IMC::serialize(vacc, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 2);
+      IMC::serialize(utc_year, bfr__ + 3);
+      IMC::serialize(utc_month, bfr__ + 5);
+      IMC::serialize(utc_day, bfr__ + 6);
+      IMC::serialize(utc_time, bfr__ + 7);
+      IMC::serialize(lat, bfr__ + 11);
+      IMC::serialize(lon, bfr__ + 19);
+      IMC::serialize(height, bfr__ + 27);
+      IMC::serialize(satellites, bfr__ + 31);
+      IMC::serialize(cog, bfr__ + 32);
+      IMC::serialize(sog, bfr__ + 36);
+      IMC::serialize(hdop, bfr__ + 40);
+      IMC::serialize(vdop, bfr__ + 44);
+      IMC::serialize(hacc, bfr__ + 48);
+      IMC::serialize(vacc, bfr__ + 52);
+      return bfr__ + 56;
     }
 
     uint16_t
     GpsFix::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_year, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_month, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_day, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::deserialize(cog, bfr__, size__);
-      bfr__ += IMC::deserialize(sog, bfr__, size__);
-      bfr__ += IMC::deserialize(hdop, bfr__, size__);
-      bfr__ += IMC::deserialize(vdop, bfr__, size__);
-      bfr__ += IMC::deserialize(hacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(validity, bfr__ + 0);
+      IMC::deserializeFixed(type, bfr__ + 2);
+      IMC::deserializeFixed(utc_year, bfr__ + 3);
+      IMC::deserializeFixed(utc_month, bfr__ + 5);
+      IMC::deserializeFixed(utc_day, bfr__ + 6);
+      IMC::deserializeFixed(utc_time, bfr__ + 7);
+      IMC::deserializeFixed(lat, bfr__ + 11);
+      IMC::deserializeFixed(lon, bfr__ + 19);
+      IMC::deserializeFixed(height, bfr__ + 27);
+      IMC::deserializeFixed(satellites, bfr__ + 31);
+      IMC::deserializeFixed(cog, bfr__ + 32);
+      IMC::deserializeFixed(sog, bfr__ + 36);
+      IMC::deserializeFixed(hdop, bfr__ + 40);
+      IMC::deserializeFixed(vdop, bfr__ + 44);
+      IMC::deserializeFixed(hacc, bfr__ + 48);
+      IMC::deserializeFixed(vacc, bfr__ + 52);
+      return 56;
     }
 
     uint16_t
     GpsFix::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(utc_year, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_month, bfr__, size__);
-      bfr__ += IMC::deserialize(utc_day, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hdop, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vdop, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(validity, bfr__ + 0);
+      IMC::deserializeFixed(type, bfr__ + 2);
+      IMC::reverseDeserializeFixed(utc_year, bfr__ + 3);
+      IMC::deserializeFixed(utc_month, bfr__ + 5);
+      IMC::deserializeFixed(utc_day, bfr__ + 6);
+      IMC::reverseDeserializeFixed(utc_time, bfr__ + 7);
+      IMC::reverseDeserializeFixed(lat, bfr__ + 11);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 19);
+      IMC::reverseDeserializeFixed(height, bfr__ + 27);
+      IMC::deserializeFixed(satellites, bfr__ + 31);
+      IMC::reverseDeserializeFixed(cog, bfr__ + 32);
+      IMC::reverseDeserializeFixed(sog, bfr__ + 36);
+      IMC::reverseDeserializeFixed(hdop, bfr__ + 40);
+      IMC::reverseDeserializeFixed(vdop, bfr__ + 44);
+      IMC::reverseDeserializeFixed(hacc, bfr__ + 48);
+      IMC::reverseDeserializeFixed(vacc, bfr__ + 52);
+      return 56;
     }
 
     void
@@ -5672,37 +5782,42 @@ namespace DUNE
     uint8_t*
     EulerAngles::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(psi_magnetic, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(phi, bfr__ + 8);
+      IMC::serialize(theta, bfr__ + 16);
+      IMC::serialize(psi, bfr__ + 24);
+      IMC::serialize(psi_magnetic, bfr__ + 32);
+      return bfr__ + 40;
     }
 
     uint16_t
     EulerAngles::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(psi_magnetic, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 40)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(time, bfr__ + 0);
+      IMC::deserializeFixed(phi, bfr__ + 8);
+      IMC::deserializeFixed(theta, bfr__ + 16);
+      IMC::deserializeFixed(psi, bfr__ + 24);
+      IMC::deserializeFixed(psi_magnetic, bfr__ + 32);
+      return 40;
     }
 
     uint16_t
     EulerAngles::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi_magnetic, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 40)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(time, bfr__ + 0);
+      IMC::reverseDeserializeFixed(phi, bfr__ + 8);
+      IMC::reverseDeserializeFixed(theta, bfr__ + 16);
+      IMC::reverseDeserializeFixed(psi, bfr__ + 24);
+      IMC::reverseDeserializeFixed(psi_magnetic, bfr__ + 32);
+      return 40;
     }
 
     void
@@ -5752,37 +5867,42 @@ namespace DUNE
     uint8_t*
     EulerAnglesDelta::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(timestep, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      IMC::serialize(timestep, bfr__ + 32);
+      return bfr__ + 36;
     }
 
     uint16_t
     EulerAnglesDelta::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 36)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(time, bfr__ + 0);
+      IMC::deserializeFixed(x, bfr__ + 8);
+      IMC::deserializeFixed(y, bfr__ + 16);
+      IMC::deserializeFixed(z, bfr__ + 24);
+      IMC::deserializeFixed(timestep, bfr__ + 32);
+      return 36;
     }
 
     uint16_t
     EulerAnglesDelta::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 36)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(time, bfr__ + 0);
+      IMC::reverseDeserializeFixed(x, bfr__ + 8);
+      IMC::reverseDeserializeFixed(y, bfr__ + 16);
+      IMC::reverseDeserializeFixed(z, bfr__ + 24);
+      IMC::reverseDeserializeFixed(timestep, bfr__ + 32);
+      return 36;
     }
 
     void
@@ -5830,34 +5950,39 @@ namespace DUNE
     uint8_t*
     AngularVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + 32;
     }
 
     uint16_t
     AngularVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(time, bfr__ + 0);
+      IMC::deserializeFixed(x, bfr__ + 8);
+      IMC::deserializeFixed(y, bfr__ + 16);
+      IMC::deserializeFixed(z, bfr__ + 24);
+      return 32;
     }
 
     uint16_t
     AngularVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(time, bfr__ + 0);
+      IMC::reverseDeserializeFixed(x, bfr__ + 8);
+      IMC::reverseDeserializeFixed(y, bfr__ + 16);
+      IMC::reverseDeserializeFixed(z, bfr__ + 24);
+      return 32;
     }
 
     void
@@ -5904,34 +6029,39 @@ namespace DUNE
     uint8_t*
     Acceleration::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + 32;
     }
 
     uint16_t
     Acceleration::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(time, bfr__ + 0);
+      IMC::deserializeFixed(x, bfr__ + 8);
+      IMC::deserializeFixed(y, bfr__ + 16);
+      IMC::deserializeFixed(z, bfr__ + 24);
+      return 32;
     }
 
     uint16_t
     Acceleration::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(time, bfr__ + 0);
+      IMC::reverseDeserializeFixed(x, bfr__ + 8);
+      IMC::reverseDeserializeFixed(y, bfr__ + 16);
+      IMC::reverseDeserializeFixed(z, bfr__ + 24);
+      return 32;
     }
 
     void
@@ -5978,34 +6108,39 @@ namespace DUNE
     uint8_t*
     MagneticField::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + 32;
     }
 
     uint16_t
     MagneticField::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(time, bfr__ + 0);
+      IMC::deserializeFixed(x, bfr__ + 8);
+      IMC::deserializeFixed(y, bfr__ + 16);
+      IMC::deserializeFixed(z, bfr__ + 24);
+      return 32;
     }
 
     uint16_t
     MagneticField::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(time, bfr__ + 0);
+      IMC::reverseDeserializeFixed(x, bfr__ + 8);
+      IMC::reverseDeserializeFixed(y, bfr__ + 16);
+      IMC::reverseDeserializeFixed(z, bfr__ + 24);
+      return 32;
     }
 
     void
@@ -6052,34 +6187,39 @@ namespace DUNE
     uint8_t*
     GroundVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 9);
+      IMC::serialize(z, bfr__ + 17);
+      return bfr__ + 25;
     }
 
     uint16_t
     GroundVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 25)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(validity, bfr__ + 0);
+      IMC::deserializeFixed(x, bfr__ + 1);
+      IMC::deserializeFixed(y, bfr__ + 9);
+      IMC::deserializeFixed(z, bfr__ + 17);
+      return 25;
     }
 
     uint16_t
     GroundVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 25)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(validity, bfr__ + 0);
+      IMC::reverseDeserializeFixed(x, bfr__ + 1);
+      IMC::reverseDeserializeFixed(y, bfr__ + 9);
+      IMC::reverseDeserializeFixed(z, bfr__ + 17);
+      return 25;
     }
 
     void
@@ -6126,34 +6266,39 @@ namespace DUNE
     uint8_t*
     WaterVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 9);
+      IMC::serialize(z, bfr__ + 17);
+      return bfr__ + 25;
     }
 
     uint16_t
     WaterVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 25)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(validity, bfr__ + 0);
+      IMC::deserializeFixed(x, bfr__ + 1);
+      IMC::deserializeFixed(y, bfr__ + 9);
+      IMC::deserializeFixed(z, bfr__ + 17);
+      return 25;
     }
 
     uint16_t
     WaterVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 25)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(validity, bfr__ + 0);
+      IMC::reverseDeserializeFixed(x, bfr__ + 1);
+      IMC::reverseDeserializeFixed(y, bfr__ + 9);
+      IMC::reverseDeserializeFixed(z, bfr__ + 17);
+      return 25;
     }
 
     void
@@ -6200,34 +6345,39 @@ namespace DUNE
     uint8_t*
     VelocityDelta::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(time, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(time, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 8);
+      IMC::serialize(y, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      return bfr__ + 32;
     }
 
     uint16_t
     VelocityDelta::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(time, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(time, bfr__ + 0);
+      IMC::deserializeFixed(x, bfr__ + 8);
+      IMC::deserializeFixed(y, bfr__ + 16);
+      IMC::deserializeFixed(z, bfr__ + 24);
+      return 32;
     }
 
     uint16_t
     VelocityDelta::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 32)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(time, bfr__ + 0);
+      IMC::reverseDeserializeFixed(x, bfr__ + 8);
+      IMC::reverseDeserializeFixed(y, bfr__ + 16);
+      IMC::reverseDeserializeFixed(z, bfr__ + 24);
+      return 32;
     }
 
     void
@@ -6278,40 +6428,45 @@ namespace DUNE
     uint8_t*
     DeviceState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      IMC::serialize(phi, bfr__ + 12);
+      IMC::serialize(theta, bfr__ + 16);
+      IMC::serialize(psi, bfr__ + 20);
+      return bfr__ + 24;
     }
 
     uint16_t
     DeviceState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(x, bfr__ + 0);
+      IMC::deserializeFixed(y, bfr__ + 4);
+      IMC::deserializeFixed(z, bfr__ + 8);
+      IMC::deserializeFixed(phi, bfr__ + 12);
+      IMC::deserializeFixed(theta, bfr__ + 16);
+      IMC::deserializeFixed(psi, bfr__ + 20);
+      return 24;
     }
 
     uint16_t
     DeviceState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(x, bfr__ + 0);
+      IMC::reverseDeserializeFixed(y, bfr__ + 4);
+      IMC::reverseDeserializeFixed(z, bfr__ + 8);
+      IMC::reverseDeserializeFixed(phi, bfr__ + 12);
+      IMC::reverseDeserializeFixed(theta, bfr__ + 16);
+      IMC::reverseDeserializeFixed(psi, bfr__ + 20);
+      return 24;
     }
 
     void
@@ -6358,28 +6513,33 @@ namespace DUNE
     uint8_t*
     BeamConfig::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(beam_width, ptr__);
-      ptr__ += IMC::serialize(beam_height, ptr__);
-      return ptr__;
+      IMC::serialize(beam_width, bfr__ + 0);
+      IMC::serialize(beam_height, bfr__ + 4);
+      return bfr__ + 8;
     }
 
     uint16_t
     BeamConfig::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(beam_width, bfr__, size__);
-      bfr__ += IMC::deserialize(beam_height, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(beam_width, bfr__ + 0);
+      IMC::deserializeFixed(beam_height, bfr__ + 4);
+      return 8;
     }
 
     uint16_t
     BeamConfig::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(beam_width, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(beam_height, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(beam_width, bfr__ + 0);
+      IMC::reverseDeserializeFixed(beam_height, bfr__ + 4);
+      return 8;
     }
 
     void
@@ -6546,25 +6706,30 @@ namespace DUNE
     uint8_t*
     Temperature::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Temperature::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Temperature::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6614,25 +6779,30 @@ namespace DUNE
     uint8_t*
     Pressure::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     Pressure::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     Pressure::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -6682,25 +6852,30 @@ namespace DUNE
     uint8_t*
     Depth::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Depth::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Depth::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6750,25 +6925,30 @@ namespace DUNE
     uint8_t*
     DepthOffset::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     DepthOffset::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     DepthOffset::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6818,25 +6998,30 @@ namespace DUNE
     uint8_t*
     SoundSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     SoundSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     SoundSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6886,25 +7071,30 @@ namespace DUNE
     uint8_t*
     WaterDensity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     WaterDensity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     WaterDensity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -6954,25 +7144,30 @@ namespace DUNE
     uint8_t*
     Conductivity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Conductivity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Conductivity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7022,25 +7217,30 @@ namespace DUNE
     uint8_t*
     Salinity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Salinity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Salinity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7094,31 +7294,36 @@ namespace DUNE
     uint8_t*
     WindSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(direction, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      return ptr__;
+      IMC::serialize(direction, bfr__ + 0);
+      IMC::serialize(speed, bfr__ + 4);
+      IMC::serialize(turbulence, bfr__ + 8);
+      return bfr__ + 12;
     }
 
     uint16_t
     WindSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(direction, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(direction, bfr__ + 0);
+      IMC::deserializeFixed(speed, bfr__ + 4);
+      IMC::deserializeFixed(turbulence, bfr__ + 8);
+      return 12;
     }
 
     uint16_t
     WindSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(direction, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(direction, bfr__ + 0);
+      IMC::reverseDeserializeFixed(speed, bfr__ + 4);
+      IMC::reverseDeserializeFixed(turbulence, bfr__ + 8);
+      return 12;
     }
 
     void
@@ -7159,25 +7364,30 @@ namespace DUNE
     uint8_t*
     RelativeHumidity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     RelativeHumidity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     RelativeHumidity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7339,25 +7549,30 @@ namespace DUNE
     uint8_t*
     Force::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Force::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Force::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -7575,25 +7790,30 @@ namespace DUNE
     uint8_t*
     PulseDetectionControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     PulseDetectionControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     PulseDetectionControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -7741,67 +7961,72 @@ namespace DUNE
     uint8_t*
     GpsNavData::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(itow, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height_ell, ptr__);
-      ptr__ += IMC::serialize(height_sea, ptr__);
-      ptr__ += IMC::serialize(hacc, ptr__);
-      ptr__ += IMC::serialize(vacc, ptr__);
-      ptr__ += IMC::serialize(vel_n, ptr__);
-      ptr__ += IMC::serialize(vel_e, ptr__);
-      ptr__ += IMC::serialize(vel_d, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(gspeed, ptr__);
-      ptr__ += IMC::serialize(heading, ptr__);
-      ptr__ += IMC::serialize(sacc, ptr__);
-      ptr__ += IMC::serialize(cacc, ptr__);
-      return ptr__;
+      IMC::serialize(itow, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 4);
+      IMC::serialize(lon, bfr__ + 12);
+      IMC::serialize(height_ell, bfr__ + 20);
+      IMC::serialize(height_sea, bfr__ + 24);
+      IMC::serialize(hacc, bfr__ + 28);
+      IMC::serialize(vacc, bfr__ + 32);
+      IMC::serialize(vel_n, bfr__ + 36);
+      IMC::serialize(vel_e, bfr__ + 40);
+      IMC::serialize(vel_d, bfr__ + 44);
+      IMC::serialize(speed, bfr__ + 48);
+      IMC::serialize(gspeed, bfr__ + 52);
+      IMC::serialize(heading, bfr__ + 56);
+      IMC::serialize(sacc, bfr__ + 60);
+      IMC::serialize(cacc, bfr__ + 64);
+      return bfr__ + 68;
     }
 
     uint16_t
     GpsNavData::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(itow, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height_ell, bfr__, size__);
-      bfr__ += IMC::deserialize(height_sea, bfr__, size__);
-      bfr__ += IMC::deserialize(hacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vacc, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_n, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_e, bfr__, size__);
-      bfr__ += IMC::deserialize(vel_d, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(gspeed, bfr__, size__);
-      bfr__ += IMC::deserialize(heading, bfr__, size__);
-      bfr__ += IMC::deserialize(sacc, bfr__, size__);
-      bfr__ += IMC::deserialize(cacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 68)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(itow, bfr__ + 0);
+      IMC::deserializeFixed(lat, bfr__ + 4);
+      IMC::deserializeFixed(lon, bfr__ + 12);
+      IMC::deserializeFixed(height_ell, bfr__ + 20);
+      IMC::deserializeFixed(height_sea, bfr__ + 24);
+      IMC::deserializeFixed(hacc, bfr__ + 28);
+      IMC::deserializeFixed(vacc, bfr__ + 32);
+      IMC::deserializeFixed(vel_n, bfr__ + 36);
+      IMC::deserializeFixed(vel_e, bfr__ + 40);
+      IMC::deserializeFixed(vel_d, bfr__ + 44);
+      IMC::deserializeFixed(speed, bfr__ + 48);
+      IMC::deserializeFixed(gspeed, bfr__ + 52);
+      IMC::deserializeFixed(heading, bfr__ + 56);
+      IMC::deserializeFixed(sacc, bfr__ + 60);
+      IMC::deserializeFixed(cacc, bfr__ + 64);
+      return 68;
     }
 
     uint16_t
     GpsNavData::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(itow, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height_ell, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height_sea, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(hacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vel_d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(gspeed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(heading, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sacc, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cacc, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 68)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(itow, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lat, bfr__ + 4);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 12);
+      IMC::reverseDeserializeFixed(height_ell, bfr__ + 20);
+      IMC::reverseDeserializeFixed(height_sea, bfr__ + 24);
+      IMC::reverseDeserializeFixed(hacc, bfr__ + 28);
+      IMC::reverseDeserializeFixed(vacc, bfr__ + 32);
+      IMC::reverseDeserializeFixed(vel_n, bfr__ + 36);
+      IMC::reverseDeserializeFixed(vel_e, bfr__ + 40);
+      IMC::reverseDeserializeFixed(vel_d, bfr__ + 44);
+      IMC::reverseDeserializeFixed(speed, bfr__ + 48);
+      IMC::reverseDeserializeFixed(gspeed, bfr__ + 52);
+      IMC::reverseDeserializeFixed(heading, bfr__ + 56);
+      IMC::reverseDeserializeFixed(sacc, bfr__ + 60);
+      IMC::reverseDeserializeFixed(cacc, bfr__ + 64);
+      return 68;
     }
 
     void
@@ -7856,28 +8081,33 @@ namespace DUNE
     uint8_t*
     ServoPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + 5;
     }
 
     uint16_t
     ServoPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::deserializeFixed(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
     ServoPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::reverseDeserializeFixed(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
@@ -7940,25 +8170,30 @@ namespace DUNE
     uint8_t*
     DataSanity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sane, ptr__);
-      return ptr__;
+      IMC::serialize(sane, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     DataSanity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sane, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(sane, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     DataSanity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sane, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(sane, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -7996,25 +8231,30 @@ namespace DUNE
     uint8_t*
     RhodamineDye::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     RhodamineDye::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     RhodamineDye::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8064,25 +8304,30 @@ namespace DUNE
     uint8_t*
     CrudeOil::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     CrudeOil::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     CrudeOil::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8132,25 +8377,30 @@ namespace DUNE
     uint8_t*
     FineOil::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     FineOil::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     FineOil::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8200,25 +8450,30 @@ namespace DUNE
     uint8_t*
     Turbidity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Turbidity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Turbidity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8268,25 +8523,30 @@ namespace DUNE
     uint8_t*
     Chlorophyll::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Chlorophyll::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Chlorophyll::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8336,25 +8596,30 @@ namespace DUNE
     uint8_t*
     Fluorescein::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Fluorescein::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Fluorescein::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8404,25 +8669,30 @@ namespace DUNE
     uint8_t*
     Phycocyanin::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Phycocyanin::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Phycocyanin::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8472,25 +8742,30 @@ namespace DUNE
     uint8_t*
     Phycoerythrin::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Phycoerythrin::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Phycoerythrin::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -8570,67 +8845,72 @@ namespace DUNE
     uint8_t*
     GpsFixRtk::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(validity, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(tow, ptr__);
-      ptr__ += IMC::serialize(base_lat, ptr__);
-      ptr__ += IMC::serialize(base_lon, ptr__);
-      ptr__ += IMC::serialize(base_height, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      ptr__ += IMC::serialize(e, ptr__);
-      ptr__ += IMC::serialize(d, ptr__);
-      ptr__ += IMC::serialize(v_n, ptr__);
-      ptr__ += IMC::serialize(v_e, ptr__);
-      ptr__ += IMC::serialize(v_d, ptr__);
-      ptr__ += IMC::serialize(satellites, ptr__);
-      ptr__ += IMC::serialize(iar_hyp, ptr__);
-      ptr__ += IMC::serialize(iar_ratio, ptr__);
-      return ptr__;
+      IMC::serialize(validity, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 2);
+      IMC::serialize(tow, bfr__ + 3);
+      IMC::serialize(base_lat, bfr__ + 7);
+      IMC::serialize(base_lon, bfr__ + 15);
+      IMC::serialize(base_height, bfr__ + 23);
+      IMC::serialize(n, bfr__ + 27);
+      IMC::serialize(e, bfr__ + 31);
+      IMC::serialize(d, bfr__ + 35);
+      IMC::serialize(v_n, bfr__ + 39);
+      IMC::serialize(v_e, bfr__ + 43);
+      IMC::serialize(v_d, bfr__ + 47);
+      IMC::serialize(satellites, bfr__ + 51);
+      IMC::serialize(iar_hyp, bfr__ + 52);
+      IMC::serialize(iar_ratio, bfr__ + 54);
+      return bfr__ + 58;
     }
 
     uint16_t
     GpsFixRtk::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(tow, bfr__, size__);
-      bfr__ += IMC::deserialize(base_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(base_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(base_height, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(e, bfr__, size__);
-      bfr__ += IMC::deserialize(d, bfr__, size__);
-      bfr__ += IMC::deserialize(v_n, bfr__, size__);
-      bfr__ += IMC::deserialize(v_e, bfr__, size__);
-      bfr__ += IMC::deserialize(v_d, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::deserialize(iar_hyp, bfr__, size__);
-      bfr__ += IMC::deserialize(iar_ratio, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 58)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(validity, bfr__ + 0);
+      IMC::deserializeFixed(type, bfr__ + 2);
+      IMC::deserializeFixed(tow, bfr__ + 3);
+      IMC::deserializeFixed(base_lat, bfr__ + 7);
+      IMC::deserializeFixed(base_lon, bfr__ + 15);
+      IMC::deserializeFixed(base_height, bfr__ + 23);
+      IMC::deserializeFixed(n, bfr__ + 27);
+      IMC::deserializeFixed(e, bfr__ + 31);
+      IMC::deserializeFixed(d, bfr__ + 35);
+      IMC::deserializeFixed(v_n, bfr__ + 39);
+      IMC::deserializeFixed(v_e, bfr__ + 43);
+      IMC::deserializeFixed(v_d, bfr__ + 47);
+      IMC::deserializeFixed(satellites, bfr__ + 51);
+      IMC::deserializeFixed(iar_hyp, bfr__ + 52);
+      IMC::deserializeFixed(iar_ratio, bfr__ + 54);
+      return 58;
     }
 
     uint16_t
     GpsFixRtk::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(validity, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(tow, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(base_height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_n, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_e, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v_d, bfr__, size__);
-      bfr__ += IMC::deserialize(satellites, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(iar_hyp, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(iar_ratio, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 58)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(validity, bfr__ + 0);
+      IMC::deserializeFixed(type, bfr__ + 2);
+      IMC::reverseDeserializeFixed(tow, bfr__ + 3);
+      IMC::reverseDeserializeFixed(base_lat, bfr__ + 7);
+      IMC::reverseDeserializeFixed(base_lon, bfr__ + 15);
+      IMC::reverseDeserializeFixed(base_height, bfr__ + 23);
+      IMC::reverseDeserializeFixed(n, bfr__ + 27);
+      IMC::reverseDeserializeFixed(e, bfr__ + 31);
+      IMC::reverseDeserializeFixed(d, bfr__ + 35);
+      IMC::reverseDeserializeFixed(v_n, bfr__ + 39);
+      IMC::reverseDeserializeFixed(v_e, bfr__ + 43);
+      IMC::reverseDeserializeFixed(v_d, bfr__ + 47);
+      IMC::deserializeFixed(satellites, bfr__ + 51);
+      IMC::reverseDeserializeFixed(iar_hyp, bfr__ + 52);
+      IMC::reverseDeserializeFixed(iar_ratio, bfr__ + 54);
+      return 58;
     }
 
     void
@@ -8728,82 +9008,87 @@ namespace DUNE
     uint8_t*
     EstimatedState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(height, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(alt, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(height, bfr__ + 16);
+      IMC::serialize(x, bfr__ + 20);
+      IMC::serialize(y, bfr__ + 24);
+      IMC::serialize(z, bfr__ + 28);
+      IMC::serialize(phi, bfr__ + 32);
+      IMC::serialize(theta, bfr__ + 36);
+      IMC::serialize(psi, bfr__ + 40);
+      IMC::serialize(u, bfr__ + 44);
+      IMC::serialize(v, bfr__ + 48);
+      IMC::serialize(w, bfr__ + 52);
+      IMC::serialize(vx, bfr__ + 56);
+      IMC::serialize(vy, bfr__ + 60);
+      IMC::serialize(vz, bfr__ + 64);
+      IMC::serialize(p, bfr__ + 68);
+      IMC::serialize(q, bfr__ + 72);
+      IMC::serialize(r, bfr__ + 76);
+      IMC::serialize(depth, bfr__ + 80);
+      IMC::serialize(alt, bfr__ + 84);
+      return bfr__ + 88;
     }
 
     uint16_t
     EstimatedState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(height, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 88)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(lat, bfr__ + 0);
+      IMC::deserializeFixed(lon, bfr__ + 8);
+      IMC::deserializeFixed(height, bfr__ + 16);
+      IMC::deserializeFixed(x, bfr__ + 20);
+      IMC::deserializeFixed(y, bfr__ + 24);
+      IMC::deserializeFixed(z, bfr__ + 28);
+      IMC::deserializeFixed(phi, bfr__ + 32);
+      IMC::deserializeFixed(theta, bfr__ + 36);
+      IMC::deserializeFixed(psi, bfr__ + 40);
+      IMC::deserializeFixed(u, bfr__ + 44);
+      IMC::deserializeFixed(v, bfr__ + 48);
+      IMC::deserializeFixed(w, bfr__ + 52);
+      IMC::deserializeFixed(vx, bfr__ + 56);
+      IMC::deserializeFixed(vy, bfr__ + 60);
+      IMC::deserializeFixed(vz, bfr__ + 64);
+      IMC::deserializeFixed(p, bfr__ + 68);
+      IMC::deserializeFixed(q, bfr__ + 72);
+      IMC::deserializeFixed(r, bfr__ + 76);
+      IMC::deserializeFixed(depth, bfr__ + 80);
+      IMC::deserializeFixed(alt, bfr__ + 84);
+      return 88;
     }
 
     uint16_t
     EstimatedState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(height, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 88)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(lat, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 8);
+      IMC::reverseDeserializeFixed(height, bfr__ + 16);
+      IMC::reverseDeserializeFixed(x, bfr__ + 20);
+      IMC::reverseDeserializeFixed(y, bfr__ + 24);
+      IMC::reverseDeserializeFixed(z, bfr__ + 28);
+      IMC::reverseDeserializeFixed(phi, bfr__ + 32);
+      IMC::reverseDeserializeFixed(theta, bfr__ + 36);
+      IMC::reverseDeserializeFixed(psi, bfr__ + 40);
+      IMC::reverseDeserializeFixed(u, bfr__ + 44);
+      IMC::reverseDeserializeFixed(v, bfr__ + 48);
+      IMC::reverseDeserializeFixed(w, bfr__ + 52);
+      IMC::reverseDeserializeFixed(vx, bfr__ + 56);
+      IMC::reverseDeserializeFixed(vy, bfr__ + 60);
+      IMC::reverseDeserializeFixed(vz, bfr__ + 64);
+      IMC::reverseDeserializeFixed(p, bfr__ + 68);
+      IMC::reverseDeserializeFixed(q, bfr__ + 72);
+      IMC::reverseDeserializeFixed(r, bfr__ + 76);
+      IMC::reverseDeserializeFixed(depth, bfr__ + 80);
+      IMC::reverseDeserializeFixed(alt, bfr__ + 84);
+      return 88;
     }
 
     void
@@ -8968,25 +9253,30 @@ namespace DUNE
     uint8_t*
     DissolvedOxygen::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     DissolvedOxygen::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     DissolvedOxygen::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -9036,25 +9326,30 @@ namespace DUNE
     uint8_t*
     AirSaturation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     AirSaturation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     AirSaturation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -9104,25 +9399,30 @@ namespace DUNE
     uint8_t*
     Throttle::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     Throttle::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     Throttle::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -9172,25 +9472,30 @@ namespace DUNE
     uint8_t*
     PH::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     PH::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
-    }
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
+    }
 
     uint16_t
     PH::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -9240,25 +9545,30 @@ namespace DUNE
     uint8_t*
     Redox::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     Redox::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     Redox::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -9312,31 +9622,36 @@ namespace DUNE
     uint8_t*
     CameraZoom::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(zoom, ptr__);
-      ptr__ += IMC::serialize(action, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(zoom, bfr__ + 1);
+      IMC::serialize(action, bfr__ + 2);
+      return bfr__ + 3;
     }
 
     uint16_t
     CameraZoom::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(zoom, bfr__, size__);
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 3)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::deserializeFixed(zoom, bfr__ + 1);
+      IMC::deserializeFixed(action, bfr__ + 2);
+      return 3;
     }
 
     uint16_t
     CameraZoom::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(zoom, bfr__, size__);
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 3)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::deserializeFixed(zoom, bfr__ + 1);
+      IMC::deserializeFixed(action, bfr__ + 2);
+      return 3;
     }
 
     uint16_t
@@ -9391,28 +9706,33 @@ namespace DUNE
     uint8_t*
     SetThrusterActuation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + 5;
     }
 
     uint16_t
     SetThrusterActuation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::deserializeFixed(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
     SetThrusterActuation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::reverseDeserializeFixed(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
@@ -9478,28 +9798,33 @@ namespace DUNE
     uint8_t*
     SetServoPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + 5;
     }
 
     uint16_t
     SetServoPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::deserializeFixed(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
     SetServoPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::reverseDeserializeFixed(value, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
@@ -9564,28 +9889,33 @@ namespace DUNE
     uint8_t*
     SetControlSurfaceDeflection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(angle, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(angle, bfr__ + 1);
+      return bfr__ + 5;
     }
 
     uint16_t
     SetControlSurfaceDeflection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(angle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::deserializeFixed(angle, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
     SetControlSurfaceDeflection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(angle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::reverseDeserializeFixed(angle, bfr__ + 1);
+      return 5;
     }
 
     uint16_t
@@ -9756,28 +10086,33 @@ namespace DUNE
     uint8_t*
     ButtonEvent::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(button, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(button, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      return bfr__ + 2;
     }
 
     uint16_t
     ButtonEvent::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(button, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(button, bfr__ + 0);
+      IMC::deserializeFixed(value, bfr__ + 1);
+      return 2;
     }
 
     uint16_t
     ButtonEvent::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(button, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(button, bfr__ + 0);
+      IMC::deserializeFixed(value, bfr__ + 1);
+      return 2;
     }
 
     fp64_t
@@ -9894,31 +10229,36 @@ namespace DUNE
     uint8_t*
     PowerOperation::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(time_remain, ptr__);
-      ptr__ += IMC::serialize(sched_time, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      IMC::serialize(time_remain, bfr__ + 1);
+      IMC::serialize(sched_time, bfr__ + 5);
+      return bfr__ + 13;
     }
 
     uint16_t
     PowerOperation::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(time_remain, bfr__, size__);
-      bfr__ += IMC::deserialize(sched_time, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 13)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      IMC::deserializeFixed(time_remain, bfr__ + 1);
+      IMC::deserializeFixed(sched_time, bfr__ + 5);
+      return 13;
     }
 
     uint16_t
     PowerOperation::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_remain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sched_time, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 13)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      IMC::reverseDeserializeFixed(time_remain, bfr__ + 1);
+      IMC::reverseDeserializeFixed(sched_time, bfr__ + 5);
+      return 13;
     }
 
     void
@@ -10336,31 +10676,36 @@ namespace DUNE
     uint8_t*
     SetPWM::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(period, ptr__);
-      ptr__ += IMC::serialize(duty_cycle, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(period, bfr__ + 1);
+      IMC::serialize(duty_cycle, bfr__ + 5);
+      return bfr__ + 9;
     }
 
     uint16_t
     SetPWM::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(period, bfr__, size__);
-      bfr__ += IMC::deserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::deserializeFixed(period, bfr__ + 1);
+      IMC::deserializeFixed(duty_cycle, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
     SetPWM::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(period, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::reverseDeserializeFixed(period, bfr__ + 1);
+      IMC::reverseDeserializeFixed(duty_cycle, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
@@ -10416,31 +10761,36 @@ namespace DUNE
     uint8_t*
     PWM::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(period, ptr__);
-      ptr__ += IMC::serialize(duty_cycle, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(period, bfr__ + 1);
+      IMC::serialize(duty_cycle, bfr__ + 5);
+      return bfr__ + 9;
     }
 
     uint16_t
     PWM::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(period, bfr__, size__);
-      bfr__ += IMC::deserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::deserializeFixed(period, bfr__ + 1);
+      IMC::deserializeFixed(duty_cycle, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
     PWM::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(period, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duty_cycle, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::reverseDeserializeFixed(period, bfr__ + 1);
+      IMC::reverseDeserializeFixed(duty_cycle, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
@@ -10496,31 +10846,36 @@ namespace DUNE
     uint8_t*
     EstimatedStreamVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      return bfr__ + 24;
     }
 
     uint16_t
     EstimatedStreamVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(x, bfr__ + 0);
+      IMC::deserializeFixed(y, bfr__ + 8);
+      IMC::deserializeFixed(z, bfr__ + 16);
+      return 24;
     }
 
     uint16_t
     EstimatedStreamVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(x, bfr__ + 0);
+      IMC::reverseDeserializeFixed(y, bfr__ + 8);
+      IMC::reverseDeserializeFixed(z, bfr__ + 16);
+      return 24;
     }
 
     void
@@ -10560,25 +10915,30 @@ namespace DUNE
     uint8_t*
     IndicatedSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     IndicatedSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     IndicatedSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -10628,25 +10988,30 @@ namespace DUNE
     uint8_t*
     TrueSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     TrueSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     TrueSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -10722,64 +11087,69 @@ namespace DUNE
     uint8_t*
     NavigationUncertainty::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(phi, ptr__);
-      ptr__ += IMC::serialize(theta, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(bias_psi, ptr__);
-      ptr__ += IMC::serialize(bias_r, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      IMC::serialize(phi, bfr__ + 12);
+      IMC::serialize(theta, bfr__ + 16);
+      IMC::serialize(psi, bfr__ + 20);
+      IMC::serialize(p, bfr__ + 24);
+      IMC::serialize(q, bfr__ + 28);
+      IMC::serialize(r, bfr__ + 32);
+      IMC::serialize(u, bfr__ + 36);
+      IMC::serialize(v, bfr__ + 40);
+      IMC::serialize(w, bfr__ + 44);
+      IMC::serialize(bias_psi, bfr__ + 48);
+      IMC::serialize(bias_r, bfr__ + 52);
+      return bfr__ + 56;
     }
 
     uint16_t
     NavigationUncertainty::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(phi, bfr__, size__);
-      bfr__ += IMC::deserialize(theta, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_r, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(x, bfr__ + 0);
+      IMC::deserializeFixed(y, bfr__ + 4);
+      IMC::deserializeFixed(z, bfr__ + 8);
+      IMC::deserializeFixed(phi, bfr__ + 12);
+      IMC::deserializeFixed(theta, bfr__ + 16);
+      IMC::deserializeFixed(psi, bfr__ + 20);
+      IMC::deserializeFixed(p, bfr__ + 24);
+      IMC::deserializeFixed(q, bfr__ + 28);
+      IMC::deserializeFixed(r, bfr__ + 32);
+      IMC::deserializeFixed(u, bfr__ + 36);
+      IMC::deserializeFixed(v, bfr__ + 40);
+      IMC::deserializeFixed(w, bfr__ + 44);
+      IMC::deserializeFixed(bias_psi, bfr__ + 48);
+      IMC::deserializeFixed(bias_r, bfr__ + 52);
+      return 56;
     }
 
     uint16_t
     NavigationUncertainty::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(phi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(theta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_r, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(x, bfr__ + 0);
+      IMC::reverseDeserializeFixed(y, bfr__ + 4);
+      IMC::reverseDeserializeFixed(z, bfr__ + 8);
+      IMC::reverseDeserializeFixed(phi, bfr__ + 12);
+      IMC::reverseDeserializeFixed(theta, bfr__ + 16);
+      IMC::reverseDeserializeFixed(psi, bfr__ + 20);
+      IMC::reverseDeserializeFixed(p, bfr__ + 24);
+      IMC::reverseDeserializeFixed(q, bfr__ + 28);
+      IMC::reverseDeserializeFixed(r, bfr__ + 32);
+      IMC::reverseDeserializeFixed(u, bfr__ + 36);
+      IMC::reverseDeserializeFixed(v, bfr__ + 40);
+      IMC::reverseDeserializeFixed(w, bfr__ + 44);
+      IMC::reverseDeserializeFixed(bias_psi, bfr__ + 48);
+      IMC::reverseDeserializeFixed(bias_r, bfr__ + 52);
+      return 56;
     }
 
     void
@@ -10846,49 +11216,54 @@ namespace DUNE
     uint8_t*
     NavigationData::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(bias_psi, ptr__);
-      ptr__ += IMC::serialize(bias_r, ptr__);
-      ptr__ += IMC::serialize(cog, ptr__);
-      ptr__ += IMC::serialize(cyaw, ptr__);
-      ptr__ += IMC::serialize(lbl_rej_level, ptr__);
-      ptr__ += IMC::serialize(gps_rej_level, ptr__);
-      ptr__ += IMC::serialize(custom_x, ptr__);
-      ptr__ += IMC::serialize(custom_y, ptr__);
-      ptr__ += IMC::serialize(custom_z, ptr__);
-      return ptr__;
+      IMC::serialize(bias_psi, bfr__ + 0);
+      IMC::serialize(bias_r, bfr__ + 4);
+      IMC::serialize(cog, bfr__ + 8);
+      IMC::serialize(cyaw, bfr__ + 12);
+      IMC::serialize(lbl_rej_level, bfr__ + 16);
+      IMC::serialize(gps_rej_level, bfr__ + 20);
+      IMC::serialize(custom_x, bfr__ + 24);
+      IMC::serialize(custom_y, bfr__ + 28);
+      IMC::serialize(custom_z, bfr__ + 32);
+      return bfr__ + 36;
     }
 
     uint16_t
     NavigationData::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::deserialize(bias_r, bfr__, size__);
-      bfr__ += IMC::deserialize(cog, bfr__, size__);
-      bfr__ += IMC::deserialize(cyaw, bfr__, size__);
-      bfr__ += IMC::deserialize(lbl_rej_level, bfr__, size__);
-      bfr__ += IMC::deserialize(gps_rej_level, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_x, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_y, bfr__, size__);
-      bfr__ += IMC::deserialize(custom_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 36)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(bias_psi, bfr__ + 0);
+      IMC::deserializeFixed(bias_r, bfr__ + 4);
+      IMC::deserializeFixed(cog, bfr__ + 8);
+      IMC::deserializeFixed(cyaw, bfr__ + 12);
+      IMC::deserializeFixed(lbl_rej_level, bfr__ + 16);
+      IMC::deserializeFixed(gps_rej_level, bfr__ + 20);
+      IMC::deserializeFixed(custom_x, bfr__ + 24);
+      IMC::deserializeFixed(custom_y, bfr__ + 28);
+      IMC::deserializeFixed(custom_z, bfr__ + 32);
+      return 36;
     }
 
     uint16_t
     NavigationData::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(bias_psi, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bias_r, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cog, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(cyaw, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lbl_rej_level, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(gps_rej_level, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(custom_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 36)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(bias_psi, bfr__ + 0);
+      IMC::reverseDeserializeFixed(bias_r, bfr__ + 4);
+      IMC::reverseDeserializeFixed(cog, bfr__ + 8);
+      IMC::reverseDeserializeFixed(cyaw, bfr__ + 12);
+      IMC::reverseDeserializeFixed(lbl_rej_level, bfr__ + 16);
+      IMC::reverseDeserializeFixed(gps_rej_level, bfr__ + 20);
+      IMC::reverseDeserializeFixed(custom_x, bfr__ + 24);
+      IMC::reverseDeserializeFixed(custom_y, bfr__ + 28);
+      IMC::reverseDeserializeFixed(custom_z, bfr__ + 32);
+      return 36;
     }
 
     void
@@ -10936,28 +11311,33 @@ namespace DUNE
     uint8_t*
     GpsFixRejection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(utc_time, ptr__);
-      ptr__ += IMC::serialize(reason, ptr__);
-      return ptr__;
+      IMC::serialize(utc_time, bfr__ + 0);
+      IMC::serialize(reason, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     GpsFixRejection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(utc_time, bfr__ + 0);
+      IMC::deserializeFixed(reason, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     GpsFixRejection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(utc_time, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(utc_time, bfr__ + 0);
+      IMC::deserializeFixed(reason, bfr__ + 4);
+      return 5;
     }
 
     void
@@ -11000,31 +11380,36 @@ namespace DUNE
     uint8_t*
     LblRangeAcceptance::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(id, ptr__);
-      ptr__ += IMC::serialize(range, ptr__);
-      ptr__ += IMC::serialize(acceptance, ptr__);
-      return ptr__;
+      IMC::serialize(id, bfr__ + 0);
+      IMC::serialize(range, bfr__ + 1);
+      IMC::serialize(acceptance, bfr__ + 5);
+      return bfr__ + 6;
     }
 
     uint16_t
     LblRangeAcceptance::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::deserialize(range, bfr__, size__);
-      bfr__ += IMC::deserialize(acceptance, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::deserializeFixed(range, bfr__ + 1);
+      IMC::deserializeFixed(acceptance, bfr__ + 5);
+      return 6;
     }
 
     uint16_t
     LblRangeAcceptance::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(range, bfr__, size__);
-      bfr__ += IMC::deserialize(acceptance, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(id, bfr__ + 0);
+      IMC::reverseDeserializeFixed(range, bfr__ + 1);
+      IMC::deserializeFixed(acceptance, bfr__ + 5);
+      return 6;
     }
 
     uint16_t
@@ -11082,34 +11467,39 @@ namespace DUNE
     uint8_t*
     DvlRejection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(reason, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(timestep, ptr__);
-      return ptr__;
+      IMC::serialize(type, bfr__ + 0);
+      IMC::serialize(reason, bfr__ + 1);
+      IMC::serialize(value, bfr__ + 2);
+      IMC::serialize(timestep, bfr__ + 6);
+      return bfr__ + 10;
     }
 
     uint16_t
     DvlRejection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(type, bfr__ + 0);
+      IMC::deserializeFixed(reason, bfr__ + 1);
+      IMC::deserializeFixed(value, bfr__ + 2);
+      IMC::deserializeFixed(timestep, bfr__ + 6);
+      return 10;
     }
 
     uint16_t
     DvlRejection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(reason, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timestep, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(type, bfr__ + 0);
+      IMC::deserializeFixed(reason, bfr__ + 1);
+      IMC::reverseDeserializeFixed(value, bfr__ + 2);
+      IMC::reverseDeserializeFixed(timestep, bfr__ + 6);
+      return 10;
     }
 
     fp64_t
@@ -11294,25 +11684,30 @@ namespace DUNE
     uint8_t*
     AlignmentState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(state, ptr__);
-      return ptr__;
+      IMC::serialize(state, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     AlignmentState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(state, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     AlignmentState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(state, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -11354,31 +11749,36 @@ namespace DUNE
     uint8_t*
     GroupStreamVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      return bfr__ + 24;
     }
 
     uint16_t
     GroupStreamVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(x, bfr__ + 0);
+      IMC::deserializeFixed(y, bfr__ + 8);
+      IMC::deserializeFixed(z, bfr__ + 16);
+      return 24;
     }
 
     uint16_t
     GroupStreamVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(x, bfr__ + 0);
+      IMC::reverseDeserializeFixed(y, bfr__ + 8);
+      IMC::reverseDeserializeFixed(z, bfr__ + 16);
+      return 24;
     }
 
     void
@@ -11422,31 +11822,36 @@ namespace DUNE
     uint8_t*
     Airflow::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(va, ptr__);
-      ptr__ += IMC::serialize(aoa, ptr__);
-      ptr__ += IMC::serialize(ssa, ptr__);
-      return ptr__;
+      IMC::serialize(va, bfr__ + 0);
+      IMC::serialize(aoa, bfr__ + 4);
+      IMC::serialize(ssa, bfr__ + 8);
+      return bfr__ + 12;
     }
 
     uint16_t
     Airflow::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(va, bfr__, size__);
-      bfr__ += IMC::deserialize(aoa, bfr__, size__);
-      bfr__ += IMC::deserialize(ssa, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(va, bfr__ + 0);
+      IMC::deserializeFixed(aoa, bfr__ + 4);
+      IMC::deserializeFixed(ssa, bfr__ + 8);
+      return 12;
     }
 
     uint16_t
     Airflow::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(va, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(aoa, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ssa, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(va, bfr__ + 0);
+      IMC::reverseDeserializeFixed(aoa, bfr__ + 4);
+      IMC::reverseDeserializeFixed(ssa, bfr__ + 8);
+      return 12;
     }
 
     void
@@ -11486,25 +11891,30 @@ namespace DUNE
     uint8_t*
     DesiredHeading::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredHeading::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredHeading::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -11556,28 +11966,33 @@ namespace DUNE
     uint8_t*
     DesiredZ::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(z_units, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     DesiredZ::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      IMC::deserializeFixed(z_units, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     DesiredZ::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      IMC::deserializeFixed(z_units, bfr__ + 4);
+      return 5;
     }
 
     fp64_t
@@ -11630,28 +12045,33 @@ namespace DUNE
     uint8_t*
     DesiredSpeed::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(speed_units, bfr__ + 8);
+      return bfr__ + 9;
     }
 
     uint16_t
     DesiredSpeed::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      IMC::deserializeFixed(speed_units, bfr__ + 8);
+      return 9;
     }
 
     uint16_t
     DesiredSpeed::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      IMC::deserializeFixed(speed_units, bfr__ + 8);
+      return 9;
     }
 
     fp64_t
@@ -11702,25 +12122,30 @@ namespace DUNE
     uint8_t*
     DesiredRoll::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredRoll::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredRoll::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -11770,25 +12195,30 @@ namespace DUNE
     uint8_t*
     DesiredPitch::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredPitch::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredPitch::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -11838,25 +12268,30 @@ namespace DUNE
     uint8_t*
     DesiredVerticalRate::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredVerticalRate::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredVerticalRate::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -11934,61 +12369,66 @@ namespace DUNE
     uint8_t*
     DesiredPath::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(path_ref, ptr__);
-      ptr__ += IMC::serialize(start_lat, ptr__);
-      ptr__ += IMC::serialize(start_lon, ptr__);
-      ptr__ += IMC::serialize(start_z, ptr__);
-      ptr__ += IMC::serialize(start_z_units, ptr__);
-      ptr__ += IMC::serialize(end_lat, ptr__);
-      ptr__ += IMC::serialize(end_lon, ptr__);
-      ptr__ += IMC::serialize(end_z, ptr__);
-      ptr__ += IMC::serialize(end_z_units, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(lradius, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::serialize(path_ref, bfr__ + 0);
+      IMC::serialize(start_lat, bfr__ + 4);
+      IMC::serialize(start_lon, bfr__ + 12);
+      IMC::serialize(start_z, bfr__ + 20);
+      IMC::serialize(start_z_units, bfr__ + 24);
+      IMC::serialize(end_lat, bfr__ + 25);
+      IMC::serialize(end_lon, bfr__ + 33);
+      IMC::serialize(end_z, bfr__ + 41);
+      IMC::serialize(end_z_units, bfr__ + 45);
+      IMC::serialize(speed, bfr__ + 46);
+      IMC::serialize(speed_units, bfr__ + 50);
+      IMC::serialize(lradius, bfr__ + 51);
+      IMC::serialize(flags, bfr__ + 55);
+      return bfr__ + 56;
     }
 
     uint16_t
     DesiredPath::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(path_ref, bfr__ + 0);
+      IMC::deserializeFixed(start_lat, bfr__ + 4);
+      IMC::deserializeFixed(start_lon, bfr__ + 12);
+      IMC::deserializeFixed(start_z, bfr__ + 20);
+      IMC::deserializeFixed(start_z_units, bfr__ + 24);
+      IMC::deserializeFixed(end_lat, bfr__ + 25);
+      IMC::deserializeFixed(end_lon, bfr__ + 33);
+      IMC::deserializeFixed(end_z, bfr__ + 41);
+      IMC::deserializeFixed(end_z_units, bfr__ + 45);
+      IMC::deserializeFixed(speed, bfr__ + 46);
+      IMC::deserializeFixed(speed_units, bfr__ + 50);
+      IMC::deserializeFixed(lradius, bfr__ + 51);
+      IMC::deserializeFixed(flags, bfr__ + 55);
+      return 56;
     }
 
     uint16_t
     DesiredPath::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 56)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(path_ref, bfr__ + 0);
+      IMC::reverseDeserializeFixed(start_lat, bfr__ + 4);
+      IMC::reverseDeserializeFixed(start_lon, bfr__ + 12);
+      IMC::reverseDeserializeFixed(start_z, bfr__ + 20);
+      IMC::deserializeFixed(start_z_units, bfr__ + 24);
+      IMC::reverseDeserializeFixed(end_lat, bfr__ + 25);
+      IMC::reverseDeserializeFixed(end_lon, bfr__ + 33);
+      IMC::reverseDeserializeFixed(end_z, bfr__ + 41);
+      IMC::deserializeFixed(end_z_units, bfr__ + 45);
+      IMC::reverseDeserializeFixed(speed, bfr__ + 46);
+      IMC::deserializeFixed(speed_units, bfr__ + 50);
+      IMC::reverseDeserializeFixed(lradius, bfr__ + 51);
+      IMC::deserializeFixed(flags, bfr__ + 55);
+      return 56;
     }
 
     void
@@ -12050,43 +12490,48 @@ namespace DUNE
     uint8_t*
     DesiredControl::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(k, ptr__);
-      ptr__ += IMC::serialize(m, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      IMC::serialize(k, bfr__ + 24);
+      IMC::serialize(m, bfr__ + 32);
+      IMC::serialize(n, bfr__ + 40);
+      IMC::serialize(flags, bfr__ + 48);
+      return bfr__ + 49;
     }
 
     uint16_t
     DesiredControl::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(k, bfr__, size__);
-      bfr__ += IMC::deserialize(m, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 49)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(x, bfr__ + 0);
+      IMC::deserializeFixed(y, bfr__ + 8);
+      IMC::deserializeFixed(z, bfr__ + 16);
+      IMC::deserializeFixed(k, bfr__ + 24);
+      IMC::deserializeFixed(m, bfr__ + 32);
+      IMC::deserializeFixed(n, bfr__ + 40);
+      IMC::deserializeFixed(flags, bfr__ + 48);
+      return 49;
     }
 
     uint16_t
     DesiredControl::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(k, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(m, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 49)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(x, bfr__ + 0);
+      IMC::reverseDeserializeFixed(y, bfr__ + 8);
+      IMC::reverseDeserializeFixed(z, bfr__ + 16);
+      IMC::reverseDeserializeFixed(k, bfr__ + 24);
+      IMC::reverseDeserializeFixed(m, bfr__ + 32);
+      IMC::reverseDeserializeFixed(n, bfr__ + 40);
+      IMC::deserializeFixed(flags, bfr__ + 48);
+      return 49;
     }
 
     void
@@ -12130,25 +12575,30 @@ namespace DUNE
     uint8_t*
     DesiredHeadingRate::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredHeadingRate::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredHeadingRate::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -12210,43 +12660,48 @@ namespace DUNE
     uint8_t*
     DesiredVelocity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(u, ptr__);
-      ptr__ += IMC::serialize(v, ptr__);
-      ptr__ += IMC::serialize(w, ptr__);
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(q, ptr__);
-      ptr__ += IMC::serialize(r, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+      IMC::serialize(u, bfr__ + 0);
+      IMC::serialize(v, bfr__ + 8);
+      IMC::serialize(w, bfr__ + 16);
+      IMC::serialize(p, bfr__ + 24);
+      IMC::serialize(q, bfr__ + 32);
+      IMC::serialize(r, bfr__ + 40);
+      IMC::serialize(flags, bfr__ + 48);
+      return bfr__ + 49;
     }
 
     uint16_t
     DesiredVelocity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(u, bfr__, size__);
-      bfr__ += IMC::deserialize(v, bfr__, size__);
-      bfr__ += IMC::deserialize(w, bfr__, size__);
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(q, bfr__, size__);
-      bfr__ += IMC::deserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 49)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(u, bfr__ + 0);
+      IMC::deserializeFixed(v, bfr__ + 8);
+      IMC::deserializeFixed(w, bfr__ + 16);
+      IMC::deserializeFixed(p, bfr__ + 24);
+      IMC::deserializeFixed(q, bfr__ + 32);
+      IMC::deserializeFixed(r, bfr__ + 40);
+      IMC::deserializeFixed(flags, bfr__ + 48);
+      return 49;
     }
 
     uint16_t
     DesiredVelocity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(u, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(v, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(w, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(q, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(r, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 49)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(u, bfr__ + 0);
+      IMC::reverseDeserializeFixed(v, bfr__ + 8);
+      IMC::reverseDeserializeFixed(w, bfr__ + 16);
+      IMC::reverseDeserializeFixed(p, bfr__ + 24);
+      IMC::reverseDeserializeFixed(q, bfr__ + 32);
+      IMC::reverseDeserializeFixed(r, bfr__ + 40);
+      IMC::deserializeFixed(flags, bfr__ + 48);
+      return 49;
     }
 
     void
@@ -12330,79 +12785,84 @@ namespace DUNE
     uint8_t*
     PathControlState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(path_ref, ptr__);
-      ptr__ += IMC::serialize(start_lat, ptr__);
-      ptr__ += IMC::serialize(start_lon, ptr__);
-      ptr__ += IMC::serialize(start_z, ptr__);
-      ptr__ += IMC::serialize(start_z_units, ptr__);
-      ptr__ += IMC::serialize(end_lat, ptr__);
-      ptr__ += IMC::serialize(end_lon, ptr__);
-      ptr__ += IMC::serialize(end_z, ptr__);
-      ptr__ += IMC::serialize(end_z_units, ptr__);
-      ptr__ += IMC::serialize(lradius, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(course_error, ptr__);
-      ptr__ += IMC::serialize(eta, ptr__);
-      return ptr__;
+      IMC::serialize(path_ref, bfr__ + 0);
+      IMC::serialize(start_lat, bfr__ + 4);
+      IMC::serialize(start_lon, bfr__ + 12);
+      IMC::serialize(start_z, bfr__ + 20);
+      IMC::serialize(start_z_units, bfr__ + 24);
+      IMC::serialize(end_lat, bfr__ + 25);
+      IMC::serialize(end_lon, bfr__ + 33);
+      IMC::serialize(end_z, bfr__ + 41);
+      IMC::serialize(end_z_units, bfr__ + 45);
+      IMC::serialize(lradius, bfr__ + 46);
+      IMC::serialize(flags, bfr__ + 50);
+      IMC::serialize(x, bfr__ + 51);
+      IMC::serialize(y, bfr__ + 55);
+      IMC::serialize(z, bfr__ + 59);
+      IMC::serialize(vx, bfr__ + 63);
+      IMC::serialize(vy, bfr__ + 67);
+      IMC::serialize(vz, bfr__ + 71);
+      IMC::serialize(course_error, bfr__ + 75);
+      IMC::serialize(eta, bfr__ + 79);
+      return bfr__ + 81;
     }
 
     uint16_t
     PathControlState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::deserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(course_error, bfr__, size__);
-      bfr__ += IMC::deserialize(eta, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 81)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(path_ref, bfr__ + 0);
+      IMC::deserializeFixed(start_lat, bfr__ + 4);
+      IMC::deserializeFixed(start_lon, bfr__ + 12);
+      IMC::deserializeFixed(start_z, bfr__ + 20);
+      IMC::deserializeFixed(start_z_units, bfr__ + 24);
+      IMC::deserializeFixed(end_lat, bfr__ + 25);
+      IMC::deserializeFixed(end_lon, bfr__ + 33);
+      IMC::deserializeFixed(end_z, bfr__ + 41);
+      IMC::deserializeFixed(end_z_units, bfr__ + 45);
+      IMC::deserializeFixed(lradius, bfr__ + 46);
+      IMC::deserializeFixed(flags, bfr__ + 50);
+      IMC::deserializeFixed(x, bfr__ + 51);
+      IMC::deserializeFixed(y, bfr__ + 55);
+      IMC::deserializeFixed(z, bfr__ + 59);
+      IMC::deserializeFixed(vx, bfr__ + 63);
+      IMC::deserializeFixed(vy, bfr__ + 67);
+      IMC::deserializeFixed(vz, bfr__ + 71);
+      IMC::deserializeFixed(course_error, bfr__ + 75);
+      IMC::deserializeFixed(eta, bfr__ + 79);
+      return 81;
     }
 
     uint16_t
     PathControlState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(path_ref, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(start_z, bfr__, size__);
-      bfr__ += IMC::deserialize(start_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(end_z, bfr__, size__);
-      bfr__ += IMC::deserialize(end_z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lradius, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(course_error, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(eta, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 81)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(path_ref, bfr__ + 0);
+      IMC::reverseDeserializeFixed(start_lat, bfr__ + 4);
+      IMC::reverseDeserializeFixed(start_lon, bfr__ + 12);
+      IMC::reverseDeserializeFixed(start_z, bfr__ + 20);
+      IMC::deserializeFixed(start_z_units, bfr__ + 24);
+      IMC::reverseDeserializeFixed(end_lat, bfr__ + 25);
+      IMC::reverseDeserializeFixed(end_lon, bfr__ + 33);
+      IMC::reverseDeserializeFixed(end_z, bfr__ + 41);
+      IMC::deserializeFixed(end_z_units, bfr__ + 45);
+      IMC::reverseDeserializeFixed(lradius, bfr__ + 46);
+      IMC::deserializeFixed(flags, bfr__ + 50);
+      IMC::reverseDeserializeFixed(x, bfr__ + 51);
+      IMC::reverseDeserializeFixed(y, bfr__ + 55);
+      IMC::reverseDeserializeFixed(z, bfr__ + 59);
+      IMC::reverseDeserializeFixed(vx, bfr__ + 63);
+      IMC::reverseDeserializeFixed(vy, bfr__ + 67);
+      IMC::reverseDeserializeFixed(vz, bfr__ + 71);
+      IMC::reverseDeserializeFixed(course_error, bfr__ + 75);
+      IMC::reverseDeserializeFixed(eta, bfr__ + 79);
+      return 81;
     }
 
     void
@@ -12462,31 +12922,36 @@ namespace DUNE
     uint8_t*
     AllocatedControlTorques::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(k, ptr__);
-      ptr__ += IMC::serialize(m, ptr__);
-      ptr__ += IMC::serialize(n, ptr__);
-      return ptr__;
+      IMC::serialize(k, bfr__ + 0);
+      IMC::serialize(m, bfr__ + 8);
+      IMC::serialize(n, bfr__ + 16);
+      return bfr__ + 24;
     }
 
     uint16_t
     AllocatedControlTorques::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(k, bfr__, size__);
-      bfr__ += IMC::deserialize(m, bfr__, size__);
-      bfr__ += IMC::deserialize(n, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(k, bfr__ + 0);
+      IMC::deserializeFixed(m, bfr__ + 8);
+      IMC::deserializeFixed(n, bfr__ + 16);
+      return 24;
     }
 
     uint16_t
     AllocatedControlTorques::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(k, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(m, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(n, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(k, bfr__ + 0);
+      IMC::reverseDeserializeFixed(m, bfr__ + 8);
+      IMC::reverseDeserializeFixed(n, bfr__ + 16);
+      return 24;
     }
 
     void
@@ -12532,34 +12997,39 @@ namespace DUNE
     uint8_t*
     ControlParcel::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(p, ptr__);
-      ptr__ += IMC::serialize(i, ptr__);
-      ptr__ += IMC::serialize(d, ptr__);
-      ptr__ += IMC::serialize(a, ptr__);
-      return ptr__;
+      IMC::serialize(p, bfr__ + 0);
+      IMC::serialize(i, bfr__ + 4);
+      IMC::serialize(d, bfr__ + 8);
+      IMC::serialize(a, bfr__ + 12);
+      return bfr__ + 16;
     }
 
     uint16_t
     ControlParcel::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(p, bfr__, size__);
-      bfr__ += IMC::deserialize(i, bfr__, size__);
-      bfr__ += IMC::deserialize(d, bfr__, size__);
-      bfr__ += IMC::deserialize(a, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(p, bfr__ + 0);
+      IMC::deserializeFixed(i, bfr__ + 4);
+      IMC::deserializeFixed(d, bfr__ + 8);
+      IMC::deserializeFixed(a, bfr__ + 12);
+      return 16;
     }
 
     uint16_t
     ControlParcel::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(p, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(i, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(d, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(a, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(p, bfr__ + 0);
+      IMC::reverseDeserializeFixed(i, bfr__ + 4);
+      IMC::reverseDeserializeFixed(d, bfr__ + 8);
+      IMC::reverseDeserializeFixed(a, bfr__ + 12);
+      return 16;
     }
 
     void
@@ -12600,25 +13070,30 @@ namespace DUNE
     uint8_t*
     Brake::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(op, ptr__);
-      return ptr__;
+      IMC::serialize(op, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     Brake::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     Brake::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(op, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -12666,60 +13141,65 @@ namespace DUNE
     }
 
     int
-    DesiredLinearState::validate(void) const
-    {
-      return true;
-    }
-
-    uint8_t*
-    DesiredLinearState::serializeFields(uint8_t* bfr__) const
-    {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(vx, ptr__);
-      ptr__ += IMC::serialize(vy, ptr__);
-      ptr__ += IMC::serialize(vz, ptr__);
-      ptr__ += IMC::serialize(ax, ptr__);
-      ptr__ += IMC::serialize(ay, ptr__);
-      ptr__ += IMC::serialize(az, ptr__);
-      ptr__ += IMC::serialize(flags, ptr__);
-      return ptr__;
+    DesiredLinearState::validate(void) const
+    {
+      return true;
+    }
+
+    uint8_t*
+    DesiredLinearState::serializeFields(uint8_t* bfr__) const
+    {
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 8);
+      IMC::serialize(z, bfr__ + 16);
+      IMC::serialize(vx, bfr__ + 24);
+      IMC::serialize(vy, bfr__ + 32);
+      IMC::serialize(vz, bfr__ + 40);
+      IMC::serialize(ax, bfr__ + 48);
+      IMC::serialize(ay, bfr__ + 56);
+      IMC::serialize(az, bfr__ + 64);
+      IMC::serialize(flags, bfr__ + 72);
+      return bfr__ + 74;
     }
 
     uint16_t
     DesiredLinearState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(vx, bfr__, size__);
-      bfr__ += IMC::deserialize(vy, bfr__, size__);
-      bfr__ += IMC::deserialize(vz, bfr__, size__);
-      bfr__ += IMC::deserialize(ax, bfr__, size__);
-      bfr__ += IMC::deserialize(ay, bfr__, size__);
-      bfr__ += IMC::deserialize(az, bfr__, size__);
-      bfr__ += IMC::deserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 74)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(x, bfr__ + 0);
+      IMC::deserializeFixed(y, bfr__ + 8);
+      IMC::deserializeFixed(z, bfr__ + 16);
+      IMC::deserializeFixed(vx, bfr__ + 24);
+      IMC::deserializeFixed(vy, bfr__ + 32);
+      IMC::deserializeFixed(vz, bfr__ + 40);
+      IMC::deserializeFixed(ax, bfr__ + 48);
+      IMC::deserializeFixed(ay, bfr__ + 56);
+      IMC::deserializeFixed(az, bfr__ + 64);
+      IMC::deserializeFixed(flags, bfr__ + 72);
+      return 74;
     }
 
     uint16_t
     DesiredLinearState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vx, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vy, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(vz, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ax, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ay, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(az, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(flags, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 74)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(x, bfr__ + 0);
+      IMC::reverseDeserializeFixed(y, bfr__ + 8);
+      IMC::reverseDeserializeFixed(z, bfr__ + 16);
+      IMC::reverseDeserializeFixed(vx, bfr__ + 24);
+      IMC::reverseDeserializeFixed(vy, bfr__ + 32);
+      IMC::reverseDeserializeFixed(vz, bfr__ + 40);
+      IMC::reverseDeserializeFixed(ax, bfr__ + 48);
+      IMC::reverseDeserializeFixed(ay, bfr__ + 56);
+      IMC::reverseDeserializeFixed(az, bfr__ + 64);
+      IMC::reverseDeserializeFixed(flags, bfr__ + 72);
+      return 74;
     }
 
     void
@@ -12766,25 +13246,30 @@ namespace DUNE
     uint8_t*
     DesiredThrottle::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     DesiredThrottle::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     DesiredThrottle::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
@@ -13605,31 +14090,36 @@ namespace DUNE
     uint8_t*
     PathPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      return bfr__ + 12;
     }
 
     uint16_t
     PathPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(x, bfr__ + 0);
+      IMC::deserializeFixed(y, bfr__ + 4);
+      IMC::deserializeFixed(z, bfr__ + 8);
+      return 12;
     }
 
     uint16_t
     PathPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(x, bfr__ + 0);
+      IMC::reverseDeserializeFixed(y, bfr__ + 4);
+      IMC::reverseDeserializeFixed(z, bfr__ + 8);
+      return 12;
     }
 
     void
@@ -14195,34 +14685,39 @@ namespace DUNE
     uint8_t*
     TrajectoryPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(t, ptr__);
-      return ptr__;
+      IMC::serialize(x, bfr__ + 0);
+      IMC::serialize(y, bfr__ + 4);
+      IMC::serialize(z, bfr__ + 8);
+      IMC::serialize(t, bfr__ + 12);
+      return bfr__ + 16;
     }
 
     uint16_t
     TrajectoryPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(t, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(x, bfr__ + 0);
+      IMC::deserializeFixed(y, bfr__ + 4);
+      IMC::deserializeFixed(z, bfr__ + 8);
+      IMC::deserializeFixed(t, bfr__ + 12);
+      return 16;
     }
 
     uint16_t
     TrajectoryPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(t, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(x, bfr__ + 0);
+      IMC::reverseDeserializeFixed(y, bfr__ + 4);
+      IMC::reverseDeserializeFixed(z, bfr__ + 8);
+      IMC::reverseDeserializeFixed(t, bfr__ + 12);
+      return 16;
     }
 
     void
@@ -14474,34 +14969,39 @@ namespace DUNE
     uint8_t*
     VehicleFormationParticipant::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(vid, ptr__);
-      ptr__ += IMC::serialize(off_x, ptr__);
-      ptr__ += IMC::serialize(off_y, ptr__);
-      ptr__ += IMC::serialize(off_z, ptr__);
-      return ptr__;
+      IMC::serialize(vid, bfr__ + 0);
+      IMC::serialize(off_x, bfr__ + 2);
+      IMC::serialize(off_y, bfr__ + 6);
+      IMC::serialize(off_z, bfr__ + 10);
+      return bfr__ + 14;
     }
 
     uint16_t
     VehicleFormationParticipant::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(vid, bfr__, size__);
-      bfr__ += IMC::deserialize(off_x, bfr__, size__);
-      bfr__ += IMC::deserialize(off_y, bfr__, size__);
-      bfr__ += IMC::deserialize(off_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 14)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(vid, bfr__ + 0);
+      IMC::deserializeFixed(off_x, bfr__ + 2);
+      IMC::deserializeFixed(off_y, bfr__ + 6);
+      IMC::deserializeFixed(off_z, bfr__ + 10);
+      return 14;
     }
 
     uint16_t
     VehicleFormationParticipant::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(vid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(off_z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 14)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(vid, bfr__ + 0);
+      IMC::reverseDeserializeFixed(off_x, bfr__ + 2);
+      IMC::reverseDeserializeFixed(off_y, bfr__ + 6);
+      IMC::reverseDeserializeFixed(off_z, bfr__ + 10);
+      return 14;
     }
 
     void
@@ -14735,25 +15235,30 @@ namespace DUNE
     uint8_t*
     RegisterManeuver::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(mid, ptr__);
-      return ptr__;
+      IMC::serialize(mid, bfr__ + 0);
+      return bfr__ + 2;
     }
 
     uint16_t
     RegisterManeuver::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(mid, bfr__ + 0);
+      return 2;
     }
 
     uint16_t
     RegisterManeuver::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(mid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(mid, bfr__ + 0);
+      return 2;
     }
 
     void
@@ -14873,46 +15378,51 @@ namespace DUNE
     uint8_t*
     FollowSystem::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(system, ptr__);
-      ptr__ += IMC::serialize(duration, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      return ptr__;
+      IMC::serialize(system, bfr__ + 0);
+      IMC::serialize(duration, bfr__ + 2);
+      IMC::serialize(speed, bfr__ + 4);
+      IMC::serialize(speed_units, bfr__ + 8);
+      IMC::serialize(x, bfr__ + 9);
+      IMC::serialize(y, bfr__ + 13);
+      IMC::serialize(z, bfr__ + 17);
+      IMC::serialize(z_units, bfr__ + 21);
+      return bfr__ + 22;
     }
 
     uint16_t
     FollowSystem::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(system, bfr__, size__);
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 22)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(system, bfr__ + 0);
+      IMC::deserializeFixed(duration, bfr__ + 2);
+      IMC::deserializeFixed(speed, bfr__ + 4);
+      IMC::deserializeFixed(speed_units, bfr__ + 8);
+      IMC::deserializeFixed(x, bfr__ + 9);
+      IMC::deserializeFixed(y, bfr__ + 13);
+      IMC::deserializeFixed(z, bfr__ + 17);
+      IMC::deserializeFixed(z_units, bfr__ + 21);
+      return 22;
     }
 
     uint16_t
     FollowSystem::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(system, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 22)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(system, bfr__ + 0);
+      IMC::reverseDeserializeFixed(duration, bfr__ + 2);
+      IMC::reverseDeserializeFixed(speed, bfr__ + 4);
+      IMC::deserializeFixed(speed_units, bfr__ + 8);
+      IMC::reverseDeserializeFixed(x, bfr__ + 9);
+      IMC::reverseDeserializeFixed(y, bfr__ + 13);
+      IMC::reverseDeserializeFixed(z, bfr__ + 17);
+      IMC::deserializeFixed(z_units, bfr__ + 21);
+      return 22;
     }
 
     void
@@ -14973,46 +15483,51 @@ namespace DUNE
     uint8_t*
     CommsRelay::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(speed_units, ptr__);
-      ptr__ += IMC::serialize(duration, ptr__);
-      ptr__ += IMC::serialize(sys_a, ptr__);
-      ptr__ += IMC::serialize(sys_b, ptr__);
-      ptr__ += IMC::serialize(move_threshold, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(speed, bfr__ + 16);
+      IMC::serialize(speed_units, bfr__ + 20);
+      IMC::serialize(duration, bfr__ + 21);
+      IMC::serialize(sys_a, bfr__ + 23);
+      IMC::serialize(sys_b, bfr__ + 25);
+      IMC::serialize(move_threshold, bfr__ + 27);
+      return bfr__ + 31;
     }
 
     uint16_t
     CommsRelay::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_a, bfr__, size__);
-      bfr__ += IMC::deserialize(sys_b, bfr__, size__);
-      bfr__ += IMC::deserialize(move_threshold, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 31)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(lat, bfr__ + 0);
+      IMC::deserializeFixed(lon, bfr__ + 8);
+      IMC::deserializeFixed(speed, bfr__ + 16);
+      IMC::deserializeFixed(speed_units, bfr__ + 20);
+      IMC::deserializeFixed(duration, bfr__ + 21);
+      IMC::deserializeFixed(sys_a, bfr__ + 23);
+      IMC::deserializeFixed(sys_b, bfr__ + 25);
+      IMC::deserializeFixed(move_threshold, bfr__ + 27);
+      return 31;
     }
 
     uint16_t
     CommsRelay::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(speed_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_a, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(sys_b, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(move_threshold, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 31)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(lat, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 8);
+      IMC::reverseDeserializeFixed(speed, bfr__ + 16);
+      IMC::deserializeFixed(speed_units, bfr__ + 20);
+      IMC::reverseDeserializeFixed(duration, bfr__ + 21);
+      IMC::reverseDeserializeFixed(sys_a, bfr__ + 23);
+      IMC::reverseDeserializeFixed(sys_b, bfr__ + 25);
+      IMC::reverseDeserializeFixed(move_threshold, bfr__ + 27);
+      return 31;
     }
 
     void
@@ -15061,28 +15576,33 @@ namespace DUNE
     uint8_t*
     PolygonVertex::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      return bfr__ + 16;
     }
 
     uint16_t
     PolygonVertex::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(lat, bfr__ + 0);
+      IMC::deserializeFixed(lon, bfr__ + 8);
+      return 16;
     }
 
     uint16_t
     PolygonVertex::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 16)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(lat, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 8);
+      return 16;
     }
 
     void
@@ -15632,37 +16152,42 @@ namespace DUNE
     uint8_t*
     FollowReference::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(control_src, ptr__);
-      ptr__ += IMC::serialize(control_ent, ptr__);
-      ptr__ += IMC::serialize(timeout, ptr__);
-      ptr__ += IMC::serialize(loiter_radius, ptr__);
-      ptr__ += IMC::serialize(altitude_interval, ptr__);
-      return ptr__;
+      IMC::serialize(control_src, bfr__ + 0);
+      IMC::serialize(control_ent, bfr__ + 2);
+      IMC::serialize(timeout, bfr__ + 3);
+      IMC::serialize(loiter_radius, bfr__ + 7);
+      IMC::serialize(altitude_interval, bfr__ + 11);
+      return bfr__ + 15;
     }
 
     uint16_t
     FollowReference::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(control_src, bfr__, size__);
-      bfr__ += IMC::deserialize(control_ent, bfr__, size__);
-      bfr__ += IMC::deserialize(timeout, bfr__, size__);
-      bfr__ += IMC::deserialize(loiter_radius, bfr__, size__);
-      bfr__ += IMC::deserialize(altitude_interval, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 15)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(control_src, bfr__ + 0);
+      IMC::deserializeFixed(control_ent, bfr__ + 2);
+      IMC::deserializeFixed(timeout, bfr__ + 3);
+      IMC::deserializeFixed(loiter_radius, bfr__ + 7);
+      IMC::deserializeFixed(altitude_interval, bfr__ + 11);
+      return 15;
     }
 
     uint16_t
     FollowReference::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(control_src, bfr__, size__);
-      bfr__ += IMC::deserialize(control_ent, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(timeout, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(loiter_radius, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(altitude_interval, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 15)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(control_src, bfr__ + 0);
+      IMC::deserializeFixed(control_ent, bfr__ + 2);
+      IMC::reverseDeserializeFixed(timeout, bfr__ + 3);
+      IMC::reverseDeserializeFixed(loiter_radius, bfr__ + 7);
+      IMC::reverseDeserializeFixed(altitude_interval, bfr__ + 11);
+      return 15;
     }
 
     void
@@ -16862,46 +17387,51 @@ namespace DUNE
     uint8_t*
     ScheduledGoto::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(arrival_time, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      ptr__ += IMC::serialize(travel_z, ptr__);
-      ptr__ += IMC::serialize(travel_z_units, ptr__);
-      ptr__ += IMC::serialize(delayed, ptr__);
-      return ptr__;
+      IMC::serialize(arrival_time, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 8);
+      IMC::serialize(lon, bfr__ + 16);
+      IMC::serialize(z, bfr__ + 24);
+      IMC::serialize(z_units, bfr__ + 28);
+      IMC::serialize(travel_z, bfr__ + 29);
+      IMC::serialize(travel_z_units, bfr__ + 33);
+      IMC::serialize(delayed, bfr__ + 34);
+      return bfr__ + 35;
     }
 
     uint16_t
     ScheduledGoto::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(arrival_time, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(delayed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 35)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(arrival_time, bfr__ + 0);
+      IMC::deserializeFixed(lat, bfr__ + 8);
+      IMC::deserializeFixed(lon, bfr__ + 16);
+      IMC::deserializeFixed(z, bfr__ + 24);
+      IMC::deserializeFixed(z_units, bfr__ + 28);
+      IMC::deserializeFixed(travel_z, bfr__ + 29);
+      IMC::deserializeFixed(travel_z_units, bfr__ + 33);
+      IMC::deserializeFixed(delayed, bfr__ + 34);
+      return 35;
     }
 
     uint16_t
     ScheduledGoto::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(arrival_time, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(travel_z, bfr__, size__);
-      bfr__ += IMC::deserialize(travel_z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(delayed, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 35)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(arrival_time, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lat, bfr__ + 8);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 16);
+      IMC::reverseDeserializeFixed(z, bfr__ + 24);
+      IMC::deserializeFixed(z_units, bfr__ + 28);
+      IMC::reverseDeserializeFixed(travel_z, bfr__ + 29);
+      IMC::deserializeFixed(travel_z_units, bfr__ + 33);
+      IMC::deserializeFixed(delayed, bfr__ + 34);
+      return 35;
     }
 
     void
@@ -18493,58 +19023,63 @@ namespace DUNE
     uint8_t*
     OperationalLimits::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(mask, ptr__);
-      ptr__ += IMC::serialize(max_depth, ptr__);
-      ptr__ += IMC::serialize(min_altitude, ptr__);
-      ptr__ += IMC::serialize(max_altitude, ptr__);
-      ptr__ += IMC::serialize(min_speed, ptr__);
-      ptr__ += IMC::serialize(max_speed, ptr__);
-      ptr__ += IMC::serialize(max_vrate, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(orientation, ptr__);
-      ptr__ += IMC::serialize(width, ptr__);
-      ptr__ += IMC::serialize(length, ptr__);
-      return ptr__;
+      IMC::serialize(mask, bfr__ + 0);
+      IMC::serialize(max_depth, bfr__ + 1);
+      IMC::serialize(min_altitude, bfr__ + 5);
+      IMC::serialize(max_altitude, bfr__ + 9);
+      IMC::serialize(min_speed, bfr__ + 13);
+      IMC::serialize(max_speed, bfr__ + 17);
+      IMC::serialize(max_vrate, bfr__ + 21);
+      IMC::serialize(lat, bfr__ + 25);
+      IMC::serialize(lon, bfr__ + 33);
+      IMC::serialize(orientation, bfr__ + 41);
+      IMC::serialize(width, bfr__ + 45);
+      IMC::serialize(length, bfr__ + 49);
+      return bfr__ + 53;
     }
 
     uint16_t
     OperationalLimits::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::deserialize(max_depth, bfr__, size__);
-      bfr__ += IMC::deserialize(min_altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(max_altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(min_speed, bfr__, size__);
-      bfr__ += IMC::deserialize(max_speed, bfr__, size__);
-      bfr__ += IMC::deserialize(max_vrate, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(orientation, bfr__, size__);
-      bfr__ += IMC::deserialize(width, bfr__, size__);
-      bfr__ += IMC::deserialize(length, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 53)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(mask, bfr__ + 0);
+      IMC::deserializeFixed(max_depth, bfr__ + 1);
+      IMC::deserializeFixed(min_altitude, bfr__ + 5);
+      IMC::deserializeFixed(max_altitude, bfr__ + 9);
+      IMC::deserializeFixed(min_speed, bfr__ + 13);
+      IMC::deserializeFixed(max_speed, bfr__ + 17);
+      IMC::deserializeFixed(max_vrate, bfr__ + 21);
+      IMC::deserializeFixed(lat, bfr__ + 25);
+      IMC::deserializeFixed(lon, bfr__ + 33);
+      IMC::deserializeFixed(orientation, bfr__ + 41);
+      IMC::deserializeFixed(width, bfr__ + 45);
+      IMC::deserializeFixed(length, bfr__ + 49);
+      return 53;
     }
 
     uint16_t
     OperationalLimits::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(min_altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(min_speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(max_vrate, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(orientation, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(width, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(length, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 53)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(mask, bfr__ + 0);
+      IMC::reverseDeserializeFixed(max_depth, bfr__ + 1);
+      IMC::reverseDeserializeFixed(min_altitude, bfr__ + 5);
+      IMC::reverseDeserializeFixed(max_altitude, bfr__ + 9);
+      IMC::reverseDeserializeFixed(min_speed, bfr__ + 13);
+      IMC::reverseDeserializeFixed(max_speed, bfr__ + 17);
+      IMC::reverseDeserializeFixed(max_vrate, bfr__ + 21);
+      IMC::reverseDeserializeFixed(lat, bfr__ + 25);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 33);
+      IMC::reverseDeserializeFixed(orientation, bfr__ + 41);
+      IMC::reverseDeserializeFixed(width, bfr__ + 45);
+      IMC::reverseDeserializeFixed(length, bfr__ + 49);
+      return 53;
     }
 
     void
@@ -18632,25 +19167,30 @@ namespace DUNE
     uint8_t*
     Calibration::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(duration, ptr__);
-      return ptr__;
+      IMC::serialize(duration, bfr__ + 0);
+      return bfr__ + 2;
     }
 
     uint16_t
-    Calibration::deserializeFields(const uint8_t* bfr__, uint16_t size__)
-    {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+    Calibration::deserializeFields(const uint8_t* bfr__, uint16_t size__)
+    {
+      if (size__ < 2)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(duration, bfr__ + 0);
+      return 2;
     }
 
     uint16_t
     Calibration::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 2)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(duration, bfr__ + 0);
+      return 2;
     }
 
     void
@@ -18692,31 +19232,36 @@ namespace DUNE
     uint8_t*
     ControlLoops::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(enable, ptr__);
-      ptr__ += IMC::serialize(mask, ptr__);
-      ptr__ += IMC::serialize(scope_ref, ptr__);
-      return ptr__;
+      IMC::serialize(enable, bfr__ + 0);
+      IMC::serialize(mask, bfr__ + 1);
+      IMC::serialize(scope_ref, bfr__ + 5);
+      return bfr__ + 9;
     }
 
     uint16_t
     ControlLoops::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(enable, bfr__, size__);
-      bfr__ += IMC::deserialize(mask, bfr__, size__);
-      bfr__ += IMC::deserialize(scope_ref, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(enable, bfr__ + 0);
+      IMC::deserializeFixed(mask, bfr__ + 1);
+      IMC::deserializeFixed(scope_ref, bfr__ + 5);
+      return 9;
     }
 
     uint16_t
     ControlLoops::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(enable, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(mask, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(scope_ref, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 9)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(enable, bfr__ + 0);
+      IMC::reverseDeserializeFixed(mask, bfr__ + 1);
+      IMC::reverseDeserializeFixed(scope_ref, bfr__ + 5);
+      return 9;
     }
 
     void
@@ -18756,25 +19301,30 @@ namespace DUNE
     uint8_t*
     VehicleMedium::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(medium, ptr__);
-      return ptr__;
+      IMC::serialize(medium, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     VehicleMedium::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(medium, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(medium, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     VehicleMedium::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(medium, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(medium, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -18814,28 +19364,33 @@ namespace DUNE
     uint8_t*
     Collision::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     Collision::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      IMC::deserializeFixed(type, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     Collision::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      IMC::deserializeFixed(type, bfr__ + 4);
+      return 5;
     }
 
     fp64_t
@@ -18896,40 +19451,45 @@ namespace DUNE
     uint8_t*
     FormState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(possimerr, ptr__);
-      ptr__ += IMC::serialize(converg, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      ptr__ += IMC::serialize(possimmon, ptr__);
-      ptr__ += IMC::serialize(commmon, ptr__);
-      ptr__ += IMC::serialize(convergmon, ptr__);
-      return ptr__;
+      IMC::serialize(possimerr, bfr__ + 0);
+      IMC::serialize(converg, bfr__ + 4);
+      IMC::serialize(turbulence, bfr__ + 8);
+      IMC::serialize(possimmon, bfr__ + 12);
+      IMC::serialize(commmon, bfr__ + 13);
+      IMC::serialize(convergmon, bfr__ + 14);
+      return bfr__ + 15;
     }
 
     uint16_t
     FormState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::deserialize(converg, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 15)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(possimerr, bfr__ + 0);
+      IMC::deserializeFixed(converg, bfr__ + 4);
+      IMC::deserializeFixed(turbulence, bfr__ + 8);
+      IMC::deserializeFixed(possimmon, bfr__ + 12);
+      IMC::deserializeFixed(commmon, bfr__ + 13);
+      IMC::deserializeFixed(convergmon, bfr__ + 14);
+      return 15;
     }
 
     uint16_t
     FormState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(converg, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 15)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(possimerr, bfr__ + 0);
+      IMC::reverseDeserializeFixed(converg, bfr__ + 4);
+      IMC::reverseDeserializeFixed(turbulence, bfr__ + 8);
+      IMC::deserializeFixed(possimmon, bfr__ + 12);
+      IMC::deserializeFixed(commmon, bfr__ + 13);
+      IMC::deserializeFixed(convergmon, bfr__ + 14);
+      return 15;
     }
 
     void
@@ -19048,46 +19608,51 @@ namespace DUNE
     uint8_t*
     FormationState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(type, ptr__);
-      ptr__ += IMC::serialize(op, ptr__);
-      ptr__ += IMC::serialize(possimerr, ptr__);
-      ptr__ += IMC::serialize(converg, ptr__);
-      ptr__ += IMC::serialize(turbulence, ptr__);
-      ptr__ += IMC::serialize(possimmon, ptr__);
-      ptr__ += IMC::serialize(commmon, ptr__);
-      ptr__ += IMC::serialize(convergmon, ptr__);
-      return ptr__;
+      IMC::serialize(type, bfr__ + 0);
+      IMC::serialize(op, bfr__ + 1);
+      IMC::serialize(possimerr, bfr__ + 2);
+      IMC::serialize(converg, bfr__ + 6);
+      IMC::serialize(turbulence, bfr__ + 10);
+      IMC::serialize(possimmon, bfr__ + 14);
+      IMC::serialize(commmon, bfr__ + 15);
+      IMC::serialize(convergmon, bfr__ + 16);
+      return bfr__ + 17;
     }
 
     uint16_t
     FormationState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::deserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::deserialize(converg, bfr__, size__);
-      bfr__ += IMC::deserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 17)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(type, bfr__ + 0);
+      IMC::deserializeFixed(op, bfr__ + 1);
+      IMC::deserializeFixed(possimerr, bfr__ + 2);
+      IMC::deserializeFixed(converg, bfr__ + 6);
+      IMC::deserializeFixed(turbulence, bfr__ + 10);
+      IMC::deserializeFixed(possimmon, bfr__ + 14);
+      IMC::deserializeFixed(commmon, bfr__ + 15);
+      IMC::deserializeFixed(convergmon, bfr__ + 16);
+      return 17;
     }
 
     uint16_t
     FormationState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      bfr__ += IMC::deserialize(op, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(possimerr, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(converg, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(turbulence, bfr__, size__);
-      bfr__ += IMC::deserialize(possimmon, bfr__, size__);
-      bfr__ += IMC::deserialize(commmon, bfr__, size__);
-      bfr__ += IMC::deserialize(convergmon, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 17)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(type, bfr__ + 0);
+      IMC::deserializeFixed(op, bfr__ + 1);
+      IMC::reverseDeserializeFixed(possimerr, bfr__ + 2);
+      IMC::reverseDeserializeFixed(converg, bfr__ + 6);
+      IMC::reverseDeserializeFixed(turbulence, bfr__ + 10);
+      IMC::deserializeFixed(possimmon, bfr__ + 14);
+      IMC::deserializeFixed(commmon, bfr__ + 15);
+      IMC::deserializeFixed(convergmon, bfr__ + 16);
+      return 17;
     }
 
     void
@@ -19224,52 +19789,57 @@ namespace DUNE
     uint8_t*
     StateReport::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(stime, ptr__);
-      ptr__ += IMC::serialize(latitude, ptr__);
-      ptr__ += IMC::serialize(longitude, ptr__);
-      ptr__ += IMC::serialize(altitude, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(heading, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(fuel, ptr__);
-      ptr__ += IMC::serialize(exec_state, ptr__);
-      ptr__ += IMC::serialize(plan_checksum, ptr__);
-      return ptr__;
+      IMC::serialize(stime, bfr__ + 0);
+      IMC::serialize(latitude, bfr__ + 4);
+      IMC::serialize(longitude, bfr__ + 8);
+      IMC::serialize(altitude, bfr__ + 12);
+      IMC::serialize(depth, bfr__ + 14);
+      IMC::serialize(heading, bfr__ + 16);
+      IMC::serialize(speed, bfr__ + 18);
+      IMC::serialize(fuel, bfr__ + 20);
+      IMC::serialize(exec_state, bfr__ + 21);
+      IMC::serialize(plan_checksum, bfr__ + 22);
+      return bfr__ + 24;
     }
 
     uint16_t
     StateReport::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(stime, bfr__, size__);
-      bfr__ += IMC::deserialize(latitude, bfr__, size__);
-      bfr__ += IMC::deserialize(longitude, bfr__, size__);
-      bfr__ += IMC::deserialize(altitude, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(heading, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(fuel, bfr__, size__);
-      bfr__ += IMC::deserialize(exec_state, bfr__, size__);
-      bfr__ += IMC::deserialize(plan_checksum, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(stime, bfr__ + 0);
+      IMC::deserializeFixed(latitude, bfr__ + 4);
+      IMC::deserializeFixed(longitude, bfr__ + 8);
+      IMC::deserializeFixed(altitude, bfr__ + 12);
+      IMC::deserializeFixed(depth, bfr__ + 14);
+      IMC::deserializeFixed(heading, bfr__ + 16);
+      IMC::deserializeFixed(speed, bfr__ + 18);
+      IMC::deserializeFixed(fuel, bfr__ + 20);
+      IMC::deserializeFixed(exec_state, bfr__ + 21);
+      IMC::deserializeFixed(plan_checksum, bfr__ + 22);
+      return 24;
     }
 
     uint16_t
     StateReport::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(stime, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(latitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(longitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(altitude, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(heading, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(fuel, bfr__, size__);
-      bfr__ += IMC::deserialize(exec_state, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(plan_checksum, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 24)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(stime, bfr__ + 0);
+      IMC::reverseDeserializeFixed(latitude, bfr__ + 4);
+      IMC::reverseDeserializeFixed(longitude, bfr__ + 8);
+      IMC::reverseDeserializeFixed(altitude, bfr__ + 12);
+      IMC::reverseDeserializeFixed(depth, bfr__ + 14);
+      IMC::reverseDeserializeFixed(heading, bfr__ + 16);
+      IMC::reverseDeserializeFixed(speed, bfr__ + 18);
+      IMC::deserializeFixed(fuel, bfr__ + 20);
+      IMC::deserializeFixed(exec_state, bfr__ + 21);
+      IMC::reverseDeserializeFixed(plan_checksum, bfr__ + 22);
+      return 24;
     }
 
     void
@@ -19682,25 +20252,30 @@ namespace DUNE
     uint8_t*
     VtolState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(state, ptr__);
-      return ptr__;
+      IMC::serialize(state, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     VtolState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(state, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     VtolState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(state, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -19738,25 +20313,30 @@ namespace DUNE
     uint8_t*
     ArmingState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(state, ptr__);
-      return ptr__;
+      IMC::serialize(state, bfr__ + 0);
+      return bfr__ + 1;
     }
 
     uint16_t
     ArmingState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(state, bfr__ + 0);
+      return 1;
     }
 
     uint16_t
     ArmingState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 1)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(state, bfr__ + 0);
+      return 1;
     }
 
     void
@@ -21819,31 +22399,36 @@ namespace DUNE
     uint8_t*
     MapPoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(alt, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 8);
+      IMC::serialize(alt, bfr__ + 16);
+      return bfr__ + 20;
     }
 
     uint16_t
     MapPoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 20)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(lat, bfr__ + 0);
+      IMC::deserializeFixed(lon, bfr__ + 8);
+      IMC::deserializeFixed(alt, bfr__ + 16);
+      return 20;
     }
 
     uint16_t
     MapPoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(alt, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 20)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(lat, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 8);
+      IMC::reverseDeserializeFixed(alt, bfr__ + 16);
+      return 20;
     }
 
     void
@@ -22946,34 +23531,39 @@ namespace DUNE
     uint8_t*
     ImageTxSettings::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(fps, ptr__);
-      ptr__ += IMC::serialize(quality, ptr__);
-      ptr__ += IMC::serialize(reps, ptr__);
-      ptr__ += IMC::serialize(tsize, ptr__);
-      return ptr__;
+      IMC::serialize(fps, bfr__ + 0);
+      IMC::serialize(quality, bfr__ + 1);
+      IMC::serialize(reps, bfr__ + 2);
+      IMC::serialize(tsize, bfr__ + 3);
+      return bfr__ + 4;
     }
 
     uint16_t
     ImageTxSettings::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(fps, bfr__, size__);
-      bfr__ += IMC::deserialize(quality, bfr__, size__);
-      bfr__ += IMC::deserialize(reps, bfr__, size__);
-      bfr__ += IMC::deserialize(tsize, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(fps, bfr__ + 0);
+      IMC::deserializeFixed(quality, bfr__ + 1);
+      IMC::deserializeFixed(reps, bfr__ + 2);
+      IMC::deserializeFixed(tsize, bfr__ + 3);
+      return 4;
     }
 
     uint16_t
     ImageTxSettings::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(fps, bfr__, size__);
-      bfr__ += IMC::deserialize(quality, bfr__, size__);
-      bfr__ += IMC::deserialize(reps, bfr__, size__);
-      bfr__ += IMC::deserialize(tsize, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(fps, bfr__ + 0);
+      IMC::deserializeFixed(quality, bfr__ + 1);
+      IMC::deserializeFixed(reps, bfr__ + 2);
+      IMC::deserializeFixed(tsize, bfr__ + 3);
+      return 4;
     }
 
     void
@@ -23024,37 +23614,42 @@ namespace DUNE
     uint8_t*
     RemoteState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(depth, ptr__);
-      ptr__ += IMC::serialize(speed, ptr__);
-      ptr__ += IMC::serialize(psi, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 4);
+      IMC::serialize(depth, bfr__ + 8);
+      IMC::serialize(speed, bfr__ + 9);
+      IMC::serialize(psi, bfr__ + 13);
+      return bfr__ + 17;
     }
 
     uint16_t
     RemoteState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::deserialize(speed, bfr__, size__);
-      bfr__ += IMC::deserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 17)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(lat, bfr__ + 0);
+      IMC::deserializeFixed(lon, bfr__ + 4);
+      IMC::deserializeFixed(depth, bfr__ + 8);
+      IMC::deserializeFixed(speed, bfr__ + 9);
+      IMC::deserializeFixed(psi, bfr__ + 13);
+      return 17;
     }
 
     uint16_t
     RemoteState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(depth, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(speed, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(psi, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 17)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(lat, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 4);
+      IMC::deserializeFixed(depth, bfr__ + 8);
+      IMC::reverseDeserializeFixed(speed, bfr__ + 9);
+      IMC::reverseDeserializeFixed(psi, bfr__ + 13);
+      return 17;
     }
 
     void
@@ -23562,25 +24157,30 @@ namespace DUNE
     uint8_t*
     CreateSession::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(timeout, ptr__);
-      return ptr__;
+      IMC::serialize(timeout, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     CreateSession::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(timeout, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(timeout, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     CreateSession::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(timeout, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(timeout, bfr__ + 0);
+      return 4;
     }
 
     void
@@ -23618,25 +24218,30 @@ namespace DUNE
     uint8_t*
     CloseSession::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      return ptr__;
+      IMC::serialize(sessid, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     CloseSession::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(sessid, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     CloseSession::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(sessid, bfr__ + 0);
+      return 4;
     }
 
     void
@@ -23736,25 +24341,30 @@ namespace DUNE
     uint8_t*
     SessionKeepAlive::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      return ptr__;
+      IMC::serialize(sessid, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     SessionKeepAlive::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(sessid, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     SessionKeepAlive::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(sessid, bfr__ + 0);
+      return 4;
     }
 
     void
@@ -23794,28 +24404,33 @@ namespace DUNE
     uint8_t*
     SessionStatus::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(sessid, ptr__);
-      ptr__ += IMC::serialize(status, ptr__);
-      return ptr__;
+      IMC::serialize(sessid, bfr__ + 0);
+      IMC::serialize(status, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     SessionStatus::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(sessid, bfr__, size__);
-      bfr__ += IMC::deserialize(status, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(sessid, bfr__ + 0);
+      IMC::deserializeFixed(status, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     SessionStatus::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(sessid, bfr__, size__);
-      bfr__ += IMC::deserialize(status, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(sessid, bfr__ + 0);
+      IMC::deserializeFixed(status, bfr__ + 4);
+      return 5;
     }
 
     void
@@ -24346,40 +24961,45 @@ namespace DUNE
     uint8_t*
     FormCtrlParam::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(action, ptr__);
-      ptr__ += IMC::serialize(longain, ptr__);
-      ptr__ += IMC::serialize(latgain, ptr__);
-      ptr__ += IMC::serialize(bondthick, ptr__);
-      ptr__ += IMC::serialize(leadgain, ptr__);
-      ptr__ += IMC::serialize(deconflgain, ptr__);
-      return ptr__;
+      IMC::serialize(action, bfr__ + 0);
+      IMC::serialize(longain, bfr__ + 1);
+      IMC::serialize(latgain, bfr__ + 5);
+      IMC::serialize(bondthick, bfr__ + 9);
+      IMC::serialize(leadgain, bfr__ + 13);
+      IMC::serialize(deconflgain, bfr__ + 17);
+      return bfr__ + 21;
     }
 
     uint16_t
     FormCtrlParam::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::deserialize(longain, bfr__, size__);
-      bfr__ += IMC::deserialize(latgain, bfr__, size__);
-      bfr__ += IMC::deserialize(bondthick, bfr__, size__);
-      bfr__ += IMC::deserialize(leadgain, bfr__, size__);
-      bfr__ += IMC::deserialize(deconflgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 21)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(action, bfr__ + 0);
+      IMC::deserializeFixed(longain, bfr__ + 1);
+      IMC::deserializeFixed(latgain, bfr__ + 5);
+      IMC::deserializeFixed(bondthick, bfr__ + 9);
+      IMC::deserializeFixed(leadgain, bfr__ + 13);
+      IMC::deserializeFixed(deconflgain, bfr__ + 17);
+      return 21;
     }
 
     uint16_t
     FormCtrlParam::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(longain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(latgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bondthick, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(leadgain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconflgain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 21)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(action, bfr__ + 0);
+      IMC::reverseDeserializeFixed(longain, bfr__ + 1);
+      IMC::reverseDeserializeFixed(latgain, bfr__ + 5);
+      IMC::reverseDeserializeFixed(bondthick, bfr__ + 9);
+      IMC::reverseDeserializeFixed(leadgain, bfr__ + 13);
+      IMC::reverseDeserializeFixed(deconflgain, bfr__ + 17);
+      return 21;
     }
 
     void
@@ -24426,31 +25046,36 @@ namespace DUNE
     uint8_t*
     FormationEval::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(err_mean, ptr__);
-      ptr__ += IMC::serialize(dist_min_abs, ptr__);
-      ptr__ += IMC::serialize(dist_min_mean, ptr__);
-      return ptr__;
+      IMC::serialize(err_mean, bfr__ + 0);
+      IMC::serialize(dist_min_abs, bfr__ + 4);
+      IMC::serialize(dist_min_mean, bfr__ + 8);
+      return bfr__ + 12;
     }
 
     uint16_t
     FormationEval::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(err_mean, bfr__, size__);
-      bfr__ += IMC::deserialize(dist_min_abs, bfr__, size__);
-      bfr__ += IMC::deserialize(dist_min_mean, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(err_mean, bfr__ + 0);
+      IMC::deserializeFixed(dist_min_abs, bfr__ + 4);
+      IMC::deserializeFixed(dist_min_mean, bfr__ + 8);
+      return 12;
     }
 
     uint16_t
     FormationEval::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(err_mean, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dist_min_abs, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(dist_min_mean, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 12)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(err_mean, bfr__ + 0);
+      IMC::reverseDeserializeFixed(dist_min_abs, bfr__ + 4);
+      IMC::reverseDeserializeFixed(dist_min_mean, bfr__ + 8);
+      return 12;
     }
 
     void
@@ -24510,55 +25135,60 @@ namespace DUNE
     uint8_t*
     FormationControlParams::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(action, ptr__);
-      ptr__ += IMC::serialize(lon_gain, ptr__);
-      ptr__ += IMC::serialize(lat_gain, ptr__);
-      ptr__ += IMC::serialize(bond_thick, ptr__);
-      ptr__ += IMC::serialize(lead_gain, ptr__);
-      ptr__ += IMC::serialize(deconfl_gain, ptr__);
-      ptr__ += IMC::serialize(accel_switch_gain, ptr__);
-      ptr__ += IMC::serialize(safe_dist, ptr__);
-      ptr__ += IMC::serialize(deconflict_offset, ptr__);
-      ptr__ += IMC::serialize(accel_safe_margin, ptr__);
-      ptr__ += IMC::serialize(accel_lim_x, ptr__);
-      return ptr__;
+      IMC::serialize(action, bfr__ + 0);
+      IMC::serialize(lon_gain, bfr__ + 1);
+      IMC::serialize(lat_gain, bfr__ + 5);
+      IMC::serialize(bond_thick, bfr__ + 9);
+      IMC::serialize(lead_gain, bfr__ + 13);
+      IMC::serialize(deconfl_gain, bfr__ + 17);
+      IMC::serialize(accel_switch_gain, bfr__ + 21);
+      IMC::serialize(safe_dist, bfr__ + 25);
+      IMC::serialize(deconflict_offset, bfr__ + 29);
+      IMC::serialize(accel_safe_margin, bfr__ + 33);
+      IMC::serialize(accel_lim_x, bfr__ + 37);
+      return bfr__ + 41;
     }
 
     uint16_t
     FormationControlParams::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::deserialize(lon_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(lat_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(bond_thick, bfr__, size__);
-      bfr__ += IMC::deserialize(lead_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(deconfl_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_switch_gain, bfr__, size__);
-      bfr__ += IMC::deserialize(safe_dist, bfr__, size__);
-      bfr__ += IMC::deserialize(deconflict_offset, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_safe_margin, bfr__, size__);
-      bfr__ += IMC::deserialize(accel_lim_x, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 41)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(action, bfr__ + 0);
+      IMC::deserializeFixed(lon_gain, bfr__ + 1);
+      IMC::deserializeFixed(lat_gain, bfr__ + 5);
+      IMC::deserializeFixed(bond_thick, bfr__ + 9);
+      IMC::deserializeFixed(lead_gain, bfr__ + 13);
+      IMC::deserializeFixed(deconfl_gain, bfr__ + 17);
+      IMC::deserializeFixed(accel_switch_gain, bfr__ + 21);
+      IMC::deserializeFixed(safe_dist, bfr__ + 25);
+      IMC::deserializeFixed(deconflict_offset, bfr__ + 29);
+      IMC::deserializeFixed(accel_safe_margin, bfr__ + 33);
+      IMC::deserializeFixed(accel_lim_x, bfr__ + 37);
+      return 41;
     }
 
     uint16_t
     FormationControlParams::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(action, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bond_thick, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lead_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconfl_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_switch_gain, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(safe_dist, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(deconflict_offset, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_safe_margin, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(accel_lim_x, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 41)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(action, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lon_gain, bfr__ + 1);
+      IMC::reverseDeserializeFixed(lat_gain, bfr__ + 5);
+      IMC::reverseDeserializeFixed(bond_thick, bfr__ + 9);
+      IMC::reverseDeserializeFixed(lead_gain, bfr__ + 13);
+      IMC::reverseDeserializeFixed(deconfl_gain, bfr__ + 17);
+      IMC::reverseDeserializeFixed(accel_switch_gain, bfr__ + 21);
+      IMC::reverseDeserializeFixed(safe_dist, bfr__ + 25);
+      IMC::reverseDeserializeFixed(deconflict_offset, bfr__ + 29);
+      IMC::reverseDeserializeFixed(accel_safe_margin, bfr__ + 33);
+      IMC::reverseDeserializeFixed(accel_lim_x, bfr__ + 37);
+      return 41;
     }
 
     void
@@ -24756,34 +25386,39 @@ namespace DUNE
     uint8_t*
     SoiWaypoint::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(eta, ptr__);
-      ptr__ += IMC::serialize(duration, ptr__);
-      return ptr__;
+      IMC::serialize(lat, bfr__ + 0);
+      IMC::serialize(lon, bfr__ + 4);
+      IMC::serialize(eta, bfr__ + 8);
+      IMC::serialize(duration, bfr__ + 12);
+      return bfr__ + 14;
     }
 
     uint16_t
     SoiWaypoint::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(eta, bfr__, size__);
-      bfr__ += IMC::deserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 14)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(lat, bfr__ + 0);
+      IMC::deserializeFixed(lon, bfr__ + 4);
+      IMC::deserializeFixed(eta, bfr__ + 8);
+      IMC::deserializeFixed(duration, bfr__ + 12);
+      return 14;
     }
 
     uint16_t
     SoiWaypoint::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(eta, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(duration, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 14)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(lat, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 4);
+      IMC::reverseDeserializeFixed(eta, bfr__ + 8);
+      IMC::reverseDeserializeFixed(duration, bfr__ + 12);
+      return 14;
     }
 
     void
@@ -25049,34 +25684,39 @@ namespace DUNE
     uint8_t*
     SoiState::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(state, ptr__);
-      ptr__ += IMC::serialize(plan_id, ptr__);
-      ptr__ += IMC::serialize(wpt_id, ptr__);
-      ptr__ += IMC::serialize(settings_chk, ptr__);
-      return ptr__;
+      IMC::serialize(state, bfr__ + 0);
+      IMC::serialize(plan_id, bfr__ + 1);
+      IMC::serialize(wpt_id, bfr__ + 3);
+      IMC::serialize(settings_chk, bfr__ + 4);
+      return bfr__ + 6;
     }
 
     uint16_t
     SoiState::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      bfr__ += IMC::deserialize(plan_id, bfr__, size__);
-      bfr__ += IMC::deserialize(wpt_id, bfr__, size__);
-      bfr__ += IMC::deserialize(settings_chk, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(state, bfr__ + 0);
+      IMC::deserializeFixed(plan_id, bfr__ + 1);
+      IMC::deserializeFixed(wpt_id, bfr__ + 3);
+      IMC::deserializeFixed(settings_chk, bfr__ + 4);
+      return 6;
     }
 
     uint16_t
     SoiState::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(state, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(plan_id, bfr__, size__);
-      bfr__ += IMC::deserialize(wpt_id, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(settings_chk, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(state, bfr__ + 0);
+      IMC::reverseDeserializeFixed(plan_id, bfr__ + 1);
+      IMC::deserializeFixed(wpt_id, bfr__ + 3);
+      IMC::reverseDeserializeFixed(settings_chk, bfr__ + 4);
+      return 6;
     }
 
     void
@@ -25296,31 +25936,36 @@ namespace DUNE
     uint8_t*
     UsblAngles::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(bearing, ptr__);
-      ptr__ += IMC::serialize(elevation, ptr__);
-      return ptr__;
+      IMC::serialize(target, bfr__ + 0);
+      IMC::serialize(bearing, bfr__ + 2);
+      IMC::serialize(elevation, bfr__ + 6);
+      return bfr__ + 10;
     }
 
     uint16_t
     UsblAngles::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(bearing, bfr__, size__);
-      bfr__ += IMC::deserialize(elevation, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(target, bfr__ + 0);
+      IMC::deserializeFixed(bearing, bfr__ + 2);
+      IMC::deserializeFixed(elevation, bfr__ + 6);
+      return 10;
     }
 
     uint16_t
     UsblAngles::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(bearing, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(elevation, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 10)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(target, bfr__ + 0);
+      IMC::reverseDeserializeFixed(bearing, bfr__ + 2);
+      IMC::reverseDeserializeFixed(elevation, bfr__ + 6);
+      return 10;
     }
 
     void
@@ -25366,34 +26011,39 @@ namespace DUNE
     uint8_t*
     UsblPosition::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(target, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 2);
+      IMC::serialize(y, bfr__ + 6);
+      IMC::serialize(z, bfr__ + 10);
+      return bfr__ + 14;
     }
 
     uint16_t
     UsblPosition::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 14)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(target, bfr__ + 0);
+      IMC::deserializeFixed(x, bfr__ + 2);
+      IMC::deserializeFixed(y, bfr__ + 6);
+      IMC::deserializeFixed(z, bfr__ + 10);
+      return 14;
     }
 
     uint16_t
     UsblPosition::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 14)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(target, bfr__ + 0);
+      IMC::reverseDeserializeFixed(x, bfr__ + 2);
+      IMC::reverseDeserializeFixed(y, bfr__ + 6);
+      IMC::reverseDeserializeFixed(z, bfr__ + 10);
+      return 14;
     }
 
     void
@@ -25444,37 +26094,42 @@ namespace DUNE
     uint8_t*
     UsblFix::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(target, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(z_units, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(target, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 2);
+      IMC::serialize(lon, bfr__ + 10);
+      IMC::serialize(z_units, bfr__ + 18);
+      IMC::serialize(z, bfr__ + 19);
+      return bfr__ + 23;
     }
 
     uint16_t
     UsblFix::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(target, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 23)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(target, bfr__ + 0);
+      IMC::deserializeFixed(lat, bfr__ + 2);
+      IMC::deserializeFixed(lon, bfr__ + 10);
+      IMC::deserializeFixed(z_units, bfr__ + 18);
+      IMC::deserializeFixed(z, bfr__ + 19);
+      return 23;
     }
 
     uint16_t
     UsblFix::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(target, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(z_units, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 23)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(target, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lat, bfr__ + 2);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 10);
+      IMC::deserializeFixed(z_units, bfr__ + 18);
+      IMC::reverseDeserializeFixed(z, bfr__ + 19);
+      return 23;
     }
 
     void
@@ -25621,31 +26276,36 @@ namespace DUNE
     uint8_t*
     SetImageCoords::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(camid, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      return ptr__;
+      IMC::serialize(camid, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 3);
+      return bfr__ + 5;
     }
 
     uint16_t
     SetImageCoords::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(camid, bfr__ + 0);
+      IMC::deserializeFixed(x, bfr__ + 1);
+      IMC::deserializeFixed(y, bfr__ + 3);
+      return 5;
     }
 
     uint16_t
     SetImageCoords::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(camid, bfr__ + 0);
+      IMC::reverseDeserializeFixed(x, bfr__ + 1);
+      IMC::reverseDeserializeFixed(y, bfr__ + 3);
+      return 5;
     }
 
     void
@@ -25689,31 +26349,36 @@ namespace DUNE
     uint8_t*
     GetImageCoords::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(camid, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      return ptr__;
+      IMC::serialize(camid, bfr__ + 0);
+      IMC::serialize(x, bfr__ + 1);
+      IMC::serialize(y, bfr__ + 3);
+      return bfr__ + 5;
     }
 
     uint16_t
     GetImageCoords::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(camid, bfr__ + 0);
+      IMC::deserializeFixed(x, bfr__ + 1);
+      IMC::deserializeFixed(y, bfr__ + 3);
+      return 5;
     }
 
     uint16_t
     GetImageCoords::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(camid, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(camid, bfr__ + 0);
+      IMC::reverseDeserializeFixed(x, bfr__ + 1);
+      IMC::reverseDeserializeFixed(y, bfr__ + 3);
+      return 5;
     }
 
     void
@@ -25763,40 +26428,45 @@ namespace DUNE
     uint8_t*
     GetWorldCoordinates::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(tracking, ptr__);
-      ptr__ += IMC::serialize(lat, ptr__);
-      ptr__ += IMC::serialize(lon, ptr__);
-      ptr__ += IMC::serialize(x, ptr__);
-      ptr__ += IMC::serialize(y, ptr__);
-      ptr__ += IMC::serialize(z, ptr__);
-      return ptr__;
+      IMC::serialize(tracking, bfr__ + 0);
+      IMC::serialize(lat, bfr__ + 1);
+      IMC::serialize(lon, bfr__ + 9);
+      IMC::serialize(x, bfr__ + 17);
+      IMC::serialize(y, bfr__ + 21);
+      IMC::serialize(z, bfr__ + 25);
+      return bfr__ + 29;
     }
 
     uint16_t
     GetWorldCoordinates::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(tracking, bfr__, size__);
-      bfr__ += IMC::deserialize(lat, bfr__, size__);
-      bfr__ += IMC::deserialize(lon, bfr__, size__);
-      bfr__ += IMC::deserialize(x, bfr__, size__);
-      bfr__ += IMC::deserialize(y, bfr__, size__);
-      bfr__ += IMC::deserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 29)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(tracking, bfr__ + 0);
+      IMC::deserializeFixed(lat, bfr__ + 1);
+      IMC::deserializeFixed(lon, bfr__ + 9);
+      IMC::deserializeFixed(x, bfr__ + 17);
+      IMC::deserializeFixed(y, bfr__ + 21);
+      IMC::deserializeFixed(z, bfr__ + 25);
+      return 29;
     }
 
     uint16_t
     GetWorldCoordinates::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(tracking, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lat, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(lon, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(x, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(y, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(z, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 29)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(tracking, bfr__ + 0);
+      IMC::reverseDeserializeFixed(lat, bfr__ + 1);
+      IMC::reverseDeserializeFixed(lon, bfr__ + 9);
+      IMC::reverseDeserializeFixed(x, bfr__ + 17);
+      IMC::reverseDeserializeFixed(y, bfr__ + 21);
+      IMC::reverseDeserializeFixed(z, bfr__ + 25);
+      return 29;
     }
 
     void
@@ -26333,28 +27003,33 @@ namespace DUNE
     uint8_t*
     DissolvedOrganicMatter::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(type, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      IMC::serialize(type, bfr__ + 4);
+      return bfr__ + 5;
     }
 
     uint16_t
     DissolvedOrganicMatter::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      IMC::deserializeFixed(type, bfr__ + 4);
+      return 5;
     }
 
     uint16_t
     DissolvedOrganicMatter::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(type, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 5)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      IMC::deserializeFixed(type, bfr__ + 4);
+      return 5;
     }
 
     fp64_t
@@ -26405,25 +27080,30 @@ namespace DUNE
     uint8_t*
     OpticalBackscatter::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 4;
     }
 
     uint16_t
     OpticalBackscatter::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     uint16_t
     OpticalBackscatter::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 4)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 4;
     }
 
     fp64_t
@@ -26503,70 +27183,75 @@ namespace DUNE
     uint8_t*
     Tachograph::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(timestamp_last_service, ptr__);
-      ptr__ += IMC::serialize(time_next_service, ptr__);
-      ptr__ += IMC::serialize(time_motor_next_service, ptr__);
-      ptr__ += IMC::serialize(time_idle_ground, ptr__);
-      ptr__ += IMC::serialize(time_idle_air, ptr__);
-      ptr__ += IMC::serialize(time_idle_water, ptr__);
-      ptr__ += IMC::serialize(time_idle_underwater, ptr__);
-      ptr__ += IMC::serialize(time_idle_unknown, ptr__);
-      ptr__ += IMC::serialize(time_motor_ground, ptr__);
-      ptr__ += IMC::serialize(time_motor_air, ptr__);
-      ptr__ += IMC::serialize(time_motor_water, ptr__);
-      ptr__ += IMC::serialize(time_motor_underwater, ptr__);
-      ptr__ += IMC::serialize(time_motor_unknown, ptr__);
-      ptr__ += IMC::serialize(rpm_min, ptr__);
-      ptr__ += IMC::serialize(rpm_max, ptr__);
-      ptr__ += IMC::serialize(depth_max, ptr__);
-      return ptr__;
+      IMC::serialize(timestamp_last_service, bfr__ + 0);
+      IMC::serialize(time_next_service, bfr__ + 8);
+      IMC::serialize(time_motor_next_service, bfr__ + 12);
+      IMC::serialize(time_idle_ground, bfr__ + 16);
+      IMC::serialize(time_idle_air, bfr__ + 20);
+      IMC::serialize(time_idle_water, bfr__ + 24);
+      IMC::serialize(time_idle_underwater, bfr__ + 28);
+      IMC::serialize(time_idle_unknown, bfr__ + 32);
+      IMC::serialize(time_motor_ground, bfr__ + 36);
+      IMC::serialize(time_motor_air, bfr__ + 40);
+      IMC::serialize(time_motor_water, bfr__ + 44);
+      IMC::serialize(time_motor_underwater, bfr__ + 48);
+      IMC::serialize(time_motor_unknown, bfr__ + 52);
+      IMC::serialize(rpm_min, bfr__ + 56);
+      IMC::serialize(rpm_max, bfr__ + 58);
+      IMC::serialize(depth_max, bfr__ + 60);
+      return bfr__ + 64;
     }
 
     uint16_t
     Tachograph::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(timestamp_last_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_next_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_next_service, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_ground, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_air, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_water, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_underwater, bfr__, size__);
-      bfr__ += IMC::deserialize(time_idle_unknown, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_ground, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_air, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_water, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_underwater, bfr__, size__);
-      bfr__ += IMC::deserialize(time_motor_unknown, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::deserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::deserialize(depth_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 64)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(timestamp_last_service, bfr__ + 0);
+      IMC::deserializeFixed(time_next_service, bfr__ + 8);
+      IMC::deserializeFixed(time_motor_next_service, bfr__ + 12);
+      IMC::deserializeFixed(time_idle_ground, bfr__ + 16);
+      IMC::deserializeFixed(time_idle_air, bfr__ + 20);
+      IMC::deserializeFixed(time_idle_water, bfr__ + 24);
+      IMC::deserializeFixed(time_idle_underwater, bfr__ + 28);
+      IMC::deserializeFixed(time_idle_unknown, bfr__ + 32);
+      IMC::deserializeFixed(time_motor_ground, bfr__ + 36);
+      IMC::deserializeFixed(time_motor_air, bfr__ + 40);
+      IMC::deserializeFixed(time_motor_water, bfr__ + 44);
+      IMC::deserializeFixed(time_motor_underwater, bfr__ + 48);
+      IMC::deserializeFixed(time_motor_unknown, bfr__ + 52);
+      IMC::deserializeFixed(rpm_min, bfr__ + 56);
+      IMC::deserializeFixed(rpm_max, bfr__ + 58);
+      IMC::deserializeFixed(depth_max, bfr__ + 60);
+      return 64;
     }
 
     uint16_t
     Tachograph::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(timestamp_last_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_next_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_next_service, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_ground, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_air, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_water, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_underwater, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_idle_unknown, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_ground, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_air, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_water, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_underwater, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(time_motor_unknown, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_min, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(rpm_max, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(depth_max, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 64)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(timestamp_last_service, bfr__ + 0);
+      IMC::reverseDeserializeFixed(time_next_service, bfr__ + 8);
+      IMC::reverseDeserializeFixed(time_motor_next_service, bfr__ + 12);
+      IMC::reverseDeserializeFixed(time_idle_ground, bfr__ + 16);
+      IMC::reverseDeserializeFixed(time_idle_air, bfr__ + 20);
+      IMC::reverseDeserializeFixed(time_idle_water, bfr__ + 24);
+      IMC::reverseDeserializeFixed(time_idle_underwater, bfr__ + 28);
+      IMC::reverseDeserializeFixed(time_idle_unknown, bfr__ + 32);
+      IMC::reverseDeserializeFixed(time_motor_ground, bfr__ + 36);
+      IMC::reverseDeserializeFixed(time_motor_air, bfr__ + 40);
+      IMC::reverseDeserializeFixed(time_motor_water, bfr__ + 44);
+      IMC::reverseDeserializeFixed(time_motor_underwater, bfr__ + 48);
+      IMC::reverseDeserializeFixed(time_motor_unknown, bfr__ + 52);
+      IMC::reverseDeserializeFixed(rpm_min, bfr__ + 56);
+      IMC::reverseDeserializeFixed(rpm_max, bfr__ + 58);
+      IMC::reverseDeserializeFixed(depth_max, bfr__ + 60);
+      return 64;
     }
 
     void
@@ -26686,31 +27371,36 @@ namespace DUNE
     uint8_t*
     SadcReadings::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(channel, ptr__);
-      ptr__ += IMC::serialize(value, ptr__);
-      ptr__ += IMC::serialize(gain, ptr__);
-      return ptr__;
+      IMC::serialize(channel, bfr__ + 0);
+      IMC::serialize(value, bfr__ + 1);
+      IMC::serialize(gain, bfr__ + 5);
+      return bfr__ + 6;
     }
 
     uint16_t
     SadcReadings::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(channel, bfr__, size__);
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(gain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(channel, bfr__ + 0);
+      IMC::deserializeFixed(value, bfr__ + 1);
+      IMC::deserializeFixed(gain, bfr__ + 5);
+      return 6;
     }
 
     uint16_t
     SadcReadings::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(channel, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      bfr__ += IMC::deserialize(gain, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 6)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(channel, bfr__ + 0);
+      IMC::reverseDeserializeFixed(value, bfr__ + 1);
+      IMC::deserializeFixed(gain, bfr__ + 5);
+      return 6;
     }
 
     fp64_t
@@ -26792,70 +27482,75 @@ namespace DUNE
     uint8_t*
     DmsDetection::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(ch01, ptr__);
-      ptr__ += IMC::serialize(ch02, ptr__);
-      ptr__ += IMC::serialize(ch03, ptr__);
-      ptr__ += IMC::serialize(ch04, ptr__);
-      ptr__ += IMC::serialize(ch05, ptr__);
-      ptr__ += IMC::serialize(ch06, ptr__);
-      ptr__ += IMC::serialize(ch07, ptr__);
-      ptr__ += IMC::serialize(ch08, ptr__);
-      ptr__ += IMC::serialize(ch09, ptr__);
-      ptr__ += IMC::serialize(ch10, ptr__);
-      ptr__ += IMC::serialize(ch11, ptr__);
-      ptr__ += IMC::serialize(ch12, ptr__);
-      ptr__ += IMC::serialize(ch13, ptr__);
-      ptr__ += IMC::serialize(ch14, ptr__);
-      ptr__ += IMC::serialize(ch15, ptr__);
-      ptr__ += IMC::serialize(ch16, ptr__);
-      return ptr__;
+      IMC::serialize(ch01, bfr__ + 0);
+      IMC::serialize(ch02, bfr__ + 4);
+      IMC::serialize(ch03, bfr__ + 8);
+      IMC::serialize(ch04, bfr__ + 12);
+      IMC::serialize(ch05, bfr__ + 16);
+      IMC::serialize(ch06, bfr__ + 20);
+      IMC::serialize(ch07, bfr__ + 24);
+      IMC::serialize(ch08, bfr__ + 28);
+      IMC::serialize(ch09, bfr__ + 32);
+      IMC::serialize(ch10, bfr__ + 36);
+      IMC::serialize(ch11, bfr__ + 40);
+      IMC::serialize(ch12, bfr__ + 44);
+      IMC::serialize(ch13, bfr__ + 48);
+      IMC::serialize(ch14, bfr__ + 52);
+      IMC::serialize(ch15, bfr__ + 56);
+      IMC::serialize(ch16, bfr__ + 60);
+      return bfr__ + 64;
     }
 
     uint16_t
     DmsDetection::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(ch01, bfr__, size__);
-      bfr__ += IMC::deserialize(ch02, bfr__, size__);
-      bfr__ += IMC::deserialize(ch03, bfr__, size__);
-      bfr__ += IMC::deserialize(ch04, bfr__, size__);
-      bfr__ += IMC::deserialize(ch05, bfr__, size__);
-      bfr__ += IMC::deserialize(ch06, bfr__, size__);
-      bfr__ += IMC::deserialize(ch07, bfr__, size__);
-      bfr__ += IMC::deserialize(ch08, bfr__, size__);
-      bfr__ += IMC::deserialize(ch09, bfr__, size__);
-      bfr__ += IMC::deserialize(ch10, bfr__, size__);
-      bfr__ += IMC::deserialize(ch11, bfr__, size__);
-      bfr__ += IMC::deserialize(ch12, bfr__, size__);
-      bfr__ += IMC::deserialize(ch13, bfr__, size__);
-      bfr__ += IMC::deserialize(ch14, bfr__, size__);
-      bfr__ += IMC::deserialize(ch15, bfr__, size__);
-      bfr__ += IMC::deserialize(ch16, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 64)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(ch01, bfr__ + 0);
+      IMC::deserializeFixed(ch02, bfr__ + 4);
+      IMC::deserializeFixed(ch03, bfr__ + 8);
+      IMC::deserializeFixed(ch04, bfr__ + 12);
+      IMC::deserializeFixed(ch05, bfr__ + 16);
+      IMC::deserializeFixed(ch06, bfr__ + 20);
+      IMC::deserializeFixed(ch07, bfr__ + 24);
+      IMC::deserializeFixed(ch08, bfr__ + 28);
+      IMC::deserializeFixed(ch09, bfr__ + 32);
+      IMC::deserializeFixed(ch10, bfr__ + 36);
+      IMC::deserializeFixed(ch11, bfr__ + 40);
+      IMC::deserializeFixed(ch12, bfr__ + 44);
+      IMC::deserializeFixed(ch13, bfr__ + 48);
+      IMC::deserializeFixed(ch14, bfr__ + 52);
+      IMC::deserializeFixed(ch15, bfr__ + 56);
+      IMC::deserializeFixed(ch16, bfr__ + 60);
+      return 64;
     }
 
     uint16_t
     DmsDetection::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(ch01, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch02, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch03, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch04, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch05, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch06, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch07, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch08, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch09, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch10, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch11, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch12, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch13, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch14, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch15, bfr__, size__);
-      bfr__ += IMC::reverseDeserialize(ch16, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 64)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(ch01, bfr__ + 0);
+      IMC::reverseDeserializeFixed(ch02, bfr__ + 4);
+      IMC::reverseDeserializeFixed(ch03, bfr__ + 8);
+      IMC::reverseDeserializeFixed(ch04, bfr__ + 12);
+      IMC::reverseDeserializeFixed(ch05, bfr__ + 16);
+      IMC::reverseDeserializeFixed(ch06, bfr__ + 20);
+      IMC::reverseDeserializeFixed(ch07, bfr__ + 24);
+      IMC::reverseDeserializeFixed(ch08, bfr__ + 28);
+      IMC::reverseDeserializeFixed(ch09, bfr__ + 32);
+      IMC::reverseDeserializeFixed(ch10, bfr__ + 36);
+      IMC::reverseDeserializeFixed(ch11, bfr__ + 40);
+      IMC::reverseDeserializeFixed(ch12, bfr__ + 44);
+      IMC::reverseDeserializeFixed(ch13, bfr__ + 48);
+      IMC::reverseDeserializeFixed(ch14, bfr__ + 52);
+      IMC::reverseDeserializeFixed(ch15, bfr__ + 56);
+      IMC::reverseDeserializeFixed(ch16, bfr__ + 60);
+      return 64;
     }
 
     void
@@ -26908,25 +27603,30 @@ namespace DUNE
     uint8_t*
     TotalMagIntensity::serializeFields(uint8_t* bfr__) const
     {
-      uint8_t* ptr__ = bfr__;
-      ptr__ += IMC::serialize(value, ptr__);
-      return ptr__;
+      IMC::serialize(value, bfr__ + 0);
+      return bfr__ + 8;
     }
 
     uint16_t
     TotalMagIntensity::deserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::deserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::deserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     uint16_t
     TotalMagIntensity::reverseDeserializeFields(const uint8_t* bfr__, uint16_t size__)
     {
-      const uint8_t* start__ = bfr__;
-      bfr__ += IMC::reverseDeserialize(value, bfr__, size__);
-      return bfr__ - start__;
+      if (size__ < 8)
+      {
+        throw BufferTooShort();
+      }
+      IMC::reverseDeserializeFixed(value, bfr__ + 0);
+      return 8;
     }
 
     fp64_t
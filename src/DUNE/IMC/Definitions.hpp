@@ -109,6 +109,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -171,6 +183,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -237,6 +261,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -310,6 +346,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -388,6 +436,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -455,6 +515,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -524,6 +596,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -600,6 +684,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -674,6 +770,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -756,6 +864,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 3;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -846,6 +966,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -908,6 +1040,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1011,6 +1155,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 69;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1072,6 +1228,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1189,6 +1357,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 80;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1261,6 +1441,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1343,6 +1535,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 3;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1425,6 +1629,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 9;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1488,6 +1704,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1574,6 +1802,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1676,6 +1916,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1764,6 +2016,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 9;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1848,6 +2112,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 9;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -1946,6 +2222,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2034,6 +2322,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 10;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2099,6 +2399,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 12;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2168,6 +2480,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 12;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2252,6 +2576,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 19;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2330,6 +2666,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2399,6 +2747,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 6;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2487,6 +2847,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 18;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2565,6 +2937,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2635,6 +3019,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 23;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2713,6 +3109,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2780,6 +3188,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2847,6 +3267,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -2914,8 +3346,20 @@ namespace DUNE
       int
       validate(void) const;
 
-      uint8_t*
-      serializeFields(uint8_t* bfr__) const;
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
+      uint8_t*
+      serializeFields(uint8_t* bfr__) const;
 
       uint16_t
       deserializeFields(const uint8_t* bfr__, uint16_t size__);
@@ -2985,6 +3429,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3058,6 +3514,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 6;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3127,6 +3595,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3217,6 +3697,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3286,6 +3778,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3361,6 +3865,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 24;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3434,6 +3950,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3522,6 +4050,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 3;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3591,6 +4131,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3679,6 +4231,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3748,6 +4312,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 6;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3817,6 +4393,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3890,6 +4478,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 12;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -3979,6 +4579,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 12;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -4058,6 +4670,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 11;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -4158,6 +4782,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -4247,6 +4883,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 12;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -4371,6 +5019,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -4510,6 +5170,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 10;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -4579,6 +5251,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -4658,6 +5342,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 23;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -4738,6 +5434,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -4821,6 +5529,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -4951,6 +5671,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5029,6 +5761,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5087,6 +5831,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5158,6 +5914,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 6;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5250,6 +6018,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 15;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5377,6 +6157,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5444,6 +6236,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5511,6 +6315,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5578,6 +6394,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5713,6 +6541,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 56;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5782,6 +6622,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 40;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5851,6 +6703,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 36;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -5918,8 +6782,20 @@ namespace DUNE
       int
       validate(void) const;
 
-      uint8_t*
-      serializeFields(uint8_t* bfr__) const;
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 32;
+      }
+
+      uint8_t*
+      serializeFields(uint8_t* bfr__) const;
 
       uint16_t
       deserializeFields(const uint8_t* bfr__, uint16_t size__);
@@ -5985,6 +6861,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 32;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6052,6 +6940,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 32;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6130,6 +7030,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 25;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6208,6 +7120,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 25;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6275,6 +7199,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 32;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6346,6 +7282,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 24;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6409,6 +7357,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6485,6 +7445,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6574,6 +7546,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6641,6 +7625,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6708,6 +7704,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6775,6 +7783,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6842,6 +7862,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6909,6 +7941,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -6976,6 +8020,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7043,6 +8099,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7114,6 +8182,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 12;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7175,6 +8255,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7242,6 +8334,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7309,6 +8413,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7376,6 +8492,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7468,6 +8596,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 14;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7546,6 +8686,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7613,6 +8765,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7678,6 +8842,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7779,6 +8955,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 68;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7842,6 +9030,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7924,6 +9124,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -7985,6 +9197,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8052,6 +9276,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8119,6 +9355,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8186,6 +9434,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8253,6 +9513,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8320,6 +9592,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8387,6 +9671,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8454,6 +9750,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8575,6 +9883,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 58;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8674,6 +9994,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 88;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8748,6 +10080,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8831,6 +10175,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8898,6 +10254,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -8965,6 +10333,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9032,6 +10412,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9099,6 +10491,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9183,6 +10587,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 3;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9252,6 +10668,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9327,6 +10755,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9402,6 +10842,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9480,6 +10932,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9547,6 +11011,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9616,6 +11092,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9700,6 +11188,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9790,6 +11290,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 13;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9876,6 +11388,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 9;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -9938,6 +11462,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10007,6 +11543,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10076,6 +11624,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10149,6 +11709,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10218,6 +11790,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10292,8 +11876,20 @@ namespace DUNE
       bool
       fieldsEqual(const Message& msg__) const;
 
-      int
-      validate(void) const;
+      int
+      validate(void) const;
+
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 9;
+      }
 
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
@@ -10366,6 +11962,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 9;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10437,6 +12045,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 24;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10498,6 +12118,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10565,6 +12197,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10658,6 +12302,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 56;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10735,6 +12391,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 36;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10813,6 +12481,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10893,6 +12573,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 6;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -10988,6 +12680,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 10;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11065,6 +12769,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 20;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11163,6 +12879,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11228,6 +12956,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 24;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11293,6 +13033,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 12;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11354,6 +13106,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11423,6 +13187,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11492,6 +13268,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 9;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11559,6 +13347,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11626,6 +13426,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11693,6 +13505,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11805,6 +13629,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 56;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11895,6 +13731,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 49;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -11956,6 +13804,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12052,6 +13912,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 49;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12164,6 +14036,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 81;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12229,6 +14113,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 24;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12296,6 +14192,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 16;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12368,6 +14276,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12470,6 +14390,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 74;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12531,6 +14463,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12618,6 +14562,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 52;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12716,6 +14672,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 35;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12783,6 +14751,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12904,6 +14884,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 48;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -12973,6 +14965,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -13044,6 +15048,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -13163,8 +15179,20 @@ namespace DUNE
       bool
       fieldsEqual(const Message& msg__) const;
 
-      int
-      validate(void) const;
+      int
+      validate(void) const;
+
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 59;
+      }
 
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
@@ -13237,6 +15265,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 12;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -13314,6 +15354,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 28;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -13415,6 +15467,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 36;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -13477,6 +15541,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -13551,6 +15627,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 32;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -13647,6 +15735,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 38;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -13720,6 +15820,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 16;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -13797,6 +15909,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 28;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -13884,6 +16008,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -13957,6 +16093,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 14;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14036,6 +16184,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 34;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14114,6 +16274,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14172,6 +16344,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14250,6 +16434,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 3;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14331,6 +16527,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 22;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14406,6 +16614,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 31;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14469,6 +16689,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 16;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14544,6 +16776,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 26;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14664,6 +16908,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 43;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14748,6 +17004,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14857,6 +17125,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 30;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -14932,6 +17212,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 15;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -15022,6 +17314,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 21;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -15145,6 +17449,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -15270,6 +17586,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 84;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -15373,6 +17701,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 72;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -15473,6 +17813,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 7;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -15615,6 +17967,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 45;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -15712,6 +18076,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 28;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -15793,6 +18169,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 28;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -15885,6 +18273,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 35;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -15985,6 +18385,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 59;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -16072,6 +18484,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 31;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -16134,6 +18558,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -16206,6 +18642,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 30;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -16290,8 +18738,20 @@ namespace DUNE
       bool
       fieldsEqual(const Message& msg__) const;
 
-      int
-      validate(void) const;
+      int
+      validate(void) const;
+
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 43;
+      }
 
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
@@ -16393,6 +18853,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 46;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -16490,6 +18962,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 26;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -16567,6 +19051,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 23;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -16663,6 +19159,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 37;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -16759,6 +19267,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 41;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -16868,6 +19388,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 27;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -16971,6 +19503,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 6;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17071,6 +19615,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17152,6 +19708,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 11;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17241,6 +19809,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 53;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17297,6 +19877,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17355,6 +19947,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17429,6 +20033,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 9;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17505,6 +20121,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17581,6 +20209,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17687,6 +20327,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 15;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17761,6 +20413,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17889,6 +20553,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 17;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -17988,6 +20664,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18073,6 +20761,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 24;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18184,6 +20884,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 16;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18294,6 +21006,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 7;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18367,6 +21091,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 10;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18451,6 +21187,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 3;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18533,6 +21281,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18603,6 +21363,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18670,6 +21442,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 10;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18774,6 +21558,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 3;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18836,6 +21632,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18924,6 +21732,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -18997,6 +21817,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -19086,6 +21918,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -19185,6 +22029,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -19287,6 +22143,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -19391,6 +22259,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -19502,6 +22382,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -19595,6 +22487,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 12;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -19674,6 +22578,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 16;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -19804,6 +22720,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 6;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -19925,6 +22853,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 16;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -20018,6 +22958,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -20134,6 +23086,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 81;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -20239,6 +23203,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -20337,6 +23313,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 57;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -20416,6 +23404,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 24;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -20487,6 +23487,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 20;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -20577,6 +23589,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -20662,6 +23686,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -20772,6 +23808,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -20857,6 +23905,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -20944,6 +24004,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21032,6 +24104,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21120,6 +24204,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21191,6 +24287,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21293,6 +24401,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21378,6 +24498,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21463,6 +24595,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21532,6 +24676,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21605,6 +24761,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21674,6 +24842,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 17;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21747,6 +24927,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 29;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21816,6 +25008,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21885,6 +25089,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -21972,6 +25188,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22041,6 +25269,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22124,6 +25364,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22191,6 +25443,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22252,6 +25516,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22315,6 +25591,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22382,6 +25670,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22454,6 +25754,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22515,6 +25827,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22582,6 +25906,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22660,6 +25996,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22742,6 +26090,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 3;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22824,6 +26184,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22916,6 +26288,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 3;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -22993,6 +26377,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 6;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23087,6 +26483,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 21;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23152,6 +26560,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 12;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23244,6 +26664,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 41;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23343,6 +26775,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 22;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23432,6 +26876,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 14;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23495,6 +26951,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23614,6 +27082,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 2;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23714,6 +27194,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 6;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23781,6 +27273,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 3;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23850,6 +27354,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23912,6 +27428,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -23974,6 +27502,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 10;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24041,6 +27581,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 14;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24110,6 +27662,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 23;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24173,6 +27737,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24235,6 +27811,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 0;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24297,6 +27885,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24362,6 +27962,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24433,6 +28045,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 29;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24510,6 +28134,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 32;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24597,6 +28233,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 40;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24674,6 +28322,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 25;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24749,6 +28409,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 21;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24829,6 +28501,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24923,6 +28607,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 5;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -24990,6 +28686,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 4;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -25087,6 +28795,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 64;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -25171,6 +28891,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return false;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 1;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -25253,6 +28985,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 6;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -25350,6 +29094,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 64;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -25411,6 +29167,18 @@ namespace DUNE
       int
       validate(void) const;
 
+      static constexpr bool
+      isFixedSize(void)
+      {
+        return true;
+      }
+
+      static constexpr unsigned
+      fixedSize(void)
+      {
+        return 8;
+      }
+
       uint8_t*
       serializeFields(uint8_t* bfr__) const;
 
@@ -0,0 +1,325 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Compression/ParallelCompressor.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/Serialization.hpp>
+#include <DUNE/IMC/LsfIndex.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Index format version.
+    static const uint16_t c_version = 1;
+    //! Size of the index file header.
+    static const unsigned c_header_size = 4;
+    //! Size of the fixed part of an entry.
+    static const unsigned c_entry_size = 2 + 8 + 8 + 8 + 8 + 8 + 4 + 2;
+
+    //! Read a field of an index entry.
+    template <typename Type>
+    static inline const uint8_t*
+    getField(Type& value, const uint8_t* ptr, uint16_t& length, bool reverse)
+    {
+      if (reverse)
+        return ptr + reverseDeserialize(value, ptr, length);
+
+      return ptr + deserialize(value, ptr, length);
+    }
+
+    LsfIndex::Block::Block(void):
+      time_begin(0),
+      time_end(0),
+      offset(0),
+      size(0),
+      block_offset(c_no_block_offset),
+      records(0)
+    { }
+
+    bool
+    LsfIndex::Block::contains(uint16_t id) const
+    {
+      unsigned byte = id / 8;
+      if (byte >= ids.size())
+        return false;
+
+      return (ids[byte] & (1 << (id % 8))) != 0;
+    }
+
+    void
+    LsfIndex::Block::add(uint16_t id, fp64_t timestamp, unsigned record_size)
+    {
+      unsigned byte = id / 8;
+      if (byte >= ids.size())
+        ids.resize(byte + 1, 0);
+
+      ids[byte] |= (1 << (id % 8));
+
+      if (records == 0)
+      {
+        time_begin = timestamp;
+        time_end = timestamp;
+      }
+      else
+      {
+        time_begin = std::min(time_begin, timestamp);
+        time_end = std::max(time_end, timestamp);
+      }
+
+      size += record_size;
+      ++records;
+    }
+
+    LsfIndex::Writer::Writer(const std::string& path, double interval, bool compressed):
+      m_ofs(path.c_str(), std::ios::binary),
+      m_interval(interval),
+      m_start(0),
+      m_compressed(compressed),
+      m_offset(0),
+      m_com(NULL)
+    {
+      writeHeader(path);
+    }
+
+    LsfIndex::Writer::Writer(const std::string& path, double interval, Compression::ParallelCompressor* com):
+      m_ofs(path.c_str(), std::ios::binary),
+      m_interval(interval),
+      m_start(0),
+      m_compressed(true),
+      m_offset(0),
+      m_com(com)
+    {
+      writeHeader(path);
+      m_com->trackBlocks();
+    }
+
+    LsfIndex::Writer::~Writer(void)
+    {
+      writeBlock();
+      writePending(true);
+    }
+
+    void
+    LsfIndex::Writer::writeHeader(const std::string& path)
+    {
+      if (!m_ofs.is_open())
+        throw std::runtime_error("unable to create index file: " + path);
+
+      uint8_t bfr[c_header_size];
+      uint8_t* ptr = bfr;
+      ptr += serialize((uint16_t)DUNE_IMC_CONST_SYNC, ptr);
+      ptr += serialize(c_version, ptr);
+      m_ofs.write((const char*)bfr, c_header_size);
+    }
+
+    void
+    LsfIndex::Writer::add(uint16_t id, fp64_t timestamp, unsigned size)
+    {
+      // Blocks are split using the timestamp of their first record.
+      if (isBoundary(timestamp))
+        writeBlock();
+
+      if (m_block.records == 0)
+        m_start = timestamp;
+
+      m_block.add(id, timestamp, size);
+    }
+
+    void
+    LsfIndex::Writer::flush(void)
+    {
+      writePending(false);
+      m_ofs.flush();
+    }
+
+    void
+    LsfIndex::Writer::writeBlock(void)
+    {
+      if (m_block.records == 0)
+        return;
+
+      m_block.offset = m_offset;
+      if (!m_compressed)
+        m_block.block_offset = m_offset;
+
+      if (m_com != NULL)
+        m_pending.push_back(m_block);
+      else
+        writeEntry(m_block);
+
+      m_offset += m_block.size;
+      m_block = Block();
+
+      writePending(false);
+    }
+
+    void
+    LsfIndex::Writer::writePending(bool all)
+    {
+      while (!m_pending.empty())
+      {
+        Block& block = m_pending.front();
+
+        uint64_t offset = Compression::ParallelCompressor::c_no_block;
+        if (!m_com->getBlockOffset(block.offset, offset) && !all)
+          break;
+
+        if (offset != Compression::ParallelCompressor::c_no_block)
+          block.block_offset = offset;
+
+        writeEntry(block);
+        m_pending.pop_front();
+      }
+    }
+
+    void
+    LsfIndex::Writer::writeEntry(const Block& block)
+    {
+      std::vector<uint8_t> bfr(c_entry_size + block.ids.size());
+      uint8_t* ptr = &bfr[0];
+      ptr += serialize((uint16_t)bfr.size(), ptr);
+      ptr += serialize(block.time_begin, ptr);
+      ptr += serialize(block.time_end, ptr);
+      ptr += serialize(block.offset, ptr);
+      ptr += serialize(block.size, ptr);
+      ptr += serialize(block.block_offset, ptr);
+      ptr += serialize(block.records, ptr);
+      ptr += serialize((uint16_t)block.ids.size(), ptr);
+      if (!block.ids.empty())
+        std::memcpy(ptr, &block.ids[0], block.ids.size());
+
+      m_ofs.write((const char*)&bfr[0], bfr.size());
+    }
+
+    std::string
+    LsfIndex::getPath(const std::string& lsf_path)
+    {
+      return lsf_path + ".idx";
+    }
+
+    bool
+    LsfIndex::load(const std::string& path)
+    {
+      std::ifstream ifs(path.c_str(), std::ios::binary);
+      if (!ifs.is_open())
+        return false;
+
+      std::vector<uint8_t> data((std::istreambuf_iterator<char>(ifs)),
+                                std::istreambuf_iterator<char>());
+
+      if (data.size() < c_header_size)
+        throw InvalidFormat();
+
+      uint16_t sync = 0;
+      uint16_t version = 0;
+      uint16_t length = c_header_size;
+      const uint8_t* ptr = getField(sync, &data[0], length, false);
+
+      bool reverse = false;
+      if (sync == DUNE_IMC_CONST_SYNC_REV)
+        reverse = true;
+      else if (sync != DUNE_IMC_CONST_SYNC)
+        throw InvalidFormat();
+
+      getField(version, ptr, length, reverse);
+      if (version != c_version)
+        throw InvalidFormat();
+
+      m_blocks.clear();
+      m_time_end.clear();
+
+      size_t pos = c_header_size;
+      while (data.size() - pos >= 2)
+      {
+        uint16_t size = 0;
+        length = 2;
+        getField(size, &data[pos], length, reverse);
+
+        // Incomplete entry.
+        if (size > data.size() - pos)
+          break;
+
+        if (size < c_entry_size)
+          throw InvalidFormat();
+
+        Block block;
+        uint16_t ids_size = 0;
+        length = size - 2;
+        ptr = &data[pos + 2];
+        ptr = getField(block.time_begin, ptr, length, reverse);
+        ptr = getField(block.time_end, ptr, length, reverse);
+        ptr = getField(block.offset, ptr, length, reverse);
+        ptr = getField(block.size, ptr, length, reverse);
+        ptr = getField(block.block_offset, ptr, length, reverse);
+        ptr = getField(block.records, ptr, length, reverse);
+        ptr = getField(ids_size, ptr, length, reverse);
+
+        if (ids_size != length)
+          throw InvalidFormat();
+
+        block.ids.assign(ptr, ptr + ids_size);
+        m_blocks.push_back(block);
+        pos += size;
+
+        if (m_time_end.empty())
+          m_time_end.push_back(block.time_end);
+        else
+          m_time_end.push_back(std::max(m_time_end.back(), block.time_end));
+      }
+
+      return true;
+    }
+
+    size_t
+    LsfIndex::find(double time) const
+    {
+      return std::lower_bound(m_time_end.begin(), m_time_end.end(), time) - m_time_end.begin();
+    }
+
+    size_t
+    LsfIndex::find(size_t first, uint16_t id) const
+    {
+      for (size_t i = first; i < m_blocks.size(); ++i)
+      {
+        if (m_blocks[i].contains(id))
+          return i;
+      }
+
+      return m_blocks.size();
+    }
+  }
+}
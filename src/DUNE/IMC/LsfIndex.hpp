@@ -0,0 +1,248 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LSF_INDEX_HPP_INCLUDED_
+#define DUNE_IMC_LSF_INDEX_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Forward declarations.
+    class ParallelCompressor;
+  }
+
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LsfIndex;
+
+    //! Index of an LSF file. The file is split in blocks of
+    //! consecutive records covering a configurable time span. For
+    //! each block the index keeps the time range, the offset of the
+    //! first record and a bitmap of the message identification
+    //! numbers present, so readers can jump to a point in time or
+    //! skip blocks without the messages they are interested in.
+    //!
+    //! Index files are named after the LSF file (see getPath()) and
+    //! are written incrementally, an incomplete last entry is
+    //! ignored when loading.
+    class LsfIndex
+    {
+    public:
+      //! Value of Block::block_offset when the block cannot be
+      //! decoded independently of the previous ones.
+      static const uint64_t c_no_block_offset = ~(uint64_t)0;
+
+      //! Index entry.
+      struct Block
+      {
+        //! Lowest record timestamp.
+        fp64_t time_begin;
+        //! Highest record timestamp.
+        fp64_t time_end;
+        //! Offset of the first record in the (uncompressed) log.
+        uint64_t offset;
+        //! Size of the block in the (uncompressed) log.
+        uint64_t size;
+        //! Offset in the log file where decoding of the block can
+        //! start, or c_no_block_offset. For block container logs this
+        //! is the offset of the container block holding the first
+        //! record.
+        uint64_t block_offset;
+        //! Number of records.
+        uint32_t records;
+        //! Bitmap of the message identification numbers present.
+        std::vector<uint8_t> ids;
+
+        Block(void);
+
+        //! Test if messages of a given type are present.
+        //! @param[in] id message identification number.
+        //! @return true if present, false otherwise.
+        bool
+        contains(uint16_t id) const;
+
+        //! Add a record.
+        //! @param[in] id message identification number.
+        //! @param[in] timestamp record timestamp.
+        //! @param[in] size record size.
+        void
+        add(uint16_t id, fp64_t timestamp, unsigned size);
+      };
+
+      //! Incremental index writer.
+      class Writer
+      {
+      public:
+        //! Create an index file.
+        //! @param[in] path index file path.
+        //! @param[in] interval time span of each block in seconds.
+        //! @param[in] compressed true if the log is compressed, in
+        //! which case blocks cannot be decoded independently.
+        Writer(const std::string& path, double interval, bool compressed);
+
+        //! Create the index file of a block container log. Entries
+        //! are written once the compressor has written the container
+        //! block where they start, so they can refer to its file
+        //! offset. The log writer must end a container block at each
+        //! index block boundary (see isBoundary()).
+        //! @param[in] path index file path.
+        //! @param[in] interval time span of each block in seconds.
+        //! @param[in] com compressor writing the log, which must
+        //! outlive the index writer.
+        Writer(const std::string& path, double interval, Compression::ParallelCompressor* com);
+
+        //! Destructor. The last block is written. For block
+        //! container logs, all data must have been written by the
+        //! compressor, entries whose container block is unknown are
+        //! written without block offset.
+        ~Writer(void);
+
+        //! Add a record. Records must be added in the order they are
+        //! written to the log.
+        //! @param[in] id message identification number.
+        //! @param[in] timestamp record timestamp.
+        //! @param[in] size record size.
+        void
+        add(uint16_t id, fp64_t timestamp, unsigned size);
+
+        //! Test if a record would start a new block.
+        //! @param[in] timestamp record timestamp.
+        //! @return true if the record starts a new block, false
+        //! otherwise.
+        bool
+        isBoundary(fp64_t timestamp) const
+        {
+          return m_block.records > 0 && timestamp >= m_start + m_interval;
+        }
+
+        //! Flush written blocks to disk.
+        void
+        flush(void);
+
+      private:
+        //! Index file.
+        std::ofstream m_ofs;
+        //! Time span of each block.
+        double m_interval;
+        //! Timestamp of the first record of the current block.
+        double m_start;
+        //! True if the log is compressed.
+        bool m_compressed;
+        //! Block being filled.
+        Block m_block;
+        //! Offset of the next record.
+        uint64_t m_offset;
+        //! Compressor writing container blocks, or NULL.
+        Compression::ParallelCompressor* m_com;
+        //! Blocks waiting for their container block offset.
+        std::deque<Block> m_pending;
+
+        //! Write the index file header.
+        //! @param[in] path index file path.
+        void
+        writeHeader(const std::string& path);
+
+        //! Write the current block and start a new one.
+        void
+        writeBlock(void);
+
+        //! Write pending blocks whose container block offset is known.
+        //! @param[in] all true to write all pending blocks.
+        void
+        writePending(bool all);
+
+        //! Write an index entry.
+        //! @param[in] block index entry.
+        void
+        writeEntry(const Block& block);
+
+        //! Non - copyable.
+        Writer(const Writer&);
+
+        //! Non - assignable.
+        Writer&
+        operator=(const Writer&);
+      };
+
+      //! Retrieve the path of the index of an LSF file.
+      //! @param[in] lsf_path LSF file path.
+      //! @return index file path.
+      static std::string
+      getPath(const std::string& lsf_path);
+
+      //! Load an index file.
+      //! @param[in] path index file path.
+      //! @return true if the index was loaded, false if the file
+      //! does not exist.
+      bool
+      load(const std::string& path);
+
+      //! Retrieve index entries.
+      //! @return index entries.
+      const std::vector<Block>&
+      getBlocks(void) const
+      {
+        return m_blocks;
+      }
+
+      //! Find the first block that may hold records with a timestamp
+      //! equal to or greater than a given time.
+      //! @param[in] time timestamp.
+      //! @return block number or the number of blocks if none.
+      size_t
+      find(double time) const;
+
+      //! Find the first block that holds messages of a given type.
+      //! @param[in] first number of the first block to consider.
+      //! @param[in] id message identification number.
+      //! @return block number or the number of blocks if none.
+      size_t
+      find(size_t first, uint16_t id) const;
+
+    private:
+      //! Index entries.
+      std::vector<Block> m_blocks;
+      //! Highest timestamp up to each block, used for binary search
+      //! since timestamps are not necessarily monotonic.
+      std::vector<fp64_t> m_time_end;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,220 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+
+// DUNE headers.
+#include <DUNE/Compression/Methods.hpp>
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/Compression/FileInput.hpp>
+#include <DUNE/System/Error.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/Packet.hpp>
+#include <DUNE/IMC/LsfMappedFile.hpp>
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_MMAN_H)
+#  include <sys/mman.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_STAT_H)
+#  include <sys/stat.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Size of chunks read from compressed files.
+    static const size_t c_read_chunk = 65536;
+
+    bool
+    LsfMappedFile::Record::verify(void) const
+    {
+      return Packet::verifyCrc(header, data);
+    }
+
+    Message*
+    LsfMappedFile::Record::decode(Message* msg, bool check_crc) const
+    {
+      uint16_t bfr_len = (uint16_t)std::min(size, (unsigned)DUNE_IMC_CONST_MAX_SIZE);
+      return Packet::deserializePayload(header, data, bfr_len, msg, check_crc);
+    }
+
+    LsfMappedFile::LsfMappedFile(const std::string& path):
+      m_data(NULL),
+      m_size(0),
+      m_mapped(false),
+      m_scan(0),
+      m_truncated(false)
+    {
+      open(path);
+    }
+
+    LsfMappedFile::~LsfMappedFile(void)
+    {
+#if defined(DUNE_SYS_HAS_MMAP)
+      if (m_mapped)
+        munmap((void*)m_data, m_size);
+#endif
+    }
+
+    void
+    LsfMappedFile::open(const std::string& path)
+    {
+      Compression::Methods method = Compression::Factory::detect(path.c_str());
+
+#if defined(DUNE_SYS_HAS_MMAP)
+      if (method == Compression::METHOD_UNKNOWN)
+      {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+          throw System::Error(errno, "opening file", path);
+
+        struct stat st;
+        if (fstat(fd, &st) == -1)
+        {
+          ::close(fd);
+          throw System::Error(errno, "retrieving file size", path);
+        }
+
+        m_size = st.st_size;
+        if (m_size == 0)
+        {
+          ::close(fd);
+          return;
+        }
+
+        void* ptr = mmap(NULL, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+
+        if (ptr == MAP_FAILED)
+          throw System::Error(errno, "mapping file", path);
+
+#  if defined(MADV_SEQUENTIAL)
+        madvise(ptr, m_size, MADV_SEQUENTIAL);
+#  endif
+
+        m_data = (const uint8_t*)ptr;
+        m_mapped = true;
+        return;
+      }
+#endif
+
+      std::istream* is = NULL;
+      if (method == Compression::METHOD_UNKNOWN)
+        is = new std::ifstream(path.c_str(), std::ios::binary);
+      else
+        is = new Compression::FileInput(path.c_str(), method);
+
+      if (!*is)
+      {
+        delete is;
+        throw System::Error(ENOENT, "opening file", path);
+      }
+
+      while (true)
+      {
+        size_t size = m_bfr.size();
+        m_bfr.resize(size + c_read_chunk);
+        is->read((char*)&m_bfr[size], c_read_chunk);
+
+        std::streamsize rv = is->gcount();
+        m_bfr.resize(size + (rv > 0 ? rv : 0));
+
+        if (rv < (std::streamsize)c_read_chunk)
+          break;
+      }
+
+      delete is;
+
+      m_size = m_bfr.size();
+      if (m_size > 0)
+        m_data = &m_bfr[0];
+    }
+
+    bool
+    LsfMappedFile::indexNext(void)
+    {
+      if (m_scan + DUNE_IMC_CONST_HEADER_SIZE > m_size)
+      {
+        m_truncated = (m_scan != m_size);
+        return false;
+      }
+
+      Header hdr;
+      Packet::deserializeHeader(hdr, m_data + m_scan, DUNE_IMC_CONST_HEADER_SIZE);
+
+      size_t size = DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+      if (m_scan + size > m_size)
+      {
+        m_truncated = true;
+        return false;
+      }
+
+      m_offsets.push_back(m_scan);
+      m_scan += size;
+      return true;
+    }
+
+    bool
+    LsfMappedFile::getRecord(size_t index, Record& record)
+    {
+      while (index >= m_offsets.size())
+      {
+        if (!indexNext())
+          return false;
+      }
+
+      const uint8_t* ptr = m_data + m_offsets[index];
+      Packet::deserializeHeader(record.header, ptr, DUNE_IMC_CONST_HEADER_SIZE);
+      record.data = ptr;
+      record.size = DUNE_IMC_CONST_HEADER_SIZE + record.header.size + DUNE_IMC_CONST_FOOTER_SIZE;
+      return true;
+    }
+
+    size_t
+    LsfMappedFile::getRecordCount(void)
+    {
+      while (indexNext())
+        ;
+
+      return m_offsets.size();
+    }
+  }
+}
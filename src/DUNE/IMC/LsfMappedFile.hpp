@@ -0,0 +1,170 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LSF_MAPPED_FILE_HPP_INCLUDED_
+#define DUNE_IMC_LSF_MAPPED_FILE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Header.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LsfMappedFile;
+
+    // Forward declarations.
+    class Message;
+
+    //! Random-access reader of LSF files. Uncompressed files are
+    //! memory mapped, compressed files are decompressed to memory
+    //! when opened. Records are indexed on the fly as they are
+    //! requested and exposed without copies.
+    class LsfMappedFile
+    {
+    public:
+      //! View of a record.
+      struct Record
+      {
+        //! Record header.
+        Header header;
+        //! Record bytes (header, payload and footer).
+        const uint8_t* data;
+        //! Record size.
+        unsigned size;
+
+        //! Validate the record CRC.
+        //! @return true if the CRC is valid, false otherwise.
+        bool
+        verify(void) const;
+
+        //! Deserialize the record.
+        //! @param[in] msg message object to fill, if NULL a new
+        //! message is created.
+        //! @param[in] check_crc true to validate the CRC.
+        //! @return message object.
+        Message*
+        decode(Message* msg = NULL, bool check_crc = false) const;
+      };
+
+      //! Open an LSF file.
+      //! @param[in] path file path.
+      LsfMappedFile(const std::string& path);
+
+      //! Destructor.
+      ~LsfMappedFile(void);
+
+      //! Retrieve the file contents.
+      //! @return pointer to the first byte.
+      const uint8_t*
+      getData(void) const
+      {
+        return m_data;
+      }
+
+      //! Retrieve the (uncompressed) size of the file.
+      //! @return size in bytes.
+      size_t
+      getSize(void) const
+      {
+        return m_size;
+      }
+
+      //! Test if the file contents are memory mapped.
+      //! @return true if memory mapped, false if read to memory.
+      bool
+      isMapped(void) const
+      {
+        return m_mapped;
+      }
+
+      //! Retrieve a record.
+      //! @param[in] index record index.
+      //! @param[out] record record view.
+      //! @return true if the record exists, false otherwise.
+      bool
+      getRecord(size_t index, Record& record);
+
+      //! Retrieve the number of records. This indexes the whole file.
+      //! @return number of records.
+      size_t
+      getRecordCount(void);
+
+      //! Test if the file ends with an incomplete record, which is
+      //! ignored. Only meaningful after the whole file is indexed.
+      //! @return true if the last record is incomplete.
+      bool
+      isTruncated(void) const
+      {
+        return m_truncated;
+      }
+
+    private:
+      //! File contents.
+      const uint8_t* m_data;
+      //! Size of file contents.
+      size_t m_size;
+      //! True if the file contents are memory mapped.
+      bool m_mapped;
+      //! Decompressed file contents.
+      std::vector<uint8_t> m_bfr;
+      //! Offsets of indexed records.
+      std::vector<size_t> m_offsets;
+      //! Offset of the first record not yet indexed.
+      size_t m_scan;
+      //! True if the file ends with an incomplete record.
+      bool m_truncated;
+
+      //! Map or read the file contents.
+      //! @param[in] path file path.
+      void
+      open(const std::string& path);
+
+      //! Index the next record.
+      //! @return true if a record was indexed, false at the end of
+      //! the file.
+      bool
+      indexNext(void);
+
+      //! Non - copyable.
+      LsfMappedFile(const LsfMappedFile&);
+
+      //! Non - assignable.
+      LsfMappedFile&
+      operator=(const LsfMappedFile&);
+    };
+  }
+}
+
+#endif
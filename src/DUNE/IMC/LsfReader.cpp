@@ -0,0 +1,233 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Compression/BlockBuffer.hpp>
+#include <DUNE/Compression/Methods.hpp>
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/Compression/FileInput.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/Packet.hpp>
+#include <DUNE/IMC/LsfReader.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    LsfReader::LsfReader(const std::string& path):
+      m_is(NULL),
+      m_owner(true),
+      m_seekable(false),
+      m_blocks(NULL),
+      m_delta(0),
+      m_offset(0),
+      m_next(0),
+      m_loaded(true),
+      m_bfr(DUNE_IMC_CONST_MAX_SIZE)
+    {
+      Compression::Methods method = Compression::Factory::detect(path.c_str());
+      if (method == Compression::METHOD_UNKNOWN)
+      {
+        m_is = new std::ifstream(path.c_str(), std::ios::binary);
+        m_seekable = true;
+      }
+      else if (method == Compression::METHOD_BLOCK)
+      {
+        m_blocks = new Compression::BlockBuffer(path);
+        m_is = new std::istream(m_blocks);
+        m_seekable = true;
+      }
+      else
+      {
+        m_is = new Compression::FileInput(path.c_str(), method);
+      }
+    }
+
+    LsfReader::LsfReader(std::istream& is):
+      m_is(&is),
+      m_owner(false),
+      m_seekable(false),
+      m_blocks(NULL),
+      m_delta(0),
+      m_offset(0),
+      m_next(0),
+      m_loaded(true),
+      m_bfr(DUNE_IMC_CONST_MAX_SIZE)
+    { }
+
+    LsfReader::~LsfReader(void)
+    {
+      if (m_owner)
+        delete m_is;
+
+      delete m_blocks;
+    }
+
+    bool
+    LsfReader::next(void)
+    {
+      // Compression stream buffers only implement bulk reads, so
+      // unread payloads are consumed the same way.
+      load();
+
+      // Records resume after skipped damaged blocks, peek to load
+      // the next intact one before taking the offset.
+      if (m_blocks != NULL)
+      {
+        m_is->peek();
+        m_next = m_blocks->getOffset() + m_delta;
+      }
+
+      m_bfr.setSize(DUNE_IMC_CONST_HEADER_SIZE);
+      m_is->read(m_bfr.getBufferSigned(), DUNE_IMC_CONST_HEADER_SIZE);
+
+      // If we're at the EOF there's nothing more to do.
+      if (m_is->gcount() <= 0)
+      {
+        m_loaded = true;
+        return false;
+      }
+
+      if (m_is->gcount() < DUNE_IMC_CONST_HEADER_SIZE)
+        throw BufferTooShort();
+
+      Packet::deserializeHeader(m_hdr, m_bfr.getBuffer(), DUNE_IMC_CONST_HEADER_SIZE);
+
+      m_offset = m_next;
+      m_next += getSize();
+      m_loaded = false;
+      return true;
+    }
+
+    void
+    LsfReader::seek(uint64_t offset)
+    {
+      if (m_seekable)
+      {
+        m_is->clear();
+        m_is->seekg((std::streamoff)offset);
+        m_delta = 0;
+        m_next = (m_blocks != NULL) ? m_blocks->getOffset() : offset;
+        m_loaded = true;
+        return;
+      }
+
+      if (offset < m_next)
+        throw std::runtime_error("cannot seek backwards in stream");
+
+      while (m_next < offset)
+      {
+        if (!next())
+          return;
+      }
+    }
+
+    void
+    LsfReader::seek(const LsfIndex::Block& block)
+    {
+      if (m_blocks != NULL && block.block_offset != LsfIndex::c_no_block_offset
+          && m_blocks->seekBlock(block.block_offset))
+      {
+        m_is->clear();
+        m_delta = (int64_t)(block.offset - m_blocks->getOffset());
+        m_next = block.offset;
+        m_loaded = true;
+        return;
+      }
+
+      seek(block.offset);
+    }
+
+    Message*
+    LsfReader::read(void)
+    {
+      if (!next())
+        return NULL;
+
+      return decode(NULL, true);
+    }
+
+    unsigned
+    LsfReader::getSize(void) const
+    {
+      return DUNE_IMC_CONST_HEADER_SIZE + m_hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+    }
+
+    void
+    LsfReader::load(void)
+    {
+      if (m_loaded)
+        return;
+
+      unsigned remaining = m_hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+      m_bfr.setSize(DUNE_IMC_CONST_HEADER_SIZE + remaining);
+      m_is->read(m_bfr.getBufferSigned() + DUNE_IMC_CONST_HEADER_SIZE, remaining);
+
+      if ((unsigned)m_is->gcount() < remaining)
+        throw BufferTooShort();
+
+      m_loaded = true;
+    }
+
+    const uint8_t*
+    LsfReader::getData(void)
+    {
+      load();
+      return m_bfr.getBuffer();
+    }
+
+    bool
+    LsfReader::verify(void)
+    {
+      load();
+      return Packet::verifyCrc(m_hdr, m_bfr.getBuffer());
+    }
+
+    Message*
+    LsfReader::decode(Message* msg, bool check_crc)
+    {
+      load();
+      uint16_t size = (uint16_t)std::min(getSize(), (unsigned)DUNE_IMC_CONST_MAX_SIZE);
+      return Packet::deserializePayload(m_hdr, m_bfr.getBuffer(), size, msg, check_crc);
+    }
+
+    unsigned
+    LsfReader::getCorruptedBlocks(void) const
+    {
+      if (m_blocks == NULL)
+        return 0;
+
+      return m_blocks->getCorrupted();
+    }
+  }
+}
@@ -0,0 +1,203 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LSF_READER_HPP_INCLUDED_
+#define DUNE_IMC_LSF_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <istream>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+#include <DUNE/IMC/Header.hpp>
+#include <DUNE/IMC/LsfIndex.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Forward declarations.
+    class BlockBuffer;
+  }
+
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LsfReader;
+
+    // Forward declarations.
+    class Message;
+
+    //! Sequential reader of LSF streams. Records are iterated by
+    //! header: the payload is only read when requested and skipped
+    //! otherwise, the CRC is only validated when explicitly asked
+    //! for and messages are only built on demand.
+    class LsfReader
+    {
+    public:
+      //! Open an LSF file. The compression method (if any) is
+      //! detected from the file contents. Block container files are
+      //! decompressed in parallel and damaged blocks are skipped
+      //! (see Compression::BlockBuffer).
+      //! @param[in] path file path.
+      LsfReader(const std::string& path);
+
+      //! Read records from an existing stream. The stream is not
+      //! owned by the reader.
+      //! @param[in] is input stream.
+      LsfReader(std::istream& is);
+
+      //! Destructor.
+      ~LsfReader(void);
+
+      //! Advance to the next record. Any unread payload of the
+      //! current record is skipped.
+      //! @return true if a record was found, false at the end of the
+      //! stream.
+      bool
+      next(void);
+
+      //! Retrieve the header of the current record.
+      //! @return record header.
+      const Header&
+      getHeader(void) const
+      {
+        return m_hdr;
+      }
+
+      //! Retrieve the offset of the current record in the
+      //! (uncompressed) stream.
+      //! @return record offset in bytes.
+      uint64_t
+      getOffset(void) const
+      {
+        return m_offset;
+      }
+
+      //! Retrieve the offset of the record returned by the next call
+      //! to next().
+      //! @return record offset in bytes.
+      uint64_t
+      getNextOffset(void) const
+      {
+        return m_next;
+      }
+
+      //! Move to a record boundary, typically taken from an index.
+      //! Uncompressed and block container files opened by path are
+      //! seeked directly, other streams can only move forward and
+      //! skip records by header.
+      //! @param[in] offset offset of the record returned by the next
+      //! call to next().
+      void
+      seek(uint64_t offset);
+
+      //! Move to the first record of an index entry. Block container
+      //! files opened by path start decoding at the container block
+      //! recorded in the entry, record offsets then follow the index
+      //! even if earlier blocks of the file were lost.
+      //! @param[in] block index entry.
+      void
+      seek(const LsfIndex::Block& block);
+
+      //! Advance to the next record and deserialize it, validating
+      //! the CRC.
+      //! @return message object or NULL at the end of the stream.
+      Message*
+      read(void);
+
+      //! Retrieve the size of the current record, including header
+      //! and footer.
+      //! @return record size in bytes.
+      unsigned
+      getSize(void) const;
+
+      //! Retrieve the raw bytes of the current record (header,
+      //! payload and footer), reading the payload if needed.
+      //! @return pointer to the record bytes.
+      const uint8_t*
+      getData(void);
+
+      //! Validate the CRC of the current record.
+      //! @return true if the CRC is valid, false otherwise.
+      bool
+      verify(void);
+
+      //! Deserialize the current record.
+      //! @param[in] msg message object to fill, if NULL a new message
+      //! is created.
+      //! @param[in] check_crc true to validate the CRC.
+      //! @return message object.
+      Message*
+      decode(Message* msg = NULL, bool check_crc = false);
+
+      //! Retrieve the number of damaged blocks skipped so far. Only
+      //! block container files can skip damaged data.
+      //! @return number of blocks.
+      unsigned
+      getCorruptedBlocks(void) const;
+
+    private:
+      //! Input stream.
+      std::istream* m_is;
+      //! True if the input stream is owned by the reader.
+      bool m_owner;
+      //! True if the input stream can be seeked.
+      bool m_seekable;
+      //! Stream buffer of block container files, NULL otherwise.
+      Compression::BlockBuffer* m_blocks;
+      //! Difference between record offsets and the offsets of the
+      //! block container stream buffer.
+      int64_t m_delta;
+      //! Current record header.
+      Header m_hdr;
+      //! Current record offset.
+      uint64_t m_offset;
+      //! Offset of the next record.
+      uint64_t m_next;
+      //! True if the payload of the current record was read.
+      bool m_loaded;
+      //! Record data.
+      Utils::ByteBuffer m_bfr;
+
+      //! Read the payload of the current record.
+      void
+      load(void);
+
+      //! Non - copyable.
+      LsfReader(const LsfReader&);
+
+      //! Non - assignable.
+      LsfReader&
+      operator=(const LsfReader&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,141 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Scheduler.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/IMC/LsfScanner.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Worker thread taking logs from a shared list.
+    class LsfScannerWorker: public Concurrency::Thread
+    {
+    public:
+      LsfScannerWorker(const std::vector<std::string>& paths, LsfScanner::Visitor& visitor,
+                       Concurrency::Mutex& mutex, size_t& next):
+        m_paths(paths),
+        m_visitor(visitor),
+        m_mutex(mutex),
+        m_next(next)
+      { }
+
+    private:
+      //! Log file paths.
+      const std::vector<std::string>& m_paths;
+      //! Record consumer.
+      LsfScanner::Visitor& m_visitor;
+      //! Lock of the next log number.
+      Concurrency::Mutex& m_mutex;
+      //! Next log number.
+      size_t& m_next;
+
+      void
+      run(void)
+      {
+        while (true)
+        {
+          size_t log;
+
+          {
+            Concurrency::ScopedMutex l(m_mutex);
+            if (m_next >= m_paths.size())
+              break;
+
+            log = m_next++;
+          }
+
+          LsfScanner::scan(log, m_paths[log], m_visitor);
+        }
+      }
+    };
+
+    void
+    LsfScanner::scan(const std::vector<std::string>& paths, Visitor& visitor, unsigned threads)
+    {
+      if (threads == 0)
+        threads = Concurrency::Scheduler::getProcessorCount();
+
+      if (threads > paths.size())
+        threads = paths.size();
+
+      if (threads <= 1)
+      {
+        for (size_t i = 0; i < paths.size(); ++i)
+          scan(i, paths[i], visitor);
+        return;
+      }
+
+      Concurrency::Mutex mutex;
+      size_t next = 0;
+      std::vector<LsfScannerWorker*> workers(threads);
+
+      for (unsigned i = 0; i < threads; ++i)
+      {
+        workers[i] = new LsfScannerWorker(paths, visitor, mutex, next);
+        workers[i]->start();
+      }
+
+      for (unsigned i = 0; i < threads; ++i)
+      {
+        workers[i]->join();
+        delete workers[i];
+      }
+    }
+
+    void
+    LsfScanner::scan(size_t log, const std::string& path, Visitor& visitor)
+    {
+      try
+      {
+        LsfMappedFile file(path);
+        visitor.onLogBegin(log, file);
+
+        LsfMappedFile::Record record;
+        for (size_t i = 0; file.getRecord(i, record); ++i)
+        {
+          if (!visitor.onRecord(log, record))
+            break;
+        }
+      }
+      catch (std::exception& e)
+      {
+        visitor.onLogError(log, e.what());
+        return;
+      }
+
+      visitor.onLogEnd(log);
+    }
+  }
+}
@@ -0,0 +1,119 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LSF_SCANNER_HPP_INCLUDED_
+#define DUNE_IMC_LSF_SCANNER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/LsfMappedFile.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LsfScanner;
+
+    //! Scan the records of a set of LSF files using a pool of
+    //! threads. Each file is scanned sequentially by a single
+    //! thread, different files are scanned concurrently.
+    class LsfScanner
+    {
+    public:
+      //! Record consumer. Callbacks for different logs may be
+      //! invoked concurrently, so consumers should keep per log
+      //! state indexed by the log number.
+      class Visitor
+      {
+      public:
+        virtual
+        ~Visitor(void)
+        { }
+
+        //! Called before the first record of a log.
+        //! @param[in] log log number.
+        //! @param[in] file log file.
+        virtual void
+        onLogBegin(size_t log, LsfMappedFile& file)
+        {
+          (void)log;
+          (void)file;
+        }
+
+        //! Called for each record of a log.
+        //! @param[in] log log number.
+        //! @param[in] record record view, only valid during the call.
+        //! @return true to continue, false to skip the rest of the log.
+        virtual bool
+        onRecord(size_t log, const LsfMappedFile::Record& record) = 0;
+
+        //! Called after the last record of a log.
+        //! @param[in] log log number.
+        virtual void
+        onLogEnd(size_t log)
+        {
+          (void)log;
+        }
+
+        //! Called if a log cannot be scanned. No further callbacks
+        //! are invoked for the log.
+        //! @param[in] log log number.
+        //! @param[in] error error message.
+        virtual void
+        onLogError(size_t log, const std::string& error)
+        {
+          (void)log;
+          (void)error;
+        }
+      };
+
+      //! Scan a set of logs. Returns when all logs are scanned.
+      //! @param[in] paths log file paths, log numbers are indexes in
+      //! this vector.
+      //! @param[in] visitor record consumer.
+      //! @param[in] threads number of threads, zero to use one per
+      //! processor.
+      static void
+      scan(const std::vector<std::string>& paths, Visitor& visitor, unsigned threads = 0);
+
+      //! Scan a single log in the calling thread.
+      //! @param[in] log log number.
+      //! @param[in] path log file path.
+      //! @param[in] visitor record consumer.
+      static void
+      scan(size_t log, const std::string& path, Visitor& visitor);
+    };
+  }
+}
+
+#endif
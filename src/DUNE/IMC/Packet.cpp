@@ -220,22 +220,12 @@ namespace DUNE
     }
 
     Message*
-    Packet::deserializePayload(const Header& hdr, const uint8_t* bfr, uint16_t bfr_len, Message* msg)
+    Packet::deserializePayload(const Header& hdr, const uint8_t* bfr, uint16_t bfr_len, Message* msg,
+                               bool check_crc)
     {
       (void)bfr_len;
 
-      // Retrieve CRC
-      uint16_t rcrc = 0;
-
-      if (hdr.sync == DUNE_IMC_CONST_SYNC_REV)
-        Utils::ByteCopy::rcopy(rcrc, bfr + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
-      else
-        Utils::ByteCopy::copy(rcrc, bfr + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
-
-      // Validate CRC.
-      uint16_t crc = Algorithms::CRC16::compute(bfr, DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
-
-      if (crc != rcrc)
+      if (check_crc && !verifyCrc(hdr, bfr))
         throw InvalidCrc();
 
       // Produce a message of the given type.
@@ -273,5 +263,22 @@ namespace DUNE
 
       return msg;
     }
+
+    bool
+    Packet::verifyCrc(const Header& hdr, const uint8_t* bfr)
+    {
+      // Retrieve CRC
+      uint16_t rcrc = 0;
+
+      if (hdr.sync == DUNE_IMC_CONST_SYNC_REV)
+        Utils::ByteCopy::rcopy(rcrc, bfr + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
+      else
+        Utils::ByteCopy::copy(rcrc, bfr + DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
+
+      // Validate CRC.
+      uint16_t crc = Algorithms::CRC16::compute(bfr, DUNE_IMC_CONST_HEADER_SIZE + hdr.size);
+
+      return crc == rcrc;
+    }
   }
 }
@@ -91,8 +91,26 @@ namespace DUNE
       static void
       deserializeHeader(Header& hdr, const uint8_t* bfr, uint16_t bfr_len);
 
+      //! Deserialize the payload of a packet whose header was already
+      //! parsed.
+      //! @param[in] hdr packet header.
+      //! @param[in] bfr packet data.
+      //! @param[in] bfr_len packet data length.
+      //! @param[in] msg message object to fill, if NULL a new message
+      //! is created.
+      //! @param[in] check_crc true to validate the packet CRC.
+      //! @return message object.
       static Message*
-      deserializePayload(const Header& hdr, const uint8_t* bfr, uint16_t bfr_len, Message* msg);
+      deserializePayload(const Header& hdr, const uint8_t* bfr, uint16_t bfr_len, Message* msg,
+                         bool check_crc = true);
+
+      //! Validate the CRC of a packet whose header was already
+      //! parsed.
+      //! @param[in] hdr packet header.
+      //! @param[in] bfr packet data, including the footer.
+      //! @return true if the CRC is valid, false otherwise.
+      static bool
+      verifyCrc(const Header& hdr, const uint8_t* bfr);
     };
   }
 }
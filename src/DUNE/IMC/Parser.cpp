@@ -27,6 +27,10 @@
 // Author: Eduardo Marques                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
 // DUNE headers.
 #include <DUNE/IMC/Parser.hpp>
 #include <DUNE/IMC/Packet.hpp>
@@ -35,6 +39,12 @@ namespace DUNE
 {
   namespace IMC
   {
+    //! Second byte of the synchronization number, present in both
+    //! byte orders at the first or second position.
+    static const uint8_t c_sync_lsb = DUNE_IMC_CONST_SYNC & 0xff;
+    //! First byte of the synchronization number.
+    static const uint8_t c_sync_msb = DUNE_IMC_CONST_SYNC >> 8;
+
     Parser::Parser(void)
     {
       reset();
@@ -46,91 +56,165 @@ namespace DUNE
     void
     Parser::reset(void)
     {
-      m_stage = c_sync;
-      m_pos = 0;
       m_buf.clear();
     }
 
     Message*
     Parser::parse(uint8_t byte)
     {
-      Message* m = 0;
       m_buf.push_back(byte);
 
+      const uint8_t* none = 0;
+      return parseBuffered(none, none);
+    }
+
+    Message*
+    Parser::parse(const uint8_t*& data, const uint8_t* end)
+    {
       while (true)
       {
-        int n = m_buf.size() - m_pos;
+        if (!m_buf.empty())
+        {
+          Message* m = parseBuffered(data, end);
+          if (m != 0 || !m_buf.empty())
+            return m;
+        }
+
+        if (data == end)
+          return 0;
 
-        if (!n)
+        const uint8_t* p = findSync(data, end);
+        if (p == end)
         {
-          reset(); // discard unneeded data
-          break;
+          data = end;
+          return 0;
         }
 
-        if (m_stage == c_sync)
+        size_t total = 0;
+        Message* m = 0;
+
+        if (!decode(p, end - p, total, m))
         {
-          // This would not be stricly necessary but is more efficient
-          // than  handling recurrent exceptions from Packet::deserializeHeader
-          if (n == 1)
-          {
-            break; // need more data
-          }
-
-          uint16_t sync = (m_buf[m_pos] << 8) | m_buf[m_pos + 1];
-
-          if (sync != DUNE_IMC_CONST_SYNC && sync != DUNE_IMC_CONST_SYNC_REV)
-          {
-            m_pos++; // invalid sync, advance
-            continue;
-          }
-          m_stage = c_header; // sync is ok, get rest of header
+          // Invalid packet, try to find sync again from next byte.
+          data = p + 1;
+          continue;
         }
 
-        if (m_stage == c_header)
+        if (m != 0)
         {
-          if (n < DUNE_IMC_CONST_HEADER_SIZE)
-            break;  // need more data
-
-          try
-          {
-            Packet::deserializeHeader(m_header, &m_buf[m_pos], n);
-          }
-          catch (...)
-          {
-            m_stage = c_sync;
-            ++m_pos; // try to find sync again from current position
-            continue;
-          }
-          m_stage = c_payload; // done with header
+          data = p + total;
+          return m;
         }
 
-        // on to c_payload stage
+        // Incomplete packet, keep it for the next block.
+        m_buf.assign(p, end);
+        data = end;
+        return 0;
+      }
+    }
+
+    const uint8_t*
+    Parser::findSync(const uint8_t* data, const uint8_t* end)
+    {
+      // The synchronization number is either 0xFE54 or 0x54FE, so
+      // memchr can skip quickly over data that cannot contain it.
+      const uint8_t* p = data;
 
-        if (n < (int)(m_header.size + DUNE_IMC_CONST_HEADER_SIZE + DUNE_IMC_CONST_FOOTER_SIZE))
-          break;  // need more data
+      while (p != end)
+      {
+        const uint8_t* q = (const uint8_t*)std::memchr(p, c_sync_lsb, end - p);
+        if (q == 0)
+          break;
 
-        // all payload data available
-        m_stage = c_sync; // the next stage in any case
+        if (q != data && q[-1] == c_sync_msb)
+          return q - 1;
 
-        try
-        {
-          m = Packet::deserializePayload(m_header, &m_buf[m_pos], n, 0);
-        }
-        catch (...)
+        if (q + 1 == end || q[1] == c_sync_msb)
+          return q;
+
+        p = q + 1;
+      }
+
+      // A trailing byte may be the start of a synchronization number.
+      if (end != data && end[-1] == c_sync_msb)
+        return end - 1;
+
+      return end;
+    }
+
+    bool
+    Parser::decode(const uint8_t* data, size_t size, size_t& total, Message*& msg)
+    {
+      msg = 0;
+      total = DUNE_IMC_CONST_HEADER_SIZE;
+
+      if (size >= 2)
+      {
+        uint16_t sync = (data[0] << 8) | data[1];
+        if (sync != DUNE_IMC_CONST_SYNC && sync != DUNE_IMC_CONST_SYNC_REV)
+          return false;
+      }
+
+      if (size < DUNE_IMC_CONST_HEADER_SIZE)
+        return true;
+
+      try
+      {
+        Header hdr;
+        Packet::deserializeHeader(hdr, data, DUNE_IMC_CONST_HEADER_SIZE);
+        total = DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+
+        if (size < total)
+          return true;
+
+        msg = Packet::deserializePayload(hdr, data, (uint16_t)std::min(total, (size_t)0xffff), 0);
+      }
+      catch (...)
+      {
+        return false;
+      }
+
+      return true;
+    }
+
+    void
+    Parser::resync(void)
+    {
+      const uint8_t* begin = &m_buf[0];
+      const uint8_t* p = findSync(begin + 1, begin + m_buf.size());
+      m_buf.erase(m_buf.begin(), m_buf.begin() + (p - begin));
+    }
+
+    Message*
+    Parser::parseBuffered(const uint8_t*& data, const uint8_t* end)
+    {
+      while (!m_buf.empty())
+      {
+        size_t total = 0;
+        Message* m = 0;
+
+        if (!decode(&m_buf[0], m_buf.size(), total, m))
         {
-          ++m_pos; // try to find sync again from current position
+          resync();
           continue;
         }
 
-        m_pos += n;
+        if (m != 0)
+        {
+          m_buf.erase(m_buf.begin(), m_buf.begin() + total);
+          return m;
+        }
 
-        if (m_pos == m_buf.size())
-          reset();  // discard unneeded data
+        if (data == end)
+          break;
 
-        break;
+        // Only copy the bytes needed to complete this stage.
+        size_t n = std::min(total - m_buf.size(), (size_t)(end - data));
+        m_buf.insert(m_buf.end(), data, data + n);
+        data += n;
       }
 
-      return m;
+      return 0;
     }
   }
 }
@@ -31,6 +31,7 @@
 #define DUNE_IMC_PARSER_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <cstddef>
 #include <vector>
 
 // DUNE headers.
@@ -44,6 +45,11 @@ namespace DUNE
     class DUNE_DLL_SYM Parser;
 
     //! Parser class.
+    //!
+    //! Data can be fed one byte at a time or in blocks. In the
+    //! latter case messages are deserialized directly from the
+    //! caller's buffer and only incomplete packets at the end of a
+    //! block are copied to an internal buffer.
     class Parser
     {
     public:
@@ -63,19 +69,72 @@ namespace DUNE
       Message*
       parse(uint8_t byte);
 
-    private:
-      //! Parser stage constants.
-      enum ParserStage
+      //! Parse a block of data and return the next message found in it.
+      //! The parser should be called repeatedly until it returns 0,
+      //! at which point all data has been consumed.
+      //! @param[in,out] data start of data, updated to point past
+      //! the consumed bytes.
+      //! @param[in] end end of data.
+      //! @return defined message or 0 if more data is needed.
+      Message*
+      parse(const uint8_t*& data, const uint8_t* end);
+
+      //! Parse a block of data and invoke a callback for every
+      //! message found. Ownership of the message is transferred to
+      //! the callback.
+      //! @param[in] data data buffer.
+      //! @param[in] len data length.
+      //! @param[in] obj callback object.
+      //! @param[in] callback callback method.
+      //! @return number of messages found.
+      template <typename T>
+      unsigned
+      parse(const uint8_t* data, size_t len, T* obj, void (T::*callback)(Message*))
       {
-        c_sync,
-        c_header,
-        c_payload
-      };
-
-      ParserStage m_stage; //!< Parser stage.
-      std::vector<uint8_t> m_buf; //!< Internal buffer.
-      unsigned int m_pos; //!< Buffer position.
-      Header m_header; //!< Holds parsed header (c_payload stage).
+        const uint8_t* end = data + len;
+        unsigned count = 0;
+
+        while (Message* m = parse(data, end))
+        {
+          (obj->*callback)(m);
+          ++count;
+        }
+
+        return count;
+      }
+
+    private:
+      //! Buffer holding an incomplete packet.
+      std::vector<uint8_t> m_buf;
+
+      //! Find the start of a synchronization number.
+      //! @param[in] data start of data.
+      //! @param[in] end end of data.
+      //! @return pointer to the first candidate or end.
+      static const uint8_t*
+      findSync(const uint8_t* data, const uint8_t* end);
+
+      //! Try to decode a packet stored at the given address.
+      //! @param[in] data start of packet.
+      //! @param[in] size available bytes.
+      //! @param[out] total size of the packet, when complete.
+      //! @param[out] msg decoded message, if any.
+      //! @return true if the packet is valid or incomplete, false
+      //! if it is invalid.
+      static bool
+      decode(const uint8_t* data, size_t size, size_t& total, Message*& msg);
+
+      //! Discard the first byte of the internal buffer and move on to
+      //! the next synchronization candidate.
+      void
+      resync(void);
+
+      //! Continue parsing the incomplete packet in the internal buffer.
+      //! @param[in,out] data start of data.
+      //! @param[in] end end of data.
+      //! @return defined message or 0.
+      Message*
+      parseBuffered(const uint8_t*& data, const uint8_t* end);
     };
   }
 }
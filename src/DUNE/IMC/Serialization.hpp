@@ -148,6 +148,18 @@ namespace DUNE
     uint16_t
     deserialize(std::vector<char>& t, const uint8_t* bfr, uint16_t& length);
 
+    //! Deserializator for scalar types without bounds checking. Used
+    //! by messages with a fixed layout after checking the size of
+    //! the whole payload.
+    //! @param t scalar where to place the unserialized bytes.
+    //! @param bfr buffer where to read the serialized bytes.
+    template <typename Type>
+    inline void
+    deserializeFixed(Type& t, const uint8_t* bfr)
+    {
+      std::memcpy(&t, bfr, sizeof(Type));
+    }
+
     //! Deserialize a numeric field with a different byte.
     //! @param t variable where to place the unserialized result.
     //! @param bfr buffer where to read the serialized bytes.
@@ -174,6 +186,18 @@ namespace DUNE
 
     uint16_t
     reverseDeserialize(std::vector<char>& t, const uint8_t* bfr, uint16_t& length);
+
+    //! Deserialize a numeric field with a different byte order
+    //! without bounds checking. Used by messages with a fixed layout
+    //! after checking the size of the whole payload.
+    //! @param t variable where to place the unserialized result.
+    //! @param bfr buffer where to read the serialized bytes.
+    template <typename Type>
+    inline void
+    reverseDeserializeFixed(Type& t, const uint8_t* bfr)
+    {
+      Utils::reverseCopy(t, (const char*)bfr);
+    }
   }
 }
 
@@ -0,0 +1,181 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_SHARED_MESSAGE_HPP_INCLUDED_
+#define DUNE_IMC_SHARED_MESSAGE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Immutable, reference counted handle to an IMC message. The
+    //! message bus wraps a single copy of each dispatched message in
+    //! one of these handles and hands it to every recipient, the
+    //! message is destroyed when the last handle goes out of scope.
+    class SharedMessage
+    {
+    public:
+      //! Create an empty handle.
+      SharedMessage(void):
+        m_ref(NULL)
+      { }
+
+      //! Create a handle that takes ownership of a message.
+      //! @param[in] msg message object (may be NULL).
+      explicit
+      SharedMessage(Message* msg):
+        m_ref(NULL)
+      {
+        if (msg != NULL)
+          m_ref = new Reference(msg);
+      }
+
+      //! Copy constructor.
+      //! @param[in] other handle to share.
+      SharedMessage(const SharedMessage& other):
+        m_ref(other.m_ref)
+      {
+        acquire();
+      }
+
+      //! Destructor.
+      ~SharedMessage(void)
+      {
+        release();
+      }
+
+      //! Assignment operator.
+      //! @param[in] other handle to share.
+      //! @return this handle.
+      SharedMessage&
+      operator=(const SharedMessage& other)
+      {
+        if (m_ref != other.m_ref)
+        {
+          release();
+          m_ref = other.m_ref;
+          acquire();
+        }
+
+        return *this;
+      }
+
+      //! Retrieve the shared message.
+      //! @return message pointer or NULL if the handle is empty.
+      const Message*
+      get(void) const
+      {
+        return (m_ref == NULL) ? NULL : m_ref->message;
+      }
+
+      const Message*
+      operator->(void) const
+      {
+        return get();
+      }
+
+      const Message&
+      operator*(void) const
+      {
+        return *get();
+      }
+
+      //! Retrieve the time at which the message was handed over to
+      //! this handle, i.e., when it was dispatched.
+      //! @return monotonic time in seconds (see Time::Clock::get()).
+      double
+      getDispatchTime(void) const
+      {
+        return (m_ref == NULL) ? 0.0 : m_ref->time;
+      }
+
+      //! Test if the handle is empty.
+      //! @return true if the handle holds no message, false otherwise.
+      bool
+      isNull(void) const
+      {
+        return m_ref == NULL;
+      }
+
+    private:
+      //! Shared message and its reference count.
+      struct Reference
+      {
+        Reference(Message* msg):
+          message(msg),
+          time(Time::Clock::get()),
+          count(1)
+        { }
+
+        ~Reference(void)
+        {
+          delete message;
+        }
+
+        //! Message object.
+        Message* message;
+        //! Dispatch time.
+        double time;
+        //! Number of handles sharing the message.
+        Concurrency::AtomicCounter count;
+      };
+
+      //! Shared reference.
+      Reference* m_ref;
+
+      void
+      acquire(void)
+      {
+        if (m_ref != NULL)
+          m_ref->count.add(1);
+      }
+
+      void
+      release(void)
+      {
+        if (m_ref == NULL)
+          return;
+
+        if (m_ref->count.sub(1) == 0)
+          delete m_ref;
+
+        m_ref = NULL;
+      }
+    };
+  }
+}
+
+#endif
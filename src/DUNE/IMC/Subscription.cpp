@@ -0,0 +1,103 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+
+// DUNE headers.
+#include <DUNE/IMC/Subscription.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Returns true if list is empty or contains value.
+    static inline bool
+    accepts(const std::vector<unsigned>& list, unsigned value)
+    {
+      return list.empty() || std::find(list.begin(), list.end(), value) != list.end();
+    }
+
+    Subscription::Subscription(void):
+      m_period(0)
+    { }
+
+    Subscription::Subscription(const Subscription& other):
+      m_sources(other.m_sources),
+      m_entities(other.m_entities),
+      m_destinations(other.m_destinations),
+      m_period(other.m_period)
+    { }
+
+    Subscription&
+    Subscription::operator=(const Subscription& other)
+    {
+      if (this == &other)
+        return *this;
+
+      m_sources = other.m_sources;
+      m_entities = other.m_entities;
+      m_destinations = other.m_destinations;
+      m_period = other.m_period;
+
+      Concurrency::ScopedMutex l(m_lock);
+      m_times.clear();
+      return *this;
+    }
+
+    bool
+    Subscription::matches(const Message* msg)
+    {
+      if (!accepts(m_sources, msg->getSource()))
+        return false;
+
+      if (!accepts(m_entities, msg->getSourceEntity()))
+        return false;
+
+      if (!accepts(m_destinations, msg->getDestination()))
+        return false;
+
+      if (m_period <= 0)
+        return true;
+
+      double now = Time::Clock::get();
+      Concurrency::ScopedMutex l(m_lock);
+
+      if (m_times.empty())
+        m_times.resize(256, -m_period);
+
+      double& last = m_times[msg->getSourceEntity()];
+      if (last + m_period > now)
+        return false;
+
+      last = now;
+      return true;
+    }
+  }
+}
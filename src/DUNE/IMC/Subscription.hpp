@@ -0,0 +1,145 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_IMC_SUBSCRIPTION_HPP_INCLUDED_
+#define DUNE_IMC_SUBSCRIPTION_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Subscription;
+
+    //! Declarative predicate attached to a bus registration. The
+    //! bus evaluates it before queueing a message for a task, so
+    //! messages that would be discarded by the consumer are never
+    //! copied. An empty subscription accepts every message.
+    class Subscription
+    {
+    public:
+      //! Constructor.
+      Subscription(void);
+
+      //! Copy constructor. Copies the predicate but not the state
+      //! of the rate limiter.
+      Subscription(const Subscription& other);
+
+      //! Assignment operator. Copies the predicate but not the
+      //! state of the rate limiter.
+      Subscription&
+      operator=(const Subscription& other);
+
+      //! Accept messages from a given source system. May be called
+      //! several times, messages from any of the given systems are
+      //! accepted.
+      //! @param[in] id system identification number.
+      //! @return reference to this object.
+      Subscription&
+      source(unsigned id)
+      {
+        m_sources.push_back(id);
+        return *this;
+      }
+
+      //! Accept messages from a given source entity. May be called
+      //! several times, messages from any of the given entities are
+      //! accepted.
+      //! @param[in] id entity identification number.
+      //! @return reference to this object.
+      Subscription&
+      sourceEntity(unsigned id)
+      {
+        m_entities.push_back(id);
+        return *this;
+      }
+
+      //! Accept messages addressed to a given system. May be called
+      //! several times, messages addressed to any of the given
+      //! systems are accepted.
+      //! @param[in] id system identification number.
+      //! @return reference to this object.
+      Subscription&
+      destination(unsigned id)
+      {
+        m_destinations.push_back(id);
+        return *this;
+      }
+
+      //! Set the minimum time between accepted messages of the same
+      //! source entity.
+      //! @param[in] period minimum period (s).
+      //! @return reference to this object.
+      Subscription&
+      minimumPeriod(double period)
+      {
+        m_period = period;
+        return *this;
+      }
+
+      //! Test if the subscription accepts every message.
+      //! @return true if no criteria are defined, false otherwise.
+      bool
+      empty(void) const
+      {
+        return m_sources.empty() && m_entities.empty()
+        && m_destinations.empty() && m_period <= 0;
+      }
+
+      //! Test a message against the subscription. Messages accepted
+      //! by the rate limiter update its state.
+      //! @param[in] msg message.
+      //! @return true if the message is accepted, false otherwise.
+      bool
+      matches(const Message* msg);
+
+    private:
+      //! Accepted source systems.
+      std::vector<unsigned> m_sources;
+      //! Accepted source entities.
+      std::vector<unsigned> m_entities;
+      //! Accepted destinations.
+      std::vector<unsigned> m_destinations;
+      //! Minimum period between messages of the same entity.
+      double m_period;
+      //! Time of the last accepted message, indexed by entity.
+      std::vector<double> m_times;
+      //! Rate limiter lock.
+      Concurrency::Mutex m_lock;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,91 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_IO_NOTIFIER_HPP_INCLUDED_
+#define DUNE_IO_NOTIFIER_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IO/Handle.hpp>
+
+namespace DUNE
+{
+  namespace IO
+  {
+    // Export symbol.
+    class DUNE_DLL_SYM Notifier;
+
+    //! A Notifier is a native I/O handle that one thread signals to
+    //! wake another thread waiting on it with Poll, alongside other
+    //! I/O handles. It is backed by an eventfd on Linux, a
+    //! non-blocking pipe on other POSIX systems and a manual-reset
+    //! event object on Microsoft Windows.
+    class Notifier
+    {
+    public:
+      //! Constructor.
+      Notifier(void);
+
+      //! Destructor.
+      ~Notifier(void);
+
+      //! Make the handle readable. Signaling an already signaled
+      //! notifier has no effect.
+      void
+      signal(void);
+
+      //! Make the handle unreadable.
+      void
+      clear(void);
+
+      //! Retrieve the native I/O handle.
+      //! @return native I/O handle.
+      NativeHandle
+      getNative(void) const
+      {
+        return m_handle;
+      }
+
+    private:
+      //! Handle to poll.
+      NativeHandle m_handle;
+#if defined(DUNE_OS_POSIX) && !defined(DUNE_SYS_HAS_SYS_EVENTFD_H)
+      //! Write end of the pipe.
+      NativeHandle m_write;
+#endif
+
+      //! Non-copyable.
+      Notifier(const Notifier&);
+
+      //! Non-assignable.
+      Notifier&
+      operator=(const Notifier&);
+    };
+  }
+}
+
+#endif
@@ -29,7 +29,9 @@
 
 // ISO C++ 98 headers.
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <stdexcept>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -38,6 +40,15 @@
 #include <DUNE/Time/Utils.hpp>
 #include <DUNE/IO/Poll.hpp>
 
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_POLL_H)
+#  include <poll.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
 namespace DUNE
 {
   namespace IO
@@ -45,9 +56,93 @@ namespace DUNE
     using std::memset;
     using System::Error;
 
+    Poll::Poll(TriggerMode mode):
+      m_mode(mode)
+    {
+      setup();
+    }
+
+    Poll::Poll(const Poll& other):
+      m_mode(other.m_mode),
+      m_handles(other.m_handles),
+      m_write_handles(other.m_write_handles)
+    {
+      setup();
+    }
+
+    Poll::~Poll(void)
+    {
+      release();
+    }
+
+    Poll&
+    Poll::operator=(const Poll& other)
+    {
+      if (this == &other)
+        return *this;
+
+      release();
+      m_mode = other.m_mode;
+      m_handles = other.m_handles;
+      m_write_handles = other.m_write_handles;
+      m_triggered.clear();
+      m_writable.clear();
+      setup();
+
+      return *this;
+    }
+
+    void
+    Poll::setup(void)
+    {
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      m_epfd = epoll_create1(EPOLL_CLOEXEC);
+      if (m_epfd == -1)
+        throw Error("creating epoll instance", Error::getLastMessage());
+
+      std::vector<NativeHandle> handles;
+      handles.swap(m_handles);
+      for (unsigned i = 0; i < handles.size(); ++i)
+        add(handles[i]);
+
+      handles.clear();
+      handles.swap(m_write_handles);
+      for (unsigned i = 0; i < handles.size(); ++i)
+        watchWrite(handles[i], true);
+#endif
+    }
+
+    void
+    Poll::release(void)
+    {
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      if (m_epfd != -1)
+      {
+        close(m_epfd);
+        m_epfd = -1;
+      }
+#endif
+    }
+
     void
     Poll::add(const NativeHandle& handle)
     {
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.events = EPOLLIN;
+      if (m_mode == TRIGGER_EDGE)
+        ev.events |= EPOLLET;
+      ev.data.fd = handle;
+
+      if (epoll_ctl(m_epfd, EPOLL_CTL_ADD, handle, &ev) == -1)
+      {
+        // Handles may be added more than once.
+        if (errno != EEXIST)
+          throw Error("adding handle to epoll instance", Error::getLastMessage());
+      }
+#endif
+
       m_handles.push_back(handle);
     }
 
@@ -56,44 +151,108 @@ namespace DUNE
     {
       std::vector<NativeHandle>::iterator itr;
       itr = std::find(m_handles.begin(), m_handles.end(), handle);
-      if (itr != m_handles.end())
-        m_handles.erase(itr);
+      if (itr == m_handles.end())
+        return;
+
+      m_handles.erase(itr);
+
+      // Only unregister the handle when its last reference is gone.
+      if (std::find(m_handles.begin(), m_handles.end(), handle) == m_handles.end())
+      {
+        itr = std::find(m_write_handles.begin(), m_write_handles.end(), handle);
+        if (itr != m_write_handles.end())
+          m_write_handles.erase(itr);
+
+        itr = std::find(m_writable.begin(), m_writable.end(), handle);
+        if (itr != m_writable.end())
+          m_writable.erase(itr);
+
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+        // Errors are ignored since the handle may already be closed.
+        epoll_ctl(m_epfd, EPOLL_CTL_DEL, handle, NULL);
+#endif
+      }
+
+      itr = std::find(m_triggered.begin(), m_triggered.end(), handle);
+      if (itr != m_triggered.end())
+        m_triggered.erase(itr);
     }
 
-    bool
-    Poll::wasTriggered(const NativeHandle& handle)
+    void
+    Poll::watchWrite(const NativeHandle& handle, bool enabled)
     {
-#if defined(DUNE_OS_POSIX)
-      // Only the triggered fd's remain in the set after select() exits.
-      return FD_ISSET(handle, &m_rfd) != 0;
+      if (std::find(m_handles.begin(), m_handles.end(), handle) == m_handles.end())
+        throw std::runtime_error("handle is not part of the polling pool");
 
-#elif defined(DUNE_OS_WINDOWS)
-      size_t idx = m_rv - WAIT_OBJECT_0;
-      if (idx < m_handles.size())
+      std::vector<NativeHandle>::iterator itr;
+      itr = std::find(m_write_handles.begin(), m_write_handles.end(), handle);
+      if (enabled == (itr != m_write_handles.end()))
+        return;
+
+      if (enabled)
+      {
+        m_write_handles.push_back(handle);
+      }
+      else
       {
-        if (m_handles[idx] == handle)
-          return true;
+        m_write_handles.erase(itr);
+
+        itr = std::find(m_writable.begin(), m_writable.end(), handle);
+        if (itr != m_writable.end())
+          m_writable.erase(itr);
       }
+
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.events = EPOLLIN;
+      if (enabled)
+        ev.events |= EPOLLOUT;
+      if (m_mode == TRIGGER_EDGE)
+        ev.events |= EPOLLET;
+      ev.data.fd = handle;
+
+      if (epoll_ctl(m_epfd, EPOLL_CTL_MOD, handle, &ev) == -1)
+        throw Error("modifying handle of epoll instance", Error::getLastMessage());
 #endif
+    }
 
-      return false;
+    bool
+    Poll::wasWritable(const NativeHandle& handle)
+    {
+      return std::find(m_writable.begin(), m_writable.end(), handle) != m_writable.end();
+    }
+
+    bool
+    Poll::wasTriggered(const NativeHandle& handle)
+    {
+      return std::find(m_triggered.begin(), m_triggered.end(), handle) != m_triggered.end();
     }
 
     bool
     Poll::poll(double timeout)
     {
+      m_triggered.clear();
+      m_writable.clear();
+
 #if defined(DUNE_OS_WINDOWS)
+      // Handles watched for write readiness are always writable.
+      m_writable = m_write_handles;
+      if (!m_writable.empty())
+        timeout = 0;
+
       DWORD count = m_handles.size();
       m_rv = WaitForMultipleObjects(count, &m_handles[0], FALSE, timeout * 1000);
 
       if (m_rv < count)
       {
+        m_triggered.push_back(m_handles[m_rv - WAIT_OBJECT_0]);
         return true;
       }
 
       if (m_rv == WAIT_TIMEOUT)
       {
-        return false;
+        return !m_writable.empty();
       }
 
       if (m_rv == WAIT_FAILED)
@@ -101,10 +260,41 @@ namespace DUNE
 
       return false;
 
+#elif defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      m_events.resize(std::max(m_handles.size(), (size_t)1));
+
+      int ms = -1;
+      if (timeout >= 0.0)
+        ms = (int)std::ceil(timeout * 1000.0);
+
+      int rv = epoll_wait(m_epfd, &m_events[0], m_events.size(), ms);
+
+      if (rv == -1)
+      {
+        //! Workaround for when we are interrupted by a signal.
+        if (errno == EINTR)
+          return false;
+        else
+          throw Error("polling handle", Error::getLastMessage());
+      }
+
+      for (int i = 0; i < rv; ++i)
+      {
+        // Errors and hang-ups are reported as input events.
+        if (m_events[i].events & ~EPOLLOUT)
+          m_triggered.push_back(m_events[i].data.fd);
+
+        if (m_events[i].events & EPOLLOUT)
+          m_writable.push_back(m_events[i].data.fd);
+      }
+
+      return rv > 0;
+
 #elif defined(DUNE_OS_POSIX)
       int rv = 0;
       NativeHandle max = 0;
       FD_ZERO(&m_rfd);
+      FD_ZERO(&m_wfd);
 
       for (std::vector<NativeHandle>::iterator itr = m_handles.begin(); itr != m_handles.end(); ++itr)
       {
@@ -113,14 +303,17 @@ namespace DUNE
         FD_SET(*itr, &m_rfd);
       }
 
+      for (std::vector<NativeHandle>::iterator itr = m_write_handles.begin(); itr != m_write_handles.end(); ++itr)
+        FD_SET(*itr, &m_wfd);
+
       if (timeout < 0.0)
       {
-        rv = select(max + 1, &m_rfd, NULL, NULL, NULL);
+        rv = select(max + 1, &m_rfd, &m_wfd, NULL, NULL);
       }
       else
       {
         timeval tv = DUNE_TIMEVAL_INIT_SEC_FP(timeout);
-        rv = select(max + 1, &m_rfd, NULL, NULL, &tv);
+        rv = select(max + 1, &m_rfd, &m_wfd, NULL, &tv);
       }
 
       if (rv == -1)
@@ -132,6 +325,19 @@ namespace DUNE
           throw Error("polling handle", Error::getLastMessage());
       }
 
+      // Only the triggered fd's remain in the set after select() exits.
+      for (std::vector<NativeHandle>::iterator itr = m_handles.begin(); itr != m_handles.end(); ++itr)
+      {
+        if (FD_ISSET(*itr, &m_rfd))
+          m_triggered.push_back(*itr);
+      }
+
+      for (std::vector<NativeHandle>::iterator itr = m_write_handles.begin(); itr != m_write_handles.end(); ++itr)
+      {
+        if (FD_ISSET(*itr, &m_wfd))
+          m_writable.push_back(*itr);
+      }
+
       return rv > 0;
 #endif
     }
@@ -143,6 +349,29 @@ namespace DUNE
       DWORD rv = WaitForSingleObjectEx(handle, timeout * 1000, FALSE);
       return rv == WAIT_OBJECT_0;
 
+#elif defined(DUNE_SYS_HAS_POLL_H)
+      pollfd pfd;
+      pfd.fd = handle;
+      pfd.events = POLLIN;
+      pfd.revents = 0;
+
+      int ms = -1;
+      if (timeout >= 0.0)
+        ms = (int)std::ceil(timeout * 1000.0);
+
+      int rv = ::poll(&pfd, 1, ms);
+
+      if (rv == -1)
+      {
+        //! Workaround for when we are interrupted by a signal.
+        if (errno == EINTR)
+          return false;
+        else
+          throw Error("polling handle", Error::getLastMessage());
+      }
+
+      return rv > 0;
+
 #elif defined(DUNE_OS_POSIX)
       fd_set rfd;
       FD_ZERO(&rfd);
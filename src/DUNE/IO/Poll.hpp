@@ -42,6 +42,11 @@
 #  include <sys/select.h>
 #endif
 
+// Linux headers.
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+#  include <sys/epoll.h>
+#endif
+
 namespace DUNE
 {
   namespace IO
@@ -49,9 +54,43 @@ namespace DUNE
     // Export symbol.
     class DUNE_DLL_SYM Poll;
 
+    //! I/O multiplexer. On systems with epoll the set of handles is
+    //! registered once with the kernel and only ready handles are
+    //! reported back, otherwise select() is used. Handles are always
+    //! watched for input, write readiness is only reported for
+    //! handles selected with watchWrite().
     class Poll
     {
     public:
+      //! Trigger modes.
+      enum TriggerMode
+      {
+        //! Handles are reported while data is available.
+        TRIGGER_LEVEL,
+        //! Handles are reported only when new data arrives, the
+        //! caller must read until the handle would block. This is
+        //! only available with epoll, otherwise it is the same as
+        //! TRIGGER_LEVEL.
+        TRIGGER_EDGE
+      };
+
+      //! Constructor.
+      //! @param[in] mode trigger mode.
+      Poll(TriggerMode mode = TRIGGER_LEVEL);
+
+      //! Copy constructor.
+      //! @param[in] other polling pool to copy.
+      Poll(const Poll& other);
+
+      //! Destructor.
+      ~Poll(void);
+
+      //! Assignment operator.
+      //! @param[in] other polling pool to copy.
+      //! @return this object.
+      Poll&
+      operator=(const Poll& other);
+
       static bool
       poll(const NativeHandle& handle, double timeout);
 
@@ -87,6 +126,27 @@ namespace DUNE
         remove(handle.getNative());
       }
 
+      //! Enable or disable write readiness notifications for a
+      //! native I/O handle of the polling pool. On Microsoft Windows
+      //! write readiness cannot be waited for and selected handles
+      //! are always reported as writable.
+      //! @param[in] handle native I/O handle.
+      //! @param[in] enabled true to report write readiness, false
+      //! otherwise.
+      void
+      watchWrite(const NativeHandle& handle, bool enabled);
+
+      //! Enable or disable write readiness notifications for an I/O
+      //! handle of the polling pool.
+      //! @param[in] handle I/O handle.
+      //! @param[in] enabled true to report write readiness, false
+      //! otherwise.
+      void
+      watchWrite(const Handle& handle, bool enabled)
+      {
+        watchWrite(handle.getNative(), enabled);
+      }
+
       bool
       poll(double timeout);
 
@@ -99,14 +159,62 @@ namespace DUNE
         return wasTriggered(handle.getNative());
       }
 
+      //! Retrieve the list of handles that were triggered by the
+      //! last call to poll().
+      //! @return list of native I/O handles.
+      const std::vector<NativeHandle>&
+      getTriggered(void) const
+      {
+        return m_triggered;
+      }
+
+      //! Test if a native I/O handle was reported as writable by the
+      //! last call to poll().
+      //! @param[in] handle native I/O handle.
+      //! @return true if the handle is writable, false otherwise.
+      bool
+      wasWritable(const NativeHandle& handle);
+
+      //! Retrieve the list of handles that were reported as writable
+      //! by the last call to poll().
+      //! @return list of native I/O handles.
+      const std::vector<NativeHandle>&
+      getWritable(void) const
+      {
+        return m_writable;
+      }
+
     private:
+      //! Trigger mode.
+      TriggerMode m_mode;
       //! List of native I/O handles.
       std::vector<NativeHandle> m_handles;
-#if defined(DUNE_OS_POSIX)
+      //! List of triggered handles.
+      std::vector<NativeHandle> m_triggered;
+      //! List of handles watched for write readiness.
+      std::vector<NativeHandle> m_write_handles;
+      //! List of writable handles.
+      std::vector<NativeHandle> m_writable;
+#if defined(DUNE_SYS_HAS_SYS_EPOLL_H)
+      //! epoll instance.
+      int m_epfd;
+      //! Buffer of epoll events.
+      std::vector<epoll_event> m_events;
+#elif defined(DUNE_OS_POSIX)
       fd_set m_rfd;
+      fd_set m_wfd;
 #elif defined(DUNE_OS_WINDOWS)
       DWORD m_rv;
 #endif
+
+      //! Create the kernel polling instance and register all
+      //! handles.
+      void
+      setup(void);
+
+      //! Release the kernel polling instance.
+      void
+      release(void);
     };
   }
 }
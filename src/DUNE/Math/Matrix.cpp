@@ -48,6 +48,7 @@
 #include <DUNE/Utils/String.hpp>
 #include <DUNE/Math/Constants.hpp>
 #include <DUNE/Math/Matrix.hpp>
+#include <DUNE/Math/MatrixKernels.hpp>
 #include <DUNE/Math/General.hpp>
 #include <DUNE/Parsers/Config.hpp>
 
@@ -188,6 +189,44 @@ namespace DUNE
       }
     }
 
+    void
+    Matrix::addTo(double* dst, double alpha) const
+    {
+      for (size_t i = 0; i < m_size; i++)
+        dst[i] += alpha * m_data[i];
+    }
+
+    void
+    Matrix::prepare(size_t r, size_t c)
+    {
+      if (m_size != 0 && m_size == r * c && *m_counter == 1)
+      {
+        m_nrows = r;
+        m_ncols = c;
+        std::memset(m_data, 0, m_size * sizeof(double));
+        return;
+      }
+
+      erase();
+
+      m_nrows = r;
+      m_ncols = c;
+      m_size = r * c;
+
+      if (!m_size)
+      {
+        m_nrows = m_ncols = 0;
+        m_data = NULL;
+        m_counter = NULL;
+        return;
+      }
+
+      m_data = ALLOCD(m_size + 1);
+      m_counter = m_data + m_size;
+      *m_counter = 1;
+      std::memset(m_data, 0, m_size * sizeof(double));
+    }
+
     void
     Matrix::split(void)
     {
@@ -1041,49 +1080,55 @@ namespace DUNE
       if (m_nrows != m_ncols)
         throw Error(" matrix is not square!");
 
+      size_t n = m_nrows;
+      std::vector<double> lu(m_data, m_data + m_size);
+      std::vector<size_t> pivots(n);
+
+      if (!MatrixKernels::factorLU(&lu[0], &pivots[0], n, Matrix::precision))
+        throw Error("Matrix is not invertible!");
+
       unsigned int permutations = 0;
-      Matrix A = *this;
-      Matrix Lf(m_nrows), dI(m_nrows), Per(m_nrows);
-      dI = dI + dI;
+      Matrix Lf(n), Uf(n, n, 0.0), Per(n);
 
-      for (size_t i = 0; i < m_nrows - 1; i++)
+      for (size_t i = 0; i < n; i++)
       {
-        if (Matrix::precision >= std::fabs(A(i, i)))
+        if (pivots[i] != i)
         {
-          bool p = 0;
-          for (size_t k = i + 1; k < m_nrows; k++)
-            if (Matrix::precision >= std::fabs(A(k, i)))
-            {
-              A.swapRows(i, k);
-              Per.swapRows(i, k);
-              p = true;
-              break;
-            }
-          if (!p)
-            throw Error("Matrix is not invertible!");
-          else
-            permutations++;
+          Per.swapRows(i, pivots[i]);
+          permutations++;
         }
 
-        Matrix Lt(m_nrows); // gaussian matrix
-        for (size_t j = i + 1; j < m_nrows; j++)
-          Lt(j, i) = -A(j, i) / A(i, i);
+        for (size_t j = 0; j < i; j++)
+          Lf.m_data[i * n + j] = lu[i * n + j];
 
-        /*
-          A = Lt * A;
-          Lf = Lf * (dI - Lt);
-        */
-        A = Lt.multiply(A);
-        Lf = Lf.multiply((dI - Lt)); // dI-Lt is the inverse of Lt (gaussian matrix)
+        for (size_t j = i; j < n; j++)
+          Uf.m_data[i * n + j] = lu[i * n + j];
       }
 
       P = Per;
-      U = A;
+      U = Uf;
       L = Lf;
 
       return permutations;
     }
 
+    void
+    Matrix::cholesky(Matrix& L) const
+    {
+      if (isEmpty())
+        throw Error("Trying to access an empty matrix!");
+
+      if (m_nrows != m_ncols)
+        throw Error("Matrix is not square!");
+
+      Matrix Lf(m_data, m_nrows, m_ncols);
+
+      if (!MatrixKernels::factorCholesky(Lf.m_data, m_nrows))
+        throw Error("Matrix is not positive definite!");
+
+      L = Lf;
+    }
+
     double
     Matrix::detr(void) const
     {
@@ -1137,16 +1182,21 @@ namespace DUNE
                 - this->element(2, 2) * this->element(1, 0) * this->element(0, 1));
       else
       {
-        Matrix L(m_nrows), U(m_nrows), P(m_nrows);
-        unsigned int exp = this->lup(L, U, P);
-        double dl = 1, du = 1;
+        std::vector<double> lu(m_data, m_data + m_size);
+        std::vector<size_t> pivots(m_nrows);
+
+        if (!MatrixKernels::factorLU(&lu[0], &pivots[0], m_nrows, 0.0))
+          return 0.0;
+
+        double d = 1.0;
         for (size_t i = 0; i < m_nrows; i++)
         {
-          // if LUP is implemented using Doolittle's algorithm, dl = 1.
-          dl = dl * L(i, i);
-          du = du * U(i, i);
+          d *= lu[i * (m_nrows + 1)];
+          if (pivots[i] != i)
+            d = -d;
         }
-        return std::pow(-1.0, (double)exp) * dl * du;
+
+        return d;
       }
     }
 
@@ -1435,126 +1485,29 @@ namespace DUNE
         throw Matrix::Error("Incompatible dimensions!");
 
       Matrix s(m_nrows, m2.m_ncols);
-
-      int n = m_nrows;
-      int m = m_ncols;
-      int r = m2.m_ncols;
-
-      double* m1_p = m_data;
-
-      for (int i = 0; i < n; i++)
-      {
-        for (int k = 0; k < m; k++)
-        {
-          double v = *m1_p++; // <-> v = m1(i,k)
-          double* m2_p = m2.m_data + k * r;
-          double* s_p = s.m_data + i * r;
-
-          // not pretty, but hopefully faster
-          if (std::fabs(v) <= precision)
-          {
-            if (!k)
-            {
-              for (int j = 0; j < r; j++)
-              {
-                *s_p = 0;
-                s_p++;
-              }
-            }
-          }
-          else
-            for (int j = 0; j < r; j++)
-            {
-              if (!k)
-                *s_p = 0;
-              *s_p += v * (*m2_p); // <-> s(i,j) += m1(i,k) * m2(k,j)
-              s_p++;
-              m2_p++;
-            }
-        }
-      }
-      return s;
-    }
-
-    Matrix
-    operator+(const Matrix& m1, const Matrix& m2)
-    {
-      if (m1.isEmpty() || m2.isEmpty())
-        throw Matrix::Error("Trying to access an empty matrix!");
-
-      if (m1.m_nrows != m2.m_nrows || m1.m_ncols != m2.m_ncols)
-        throw Matrix::Error("Incompatible dimensions!");
-
-      Matrix s(m1.m_nrows, m1.m_ncols);
-
-      int size = s.m_size;
-      double* p = s.m_data;
-      double* p1 = m1.m_data;
-      double* p2 = m2.m_data;
-
-      for (int i = 0; i < size; i++)
-        *(p++) = *(p1++) + *(p2++);
-
+      MatrixKernels::multiply(m_data, m2.m_data, s.m_data, m_nrows, m_ncols, m2.m_ncols);
       return s;
     }
 
     Matrix
-    operator-(const Matrix& m1, const Matrix& m2)
+    transform(const Matrix& a, const Matrix& b)
     {
-      if (m1.isEmpty() || m2.isEmpty())
-        throw Matrix::Error("Trying to access an empty matrix!");
-
-      if (m1.m_nrows != m2.m_nrows || m1.m_ncols != m2.m_ncols)
-        throw Matrix::Error("Incompatible dimensions!");
-
-      Matrix s(m1.m_nrows, m1.m_ncols);
-
-      int size = s.m_size;
-      double* p = s.m_data;
-      double* p1 = m1.m_data;
-      double* p2 = m2.m_data;
-
-      for (int i = 0; i < size; i++)
-        *(p++) = *(p1++) - *(p2++);
-
-      return s;
-    }
-
-    Matrix
-    operator*(const Matrix& m1, const Matrix& m2)
-    {
-      if (m1.isEmpty() || m2.isEmpty())
+      if (a.isEmpty() || b.isEmpty())
         throw Matrix::Error("Trying to access an empty matrix!");
 
-      if (m1.m_ncols != m2.m_nrows)
+      if (b.m_nrows != b.m_ncols || a.m_ncols != b.m_nrows)
         throw Matrix::Error("Incompatible dimensions!");
 
-      Matrix s(m1.m_nrows, m2.m_ncols);
-
-      int n = m1.m_nrows;
-      int m = m1.m_ncols;
-      int r = m2.m_ncols;
+      size_t n = a.m_nrows;
+      size_t k = a.m_ncols;
 
-      double* m1_p = m1.m_data;
+      // The product a * b is transposed into the result without
+      // computing transpose(a).
+      std::vector<double> ab(n * k);
+      MatrixKernels::multiply(a.m_data, b.m_data, &ab[0], n, k, k);
 
-      for (int i = 0; i < n; i++)
-      {
-        for (int k = 0; k < m; k++)
-        {
-          double v = *m1_p++; // <-> v = m1(i,k)
-          double* m2_p = m2.m_data + k * r;
-          double* s_p = s.m_data + i * r;
-
-          for (int j = 0; j < r; j++)
-          {
-            if (!k)
-              *s_p = 0;
-            *s_p += v * (*m2_p); // <-> s(i,j) += m1(i,k) * m2(k,j)
-            s_p++;
-            m2_p++;
-          }
-        }
-      }
+      Matrix s(n, n);
+      MatrixKernels::multiplyTransposed(&ab[0], a.m_data, s.m_data, n, k, n);
       return s;
     }
 
@@ -1602,36 +1555,6 @@ namespace DUNE
       return s;
     }
 
-    Matrix
-    operator*(double x, const Matrix& a)
-    {
-      Matrix s(a);
-
-      s *= x;
-
-      return s;
-    }
-
-    Matrix
-    operator*(const Matrix& a, double x)
-    {
-      Matrix s(a);
-
-      s *= x;
-
-      return s;
-    }
-
-    Matrix
-    operator/(const Matrix& a, double x)
-    {
-      Matrix s(a);
-
-      s /= x;
-
-      return s;
-    }
-
     std::ostream&
     operator<<(std::ostream& os, const Matrix& a)
     {
@@ -1693,22 +1616,25 @@ namespace DUNE
       return is;
     }
 
-    Matrix
-    transpose(const Matrix& a)
+    //! Solve a * x = b, where a has n x n elements and b has n x m
+    //! elements, using LU decomposition with partial pivoting.
+    //! @param[in] a coefficients.
+    //! @param[in,out] b right-hand side, replaced by the solution.
+    //! @param[in] n dimension.
+    //! @param[in] m number of right-hand sides.
+    //! @param[in] tolerance pivots with smaller magnitude are zero.
+    //! @return false if a is singular, true otherwise.
+    static bool
+    solveLinear(const double* a, double* b, size_t n, size_t m, double tolerance)
     {
-      if (a.isEmpty())
-        throw Matrix::Error("Trying to access an empty matrix!");
+      std::vector<double> lu(a, a + n * n);
+      std::vector<size_t> pivots(n);
 
-      int n = a.m_nrows;
-      int m = a.m_ncols;
-
-      Matrix t(m, n);
-
-      for (int i = 0; i < n; i++)
-        for (int j = 0; j < m; j++)
-          (t.m_data + j * n)[i] = (a.m_data + i * m)[j];
+      if (!MatrixKernels::factorLU(&lu[0], &pivots[0], n, tolerance))
+        return false;
 
-      return t;
+      MatrixKernels::solveLU(&lu[0], &pivots[0], b, n, m);
+      return true;
     }
 
     bool
@@ -1720,29 +1646,10 @@ namespace DUNE
       if (m_nrows != m_ncols)
         throw Matrix::Error("Inversion of a nonsquare Matrix!");
 
-      int n = m_nrows;
-      double* M = ALLOCD(2 * n * n);
-      double* p1 = M;
-      double* p2 = m_data;
-
-      for (int i = 0; i < n; i++)
-      {
-        for (int j = 0; j < n; j++)
-        {
-          *p1 = *p2;
-          *(p1 + n) = (i == j) ? 1 : 0;
-          p1++;
-          p2++;
-        }
-
-        p1 += n;
-      }
-
-      int rv = upper_triangular_pp(M, n, n + n, Matrix::precision);
-
-      std::free(M);
+      std::vector<double> lu(m_data, m_data + m_size);
+      std::vector<size_t> pivots(m_nrows);
 
-      return rv == 0;
+      return MatrixKernels::factorLU(&lu[0], &pivots[0], m_nrows, Matrix::precision);
     }
 
     Matrix
@@ -1754,48 +1661,11 @@ namespace DUNE
       if (a.m_nrows != a.m_ncols)
         throw Matrix::Error("Inversion of a nonsquare Matrix!");
 
-      int n = a.m_nrows;
-      double* M = ALLOCD(2 * n * n);
-      double* p1 = M;
-      double* p2 = a.m_data;
+      Matrix s(a.m_nrows);
 
-      for (int i = 0; i < n; i++)
-      {
-        for (int j = 0; j < n; j++)
-        {
-          *p1 = *p2;
-          *(p1 + n) = (i == j) ? 1 : 0;
-          p1++;
-          p2++;
-        }
-        p1 += n;
-      }
-
-      int result = Math::Matrix::upper_triangular_pp(M, n, n + n, Matrix::precision);
-
-      Matrix s(n, n);
-
-      if (result)  // singular Matrix
-      {
-        std::free(M);
+      if (!solveLinear(a.m_data, s.m_data, a.m_nrows, a.m_nrows, Matrix::precision))
         throw Matrix::Error("Inversion error!");
-      }
-
-      p1 = s.m_data;
-      p2 = M;
-      int n2 = n + n;
 
-      for (int j = 0; j < n; j++)
-        for (int i = n - 1; i >= 0; i--)
-        {
-          double* p = p1 + n * i + j;
-          *p = p2[i * n2 + n + j];
-          for (int ii = i + 1; ii < n; ii++)
-            *p -= p2[n2 * i + ii] * p1[n * ii + j];
-          *p /= p2[n2 * i + i];
-        }
-
-      std::free(M);
       return s;
     }
 
@@ -1811,166 +1681,24 @@ namespace DUNE
       if (a.m_nrows != b.m_nrows)
         throw Matrix::Error("Incompatible dimensions!");
 
-      int n = a.m_nrows;
-      int m = b.m_ncols;
-      double* M = ALLOCD(n * (n + m));
-
-      double* p1 = M;
-      double* p2 = a.m_data;
-      double* p3 = b.m_data;
-      for (int i = 0; i < n; i++)
-      {
-        for (int j = 0; j < n; j++)
-          *(p1++) = *(p2++);
+      Matrix s(b.m_data, b.m_nrows, b.m_ncols);
 
-        for (int j = 0; j < m; j++)
-          *(p1++) = *(p3++);
-      }
-
-      int result = Math::Matrix::upper_triangular_pp(M, n, n + m, Matrix::precision);
-
-      Matrix s(n, m);
-
-      if (result)  // singular Matrix
-      {
-        std::free(M);
+      if (!solveLinear(a.m_data, s.m_data, a.m_nrows, b.m_ncols, Matrix::precision))
         throw Matrix::Error("Inversion error!");
-      }
-
-      p1 = s.m_data;
-      p2 = M;
-      int n2 = n + m;
-
-      for (int j = 0; j < m; j++)
-        for (int i = n - 1; i >= 0; i--)
-        {
-          double* p = p1 + m * i + j;
-          *p = p2[i * n2 + n + j];
-          for (int ii = i + 1; ii < n; ii++)
-            *p -= p2[n2 * i + ii] * p1[m * ii + j];
-          *p /= p2[n2 * i + i];
-        }
 
-      std::free(M);
       return s;
     }
 
     Matrix
     inverse(const Matrix& a)
     {
-      if (a.isEmpty())
-        throw Matrix::Error("Trying to access an empty matrix!");
-
-      if (a.m_nrows != a.m_ncols)
-        throw Matrix::Error("Inversion of a nonsquare Matrix!");
-
-      int n = a.m_nrows;
-      double* M = ALLOCD(2 * n * n);
-      int* index = ALLOCI(n);
-
-      double* p1 = M;
-      double* p2 = a.m_data;
-
-      for (int i = 0; i < n; i++)
-      {
-        for (int j = 0; j < n; j++)
-        {
-          *p1 = *p2;
-          *(p1 + n) = (i == j) ? 1 : 0;
-          p1++;
-          p2++;
-        }
-        p1 += n;
-        index[i] = i;
-      }
-
-      int result = Math::Matrix::upper_triangular_tp(M, index, n, n + n, Matrix::precision);
-
-      Matrix s(n, n);
-
-      if (result)  // singular Matrix
-      {
-        std::free(index);
-        std::free(M);
-        throw Matrix::Error("Inversion error!");
-      }
-
-      p1 = s.m_data;
-      p2 = M;
-      int n2 = n + n;
-
-      for (int j = 0; j < n; j++)
-        for (int i = n - 1; i >= 0; i--)
-        {
-          double* p = p1 + n * index[i] + j;
-          *p = p2[i * n2 + n + j];
-          for (int ii = i + 1; ii < n; ii++)
-            *p -= p2[n2 * i + ii] * p1[n * index[ii] + j];
-          *p /= p2[n2 * i + i];
-        }
-
-      std::free(index);
-      std::free(M);
-      return s;
+      return inverse_pp(a);
     }
 
     Matrix
     inverse(const Matrix& a, const Matrix& b)
     {
-      if (a.isEmpty() || b.isEmpty())
-        throw Matrix::Error("Trying to access an empty matrix!");
-
-      if (a.m_nrows != a.m_ncols)
-        throw Matrix::Error("Inversion of a nonsquare Matrix!");
-
-      if (a.m_nrows != b.m_nrows)
-        throw Matrix::Error("Incompatible dimensions!");
-
-      int n = a.m_nrows;
-      int m = b.m_ncols;
-      double* M = ALLOCD(n * (n + m));
-      int* index = ALLOCI(n);
-
-      double* p1 = M;
-      double* p2 = a.m_data;
-      double* p3 = b.m_data;
-      for (int i = 0; i < n; i++)
-      {
-        for (int j = 0; j < n; j++)
-          *(p1++) = *(p2++);
-        for (int j = 0; j < m; j++)
-          *(p1++) = *(p3++);
-        index[i] = i;
-      }
-
-      int result = Math::Matrix::upper_triangular_tp(M, index, n, n + m, Matrix::precision);
-
-      Matrix s(n, m);
-
-      if (result)  // singular Matrix
-      {
-        std::free(index);
-        std::free(M);
-        throw Matrix::Error("Inversion error!");
-      }
-
-      p1 = s.m_data;
-      p2 = M;
-      int n2 = n + m;
-
-      for (int j = 0; j < m; j++)
-        for (int i = n - 1; i >= 0; i--)
-        {
-          double* p = p1 + m * index[i] + j;
-          *p = p2[i * n2 + n + j];
-          for (int ii = i + 1; ii < n; ii++)
-            *p -= p2[n2 * i + ii] * p1[m * index[ii] + j];
-          *p /= p2[n2 * i + i];
-        }
-
-      std::free(index);
-      std::free(M);
-      return s;
+      return inverse_pp(a, b);
     }
 
     Matrix
@@ -2010,50 +1738,12 @@ namespace DUNE
       if (a.m_nrows != a.m_ncols)
         throw Matrix::Error("Inversion of a nonsquare Matrix!");
 
-      int n = a.m_nrows;
-
-      Matrix L(n);
-      Matrix U(n);
-      Matrix P(n);
-
-      a.lup(L, U, P);
-
-      double* y = ALLOCD(n);
-      double* l = L.m_data;
-      double* u = U.m_data;
-      double* p = P.m_data;
-
-      Matrix Minv(n, n);
-      double* m = Minv.m_data;
-
-      for (int k = 0; k < n; k++)
-      {
-        for (int j = 0; j < n; j++)
-        {
-          y[j] = p[j * n + k];
+      Matrix s(a.m_nrows);
 
-          for (int i = 0; i < j; i++)
-            y[j] -= l[j * n + i] * y[i];
+      if (!solveLinear(a.m_data, s.m_data, a.m_nrows, a.m_nrows, Matrix::precision))
+        throw Matrix::Error("Matrix is not invertible!");
 
-          y[j] /= l[j * n + j];
-        }
-
-        for (int j = n - 1; j >= 0; j--)
-        {
-          m[j * n + k] = y[j];
-          for (int i = j + 1; i < n; i++)
-            m[j * n + k] -= u[j * n + i] * m[i * n + k];
-
-          if (Matrix::precision >= std::fabs(u[j * n + j]))
-            throw Matrix::Error("Matrix is not invertible!");
-          else
-            m[j * n + k] /= u[j * n + j];
-        }
-      }
-
-      std::free(y);
-
-      return Minv;
+      return s;
     }
 
     Matrix
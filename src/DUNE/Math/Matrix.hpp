@@ -42,6 +42,7 @@
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/Math/MatrixKernels.hpp>
 
 namespace DUNE
 {
@@ -53,7 +54,115 @@ namespace DUNE
     // Export DLL Symbol.
     class DUNE_DLL_SYM Matrix;
 
-    class Matrix
+    //! Base of matrix expressions. The arithmetic operators on
+    //! matrices (+, -, scalar *, /, matrix product and transpose())
+    //! return lightweight expression objects instead of matrices.
+    //! Expressions are evaluated directly into the destination when
+    //! they are assigned to a Matrix, so chained operations such as
+    //! 'x + K * y' do not create intermediate matrices.
+    //!
+    //! An expression is a class E deriving from MatrixExpression<E>
+    //! that provides:
+    //! - rows() and columns(): dimensions of the result.
+    //! - check(): NULL if the operands are valid, an error message
+    //!   otherwise.
+    //! - coefficient(i, j): value of a single element.
+    //! - aliases(data): true if the expression reads from 'data'.
+    //! - addTo(dst, alpha): add alpha times the result to 'dst'.
+    //! - evaluated(buffer): pointer to the result in row-major
+    //!   order, evaluated into 'buffer' if needed.
+    template <typename E>
+    class MatrixExpression
+    {
+    public:
+      //! Get the concrete expression.
+      //! @return expression.
+      const E&
+      expression(void) const
+      {
+        return static_cast<const E&>(*this);
+      }
+
+      //! Evaluate a single element of the expression.
+      //! @param[in] i row index.
+      //! @param[in] j column index.
+      //! @return element value.
+      double
+      operator()(size_t i, size_t j) const;
+
+      //! Evaluate a single element of the expression.
+      //! @param[in] i element index, in row-major order.
+      //! @return element value.
+      double
+      operator()(size_t i) const;
+
+      //! Evaluate the expression into a new matrix.
+      //! @return resultant matrix.
+      Matrix
+      evaluate(void) const;
+
+      //! @name Matrix queries
+      //! These evaluate the expression and call the Matrix method of
+      //! the same name, so that expressions can be used where
+      //! matrices were returned before.
+      //! @{
+      Matrix
+      get(size_t i1, size_t i2, size_t j1, size_t j2) const;
+
+      Matrix
+      row(size_t i) const;
+
+      Matrix
+      column(size_t j) const;
+
+      double
+      element(size_t i, size_t j) const;
+
+      double
+      det(void) const;
+
+      double
+      trace(void) const;
+
+      double
+      norm_p(double p) const;
+
+      double
+      norm_2(void) const;
+
+      double
+      norm_inf(void) const;
+
+      Matrix
+      toDCM(void) const;
+
+      Matrix
+      toQuaternion(void) const;
+
+      Matrix
+      toEulerAngles(void) const;
+
+      Matrix
+      expmts(double tol = 1e-05) const;
+
+      bool
+      operator==(const Matrix& m) const;
+      //! @}
+
+      //! Evaluate the expression into a buffer.
+      //! @param[out] buffer storage of the result.
+      //! @return pointer to the result.
+      const double*
+      evaluated(std::vector<double>& buffer) const
+      {
+        const E& e = expression();
+        buffer.assign(e.rows() * e.columns(), 0.0);
+        e.addTo(&buffer[0], 1.0);
+        return &buffer[0];
+      }
+    };
+
+    class Matrix: public MatrixExpression<Matrix>
     {
     public:
       class Error: public std::runtime_error
@@ -107,6 +216,12 @@ namespace DUNE
       //! param[in] n size of new matrix (n * n)
       Matrix(const double* diag, size_t n);
 
+      //! Constructor.
+      //! Create a Matrix with the value of an expression.
+      //! @param[in] e matrix expression.
+      template <typename E>
+      Matrix(const MatrixExpression<E>& e);
+
       //! Destructor.
       //! Decrement the number of copies of a Matrix and frees the
       //! allocated memory if this number reaches zero.
@@ -421,6 +536,31 @@ namespace DUNE
       Matrix&
       operator=(const Matrix& m);
 
+      //! This method evaluates an expression into this Matrix. The
+      //! existing storage is reused when it is not shared and has
+      //! the right size. If the expression reads this Matrix it is
+      //! evaluated into a temporary first.
+      //! @param[in] e matrix expression
+      //! @return reference to resultant matrix
+      template <typename E>
+      Matrix&
+      operator=(const MatrixExpression<E>& e);
+
+      //! This method adds the value of an expression to this Matrix.
+      //! @param[in] e matrix expression
+      //! @return reference to resultant matrix
+      template <typename E>
+      Matrix&
+      operator+=(const MatrixExpression<E>& e);
+
+      //! This method subtracts the value of an expression from this
+      //! Matrix.
+      //! @param[in] e matrix expression
+      //! @return reference to resultant matrix
+      template <typename E>
+      Matrix&
+      operator-=(const MatrixExpression<E>& e);
+
       //! This methods adds to a Matrix the contents of another Matrix.
       //! @param[in] m reference to matrix to be added
       //! @return reference to resultant matrix
@@ -488,6 +628,12 @@ namespace DUNE
       unsigned int
       lup(Matrix& L, Matrix& U, Matrix& P) const;
 
+      //! Cholesky decomposition (A = L * L') of a symmetric positive
+      //! definite matrix.
+      //! @param[out] L lower triangular matrix
+      void
+      cholesky(Matrix& L) const;
+
       // LU decomposition (Doolittle Decomposition of a Matrix).
       // NOTE: A(i,i) == 0 isn't handled
       //! @param[in] L lower triangular matrix
@@ -501,8 +647,8 @@ namespace DUNE
       double
       detr(void) const;
 
-      //! Matrix determinant through LUP decomposition
-      //! Iterative technique O(n^3).
+      //! Matrix determinant through LU decomposition with partial
+      //! pivoting. Iterative technique O(n^3).
       //! @return matrix determinant
       double
       det(void) const;
@@ -630,34 +776,14 @@ namespace DUNE
       static Matrix
       cross(const Matrix& a, const Matrix& b);
 
-      //! This method returns the sum of two matrices.
-      //! @param[in] m1 matrix to be summed.
-      //! @param[in] m2 matrix to be summed.
-      //! @return resultant matrix.
+      //! This method returns a * b * transpose(a), without computing
+      //! transpose(a). This is the common form of covariance
+      //! propagation.
+      //! @param[in] a transformation matrix (n x k).
+      //! @param[in] b square matrix (k x k).
+      //! @return resultant matrix (n x n).
       friend DUNE_DLL_SYM Matrix
-      operator+(const Matrix& m1, const Matrix& m2);
-
-      //! This method returns the difference of two matrices.
-      //! @param[in] m1 matrix to be subtracted.
-      //! @param[in] m2 matrix to subtract.
-      //! @return resultant matrix.
-      friend DUNE_DLL_SYM Matrix
-      operator-(const Matrix& m1, const Matrix& m2);
-
-      //! This method returns the product of two matrices.
-      //! Note on optimization by Eduardo Marques - Sep 8 2010
-      //! ====================================================
-      //! Applied loop interchange to achieve memory stride 1
-      //! (better data locality) in iterations of the innermost loop,
-      //! This makes for better cache behavior (i.e. less cache misses),
-      //! particularly as matrix dimensions increase.
-      //! For those interested, see papers or books by M J Wolfe.
-      //!
-      //! @param[in] m1 matrix to be summed.
-      //! @param[in] m2 matrix to be summed.
-      //! @return resultant matrix.
-      friend DUNE_DLL_SYM Matrix
-      operator*(const Matrix& m1, const Matrix& m2);
+      transform(const Matrix& a, const Matrix& b);
 
       //! This method returns the element-element product of two matrices.
       //! @param[in] m1 matrix to be multiplied (element-element).
@@ -673,27 +799,6 @@ namespace DUNE
       friend DUNE_DLL_SYM Matrix
       operator/(const Matrix& a, const Matrix& b);
 
-      //! This function multiplies a Matrix by a real number.
-      //! @param[in] x real number.
-      //! @param[in] a matrix to be multiplied.
-      //! @return resultant matrix.
-      friend DUNE_DLL_SYM Matrix
-      operator*(double x, const Matrix& a);
-
-      //! This function multiplies a Matrix by a real number.
-      //! @param[in] a matrix to be multiplied.
-      //! @param[in] x real number.
-      //! @return resultant matrix.
-      friend DUNE_DLL_SYM Matrix
-      operator*(const Matrix& a, double x);
-
-      //! This function divides a Matrix by a real number.
-      //! @param[in] a matrix to be divided.
-      //! @param[in] x real number.
-      //! @return resultant matrix.
-      friend DUNE_DLL_SYM Matrix
-      operator/(const Matrix& a, double x);
-
       //! This method sends a Matrix to an 'ostream'.
       //! Each row of the Matrix is put on a different line.
       //! @param[in] os output stream.
@@ -709,20 +814,12 @@ namespace DUNE
       friend DUNE_DLL_SYM std::istream&
       operator>>(std::istream& is, Matrix& a);
 
-      //! This method returns the transpose of a Matrix.
-      //! @param[in] a to be transposed.
-      //! @return transposed matrix.
-      friend DUNE_DLL_SYM Matrix
-      transpose(const Matrix& a);
-
       //! This methods calculates the inverse of a Matrix.
-      //! The inverse is calculated using Gauss elimination with total
-      //! pivoting.
+      //! The inverse is calculated using LU decomposition with
+      //! partial pivoting.
       //!
-      //! If Matrix 'a' is singular (with current precision) a zero
-      //! Matrix with the same dimension of 'a' is returned and the
-      //! variable 'dMatrix::inversionerror' is set to 1. Otherwise it
-      //! is set to 0.
+      //! If Matrix 'a' is singular (with current precision) an
+      //! exception is thrown.
       //!
       //! @param[in] a matrix to be inverted.
       //!
@@ -733,11 +830,10 @@ namespace DUNE
       //! This methods calculates the Matrix 'x' that solves
       //! the linear system of equations 'a.x=b'.
       //!
-      //! The system is solved using Gauss elimination with total pivoting.
+      //! The system is solved using LU decomposition with partial pivoting.
       //!
-      //! If Matrix 'a' is singular (with current precision) a zero Matrix with
-      //! the same dimension of 'b' is returned and the variable
-      //! 'dMatrix::inversionerror' is set to 1. Otherwise it is set to 0.
+      //! If Matrix 'a' is singular (with current precision) an
+      //! exception is thrown.
       //! @param[in] a matrix
       //! @param[in] b matrix
       //! @return resultant matrix
@@ -752,11 +848,10 @@ namespace DUNE
       skew(const Matrix& a);
 
       //! This methods calculates the inverse of a Matrix.
-      //! The inverse is calculated using Gauss elimination with partial pivoting.
+      //! The inverse is calculated using LU decomposition with partial pivoting.
       //!
-      //! If Matrix is singular (with current precision) a zero Matrix with
-      //! the same dimension is returned and the variable.
-      //! 'dMatrix::inversionerror' is set to 1. Otherwise is is set to 0.
+      //! If Matrix is singular (with current precision) an exception is
+      //! thrown.
       //! @param[in] a reference to matrix to be inverted
       //! @return inverted matrix
       friend Matrix
@@ -765,11 +860,10 @@ namespace DUNE
       //! This methods calculates the Matrix 'x' that solves
       //! the linear system of equations 'a.x=b'.
       //!
-      //! The system is solved using Gauss elimination with partial pivoting.
+      //! The system is solved using LU decomposition with partial pivoting.
       //!
-      //! If Matrix 'a' is singular (with current precision) a zero Matrix with
-      //! the same dimension of 'b' is returned and the variable.
-      //! 'dMatrix::inversionerror' is set to 1. Otherwise it is set to 0.
+      //! If Matrix 'a' is singular (with current precision) an
+      //! exception is thrown.
       //! @param[in] a matrix
       //! @param[in] b matrix
       //! @return resultant matrix
@@ -851,6 +945,51 @@ namespace DUNE
       static int
       upper_triangular_tp(double* M, int* index, int n, int m, double tolerance);
 
+      //! Check if the matrix is a valid operand (see
+      //! MatrixExpression).
+      //! @return NULL.
+      const char*
+      check(void) const
+      {
+        return NULL;
+      }
+
+      //! Get a single element without bounds checking (see
+      //! MatrixExpression).
+      //! @param[in] i row index.
+      //! @param[in] j column index.
+      //! @return element value.
+      double
+      coefficient(size_t i, size_t j) const
+      {
+        return m_data[i * m_ncols + j];
+      }
+
+      //! Test if the matrix data is stored at a given address (see
+      //! MatrixExpression).
+      //! @param[in] data address.
+      //! @return true if data is the address of this matrix data.
+      bool
+      aliases(const double* data) const
+      {
+        return m_size != 0 && data == m_data;
+      }
+
+      //! Add a multiple of this matrix to an array (see
+      //! MatrixExpression).
+      //! @param[in,out] dst destination array.
+      //! @param[in] alpha scale factor.
+      void
+      addTo(double* dst, double alpha) const;
+
+      //! Get the matrix data (see MatrixExpression).
+      //! @return pointer to the first element.
+      const double*
+      evaluated(std::vector<double>&) const
+      {
+        return m_data;
+      }
+
     private:
       static double precision;
 
@@ -867,6 +1006,14 @@ namespace DUNE
       //! This method creates a unique copy of the data of a Matrix.
       void
       split(void);
+
+      //! Make this Matrix a zero filled matrix with the given
+      //! dimensions and data that is not shared. The current data is
+      //! reused when possible.
+      //! @param[in] r number of rows.
+      //! @param[in] c number of columns.
+      void
+      prepare(size_t r, size_t c);
     };
 
     //! This function returns a 3x3 skew symmetrical
@@ -875,6 +1022,612 @@ namespace DUNE
     //! @return skewed matrix
     Matrix
     skew(const double data[3]);
+
+    //! Operands of matrix expressions: matrices are held by
+    //! reference and sub-expressions by value.
+    template <typename E>
+    struct MatrixOperand
+    {
+      typedef const E Type;
+    };
+
+    template <>
+    struct MatrixOperand<Matrix>
+    {
+      typedef const Matrix& Type;
+    };
+
+    //! Sum or difference of two matrix expressions.
+    template <typename L, typename R>
+    class MatrixSum: public MatrixExpression<MatrixSum<L, R> >
+    {
+    public:
+      //! Constructor.
+      //! @param[in] l left operand.
+      //! @param[in] r right operand.
+      //! @param[in] sign 1 for a sum, -1 for a difference.
+      MatrixSum(const L& l, const R& r, double sign):
+        m_l(l),
+        m_r(r),
+        m_sign(sign)
+      { }
+
+      size_t
+      rows(void) const
+      {
+        return m_l.rows();
+      }
+
+      size_t
+      columns(void) const
+      {
+        return m_l.columns();
+      }
+
+      const char*
+      check(void) const
+      {
+        const char* error = m_l.check();
+        if (error == NULL)
+          error = m_r.check();
+        if (error != NULL)
+          return error;
+
+        if (m_l.rows() == 0 || m_r.rows() == 0)
+          return "Trying to access an empty matrix!";
+
+        if ((size_t)m_l.rows() != (size_t)m_r.rows() || (size_t)m_l.columns() != (size_t)m_r.columns())
+          return "Incompatible dimensions!";
+
+        return NULL;
+      }
+
+      double
+      coefficient(size_t i, size_t j) const
+      {
+        return m_l.coefficient(i, j) + m_sign * m_r.coefficient(i, j);
+      }
+
+      bool
+      aliases(const double* data) const
+      {
+        return m_l.aliases(data) || m_r.aliases(data);
+      }
+
+      void
+      addTo(double* dst, double alpha) const
+      {
+        m_l.addTo(dst, alpha);
+        m_r.addTo(dst, alpha * m_sign);
+      }
+
+    private:
+      typename MatrixOperand<L>::Type m_l;
+      typename MatrixOperand<R>::Type m_r;
+      double m_sign;
+    };
+
+    //! Matrix expression multiplied by a scalar.
+    template <typename E>
+    class MatrixScaled: public MatrixExpression<MatrixScaled<E> >
+    {
+    public:
+      //! Constructor.
+      //! @param[in] e operand.
+      //! @param[in] factor scale factor.
+      MatrixScaled(const E& e, double factor):
+        m_e(e),
+        m_factor(factor)
+      { }
+
+      size_t
+      rows(void) const
+      {
+        return m_e.rows();
+      }
+
+      size_t
+      columns(void) const
+      {
+        return m_e.columns();
+      }
+
+      const char*
+      check(void) const
+      {
+        return m_e.check();
+      }
+
+      double
+      coefficient(size_t i, size_t j) const
+      {
+        return m_factor * m_e.coefficient(i, j);
+      }
+
+      bool
+      aliases(const double* data) const
+      {
+        return m_e.aliases(data);
+      }
+
+      void
+      addTo(double* dst, double alpha) const
+      {
+        m_e.addTo(dst, alpha * m_factor);
+      }
+
+    private:
+      typename MatrixOperand<E>::Type m_e;
+      double m_factor;
+    };
+
+    //! Transpose of a matrix expression.
+    template <typename E>
+    class MatrixTransposed: public MatrixExpression<MatrixTransposed<E> >
+    {
+    public:
+      //! Constructor.
+      //! @param[in] e operand.
+      MatrixTransposed(const E& e):
+        m_e(e)
+      { }
+
+      size_t
+      rows(void) const
+      {
+        return m_e.columns();
+      }
+
+      size_t
+      columns(void) const
+      {
+        return m_e.rows();
+      }
+
+      const char*
+      check(void) const
+      {
+        const char* error = m_e.check();
+        if (error == NULL && m_e.rows() == 0)
+          return "Trying to access an empty matrix!";
+
+        return error;
+      }
+
+      double
+      coefficient(size_t i, size_t j) const
+      {
+        return m_e.coefficient(j, i);
+      }
+
+      bool
+      aliases(const double* data) const
+      {
+        return m_e.aliases(data);
+      }
+
+      void
+      addTo(double* dst, double alpha) const
+      {
+        std::vector<double> buffer;
+        const double* src = m_e.evaluated(buffer);
+        size_t r = rows();
+        size_t c = columns();
+
+        for (size_t i = 0; i < r; ++i)
+        {
+          for (size_t j = 0; j < c; ++j)
+            dst[i * c + j] += alpha * src[j * r + i];
+        }
+      }
+
+      //! Get the operand, before transposition.
+      //! @param[out] buffer storage for the operand.
+      //! @return pointer to the operand.
+      const double*
+      source(std::vector<double>& buffer) const
+      {
+        return m_e.evaluated(buffer);
+      }
+
+    private:
+      typename MatrixOperand<E>::Type m_e;
+    };
+
+    //! Evaluation of matrix products.
+    template <typename L, typename R>
+    struct MatrixProductKernel
+    {
+      static void
+      addTo(const L& l, const R& r, double* dst, double alpha)
+      {
+        std::vector<double> lb;
+        std::vector<double> rb;
+        MatrixKernels::multiplyAdd(l.evaluated(lb), r.evaluated(rb), dst,
+                                   l.rows(), l.columns(), r.columns(), alpha);
+      }
+    };
+
+    //! Products with a transpose read the transposed operand in
+    //! place.
+    template <typename L, typename E>
+    struct MatrixProductKernel<L, MatrixTransposed<E> >
+    {
+      static void
+      addTo(const L& l, const MatrixTransposed<E>& r, double* dst, double alpha)
+      {
+        std::vector<double> lb;
+        std::vector<double> rb;
+        MatrixKernels::multiplyTransposedAdd(l.evaluated(lb), r.source(rb), dst,
+                                             l.rows(), l.columns(), r.columns(), alpha);
+      }
+    };
+
+    //! Product of two matrix expressions.
+    template <typename L, typename R>
+    class MatrixProduct: public MatrixExpression<MatrixProduct<L, R> >
+    {
+    public:
+      //! Constructor.
+      //! @param[in] l left operand.
+      //! @param[in] r right operand.
+      MatrixProduct(const L& l, const R& r):
+        m_l(l),
+        m_r(r)
+      { }
+
+      size_t
+      rows(void) const
+      {
+        return m_l.rows();
+      }
+
+      size_t
+      columns(void) const
+      {
+        return m_r.columns();
+      }
+
+      const char*
+      check(void) const
+      {
+        const char* error = m_l.check();
+        if (error == NULL)
+          error = m_r.check();
+        if (error != NULL)
+          return error;
+
+        if (m_l.rows() == 0 || m_r.rows() == 0)
+          return "Trying to access an empty matrix!";
+
+        if ((size_t)m_l.columns() != (size_t)m_r.rows())
+          return "Incompatible dimensions!";
+
+        return NULL;
+      }
+
+      double
+      coefficient(size_t i, size_t j) const
+      {
+        double v = 0;
+        for (size_t k = 0; k < (size_t)m_l.columns(); ++k)
+          v += m_l.coefficient(i, k) * m_r.coefficient(k, j);
+        return v;
+      }
+
+      bool
+      aliases(const double* data) const
+      {
+        return m_l.aliases(data) || m_r.aliases(data);
+      }
+
+      void
+      addTo(double* dst, double alpha) const
+      {
+        MatrixProductKernel<L, R>::addTo(m_l, m_r, dst, alpha);
+      }
+
+    private:
+      typename MatrixOperand<L>::Type m_l;
+      typename MatrixOperand<R>::Type m_r;
+    };
+
+    //! This function returns the sum of two matrices.
+    //! @param[in] l matrix to be summed.
+    //! @param[in] r matrix to be summed.
+    //! @return sum expression.
+    template <typename L, typename R>
+    inline MatrixSum<L, R>
+    operator+(const MatrixExpression<L>& l, const MatrixExpression<R>& r)
+    {
+      return MatrixSum<L, R>(l.expression(), r.expression(), 1.0);
+    }
+
+    //! This function returns the difference of two matrices.
+    //! @param[in] l matrix to be subtracted.
+    //! @param[in] r matrix to subtract.
+    //! @return difference expression.
+    template <typename L, typename R>
+    inline MatrixSum<L, R>
+    operator-(const MatrixExpression<L>& l, const MatrixExpression<R>& r)
+    {
+      return MatrixSum<L, R>(l.expression(), r.expression(), -1.0);
+    }
+
+    //! This function returns the product of two matrices. The
+    //! product is computed by MatrixKernels, which uses cache
+    //! blocking and SIMD instructions for larger matrices.
+    //! @param[in] l left matrix.
+    //! @param[in] r right matrix.
+    //! @return product expression.
+    template <typename L, typename R>
+    inline MatrixProduct<L, R>
+    operator*(const MatrixExpression<L>& l, const MatrixExpression<R>& r)
+    {
+      return MatrixProduct<L, R>(l.expression(), r.expression());
+    }
+
+    //! This function multiplies a matrix by a real number.
+    //! @param[in] x real number.
+    //! @param[in] e matrix to be multiplied.
+    //! @return scaled expression.
+    template <typename E>
+    inline MatrixScaled<E>
+    operator*(double x, const MatrixExpression<E>& e)
+    {
+      return MatrixScaled<E>(e.expression(), x);
+    }
+
+    //! This function multiplies a matrix by a real number.
+    //! @param[in] e matrix to be multiplied.
+    //! @param[in] x real number.
+    //! @return scaled expression.
+    template <typename E>
+    inline MatrixScaled<E>
+    operator*(const MatrixExpression<E>& e, double x)
+    {
+      return MatrixScaled<E>(e.expression(), x);
+    }
+
+    //! This function divides a matrix by a real number.
+    //! @param[in] e matrix to be divided.
+    //! @param[in] x real number.
+    //! @return scaled expression.
+    template <typename E>
+    inline MatrixScaled<E>
+    operator/(const MatrixExpression<E>& e, double x)
+    {
+      return MatrixScaled<E>(e.expression(), 1.0 / x);
+    }
+
+    //! This function negates a matrix expression.
+    //! @param[in] e matrix expression.
+    //! @return scaled expression.
+    template <typename E>
+    inline MatrixScaled<E>
+    operator-(const MatrixExpression<E>& e)
+    {
+      return MatrixScaled<E>(e.expression(), -1.0);
+    }
+
+    //! This function returns the transpose of a matrix.
+    //! @param[in] e matrix to be transposed.
+    //! @return transposed expression.
+    template <typename E>
+    inline MatrixTransposed<E>
+    transpose(const MatrixExpression<E>& e)
+    {
+      return MatrixTransposed<E>(e.expression());
+    }
+
+    template <typename E>
+    inline double
+    MatrixExpression<E>::operator()(size_t i, size_t j) const
+    {
+      const E& e = expression();
+      const char* error = e.check();
+      if (error != NULL)
+        throw Matrix::Error(error);
+
+      if (i >= e.rows() || j >= e.columns())
+        throw Matrix::Error("Invalid index!");
+
+      return e.coefficient(i, j);
+    }
+
+    template <typename E>
+    inline double
+    MatrixExpression<E>::operator()(size_t i) const
+    {
+      const E& e = expression();
+      const char* error = e.check();
+      if (error != NULL)
+        throw Matrix::Error(error);
+
+      if (i >= e.rows() * e.columns())
+        throw Matrix::Error("Invalid index!");
+
+      return e.coefficient(i / e.columns(), i % e.columns());
+    }
+
+    template <typename E>
+    inline Matrix
+    MatrixExpression<E>::evaluate(void) const
+    {
+      return Matrix(*this);
+    }
+
+    template <typename E>
+    inline Matrix
+    MatrixExpression<E>::get(size_t i1, size_t i2, size_t j1, size_t j2) const
+    {
+      return evaluate().get(i1, i2, j1, j2);
+    }
+
+    template <typename E>
+    inline Matrix
+    MatrixExpression<E>::row(size_t i) const
+    {
+      return evaluate().row(i);
+    }
+
+    template <typename E>
+    inline Matrix
+    MatrixExpression<E>::column(size_t j) const
+    {
+      return evaluate().column(j);
+    }
+
+    template <typename E>
+    inline double
+    MatrixExpression<E>::element(size_t i, size_t j) const
+    {
+      return (*this)(i, j);
+    }
+
+    template <typename E>
+    inline double
+    MatrixExpression<E>::det(void) const
+    {
+      return evaluate().det();
+    }
+
+    template <typename E>
+    inline double
+    MatrixExpression<E>::trace(void) const
+    {
+      return evaluate().trace();
+    }
+
+    template <typename E>
+    inline double
+    MatrixExpression<E>::norm_p(double p) const
+    {
+      return evaluate().norm_p(p);
+    }
+
+    template <typename E>
+    inline double
+    MatrixExpression<E>::norm_2(void) const
+    {
+      return evaluate().norm_2();
+    }
+
+    template <typename E>
+    inline double
+    MatrixExpression<E>::norm_inf(void) const
+    {
+      return evaluate().norm_inf();
+    }
+
+    template <typename E>
+    inline Matrix
+    MatrixExpression<E>::toDCM(void) const
+    {
+      return evaluate().toDCM();
+    }
+
+    template <typename E>
+    inline Matrix
+    MatrixExpression<E>::toQuaternion(void) const
+    {
+      return evaluate().toQuaternion();
+    }
+
+    template <typename E>
+    inline Matrix
+    MatrixExpression<E>::toEulerAngles(void) const
+    {
+      return evaluate().toEulerAngles();
+    }
+
+    template <typename E>
+    inline Matrix
+    MatrixExpression<E>::expmts(double tol) const
+    {
+      return evaluate().expmts(tol);
+    }
+
+    template <typename E>
+    inline bool
+    MatrixExpression<E>::operator==(const Matrix& m) const
+    {
+      return evaluate() == m;
+    }
+
+    template <typename E>
+    Matrix::Matrix(const MatrixExpression<E>& e):
+      m_nrows(0),
+      m_ncols(0),
+      m_size(0),
+      m_data(NULL),
+      m_counter(NULL)
+    {
+      const E& x = e.expression();
+      const char* error = x.check();
+      if (error != NULL)
+        throw Error(error);
+
+      prepare(x.rows(), x.columns());
+      x.addTo(m_data, 1.0);
+    }
+
+    template <typename E>
+    Matrix&
+    Matrix::operator=(const MatrixExpression<E>& e)
+    {
+      const E& x = e.expression();
+      if (x.aliases(m_data))
+        return *this = Matrix(e);
+
+      const char* error = x.check();
+      if (error != NULL)
+        throw Error(error);
+
+      prepare(x.rows(), x.columns());
+      x.addTo(m_data, 1.0);
+      return *this;
+    }
+
+    template <typename E>
+    Matrix&
+    Matrix::operator+=(const MatrixExpression<E>& e)
+    {
+      const E& x = e.expression();
+      const char* error = x.check();
+      if (error != NULL)
+        throw Error(error);
+
+      if (m_nrows != x.rows() || m_ncols != x.columns())
+        throw Error("Incompatible dimensions!");
+
+      if (x.aliases(m_data))
+        return *this += Matrix(e);
+
+      split();
+      x.addTo(m_data, 1.0);
+      return *this;
+    }
+
+    template <typename E>
+    Matrix&
+    Matrix::operator-=(const MatrixExpression<E>& e)
+    {
+      const E& x = e.expression();
+      const char* error = x.check();
+      if (error != NULL)
+        throw Error(error);
+
+      if (m_nrows != x.rows() || m_ncols != x.columns())
+        throw Error("Incompatible dimensions!");
+
+      if (x.aliases(m_data))
+        return *this -= Matrix(e);
+
+      split();
+      x.addTo(m_data, -1.0);
+      return *this;
+    }
   }
 }
 
@@ -0,0 +1,624 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+// DUNE headers.
+#include <DUNE/Math/MatrixKernels.hpp>
+
+// AVX and SSE2 (x86).
+#if defined(DUNE_CPU_X86) && (defined(DUNE_CXX_GNU) || defined(DUNE_CXX_CLANG))
+#  define DUNE_MATRIX_AVX
+#  include <immintrin.h>
+#endif
+
+#if defined(__SSE2__)
+#  define DUNE_MATRIX_SSE2
+#  include <emmintrin.h>
+#endif
+
+// NEON (ARMv8).
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#  define DUNE_MATRIX_NEON
+#  include <arm_neon.h>
+#endif
+
+#if defined(DUNE_USING_BLAS)
+extern "C"
+{
+  void
+  dgemm_(const char* transa, const char* transb, const int* m, const int* n, const int* k,
+         const double* alpha, const double* a, const int* lda, const double* b, const int* ldb,
+         const double* beta, double* c, const int* ldc);
+
+  void
+  dgetrf_(const int* m, const int* n, double* a, const int* lda, int* ipiv, int* info);
+
+  void
+  dpotrf_(const char* uplo, const int* n, double* a, const int* lda, int* info);
+}
+#endif
+
+namespace DUNE
+{
+  namespace Math
+  {
+    //! Products with fewer multiplications use a plain loop.
+    static const size_t c_small_product = 4096;
+    //! Rows of the right operand processed per block.
+    static const size_t c_block_rows = 128;
+    //! Columns of the right operand processed per block.
+    static const size_t c_block_columns = 512;
+#if defined(DUNE_USING_BLAS)
+    //! Products with more multiplications use BLAS.
+    static const size_t c_blas_product = 32768;
+    //! Factorizations of larger matrices use LAPACK.
+    static const size_t c_lapack_dimension = 48;
+#endif
+
+    //! Compute y += alpha * x.
+    typedef void (*AxpyFunction)(double* y, const double* x, double alpha, size_t n);
+    //! Compute x . y.
+    typedef double (*DotFunction)(const double* x, const double* y, size_t n);
+
+    static void
+    axpyGeneric(double* y, const double* x, double alpha, size_t n)
+    {
+      for (size_t i = 0; i < n; ++i)
+        y[i] += alpha * x[i];
+    }
+
+    static double
+    dotGeneric(const double* x, const double* y, size_t n)
+    {
+      double v = 0;
+      for (size_t i = 0; i < n; ++i)
+        v += x[i] * y[i];
+      return v;
+    }
+
+#if defined(DUNE_MATRIX_SSE2)
+    static void
+    axpySSE2(double* y, const double* x, double alpha, size_t n)
+    {
+      __m128d va = _mm_set1_pd(alpha);
+      size_t i = 0;
+
+      for (; i + 4 <= n; i += 4)
+      {
+        __m128d y0 = _mm_add_pd(_mm_loadu_pd(y + i), _mm_mul_pd(va, _mm_loadu_pd(x + i)));
+        __m128d y1 = _mm_add_pd(_mm_loadu_pd(y + i + 2), _mm_mul_pd(va, _mm_loadu_pd(x + i + 2)));
+        _mm_storeu_pd(y + i, y0);
+        _mm_storeu_pd(y + i + 2, y1);
+      }
+
+      for (; i < n; ++i)
+        y[i] += alpha * x[i];
+    }
+
+    static double
+    dotSSE2(const double* x, const double* y, size_t n)
+    {
+      __m128d s0 = _mm_setzero_pd();
+      __m128d s1 = _mm_setzero_pd();
+      size_t i = 0;
+
+      for (; i + 4 <= n; i += 4)
+      {
+        s0 = _mm_add_pd(s0, _mm_mul_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(y + i)));
+        s1 = _mm_add_pd(s1, _mm_mul_pd(_mm_loadu_pd(x + i + 2), _mm_loadu_pd(y + i + 2)));
+      }
+
+      double t[2];
+      _mm_storeu_pd(t, _mm_add_pd(s0, s1));
+      double v = t[0] + t[1];
+
+      for (; i < n; ++i)
+        v += x[i] * y[i];
+
+      return v;
+    }
+#endif
+
+#if defined(DUNE_MATRIX_AVX)
+    //! Test if the CPU and operating system support AVX.
+    static bool
+    hasAVX(void)
+    {
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx");
+    }
+
+    __attribute__((target("avx")))
+    static void
+    axpyAVX(double* y, const double* x, double alpha, size_t n)
+    {
+      __m256d va = _mm256_set1_pd(alpha);
+      size_t i = 0;
+
+      for (; i + 8 <= n; i += 8)
+      {
+        __m256d y0 = _mm256_add_pd(_mm256_loadu_pd(y + i), _mm256_mul_pd(va, _mm256_loadu_pd(x + i)));
+        __m256d y1 = _mm256_add_pd(_mm256_loadu_pd(y + i + 4), _mm256_mul_pd(va, _mm256_loadu_pd(x + i + 4)));
+        _mm256_storeu_pd(y + i, y0);
+        _mm256_storeu_pd(y + i + 4, y1);
+      }
+
+      for (; i < n; ++i)
+        y[i] += alpha * x[i];
+    }
+
+    __attribute__((target("avx")))
+    static double
+    dotAVX(const double* x, const double* y, size_t n)
+    {
+      __m256d s0 = _mm256_setzero_pd();
+      __m256d s1 = _mm256_setzero_pd();
+      size_t i = 0;
+
+      for (; i + 8 <= n; i += 8)
+      {
+        s0 = _mm256_add_pd(s0, _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+        s1 = _mm256_add_pd(s1, _mm256_mul_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4)));
+      }
+
+      double t[4];
+      _mm256_storeu_pd(t, _mm256_add_pd(s0, s1));
+      double v = (t[0] + t[1]) + (t[2] + t[3]);
+
+      for (; i < n; ++i)
+        v += x[i] * y[i];
+
+      return v;
+    }
+#endif
+
+#if defined(DUNE_MATRIX_NEON)
+    static void
+    axpyNEON(double* y, const double* x, double alpha, size_t n)
+    {
+      float64x2_t va = vdupq_n_f64(alpha);
+      size_t i = 0;
+
+      for (; i + 4 <= n; i += 4)
+      {
+        vst1q_f64(y + i, vfmaq_f64(vld1q_f64(y + i), va, vld1q_f64(x + i)));
+        vst1q_f64(y + i + 2, vfmaq_f64(vld1q_f64(y + i + 2), va, vld1q_f64(x + i + 2)));
+      }
+
+      for (; i < n; ++i)
+        y[i] += alpha * x[i];
+    }
+
+    static double
+    dotNEON(const double* x, const double* y, size_t n)
+    {
+      float64x2_t s0 = vdupq_n_f64(0.0);
+      float64x2_t s1 = vdupq_n_f64(0.0);
+      size_t i = 0;
+
+      for (; i + 4 <= n; i += 4)
+      {
+        s0 = vfmaq_f64(s0, vld1q_f64(x + i), vld1q_f64(y + i));
+        s1 = vfmaq_f64(s1, vld1q_f64(x + i + 2), vld1q_f64(y + i + 2));
+      }
+
+      double v = vaddvq_f64(vaddq_f64(s0, s1));
+
+      for (; i < n; ++i)
+        v += x[i] * y[i];
+
+      return v;
+    }
+#endif
+
+    //! Implementation selected at run time.
+    struct MatrixImplementation
+    {
+      AxpyFunction axpy;
+      DotFunction dot;
+      const char* name;
+
+      MatrixImplementation(void):
+        axpy(axpyGeneric),
+        dot(dotGeneric),
+        name("generic")
+      {
+#if defined(DUNE_MATRIX_SSE2)
+        axpy = axpySSE2;
+        dot = dotSSE2;
+        name = "sse2";
+#endif
+
+#if defined(DUNE_MATRIX_AVX)
+        if (hasAVX())
+        {
+          axpy = axpyAVX;
+          dot = dotAVX;
+          name = "avx";
+        }
+#endif
+
+#if defined(DUNE_MATRIX_NEON)
+        axpy = axpyNEON;
+        dot = dotNEON;
+        name = "neon";
+#endif
+
+#if defined(DUNE_USING_BLAS)
+        name = "blas";
+#endif
+      }
+    };
+
+    static const MatrixImplementation&
+    getSelected(void)
+    {
+      static const MatrixImplementation impl;
+      return impl;
+    }
+
+    void
+    MatrixKernels::multiply(const double* a, const double* b, double* c, size_t n, size_t k, size_t m)
+    {
+      std::memset(c, 0, n * m * sizeof(double));
+      multiplyAdd(a, b, c, n, k, m, 1.0);
+    }
+
+    void
+    MatrixKernels::multiplyAdd(const double* a, const double* b, double* c, size_t n, size_t k, size_t m,
+                               double alpha)
+    {
+#if defined(DUNE_USING_BLAS)
+      if (n * k * m >= c_blas_product)
+      {
+        // Row-major c = a * b is column-major c' = b' * a'.
+        int in = (int)n, ik = (int)k, im = (int)m;
+        double one = 1.0;
+        dgemm_("N", "N", &im, &in, &ik, &alpha, b, &im, a, &ik, &one, c, &im);
+        return;
+      }
+#endif
+
+      if (n * k * m <= c_small_product)
+      {
+        for (size_t i = 0; i < n; ++i)
+        {
+          double* ci = c + i * m;
+
+          for (size_t l = 0; l < k; ++l)
+          {
+            double ail = alpha * a[i * k + l];
+            const double* bl = b + l * m;
+            for (size_t j = 0; j < m; ++j)
+              ci[j] += ail * bl[j];
+          }
+        }
+
+        return;
+      }
+
+      AxpyFunction axpy = getSelected().axpy;
+
+      // Blocks of b are reused by all rows of a while in cache.
+      for (size_t l0 = 0; l0 < k; l0 += c_block_rows)
+      {
+        size_t l1 = std::min(k, l0 + c_block_rows);
+
+        for (size_t j0 = 0; j0 < m; j0 += c_block_columns)
+        {
+          size_t len = std::min(m - j0, c_block_columns);
+
+          for (size_t i = 0; i < n; ++i)
+          {
+            const double* ai = a + i * k;
+            double* ci = c + i * m + j0;
+
+            for (size_t l = l0; l < l1; ++l)
+            {
+              if (ai[l] != 0)
+                axpy(ci, b + l * m + j0, alpha * ai[l], len);
+            }
+          }
+        }
+      }
+    }
+
+    void
+    MatrixKernels::multiplyReference(const double* a, const double* b, double* c, size_t n, size_t k, size_t m)
+    {
+      for (size_t i = 0; i < n; i++)
+      {
+        for (size_t l = 0; l < k; l++)
+        {
+          double v = a[i * k + l];
+          const double* b_p = b + l * m;
+          double* c_p = c + i * m;
+
+          for (size_t j = 0; j < m; j++)
+          {
+            if (!l)
+              *c_p = 0;
+            *c_p += v * (*b_p);
+            c_p++;
+            b_p++;
+          }
+        }
+      }
+    }
+
+    void
+    MatrixKernels::multiplyTransposed(const double* a, const double* b, double* c, size_t n, size_t k, size_t m)
+    {
+      std::memset(c, 0, n * m * sizeof(double));
+      multiplyTransposedAdd(a, b, c, n, k, m, 1.0);
+    }
+
+    void
+    MatrixKernels::multiplyTransposedAdd(const double* a, const double* b, double* c, size_t n, size_t k, size_t m,
+                                         double alpha)
+    {
+#if defined(DUNE_USING_BLAS)
+      if (n * k * m >= c_blas_product)
+      {
+        // Row-major c = a * b' is column-major c' = b * a'.
+        int in = (int)n, ik = (int)k, im = (int)m;
+        double one = 1.0;
+        dgemm_("T", "N", &im, &in, &ik, &alpha, b, &ik, a, &ik, &one, c, &im);
+        return;
+      }
+#endif
+
+      DotFunction dot = (n * k * m <= c_small_product) ? dotGeneric : getSelected().dot;
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        for (size_t j = 0; j < m; ++j)
+          c[i * m + j] += alpha * dot(a + i * k, b + j * k, k);
+      }
+    }
+
+#if defined(DUNE_USING_BLAS)
+    //! Transpose a square matrix in place, to switch between row
+    //! and column-major order.
+    static void
+    transposeSquare(double* a, size_t n)
+    {
+      for (size_t i = 0; i < n; ++i)
+      {
+        for (size_t j = i + 1; j < n; ++j)
+          std::swap(a[i * n + j], a[j * n + i]);
+      }
+    }
+#endif
+
+    bool
+    MatrixKernels::factorLU(double* a, size_t* pivots, size_t n, double tolerance)
+    {
+#if defined(DUNE_USING_BLAS)
+      if (n >= c_lapack_dimension)
+      {
+        int in = (int)n;
+        int info = 0;
+        std::vector<int> ipiv(n);
+
+        transposeSquare(a, n);
+        dgetrf_(&in, &in, a, &in, &ipiv[0], &info);
+        transposeSquare(a, n);
+
+        if (info < 0)
+          return false;
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          pivots[i] = (size_t)(ipiv[i] - 1);
+          if (std::fabs(a[i * n + i]) <= tolerance)
+            return false;
+        }
+
+        return true;
+      }
+#endif
+
+      AxpyFunction axpy = getSelected().axpy;
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        size_t p = i;
+        double max = std::fabs(a[i * n + i]);
+        for (size_t r = i + 1; r < n; ++r)
+        {
+          double v = std::fabs(a[r * n + i]);
+          if (v > max)
+          {
+            max = v;
+            p = r;
+          }
+        }
+
+        if (max <= tolerance)
+          return false;
+
+        pivots[i] = p;
+        if (p != i)
+          std::swap_ranges(a + i * n, a + (i + 1) * n, a + p * n);
+
+        const double* ui = a + i * n;
+        for (size_t r = i + 1; r < n; ++r)
+        {
+          double* ar = a + r * n;
+          double f = ar[i] / ui[i];
+          ar[i] = f;
+
+          if (f != 0)
+            axpy(ar + i + 1, ui + i + 1, -f, n - i - 1);
+        }
+      }
+
+      return true;
+    }
+
+    void
+    MatrixKernels::solveLU(const double* lu, const size_t* pivots, double* b, size_t n, size_t m)
+    {
+      AxpyFunction axpy = getSelected().axpy;
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        if (pivots[i] != i)
+          std::swap_ranges(b + i * m, b + (i + 1) * m, b + pivots[i] * m);
+      }
+
+      // Forward substitution (unit lower triangle).
+      for (size_t i = 1; i < n; ++i)
+      {
+        for (size_t r = 0; r < i; ++r)
+        {
+          double f = lu[i * n + r];
+          if (f != 0)
+            axpy(b + i * m, b + r * m, -f, m);
+        }
+      }
+
+      // Back substitution.
+      for (size_t i = n; i-- > 0; )
+      {
+        double* bi = b + i * m;
+        for (size_t r = i + 1; r < n; ++r)
+        {
+          double f = lu[i * n + r];
+          if (f != 0)
+            axpy(bi, b + r * m, -f, m);
+        }
+
+        double d = 1.0 / lu[i * n + i];
+        for (size_t j = 0; j < m; ++j)
+          bi[j] *= d;
+      }
+    }
+
+    bool
+    MatrixKernels::factorCholesky(double* a, size_t n)
+    {
+#if defined(DUNE_USING_BLAS)
+      if (n >= c_lapack_dimension)
+      {
+        // The upper factor of the column-major (transposed) matrix
+        // is the lower factor in row-major order.
+        int in = (int)n;
+        int info = 0;
+        dpotrf_("U", &in, a, &in, &info);
+        if (info != 0)
+          return false;
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          for (size_t j = i + 1; j < n; ++j)
+            a[i * n + j] = 0;
+        }
+
+        return true;
+      }
+#endif
+
+      DotFunction dot = getSelected().dot;
+
+      for (size_t j = 0; j < n; ++j)
+      {
+        double* lj = a + j * n;
+        double d = lj[j] - dot(lj, lj, j);
+        if (!(d > 0))
+          return false;
+
+        d = std::sqrt(d);
+        lj[j] = d;
+
+        for (size_t i = j + 1; i < n; ++i)
+        {
+          double* li = a + i * n;
+          li[j] = (li[j] - dot(li, lj, j)) / d;
+        }
+      }
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        for (size_t j = i + 1; j < n; ++j)
+          a[i * n + j] = 0;
+      }
+
+      return true;
+    }
+
+    void
+    MatrixKernels::solveCholesky(const double* l, double* b, size_t n, size_t m)
+    {
+      AxpyFunction axpy = getSelected().axpy;
+
+      // Solve L * y = b.
+      for (size_t i = 0; i < n; ++i)
+      {
+        double* bi = b + i * m;
+        for (size_t r = 0; r < i; ++r)
+        {
+          double f = l[i * n + r];
+          if (f != 0)
+            axpy(bi, b + r * m, -f, m);
+        }
+
+        double d = 1.0 / l[i * n + i];
+        for (size_t j = 0; j < m; ++j)
+          bi[j] *= d;
+      }
+
+      // Solve L' * x = y.
+      for (size_t i = n; i-- > 0; )
+      {
+        double* bi = b + i * m;
+        for (size_t r = i + 1; r < n; ++r)
+        {
+          double f = l[r * n + i];
+          if (f != 0)
+            axpy(bi, b + r * m, -f, m);
+        }
+
+        double d = 1.0 / l[i * n + i];
+        for (size_t j = 0; j < m; ++j)
+          bi[j] *= d;
+      }
+    }
+
+    const char*
+    MatrixKernels::getImplementation(void)
+    {
+      return getSelected().name;
+    }
+  }
+}
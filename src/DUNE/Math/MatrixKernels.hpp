@@ -0,0 +1,164 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_MATH_MATRIX_KERNELS_HPP_INCLUDED_
+#define DUNE_MATH_MATRIX_KERNELS_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Math
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM MatrixKernels;
+
+    //! Dense linear algebra kernels used by Matrix. Matrices are
+    //! stored in row-major order. Inner loops use the widest SIMD
+    //! instructions supported by the CPU (AVX, SSE2 or NEON), which
+    //! are selected on first use. When DUNE is built with the BLAS
+    //! option, large products and factorizations are delegated to
+    //! the system BLAS/LAPACK libraries.
+    class MatrixKernels
+    {
+    public:
+      //! Compute c = a * b.
+      //! @param[in] a matrix with n x k elements.
+      //! @param[in] b matrix with k x m elements.
+      //! @param[out] c matrix with n x m elements, which must not
+      //! overlap a or b.
+      //! @param[in] n number of rows of a.
+      //! @param[in] k number of columns of a.
+      //! @param[in] m number of columns of b.
+      static void
+      multiply(const double* a, const double* b, double* c, size_t n, size_t k, size_t m);
+
+      //! Compute c = c + alpha * a * b.
+      //! @param[in] a matrix with n x k elements.
+      //! @param[in] b matrix with k x m elements.
+      //! @param[in,out] c matrix with n x m elements, which must not
+      //! overlap a or b.
+      //! @param[in] n number of rows of a.
+      //! @param[in] k number of columns of a.
+      //! @param[in] m number of columns of b.
+      //! @param[in] alpha scale factor of the product.
+      static void
+      multiplyAdd(const double* a, const double* b, double* c, size_t n, size_t k, size_t m, double alpha);
+
+      //! Compute c = a * b using a straightforward loop, which is
+      //! kept as a reference for the optimized kernels.
+      //! @param[in] a matrix with n x k elements.
+      //! @param[in] b matrix with k x m elements.
+      //! @param[out] c matrix with n x m elements.
+      //! @param[in] n number of rows of a.
+      //! @param[in] k number of columns of a.
+      //! @param[in] m number of columns of b.
+      static void
+      multiplyReference(const double* a, const double* b, double* c, size_t n, size_t k, size_t m);
+
+      //! Compute c = a * transpose(b).
+      //! @param[in] a matrix with n x k elements.
+      //! @param[in] b matrix with m x k elements.
+      //! @param[out] c matrix with n x m elements, which must not
+      //! overlap a or b.
+      //! @param[in] n number of rows of a.
+      //! @param[in] k number of columns of a and b.
+      //! @param[in] m number of rows of b.
+      static void
+      multiplyTransposed(const double* a, const double* b, double* c, size_t n, size_t k, size_t m);
+
+      //! Compute c = c + alpha * a * transpose(b).
+      //! @param[in] a matrix with n x k elements.
+      //! @param[in] b matrix with m x k elements.
+      //! @param[in,out] c matrix with n x m elements, which must not
+      //! overlap a or b.
+      //! @param[in] n number of rows of a.
+      //! @param[in] k number of columns of a and b.
+      //! @param[in] m number of rows of b.
+      //! @param[in] alpha scale factor of the product.
+      static void
+      multiplyTransposedAdd(const double* a, const double* b, double* c, size_t n, size_t k, size_t m,
+                            double alpha);
+
+      //! Compute the LU decomposition with partial pivoting
+      //! (P * A = L * U) in place. L is unit lower triangular and
+      //! is stored below the diagonal, U is stored in the upper
+      //! triangle.
+      //! @param[in,out] a matrix with n x n elements.
+      //! @param[out] pivots row swapped with row i at step i, for
+      //! each of the n steps.
+      //! @param[in] n dimension.
+      //! @param[in] tolerance pivots with smaller magnitude are
+      //! considered zero.
+      //! @return false if the matrix is singular, true otherwise.
+      static bool
+      factorLU(double* a, size_t* pivots, size_t n, double tolerance);
+
+      //! Solve a * x = b in place using the output of factorLU().
+      //! @param[in] lu LU decomposition with n x n elements.
+      //! @param[in] pivots pivots of the decomposition.
+      //! @param[in,out] b right-hand side with n x m elements,
+      //! replaced by the solution.
+      //! @param[in] n dimension.
+      //! @param[in] m number of right-hand sides.
+      static void
+      solveLU(const double* lu, const size_t* pivots, double* b, size_t n, size_t m);
+
+      //! Compute the Cholesky decomposition (A = L * L') of a
+      //! symmetric positive definite matrix in place. The upper
+      //! triangle is cleared.
+      //! @param[in,out] a matrix with n x n elements.
+      //! @param[in] n dimension.
+      //! @return false if the matrix is not positive definite, true
+      //! otherwise.
+      static bool
+      factorCholesky(double* a, size_t n);
+
+      //! Solve a * x = b in place using the output of
+      //! factorCholesky().
+      //! @param[in] l Cholesky factor with n x n elements.
+      //! @param[in,out] b right-hand side with n x m elements,
+      //! replaced by the solution.
+      //! @param[in] n dimension.
+      //! @param[in] m number of right-hand sides.
+      static void
+      solveCholesky(const double* l, double* b, size_t n, size_t m);
+
+      //! Retrieve the name of the implementation selected for this
+      //! CPU.
+      //! @return implementation name.
+      static const char*
+      getImplementation(void);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,675 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_MATH_MATRIX_N_HPP_INCLUDED_
+#define DUNE_MATH_MATRIX_N_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <cmath>
+#include <ostream>
+
+// DUNE headers.
+#include <DUNE/Math/Constants.hpp>
+#include <DUNE/Math/Matrix.hpp>
+
+namespace DUNE
+{
+  namespace Math
+  {
+    //! Matrix with dimensions fixed at compile time. Elements are
+    //! stored inline in row-major order, so instances never touch
+    //! the heap and dimension mismatches are compile errors. Loops
+    //! have constant bounds and are unrolled and vectorized by the
+    //! compiler. Element indexes are not checked.
+    //! @tparam R number of rows.
+    //! @tparam C number of columns.
+    template <size_t R, size_t C>
+    class MatrixN
+    {
+    public:
+      //! Constructor.
+      //! Construct a matrix filled with zeros.
+      MatrixN(void)
+      {
+        fill(0.0);
+      }
+
+      //! Constructor.
+      //! Construct a matrix filled with a constant value.
+      //! @param[in] value value used to initialize elements.
+      explicit MatrixN(double value)
+      {
+        fill(value);
+      }
+
+      //! Constructor.
+      //! Construct a matrix from row-major data.
+      //! @param[in] data pointer to R * C values.
+      explicit MatrixN(const double* data)
+      {
+        for (size_t i = 0; i < R * C; ++i)
+          m_data[i] = data[i];
+      }
+
+      //! Constructor.
+      //! Construct a matrix from a dynamic matrix.
+      //! @param[in] m matrix with R rows and C columns.
+      //! @throw Matrix::Error if the dimensions do not match.
+      explicit MatrixN(const Matrix& m)
+      {
+        set(m);
+      }
+
+      //! Construct an identity matrix.
+      //! @return identity matrix.
+      static MatrixN
+      identity(void)
+      {
+        MatrixN m;
+        for (size_t i = 0; i < R && i < C; ++i)
+          m(i, i) = 1.0;
+        return m;
+      }
+
+      //! Retrieve the number of rows of the matrix.
+      //! @return number of rows.
+      static size_t
+      rows(void)
+      {
+        return R;
+      }
+
+      //! Retrieve the number of columns of the matrix.
+      //! @return number of columns.
+      static size_t
+      columns(void)
+      {
+        return C;
+      }
+
+      //! Retrieve the number of elements of the matrix.
+      //! @return number of elements.
+      static size_t
+      size(void)
+      {
+        return R * C;
+      }
+
+      //! Pointer to first element.
+      double*
+      begin(void)
+      {
+        return m_data;
+      }
+
+      //! Pointer to element after last element.
+      double*
+      end(void)
+      {
+        return m_data + R * C;
+      }
+
+      //! Const pointer to first element.
+      const double*
+      begin(void) const
+      {
+        return m_data;
+      }
+
+      //! Const pointer to element after last element.
+      const double*
+      end(void) const
+      {
+        return m_data + R * C;
+      }
+
+      //! Fill the matrix with a constant value.
+      //! @param[in] value value.
+      void
+      fill(double value)
+      {
+        for (size_t i = 0; i < R * C; ++i)
+          m_data[i] = value;
+      }
+
+      //! Copy the elements of a dynamic matrix.
+      //! @param[in] m matrix with R rows and C columns.
+      //! @throw Matrix::Error if the dimensions do not match.
+      void
+      set(const Matrix& m)
+      {
+        if ((size_t)m.rows() != R || (size_t)m.columns() != C)
+          throw Matrix::Error("invalid dimensions for fixed-size matrix!");
+
+        const double* src = m.begin();
+        for (size_t i = 0; i < R * C; ++i)
+          m_data[i] = src[i];
+      }
+
+      //! Convert to a dynamic matrix.
+      //! @return matrix with R rows and C columns.
+      Matrix
+      toMatrix(void) const
+      {
+        return Matrix(m_data, R, C);
+      }
+
+      //! Extract a block of the matrix.
+      //! @tparam BR number of rows of the block.
+      //! @tparam BC number of columns of the block.
+      //! @param[in] i row of the first element of the block.
+      //! @param[in] j column of the first element of the block.
+      //! @return block.
+      template <size_t BR, size_t BC>
+      MatrixN<BR, BC>
+      get(size_t i, size_t j) const
+      {
+        MatrixN<BR, BC> b;
+        for (size_t r = 0; r < BR; ++r)
+          for (size_t c = 0; c < BC; ++c)
+            b(r, c) = (*this)(i + r, j + c);
+        return b;
+      }
+
+      //! Replace a block of the matrix.
+      //! @param[in] i row of the first element of the block.
+      //! @param[in] j column of the first element of the block.
+      //! @param[in] b block.
+      template <size_t BR, size_t BC>
+      void
+      put(size_t i, size_t j, const MatrixN<BR, BC>& b)
+      {
+        for (size_t r = 0; r < BR; ++r)
+          for (size_t c = 0; c < BC; ++c)
+            (*this)(i + r, j + c) = b(r, c);
+      }
+
+      //! Access an element.
+      //! @param[in] i row.
+      //! @param[in] j column.
+      //! @return reference to the element.
+      double&
+      operator()(size_t i, size_t j)
+      {
+        return m_data[i * C + j];
+      }
+
+      //! Access an element.
+      //! @param[in] i row.
+      //! @param[in] j column.
+      //! @return element.
+      double
+      operator()(size_t i, size_t j) const
+      {
+        return m_data[i * C + j];
+      }
+
+      //! Access an element in row-major order.
+      //! @param[in] i index.
+      //! @return reference to the element.
+      double&
+      operator()(size_t i)
+      {
+        return m_data[i];
+      }
+
+      //! Access an element in row-major order.
+      //! @param[in] i index.
+      //! @return element.
+      double
+      operator()(size_t i) const
+      {
+        return m_data[i];
+      }
+
+      //! Compare with another matrix using the precision of
+      //! Matrix::get_precision().
+      //! @param[in] m matrix.
+      //! @return true if all elements are equal, false otherwise.
+      bool
+      operator==(const MatrixN& m) const
+      {
+        double p = Matrix::get_precision();
+        for (size_t i = 0; i < R * C; ++i)
+        {
+          if (std::fabs(m_data[i] - m.m_data[i]) > p)
+            return false;
+        }
+        return true;
+      }
+
+      MatrixN&
+      operator+=(const MatrixN& m)
+      {
+        for (size_t i = 0; i < R * C; ++i)
+          m_data[i] += m.m_data[i];
+        return *this;
+      }
+
+      MatrixN&
+      operator-=(const MatrixN& m)
+      {
+        for (size_t i = 0; i < R * C; ++i)
+          m_data[i] -= m.m_data[i];
+        return *this;
+      }
+
+      MatrixN&
+      operator*=(double x)
+      {
+        for (size_t i = 0; i < R * C; ++i)
+          m_data[i] *= x;
+        return *this;
+      }
+
+      MatrixN&
+      operator/=(double x)
+      {
+        for (size_t i = 0; i < R * C; ++i)
+          m_data[i] /= x;
+        return *this;
+      }
+
+      MatrixN
+      operator-(void) const
+      {
+        MatrixN m;
+        for (size_t i = 0; i < R * C; ++i)
+          m.m_data[i] = -m_data[i];
+        return m;
+      }
+
+      //! Compute the trace of the matrix.
+      //! @return sum of the diagonal elements.
+      double
+      trace(void) const
+      {
+        double t = 0;
+        for (size_t i = 0; i < R && i < C; ++i)
+          t += (*this)(i, i);
+        return t;
+      }
+
+      //! Compute the Frobenius norm of the matrix.
+      //! @return square root of the sum of squared elements.
+      double
+      norm_2(void) const
+      {
+        double n = 0;
+        for (size_t i = 0; i < R * C; ++i)
+          n += m_data[i] * m_data[i];
+        return std::sqrt(n);
+      }
+
+    private:
+      //! Elements in row-major order.
+      double m_data[R * C];
+    };
+
+    //! Column vector with dimension fixed at compile time.
+    //! @tparam N number of elements.
+    template <size_t N>
+    class VectorN: public MatrixN<N, 1>
+    {
+    public:
+      //! Constructor.
+      //! Construct a vector filled with zeros.
+      VectorN(void)
+      { }
+
+      //! Constructor.
+      //! Construct a vector filled with a constant value.
+      //! @param[in] value value used to initialize elements.
+      explicit VectorN(double value):
+        MatrixN<N, 1>(value)
+      { }
+
+      //! Constructor.
+      //! @param[in] data pointer to N values.
+      explicit VectorN(const double* data):
+        MatrixN<N, 1>(data)
+      { }
+
+      //! Constructor.
+      //! @param[in] m dynamic matrix with N elements.
+      //! @throw Matrix::Error if the dimensions do not match.
+      explicit VectorN(const Matrix& m):
+        MatrixN<N, 1>(m)
+      { }
+
+      //! Constructor.
+      //! Convert from a single column matrix, which makes results
+      //! of matrix operations assignable to vectors.
+      //! @param[in] m single column matrix.
+      VectorN(const MatrixN<N, 1>& m):
+        MatrixN<N, 1>(m)
+      { }
+    };
+
+    template <size_t R, size_t C>
+    inline MatrixN<R, C>
+    operator+(const MatrixN<R, C>& a, const MatrixN<R, C>& b)
+    {
+      MatrixN<R, C> m(a);
+      return m += b;
+    }
+
+    template <size_t R, size_t C>
+    inline MatrixN<R, C>
+    operator-(const MatrixN<R, C>& a, const MatrixN<R, C>& b)
+    {
+      MatrixN<R, C> m(a);
+      return m -= b;
+    }
+
+    template <size_t R, size_t C>
+    inline MatrixN<R, C>
+    operator*(const MatrixN<R, C>& a, double x)
+    {
+      MatrixN<R, C> m(a);
+      return m *= x;
+    }
+
+    template <size_t R, size_t C>
+    inline MatrixN<R, C>
+    operator*(double x, const MatrixN<R, C>& a)
+    {
+      MatrixN<R, C> m(a);
+      return m *= x;
+    }
+
+    template <size_t R, size_t C>
+    inline MatrixN<R, C>
+    operator/(const MatrixN<R, C>& a, double x)
+    {
+      MatrixN<R, C> m(a);
+      return m /= x;
+    }
+
+    //! Matrix product. The inner loop runs along rows of both the
+    //! right operand and the result, which keeps accesses
+    //! sequential.
+    template <size_t R, size_t K, size_t C>
+    inline MatrixN<R, C>
+    operator*(const MatrixN<R, K>& a, const MatrixN<K, C>& b)
+    {
+      MatrixN<R, C> m;
+      for (size_t i = 0; i < R; ++i)
+      {
+        for (size_t k = 0; k < K; ++k)
+        {
+          double aik = a(i, k);
+          for (size_t j = 0; j < C; ++j)
+            m(i, j) += aik * b(k, j);
+        }
+      }
+      return m;
+    }
+
+    template <size_t R, size_t C>
+    inline MatrixN<C, R>
+    transpose(const MatrixN<R, C>& a)
+    {
+      MatrixN<C, R> m;
+      for (size_t i = 0; i < R; ++i)
+        for (size_t j = 0; j < C; ++j)
+          m(j, i) = a(i, j);
+      return m;
+    }
+
+    //! Compute a * b * transpose(a) without forming the transpose,
+    //! as used to propagate covariances.
+    //! @param[in] a transformation.
+    //! @param[in] b square matrix.
+    //! @return a * b * transpose(a).
+    template <size_t R, size_t C>
+    inline MatrixN<R, R>
+    transform(const MatrixN<R, C>& a, const MatrixN<C, C>& b)
+    {
+      MatrixN<R, C> ab = a * b;
+      MatrixN<R, R> m;
+      for (size_t i = 0; i < R; ++i)
+      {
+        for (size_t j = 0; j < R; ++j)
+        {
+          double v = 0;
+          for (size_t k = 0; k < C; ++k)
+            v += ab(i, k) * a(j, k);
+          m(i, j) = v;
+        }
+      }
+      return m;
+    }
+
+    template <size_t N>
+    inline double
+    dot(const MatrixN<N, 1>& a, const MatrixN<N, 1>& b)
+    {
+      double v = 0;
+      for (size_t i = 0; i < N; ++i)
+        v += a(i) * b(i);
+      return v;
+    }
+
+    inline VectorN<3>
+    cross(const MatrixN<3, 1>& a, const MatrixN<3, 1>& b)
+    {
+      VectorN<3> v;
+      v(0) = a(1) * b(2) - a(2) * b(1);
+      v(1) = a(2) * b(0) - a(0) * b(2);
+      v(2) = a(0) * b(1) - a(1) * b(0);
+      return v;
+    }
+
+    inline MatrixN<3, 3>
+    skew(const MatrixN<3, 1>& a)
+    {
+      MatrixN<3, 3> m;
+      m(0, 1) = -a(2);
+      m(0, 2) = a(1);
+      m(1, 0) = a(2);
+      m(1, 2) = -a(0);
+      m(2, 0) = -a(1);
+      m(2, 1) = a(0);
+      return m;
+    }
+
+    //! Convert Euler angles (roll, pitch, yaw) to a direction
+    //! cosine matrix, as Matrix::toDCM().
+    //! @param[in] ea Euler angles.
+    //! @return direction cosine matrix.
+    inline MatrixN<3, 3>
+    toDCM(const VectorN<3>& ea)
+    {
+      double cr = std::cos(ea(0));
+      double sr = std::sin(ea(0));
+      double cp = std::cos(ea(1));
+      double sp = std::sin(ea(1));
+      double cy = std::cos(ea(2));
+      double sy = std::sin(ea(2));
+
+      double v[9] =
+      {
+        cp * cy, sr * sp * cy - cr * sy, cr * sp * cy + sr * sy,
+        cp * sy, sr * sp * sy + cr * cy, cr * sp * sy - sr * cy,
+        -sp, sr * cp, cr * cp
+      };
+
+      return MatrixN<3, 3>(v);
+    }
+
+    //! Convert a quaternion (scalar first) to a direction cosine
+    //! matrix, as Matrix::toDCM().
+    //! @param[in] q quaternion.
+    //! @return direction cosine matrix.
+    inline MatrixN<3, 3>
+    toDCM(const VectorN<4>& q)
+    {
+      double v[9] =
+      {
+        q(0) * q(0) + q(1) * q(1) - q(2) * q(2) - q(3) * q(3),
+        2 * (q(1) * q(2) - q(0) * q(3)),
+        2 * (q(1) * q(3) + q(0) * q(2)),
+        2 * (q(1) * q(2) + q(0) * q(3)),
+        q(0) * q(0) - q(1) * q(1) + q(2) * q(2) - q(3) * q(3),
+        2 * (q(2) * q(3) - q(0) * q(1)),
+        2 * (q(1) * q(3) - q(0) * q(2)),
+        2 * (q(2) * q(3) + q(0) * q(1)),
+        q(0) * q(0) - q(1) * q(1) - q(2) * q(2) + q(3) * q(3)
+      };
+
+      return MatrixN<3, 3>(v);
+    }
+
+    //! Convert Euler angles (roll, pitch, yaw) to a quaternion
+    //! (scalar first), as Matrix::toQuaternion().
+    //! @param[in] ea Euler angles.
+    //! @return quaternion.
+    inline VectorN<4>
+    toQuaternion(const VectorN<3>& ea)
+    {
+      double cr = std::cos(ea(0) / 2);
+      double sr = std::sin(ea(0) / 2);
+      double cp = std::cos(ea(1) / 2);
+      double sp = std::sin(ea(1) / 2);
+      double cy = std::cos(ea(2) / 2);
+      double sy = std::sin(ea(2) / 2);
+
+      double q[4] = {cr * cp * cy + sr * sp * sy,
+                     sr * cp * cy - cr * sp * sy,
+                     cr * sp * cy + sr * cp * sy,
+                     cr * cp * sy - sr * sp * cy};
+
+      return VectorN<4>(q);
+    }
+
+    //! Convert a direction cosine matrix to a quaternion (scalar
+    //! first). Unlike Matrix::toQuaternion(), the result uses the
+    //! same convention as toDCM(), so conversions round trip, and
+    //! the largest component is used as pivot to stay accurate for
+    //! any rotation.
+    //! @param[in] dcm direction cosine matrix.
+    //! @return quaternion.
+    inline VectorN<4>
+    toQuaternion(const MatrixN<3, 3>& dcm)
+    {
+      double t = dcm.trace();
+      VectorN<4> q;
+
+      if (t > dcm(0, 0) && t > dcm(1, 1) && t > dcm(2, 2))
+      {
+        double s = 2 * std::sqrt(1 + t);
+        q(0) = s / 4;
+        q(1) = (dcm(2, 1) - dcm(1, 2)) / s;
+        q(2) = (dcm(0, 2) - dcm(2, 0)) / s;
+        q(3) = (dcm(1, 0) - dcm(0, 1)) / s;
+      }
+      else if (dcm(0, 0) > dcm(1, 1) && dcm(0, 0) > dcm(2, 2))
+      {
+        double s = 2 * std::sqrt(1 + dcm(0, 0) - dcm(1, 1) - dcm(2, 2));
+        q(0) = (dcm(2, 1) - dcm(1, 2)) / s;
+        q(1) = s / 4;
+        q(2) = (dcm(0, 1) + dcm(1, 0)) / s;
+        q(3) = (dcm(0, 2) + dcm(2, 0)) / s;
+      }
+      else if (dcm(1, 1) > dcm(2, 2))
+      {
+        double s = 2 * std::sqrt(1 + dcm(1, 1) - dcm(0, 0) - dcm(2, 2));
+        q(0) = (dcm(0, 2) - dcm(2, 0)) / s;
+        q(1) = (dcm(0, 1) + dcm(1, 0)) / s;
+        q(2) = s / 4;
+        q(3) = (dcm(1, 2) + dcm(2, 1)) / s;
+      }
+      else
+      {
+        double s = 2 * std::sqrt(1 + dcm(2, 2) - dcm(0, 0) - dcm(1, 1));
+        q(0) = (dcm(1, 0) - dcm(0, 1)) / s;
+        q(1) = (dcm(0, 2) + dcm(2, 0)) / s;
+        q(2) = (dcm(1, 2) + dcm(2, 1)) / s;
+        q(3) = s / 4;
+      }
+
+      if (q(0) < 0)
+        q *= -1.0;
+
+      return q;
+    }
+
+    //! Convert a direction cosine matrix to Euler angles (roll,
+    //! pitch, yaw), as Matrix::toEulerAngles().
+    //! @param[in] dcm direction cosine matrix.
+    //! @return Euler angles.
+    inline VectorN<3>
+    toEulerAngles(const MatrixN<3, 3>& dcm)
+    {
+      double k = dcm(2, 0);
+      double ea[3] =
+      {
+        std::atan2(dcm(2, 1), dcm(2, 2)),
+        -std::atan(k / std::sqrt(1 - k * k)),
+        std::atan2(dcm(1, 0), dcm(0, 0))
+      };
+
+      return VectorN<3>(ea);
+    }
+
+    //! Convert a quaternion (scalar first) to Euler angles (roll,
+    //! pitch, yaw), as Matrix::toEulerAngles().
+    //! @param[in] q quaternion, which need not be normalized.
+    //! @return Euler angles.
+    inline VectorN<3>
+    toEulerAngles(const VectorN<4>& q)
+    {
+      VectorN<4> n = q / q.norm_2();
+
+      double roll = std::atan2(2 * (n(0) * n(1) + n(2) * n(3)),
+                               1 - 2 * (n(1) * n(1) + n(2) * n(2)));
+
+      double pitch = 2 * (n(0) * n(2) - n(3) * n(1));
+      if (std::fabs(pitch) >= 1)
+        pitch = c_half_pi * pitch / std::fabs(pitch);
+      else
+        pitch = std::asin(pitch);
+
+      double yaw = std::atan2(2 * (n(0) * n(3) + n(1) * n(2)),
+                              1 - 2 * (n(2) * n(2) + n(3) * n(3)));
+
+      double ea[3] = {roll, pitch, yaw};
+      return VectorN<3>(ea);
+    }
+
+    template <size_t R, size_t C>
+    inline std::ostream&
+    operator<<(std::ostream& os, const MatrixN<R, C>& a)
+    {
+      return os << a.toMatrix();
+    }
+  }
+}
+
+#endif
@@ -235,6 +235,10 @@ namespace DUNE
                         | IMC::WaterVelocity::VAL_VEL_Y
                         | IMC::WaterVelocity::VAL_VEL_Z;
 
+      // Measurement noise is diagonal, update without allocations.
+      m_kal.setUpdateMethod(KalmanFilter::UPDATE_SEQUENTIAL);
+      m_kal.setJosephForm(true);
+
       // Register callbacks.
       bind<IMC::Acceleration>(this);
       bind<IMC::AngularVelocity>(this);
@@ -1215,21 +1219,20 @@ namespace DUNE
     void
     BasicNavigation::extractEarthRotation(double& p, double& q, double& r)
     {
-      // Insert euler angles into row matrix.
-      Math::Matrix ea(3,1);
+      // Insert euler angles into column vector.
+      Math::VectorN<3> ea;
       ea(0) = Math::Angles::normalizeRadian(getEuler(AXIS_X));
       ea(1) = Math::Angles::normalizeRadian(getEuler(AXIS_Y));
       ea(2) = Math::Angles::normalizeRadian(getEuler(AXIS_Z));
 
       // Earth rotation vector.
-      Math::Matrix we(3,1);
+      Math::VectorN<3> we;
       we(0) = Math::c_earth_rotation * std::cos(m_last_lat);
       we(1) = 0.0;
       we(2) = - Math::c_earth_rotation * std::sin(m_last_lat);
 
       // Sensed angular velocities due to Earth rotation effect.
-      Math::Matrix av(3,1);
-      av = transpose(ea.toDCM()) * we;
+      Math::VectorN<3> av = transpose(toDCM(ea)) * we;
 
       // Extract from angular velocities measurements.
       p -= av(0);
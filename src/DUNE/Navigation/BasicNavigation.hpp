@@ -42,6 +42,7 @@
 #include <DUNE/Memory.hpp>
 #include <DUNE/Math/Angles.hpp>
 #include <DUNE/Math/Derivative.hpp>
+#include <DUNE/Math/MatrixN.hpp>
 #include <DUNE/Math/MovingAverage.hpp>
 #include <DUNE/Navigation/KalmanFilter.hpp>
 #include <DUNE/Navigation/Ranging.hpp>
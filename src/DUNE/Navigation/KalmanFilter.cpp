@@ -29,21 +29,62 @@
 //***************************************************************************
 
 // DUNE headers.
+#include <DUNE/Math/MatrixKernels.hpp>
 #include <DUNE/Navigation/KalmanFilter.hpp>
 
 namespace DUNE
 {
   namespace Navigation
   {
-    KalmanFilter::KalmanFilter(void)
+    //! Get a writable pointer to the elements of a matrix, detaching
+    //! it from other matrices sharing the same data.
+    static double*
+    data(Math::Matrix& m)
+    {
+      return &m(0, 0);
+    }
+
+    //! Solve l * y = v in place, where l is lower triangular.
+    static void
+    solveLower(const double* l, double* v, size_t n)
+    {
+      for (size_t i = 0; i < n; ++i)
+      {
+        double x = v[i];
+        for (size_t k = 0; k < i; ++k)
+          x -= l[i * n + k] * v[k];
+        v[i] = x / l[i * n + i];
+      }
+    }
+
+    //! Solve transpose(l) * y = v in place, where l is lower
+    //! triangular.
+    static void
+    solveUpper(const double* l, double* v, size_t n)
+    {
+      for (size_t i = n; i-- > 0; )
+      {
+        double x = v[i];
+        for (size_t k = i + 1; k < n; ++k)
+          x -= l[k * n + i] * v[k];
+        v[i] = x / l[i * n + i];
+      }
+    }
+
+    KalmanFilter::KalmanFilter(void):
+      m_method(UPDATE_INVERSE),
+      m_joseph(false)
     {
       m_state_count = 1;
       Math::Matrix I(1);
       I(0) = 0;
       m_x = m_y = m_ax = m_ap = m_c = m_p = m_q = m_r = m_innov = I;
+      resizeWorkspaces();
     }
 
-    KalmanFilter::KalmanFilter(Math::Matrix& A, Math::Matrix& C, Math::Matrix& P, Math::Matrix& Q)
+    KalmanFilter::KalmanFilter(Math::Matrix& A, Math::Matrix& C, Math::Matrix& P, Math::Matrix& Q):
+      m_method(UPDATE_INVERSE),
+      m_joseph(false)
     {
       m_ax = A;
       m_ap = A;
@@ -52,6 +93,26 @@ namespace DUNE
       m_q = Q;
       m_state_count = m_ax.rows();
       m_x.resizeAndFill(m_state_count, 1, 0.0);
+      resizeWorkspaces();
+    }
+
+    void
+    KalmanFilter::resizeWorkspaces(void)
+    {
+      size_t n = m_state_count;
+      size_t m = m_c.rows();
+
+      m_ws_nn.resizeAndFill(n, n, 0.0);
+      m_ws_nn2.resizeAndFill(n, n, 0.0);
+      m_ws_n.resizeAndFill(3, n, 0.0);
+
+      if (m == 0)
+        return;
+
+      m_ws_nm.resizeAndFill(n, m, 0.0);
+      m_ws_k.resizeAndFill(n, m, 0.0);
+      m_ws_mm.resizeAndFill(m, m, 0.0);
+      m_ws_m.resizeAndFill(m, 1, 0.0);
     }
 
     void
@@ -70,6 +131,8 @@ namespace DUNE
 
       m_ax.identity();
       m_ap.identity();
+
+      resizeWorkspaces();
     }
 
     bool
@@ -82,6 +145,7 @@ namespace DUNE
         m_c.resizeAndKeep(num_outputs, num_states);
         m_r.resizeAndKeep(num_outputs, num_outputs);
         m_innov.resizeAndKeep(num_outputs, 1);
+        resizeWorkspaces();
         return true;
       }
       else
@@ -104,7 +168,18 @@ namespace DUNE
     void
     KalmanFilter::normalize(void)
     {
-      m_p = 0.5 * (m_p + transpose(m_p));
+      size_t n = m_state_count;
+      double* p = data(m_p);
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        for (size_t j = i + 1; j < n; ++j)
+        {
+          double v = 0.5 * (p[i * n + j] + p[j * n + i]);
+          p[i * n + j] = v;
+          p[j * n + i] = v;
+        }
+      }
     }
 
     void
@@ -113,15 +188,45 @@ namespace DUNE
       if (u.rows() != b.columns() || u.columns() != 1)
         throw std::runtime_error(DTR("invalid dimensions"));
 
-      m_x = m_ax * m_x + b * u;
-      m_p = m_ap * m_p * transpose(m_ap) + m_q;
+      if ((size_t)b.rows() != m_state_count)
+        throw std::runtime_error(DTR("invalid dimensions"));
+
+      predict();
+
+      size_t n = m_state_count;
+      size_t l = u.rows();
+      const double* pb = b.begin();
+      const double* pu = u.begin();
+      double* x = data(m_x);
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        for (size_t j = 0; j < l; ++j)
+          x[i] += pb[i * l + j] * pu[j];
+      }
     }
 
     void
     KalmanFilter::predict(void)
     {
-      m_x = m_ax * m_x;
-      m_p = m_ap * m_p * transpose(m_ap) + m_q;
+      size_t n = m_state_count;
+
+      // State prediction.
+      double* t = data(m_ws_n);
+      Math::MatrixKernels::multiply(m_ax.begin(), m_x.begin(), t, n, n, 1);
+      double* x = data(m_x);
+      for (size_t i = 0; i < n; ++i)
+        x[i] = t[i];
+
+      // Covariance prediction, A * P * A' + Q.
+      double* ap = data(m_ws_nn);
+      Math::MatrixKernels::multiply(m_ap.begin(), m_p.begin(), ap, n, n, n);
+      double* p = data(m_p);
+      Math::MatrixKernels::multiplyTransposed(ap, m_ap.begin(), p, n, n, n);
+
+      const double* q = m_q.begin();
+      for (size_t i = 0; i < n * n; ++i)
+        p[i] += q[i];
     }
 
     int
@@ -139,6 +244,12 @@ namespace DUNE
       if (m_r.rows() != m_r.columns() || m_r.rows() != m_innov.rows())
         throw std::runtime_error(DTR("invalid dimensions"));
 
+      if (m_method == UPDATE_SEQUENTIAL)
+        return updateSequential(threshold);
+
+      if (m_method == UPDATE_CHOLESKY)
+        return updateCholesky(threshold);
+
       // Measurement prediction covariance.
       Math::Matrix S = (m_c * m_p * transpose(m_c)) + m_r;
       Math::Matrix S_1;
@@ -175,6 +286,243 @@ namespace DUNE
       return 0;
     }
 
+    void
+    KalmanFilter::factorInnovationCovariance(void)
+    {
+      size_t n = m_state_count;
+      size_t m = m_innov.rows();
+
+      // P * C', which is also transpose(C * P).
+      double* pct = data(m_ws_nm);
+      Math::MatrixKernels::multiplyTransposed(m_p.begin(), m_c.begin(), pct, n, n, m);
+
+      // Measurement prediction covariance, C * P * C' + R.
+      double* s = data(m_ws_mm);
+      const double* c = m_c.begin();
+      const double* r = m_r.begin();
+      for (size_t i = 0; i < m; ++i)
+      {
+        for (size_t j = 0; j < m; ++j)
+        {
+          double v = r[i * m + j];
+          for (size_t k = 0; k < n; ++k)
+            v += c[i * n + k] * pct[k * m + j];
+          s[i * m + j] = v;
+        }
+      }
+
+      if (!Math::MatrixKernels::factorCholesky(s, m))
+        throw std::runtime_error(DTR("matrix inversion error"));
+    }
+
+    bool
+    KalmanFilter::rejectInnovation(float threshold)
+    {
+      // Set threshold to 0 to accept everything.
+      if (threshold == 0)
+        return false;
+
+      size_t m = m_innov.rows();
+      double* y = data(m_ws_m);
+      const double* innov = m_innov.begin();
+      for (size_t i = 0; i < m; ++i)
+        y[i] = innov[i];
+
+      // innov' * inv(S) * innov = |inv(L) * innov|^2.
+      solveLower(m_ws_mm.begin(), y, m);
+
+      double level = 0;
+      for (size_t i = 0; i < m; ++i)
+        level += y[i] * y[i];
+
+      return level >= threshold;
+    }
+
+    int
+    KalmanFilter::updateCholesky(float threshold)
+    {
+      size_t n = m_state_count;
+      size_t m = m_innov.rows();
+
+      factorInnovationCovariance();
+
+      if (rejectInnovation(threshold))
+        return -1;
+
+      const double* l = m_ws_mm.begin();
+      const double* pct = m_ws_nm.begin();
+      const double* innov = m_innov.begin();
+
+      // Kalman Gain, each row solves S * k' = (P * C')'.
+      double* k = data(m_ws_k);
+      for (size_t i = 0; i < n; ++i)
+      {
+        double* ki = k + i * m;
+        for (size_t j = 0; j < m; ++j)
+          ki[j] = pct[i * m + j];
+
+        solveLower(l, ki, m);
+        solveUpper(l, ki, m);
+      }
+
+      // State update.
+      double* x = data(m_x);
+      for (size_t i = 0; i < n; ++i)
+      {
+        for (size_t j = 0; j < m; ++j)
+          x[i] += k[i * m + j] * innov[j];
+      }
+
+      double* p = data(m_p);
+
+      if (!m_joseph)
+      {
+        // State Covariance update, P - K * C * P.
+        for (size_t i = 0; i < n; ++i)
+        {
+          for (size_t j = 0; j < n; ++j)
+          {
+            double v = 0;
+            for (size_t t = 0; t < m; ++t)
+              v += k[i * m + t] * pct[j * m + t];
+            p[i * n + j] -= v;
+          }
+        }
+
+        return 0;
+      }
+
+      // Joseph form, (I - K * C) * P * (I - K * C)' + K * R * K'.
+      double* w = data(m_ws_nn);
+      Math::MatrixKernels::multiply(k, m_c.begin(), w, n, m, n);
+      for (size_t i = 0; i < n * n; ++i)
+        w[i] = -w[i];
+      for (size_t i = 0; i < n; ++i)
+        w[i * n + i] += 1.0;
+
+      double* wp = data(m_ws_nn2);
+      Math::MatrixKernels::multiply(w, p, wp, n, n, n);
+      Math::MatrixKernels::multiplyTransposed(wp, w, p, n, n, n);
+
+      double* kr = data(m_ws_nm);
+      Math::MatrixKernels::multiply(k, m_r.begin(), kr, n, m, m);
+      for (size_t i = 0; i < n; ++i)
+      {
+        for (size_t j = 0; j < n; ++j)
+        {
+          double v = 0;
+          for (size_t t = 0; t < m; ++t)
+            v += kr[i * m + t] * k[j * m + t];
+          p[i * n + j] += v;
+        }
+      }
+
+      return 0;
+    }
+
+    int
+    KalmanFilter::updateSequential(float threshold)
+    {
+      size_t n = m_state_count;
+      size_t m = m_innov.rows();
+      const double* r = m_r.begin();
+
+      for (size_t i = 0; i < m; ++i)
+      {
+        for (size_t j = 0; j < m; ++j)
+        {
+          if (i != j && r[i * m + j] != 0)
+            return updateCholesky(threshold);
+        }
+      }
+
+      // The innovation test needs the joint innovation covariance.
+      if (threshold != 0)
+      {
+        factorInnovationCovariance();
+
+        if (rejectInnovation(threshold))
+          return -1;
+      }
+
+      double* ws = data(m_ws_n);
+      double* pc = ws;
+      double* k = ws + n;
+      double* dx = ws + 2 * n;
+      for (size_t i = 0; i < n; ++i)
+        dx[i] = 0;
+
+      const double* c = m_c.begin();
+      const double* innov = m_innov.begin();
+      double* x = data(m_x);
+      double* p = data(m_p);
+
+      for (size_t j = 0; j < m; ++j)
+      {
+        const double* cj = c + j * n;
+
+        // P * c', skipping unobserved states.
+        bool observed = false;
+        for (size_t i = 0; i < n; ++i)
+          pc[i] = 0;
+
+        for (size_t t = 0; t < n; ++t)
+        {
+          if (cj[t] == 0)
+            continue;
+
+          observed = true;
+          for (size_t i = 0; i < n; ++i)
+            pc[i] += p[i * n + t] * cj[t];
+        }
+
+        if (!observed)
+          continue;
+
+        double s = r[j * m + j];
+        double e = innov[j];
+        for (size_t t = 0; t < n; ++t)
+        {
+          s += cj[t] * pc[t];
+          e -= cj[t] * dx[t];
+        }
+
+        if (!(s > 0))
+          throw std::runtime_error(DTR("matrix inversion error"));
+
+        // Kalman Gain and state update. The innovation is corrected
+        // by the updates of previous measurements.
+        for (size_t i = 0; i < n; ++i)
+        {
+          k[i] = pc[i] / s;
+          x[i] += k[i] * e;
+          dx[i] += k[i] * e;
+        }
+
+        // State Covariance update. The Joseph form reduces to
+        // P - k * c * P - P * c' * k' + s * k * k', which is
+        // symmetric by construction.
+        if (m_joseph)
+        {
+          for (size_t i = 0; i < n; ++i)
+          {
+            for (size_t t = 0; t < n; ++t)
+              p[i * n + t] += s * k[i] * k[t] - k[i] * pc[t] - pc[i] * k[t];
+          }
+        }
+        else
+        {
+          for (size_t i = 0; i < n; ++i)
+          {
+            for (size_t t = 0; t < n; ++t)
+              p[i * n + t] -= k[i] * pc[t];
+          }
+        }
+      }
+
+      return 0;
+    }
+
     void
     KalmanFilter::setState(short pos, double value)
     {
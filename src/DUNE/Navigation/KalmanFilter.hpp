@@ -61,6 +61,20 @@ namespace DUNE
     class KalmanFilter
     {
     public:
+      //! Methods used by update() to incorporate measurements.
+      enum UpdateMethod
+      {
+        //! Explicit inverse of the innovation covariance.
+        UPDATE_INVERSE,
+        //! Cholesky factorization of the innovation covariance,
+        //! using preallocated workspaces.
+        UPDATE_CHOLESKY,
+        //! One scalar update per measurement, using preallocated
+        //! workspaces. Requires a diagonal measurement noise
+        //! covariance matrix, otherwise UPDATE_CHOLESKY is used.
+        UPDATE_SEQUENTIAL
+      };
+
       //! Constructor.
       KalmanFilter(void);
 
@@ -109,6 +123,27 @@ namespace DUNE
       int
       update(float threshold);
 
+      //! Select the method used by update(). Unlike UPDATE_INVERSE,
+      //! the other methods do not allocate memory once the filter
+      //! has been sized with reset() or resize().
+      //! @param method update method.
+      void
+      setUpdateMethod(UpdateMethod method)
+      {
+        m_method = method;
+      }
+
+      //! Use the Joseph form of the covariance update, which keeps
+      //! the state covariance symmetric and positive definite in the
+      //! presence of rounding errors. Does not apply to
+      //! UPDATE_INVERSE.
+      //! @param enable true to use the Joseph form, false otherwise.
+      void
+      setJosephForm(bool enable)
+      {
+        m_joseph = enable;
+      }
+
       //! Get filter state value.
       //! @param pos matrix index.
       //! @return state matrix value.
@@ -361,6 +396,56 @@ namespace DUNE
       Math::Matrix m_r;
       //! Innovation vector.
       Math::Matrix m_innov;
+      //! Update method.
+      UpdateMethod m_method;
+      //! True to use the Joseph form of the covariance update.
+      bool m_joseph;
+      //! Workspace with states x states elements.
+      Math::Matrix m_ws_nn;
+      //! Second workspace with states x states elements.
+      Math::Matrix m_ws_nn2;
+      //! Workspace with states x outputs elements.
+      Math::Matrix m_ws_nm;
+      //! Workspace for the Kalman gain (states x outputs).
+      Math::Matrix m_ws_k;
+      //! Workspace for the innovation covariance (outputs x outputs).
+      Math::Matrix m_ws_mm;
+      //! Workspace with outputs elements.
+      Math::Matrix m_ws_m;
+      //! Workspace with 3 x states elements.
+      Math::Matrix m_ws_n;
+
+      //! Size workspaces for the current number of states and outputs.
+      void
+      resizeWorkspaces(void);
+
+      //! Compute the Cholesky factor of the innovation covariance in
+      //! m_ws_mm, leaving the product of the state covariance and the
+      //! transposed observation model in m_ws_nm.
+      //! @throw std::runtime_error if the innovation covariance is not
+      //! positive definite.
+      void
+      factorInnovationCovariance(void);
+
+      //! Test an innovation against a threshold using the factored
+      //! innovation covariance.
+      //! @param threshold threshold.
+      //! @return true if the innovation must be rejected, false
+      //! otherwise.
+      bool
+      rejectInnovation(float threshold);
+
+      //! Update using the Cholesky factor of the innovation covariance.
+      //! @param threshold threshold to reject large state innovations.
+      //! @return 0 if update is successful, -1 otherwise.
+      int
+      updateCholesky(float threshold);
+
+      //! Update using one scalar update per measurement.
+      //! @param threshold threshold to reject large state innovations.
+      //! @return 0 if update is successful, -1 otherwise.
+      int
+      updateSequential(float threshold);
     };
   }
 }
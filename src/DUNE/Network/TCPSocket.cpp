@@ -28,6 +28,7 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <cstring>
 #include <sstream>
 #include <iostream>
@@ -117,12 +118,24 @@ getLastErrorMessage(void)
 #endif
 }
 
+//! Test if the last socket operation failed because it would block.
+static inline bool
+wouldBlock(void)
+{
+#if defined(DUNE_OS_WINDOWS)
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return (errno == EAGAIN) || (errno == EWOULDBLOCK);
+#endif
+}
+
 namespace DUNE
 {
   namespace Network
   {
     TCPSocket::TCPSocket(bool create):
-      m_handle(INVALID_SOCKET)
+      m_handle(INVALID_SOCKET),
+      m_non_blocking(false)
     {
       if (create)
       {
@@ -197,8 +210,12 @@ namespace DUNE
       socklen_t size = sizeof(addr);
       int rv = ::accept(m_handle, (sockaddr*)&addr, &size);
 
-      if (rv == 0)
+      if (rv < 0)
+      {
+        if (m_non_blocking && wouldBlock())
+          return NULL;
         throw NetworkError(DTR("failed to accept connection"), getLastErrorMessage());
+      }
 
       if (a)
         *a = (sockaddr*)&addr;
@@ -223,6 +240,8 @@ namespace DUNE
       }
       else if (rv < 0)
       {
+        if (m_non_blocking && wouldBlock())
+          return 0;
         if (errno == ECONNRESET)
           throw ConnectionClosed();
         throw NetworkError(DTR("error receiving data"), getLastErrorMessage());
@@ -244,6 +263,8 @@ namespace DUNE
 
       if (rv < 0)
       {
+        if (m_non_blocking && wouldBlock())
+          return 0;
         if (errno == EPIPE)
           throw ConnectionClosed();
         throw NetworkError(DTR("error sending data"), getLastErrorMessage());
@@ -326,6 +347,63 @@ namespace DUNE
 #endif
     }
 
+    size_t
+    TCPSocket::writeFile(std::FILE* file, int64_t offset, size_t size)
+    {
+      size = std::min(size, (size_t)c_block_size);
+      if (size == 0)
+        return 0;
+
+#if defined(DUNE_OS_LINUX)
+      off64_t off = offset;
+      ssize_t rv = sendfile64(m_handle, fileno(file), &off, size);
+
+      if (rv < 0)
+      {
+        if (m_non_blocking && wouldBlock())
+          return 0;
+        if (errno == EPIPE)
+          throw ConnectionClosed();
+        throw NetworkError(DTR("error sending file"), getLastErrorMessage());
+      }
+
+      if (rv == 0)
+        throw NetworkError(DTR("error sending file"), DTR("unexpected end of file"));
+
+      return static_cast<size_t>(rv);
+
+#else
+      if (std::fseek(file, (long)offset, SEEK_SET) != 0)
+        throw NetworkError(DTR("error sending file"), System::Error::getLastMessage());
+
+      char bfr[c_block_size];
+      size_t rv = std::fread(bfr, 1, size, file);
+      if (rv == 0)
+        throw NetworkError(DTR("error sending file"), DTR("unexpected end of file"));
+
+      return doWrite((const uint8_t*)bfr, rv);
+#endif
+    }
+
+    void
+    TCPSocket::setNonBlocking(bool enabled)
+    {
+#if defined(DUNE_OS_WINDOWS)
+      u_long set = enabled ? 1 : 0;
+      if (ioctlsocket(m_handle, FIONBIO, &set) != 0)
+        throw NetworkError(DTR("unable to set non-blocking mode"), getLastErrorMessage());
+#else
+      int flags = fcntl(m_handle, F_GETFL, 0);
+      if (flags != -1)
+        flags = enabled ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+
+      if (flags == -1 || fcntl(m_handle, F_SETFL, flags) == -1)
+        throw NetworkError(DTR("unable to set non-blocking mode"), getLastErrorMessage());
+#endif
+
+      m_non_blocking = enabled;
+    }
+
     void
     TCPSocket::setKeepAlive(bool enabled)
     {
@@ -33,6 +33,7 @@
 // ISO C++ 98 headers.
 #include <vector>
 #include <cstddef>
+#include <cstdio>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -71,12 +72,36 @@ namespace DUNE
       void
       listen(int backlog);
 
+      //! Accept a connection on a listening socket.
+      //! @param[out] a address of the peer.
+      //! @param[out] port port of the peer.
+      //! @return new connected socket or NULL if the socket is in
+      //! non-blocking mode and there are no pending connections.
       TCPSocket*
       accept(Address* a = 0, uint16_t* port = 0);
 
       bool
       writeFile(const char* filename, int64_t off_end, int64_t off_beg = -1);
 
+      //! Write part of an open file to the socket. On Linux the data
+      //! is copied by the kernel using sendfile(), otherwise it is
+      //! read into a buffer and written to the socket.
+      //! @param[in] file file opened for reading.
+      //! @param[in] offset offset of the first byte to write.
+      //! @param[in] size maximum number of bytes to write.
+      //! @return number of bytes written, which is zero if the socket
+      //! is in non-blocking mode and the operation would block.
+      size_t
+      writeFile(std::FILE* file, int64_t offset, size_t size);
+
+      //! Enable/disable non-blocking mode. In non-blocking mode
+      //! accept() returns NULL and read and write operations return
+      //! zero instead of blocking.
+      //! @param[in] enabled true to enable non-blocking mode, false
+      //! to disable.
+      void
+      setNonBlocking(bool enabled);
+
       //! Enable/disable keep-alive messages. When enabled connections
       //! are kept active by periodically transmitting messages.
       //! @param[in] enabled true to enable this feature, false to
@@ -117,6 +142,8 @@ namespace DUNE
 #else
       int m_handle;
 #endif
+      //! True if the socket is in non-blocking mode.
+      bool m_non_blocking;
 
       IO::NativeHandle
       doGetNative(void) const;
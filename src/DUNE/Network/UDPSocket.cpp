@@ -29,6 +29,8 @@
 
 // ISO C++ 98 headers.
 #include <cerrno>
+#include <cstring>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -93,8 +95,41 @@ namespace DUNE
 {
   namespace Network
   {
+    //! System call arguments of batch operations, kept between calls
+    //! and sized for the largest batch.
+    struct UDPSocket::Batch
+    {
+#if defined(DUNE_SYS_HAS_RECVMMSG) || defined(DUNE_SYS_HAS_SENDMMSG)
+      //! Message headers.
+      std::vector<mmsghdr> hdrs;
+      //! Data buffers.
+      std::vector<iovec> iovs;
+      //! Host addresses.
+      std::vector<sockaddr_in> hosts;
+
+      //! Make room for a given number of datagrams and clear the
+      //! headers and addresses that will be used.
+      //! @param[in] count number of datagrams.
+      void
+      prepare(size_t count)
+      {
+        if (hdrs.size() < count)
+        {
+          hdrs.resize(count);
+          iovs.resize(count);
+          hosts.resize(count);
+        }
+
+        std::memset(&hdrs[0], 0, count * sizeof(mmsghdr));
+        std::memset(&hosts[0], 0, count * sizeof(sockaddr_in));
+      }
+#endif
+    };
+
     UDPSocket::UDPSocket(void):
-      m_con_port(0)
+      m_con_port(0),
+      m_read_batch(NULL),
+      m_write_batch(NULL)
     {
       //  POSIX / Win32
 #if defined(DUNE_SYS_HAS_SOCKET)
@@ -122,10 +157,15 @@ namespace DUNE
 #endif
 
       createEventHandle();
+      m_read_batch = new Batch;
+      m_write_batch = new Batch;
     }
 
     UDPSocket::~UDPSocket(void)
     {
+      delete m_read_batch;
+      delete m_write_batch;
+
       // POSIX
 #if defined(DUNE_SYS_HAS_CLOSE)
       close(m_handle);
@@ -232,6 +272,106 @@ namespace DUNE
       return rv;
     }
 
+    size_t
+    UDPSocket::readBatch(Datagram* dgrams, size_t count)
+    {
+      if (count == 0)
+        return 0;
+
+#if defined(DUNE_SYS_HAS_RECVMMSG)
+      m_read_batch->prepare(count);
+      std::vector<mmsghdr>& hdrs = m_read_batch->hdrs;
+      std::vector<iovec>& iovs = m_read_batch->iovs;
+      std::vector<sockaddr_in>& hosts = m_read_batch->hosts;
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        iovs[i].iov_base = dgrams[i].data;
+        iovs[i].iov_len = dgrams[i].size;
+        hdrs[i].msg_hdr.msg_iov = &iovs[i];
+        hdrs[i].msg_hdr.msg_iovlen = 1;
+        hdrs[i].msg_hdr.msg_name = &hosts[i];
+        hdrs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+      }
+
+      int rv = recvmmsg(m_handle, &hdrs[0], count, MSG_WAITFORONE, NULL);
+      if (rv <= 0)
+        throw NetworkError(DTR("error receiving data"), DUNE_SOCKET_ERROR);
+
+      for (int i = 0; i < rv; ++i)
+      {
+        dgrams[i].length = hdrs[i].msg_len;
+        dgrams[i].address = (::sockaddr*)&hosts[i];
+        dgrams[i].port = Utils::ByteCopy::fromBE(hosts[i].sin_port);
+      }
+
+      return rv;
+#else
+      dgrams[0].length = read(dgrams[0].data, dgrams[0].size, &dgrams[0].address, &dgrams[0].port);
+      return 1;
+#endif
+    }
+
+    size_t
+    UDPSocket::writeBatch(const Datagram* dgrams, size_t count)
+    {
+      size_t sent = 0;
+
+#if defined(DUNE_SYS_HAS_SENDMMSG)
+      if (count == 0)
+        return 0;
+
+      m_write_batch->prepare(count);
+      std::vector<mmsghdr>& hdrs = m_write_batch->hdrs;
+      std::vector<iovec>& iovs = m_write_batch->iovs;
+      std::vector<sockaddr_in>& hosts = m_write_batch->hosts;
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        hosts[i].sin_family = AF_INET;
+        hosts[i].sin_port = Utils::ByteCopy::toBE(dgrams[i].port);
+        hosts[i].sin_addr.s_addr = dgrams[i].address.toInteger();
+        iovs[i].iov_base = dgrams[i].data;
+        iovs[i].iov_len = dgrams[i].size;
+        hdrs[i].msg_hdr.msg_iov = &iovs[i];
+        hdrs[i].msg_hdr.msg_iovlen = 1;
+        hdrs[i].msg_hdr.msg_name = &hosts[i];
+        hdrs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+      }
+
+      size_t next = 0;
+      while (next < count)
+      {
+        int rv = sendmmsg(m_handle, &hdrs[next], count - next, 0);
+        if (rv > 0)
+        {
+          sent += rv;
+          next += rv;
+        }
+        else
+        {
+          // Skip the datagram that failed, e.g., unreachable host.
+          if (rv < 0 && errno == EINTR)
+            continue;
+          ++next;
+        }
+      }
+#else
+      for (size_t i = 0; i < count; ++i)
+      {
+        try
+        {
+          write(dgrams[i].data, dgrams[i].size, dgrams[i].address, dgrams[i].port);
+          ++sent;
+        }
+        catch (...)
+        { }
+      }
+#endif
+
+      return sent;
+    }
+
     void
     UDPSocket::createEventHandle(void)
     {
@@ -51,6 +51,22 @@ namespace DUNE
     class UDPSocket: public IO::Handle
     {
     public:
+      //! Datagram used by batch operations.
+      struct Datagram
+      {
+        //! Data buffer.
+        uint8_t* data;
+        //! Size of the data buffer when receiving, size of the data
+        //! when sending.
+        size_t size;
+        //! Number of bytes received.
+        size_t length;
+        //! Source or destination address.
+        Address address;
+        //! Source or destination port.
+        uint16_t port;
+      };
+
       //! Create an unbound UDP socket.
       UDPSocket(void);
 
@@ -97,7 +113,29 @@ namespace DUNE
       size_t
       read(uint8_t* buffer, size_t size, Address* addr = NULL, uint16_t* port = NULL);
 
+      //! Receive a burst of UDP datagrams using a single system call
+      //! where available. This function blocks until at least one
+      //! datagram is received and then returns the datagrams that
+      //! are already queued, up to the given count.
+      //! @param[in,out] dgrams datagrams with preallocated buffers.
+      //! @param[in] count number of datagrams.
+      //! @return number of datagrams received.
+      size_t
+      readBatch(Datagram* dgrams, size_t count);
+
+      //! Send UDP datagrams to their respective destinations using a
+      //! single system call where available. Datagrams that cannot
+      //! be sent are skipped.
+      //! @param[in] dgrams datagrams to send.
+      //! @param[in] count number of datagrams.
+      //! @return number of datagrams sent.
+      size_t
+      writeBatch(const Datagram* dgrams, size_t count);
+
     private:
+      // Forward declaration.
+      struct Batch;
+
       //! Platform specific handle.
 #if defined(DUNE_OS_WINDOWS)
       SOCKET m_handle;
@@ -110,6 +148,10 @@ namespace DUNE
       Address m_con_addr;
       //! Connected port.
       unsigned m_con_port;
+      //! Buffers of batch reads.
+      Batch* m_read_batch;
+      //! Buffers of batch writes.
+      Batch* m_write_batch;
 
       IO::NativeHandle
       doGetNative(void) const
@@ -180,12 +180,14 @@ namespace DUNE
       return proc_delta * 100 / global_delta;
     }
 
-    void
+    bool
     Resources::lockMemory(void)
     {
 #if defined(DUNE_SYS_HAS_MLOCKALL)
-      mlockall(MCL_CURRENT | MCL_FUTURE);
+      return mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
 #endif
+
+      return false;
     }
 
     void
@@ -225,5 +227,20 @@ namespace DUNE
       (void)length;
 #endif
     }
+
+    void
+    Resources::prefaultStack(size_t size)
+    {
+      // One page per call, the frame stays in use until the call
+      // returns.
+      volatile unsigned char page[4096];
+      for (size_t i = 0; i < sizeof(page); i += 64)
+        page[i] = 0;
+
+      if (size > sizeof(page))
+        prefaultStack(size - sizeof(page));
+
+      page[0] = page[sizeof(page) - 64];
+    }
   }
 }
@@ -60,7 +60,8 @@ namespace DUNE
       //! Make all memory pages mapped by the address space of the
       //! current process to be memory-resident until unlocked or until
       //! the process exits.
-      static void
+      //! @return true if memory was locked, false otherwise.
+      static bool
       lockMemory(void);
 
       //! Unlock memory pages.
@@ -83,6 +84,14 @@ namespace DUNE
       static void
       unlockMemory(const void* addr, size_t length);
 
+      //! Touch the given amount of the calling thread's stack, so
+      //! that its pages are mapped (and locked, if memory is locked)
+      //! before they are needed by time-critical code.
+      //! @param[in] size number of bytes, which must be smaller than
+      //! the stack size of the thread.
+      static void
+      prefaultStack(size_t size);
+
     private:
       //! Last process's CPU time.
       uint64_t m_last_proc_time;
@@ -52,5 +52,7 @@ namespace DUNE
 #include <DUNE/Tasks/SimpleTransport.hpp>
 #include <DUNE/Tasks/MessageFilter.hpp>
 #include <DUNE/Tasks/SourceFilter.hpp>
+#include <DUNE/Tasks/Statistics.hpp>
+#include <DUNE/Tasks/Executor.hpp>
 
 #endif
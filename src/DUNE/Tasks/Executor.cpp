@@ -0,0 +1,480 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Streams/Terminal.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Tasks/Executor.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    //! Duration of a timer wheel tick (s).
+    static const double c_tick = 0.005;
+    //! Number of timer wheel slots.
+    static const unsigned c_slots = 512;
+    //! Value of m_next_tick when no timers are set.
+    static const uint64_t c_no_tick = ~(uint64_t)0;
+    //! Time before running a job that failed again (s).
+    static const double c_retry_delay = 1.0;
+
+    // Locks are always taken in the following order: m_jobs,
+    // m_wheel_cond, queue locks or m_idle.
+
+    //! Thread running jobs.
+    class ExecutorWorker: public Concurrency::Thread
+    {
+    public:
+      ExecutorWorker(Executor& parent, unsigned index):
+        m_parent(parent),
+        m_index(index)
+      { }
+
+    private:
+      //! Parent executor.
+      Executor& m_parent;
+      //! Worker index.
+      unsigned m_index;
+
+      void
+      run(void)
+      {
+        Executor::Job* job = NULL;
+        while ((job = m_parent.take(m_index)) != NULL)
+          m_parent.run(job, m_index);
+      }
+    };
+
+    //! Thread serving the timer wheel.
+    class ExecutorTimer: public Concurrency::Thread
+    {
+    public:
+      ExecutorTimer(Executor& parent):
+        m_parent(parent)
+      { }
+
+    private:
+      //! Parent executor.
+      Executor& m_parent;
+
+      void
+      run(void)
+      {
+        while (m_parent.serviceTimers())
+        { }
+      }
+    };
+
+    Executor::Job::Job(void):
+      m_executor(NULL),
+      m_state(JS_IDLE),
+      m_again(false),
+      m_removed(false),
+      m_timer(0),
+      m_home(0)
+    { }
+
+    void
+    Executor::Job::wake(void)
+    {
+      Executor* executor = m_executor;
+      if (executor == NULL)
+        return;
+
+      Concurrency::ScopedCondition l(executor->m_jobs);
+      executor->wakeJob(this);
+    }
+
+    Executor::Executor(unsigned threads):
+      m_timer(NULL),
+      m_pending(0),
+      m_stopping(false),
+      m_wheel(c_slots),
+      m_tick(0),
+      m_next_tick(c_no_tick),
+      m_armed(0),
+      m_next_home(0)
+    {
+      if (threads == 0)
+        threads = 1;
+
+      m_tick = static_cast<uint64_t>(std::floor(Time::Clock::get() / c_tick));
+
+      m_queues.resize(threads);
+      for (unsigned i = 0; i < threads; ++i)
+        m_queue_locks.push_back(new Concurrency::Mutex);
+
+      try
+      {
+        for (unsigned i = 0; i < threads; ++i)
+        {
+          m_workers.push_back(new ExecutorWorker(*this, i));
+          m_workers.back()->start();
+        }
+
+        m_timer = new ExecutorTimer(*this);
+        m_timer->start();
+      }
+      catch (...)
+      {
+        stopThreads();
+        throw;
+      }
+    }
+
+    Executor::~Executor(void)
+    {
+      stopThreads();
+    }
+
+    void
+    Executor::stopThreads(void)
+    {
+      m_wheel_cond.lock();
+      m_idle.lock();
+      m_stopping = true;
+      m_idle.broadcast();
+      m_idle.unlock();
+      m_wheel_cond.broadcast();
+      m_wheel_cond.unlock();
+
+      for (unsigned i = 0; i < m_workers.size(); ++i)
+      {
+        if (m_workers[i]->isCreated())
+          m_workers[i]->stopAndJoin();
+        delete m_workers[i];
+      }
+      m_workers.clear();
+
+      if (m_timer != NULL)
+      {
+        if (m_timer->isCreated())
+          m_timer->stopAndJoin();
+        delete m_timer;
+        m_timer = NULL;
+      }
+
+      for (unsigned i = 0; i < m_queue_locks.size(); ++i)
+        delete m_queue_locks[i];
+      m_queue_locks.clear();
+    }
+
+    void
+    Executor::add(Job* job)
+    {
+      Concurrency::ScopedCondition l(m_jobs);
+      job->m_executor = this;
+      job->m_state = Job::JS_IDLE;
+      job->m_again = false;
+      job->m_removed = false;
+      job->m_home = m_next_home++ % m_queues.size();
+      wakeJob(job);
+    }
+
+    void
+    Executor::remove(Job* job)
+    {
+      Concurrency::ScopedCondition l(m_jobs);
+      job->m_removed = true;
+      ++job->m_timer;
+
+      // Drop pending timers, which refer to the job.
+      m_wheel_cond.lock();
+      for (unsigned i = 0; i < c_slots; ++i)
+      {
+        std::vector<Timer>& slot = m_wheel[i];
+        for (size_t j = 0; j < slot.size(); )
+        {
+          if (slot[j].job == job)
+          {
+            slot[j] = slot.back();
+            slot.pop_back();
+            --m_armed;
+          }
+          else
+          {
+            ++j;
+          }
+        }
+      }
+      m_wheel_cond.unlock();
+
+      // Queued jobs are discarded by the worker that claims them.
+      while (job->m_state != Job::JS_IDLE)
+        m_jobs.wait();
+    }
+
+    void
+    Executor::wakeJob(Job* job)
+    {
+      if (job->m_removed)
+        return;
+
+      switch (job->m_state)
+      {
+        case Job::JS_IDLE:
+          // The next step arms a new timer.
+          ++job->m_timer;
+          job->m_state = Job::JS_QUEUED;
+          submit(job);
+          break;
+
+        case Job::JS_RUNNING:
+          job->m_again = true;
+          break;
+
+        case Job::JS_QUEUED:
+          break;
+      }
+    }
+
+    void
+    Executor::submit(Job* job)
+    {
+      {
+        Concurrency::ScopedMutex l(*m_queue_locks[job->m_home]);
+        m_queues[job->m_home].push_back(job);
+      }
+
+      Concurrency::ScopedCondition l(m_idle);
+      ++m_pending;
+      m_idle.signal();
+    }
+
+    Executor::Job*
+    Executor::take(unsigned worker)
+    {
+      {
+        Concurrency::ScopedCondition l(m_idle);
+        while (m_pending == 0 && !m_stopping)
+          m_idle.wait();
+
+        if (m_stopping)
+          return NULL;
+
+        --m_pending;
+      }
+
+      // A job was claimed, so at least one queue holds one. Prefer
+      // the oldest job of our own queue, otherwise steal the newest
+      // job of another worker.
+      unsigned count = m_queues.size();
+      while (true)
+      {
+        for (unsigned i = 0; i < count; ++i)
+        {
+          unsigned index = (worker + i) % count;
+          Concurrency::ScopedMutex l(*m_queue_locks[index]);
+          std::deque<Job*>& queue = m_queues[index];
+          if (queue.empty())
+            continue;
+
+          Job* job = NULL;
+          if (i == 0)
+          {
+            job = queue.front();
+            queue.pop_front();
+          }
+          else
+          {
+            job = queue.back();
+            queue.pop_back();
+          }
+
+          return job;
+        }
+      }
+    }
+
+    void
+    Executor::run(Job* job, unsigned worker)
+    {
+      m_jobs.lock();
+      if (job->m_removed)
+      {
+        job->m_state = Job::JS_IDLE;
+        m_jobs.broadcast();
+        m_jobs.unlock();
+        return;
+      }
+
+      job->m_state = Job::JS_RUNNING;
+      job->m_home = worker;
+      m_jobs.unlock();
+
+      // Failed jobs are retried later instead of waiting for a wake
+      // that may never come.
+      double deadline = -1.0;
+      try
+      {
+        deadline = job->onStep();
+      }
+      catch (std::exception& e)
+      {
+        DUNE_ERR("Executor", "job failed: " << e.what());
+        deadline = Time::Clock::get() + c_retry_delay;
+      }
+      catch (...)
+      {
+        DUNE_ERR("Executor", "job failed with unknown exception");
+        deadline = Time::Clock::get() + c_retry_delay;
+      }
+
+      Concurrency::ScopedCondition l(m_jobs);
+      if (job->m_removed)
+      {
+        job->m_state = Job::JS_IDLE;
+        m_jobs.broadcast();
+      }
+      else if (job->m_again)
+      {
+        job->m_again = false;
+        job->m_state = Job::JS_QUEUED;
+        submit(job);
+      }
+      else
+      {
+        job->m_state = Job::JS_IDLE;
+        if (deadline >= 0)
+          setTimer(job, deadline);
+      }
+    }
+
+    void
+    Executor::setTimer(Job* job, double deadline)
+    {
+      Timer timer;
+      timer.job = job;
+      timer.generation = ++job->m_timer;
+      timer.tick = static_cast<uint64_t>(std::ceil(deadline / c_tick));
+
+      // The last processed tick is stale after the timer thread slept
+      // on an empty wheel.
+      uint64_t now = static_cast<uint64_t>(std::floor(Time::Clock::get() / c_tick));
+
+      Concurrency::ScopedCondition l(m_wheel_cond);
+      if (timer.tick <= m_tick || timer.tick <= now)
+      {
+        // Already expired.
+        job->m_state = Job::JS_QUEUED;
+        submit(job);
+        return;
+      }
+
+      m_wheel[timer.tick % c_slots].push_back(timer);
+      ++m_armed;
+
+      if (timer.tick < m_next_tick)
+      {
+        m_next_tick = timer.tick;
+        m_wheel_cond.signal();
+      }
+    }
+
+    bool
+    Executor::serviceTimers(void)
+    {
+      std::vector<Timer> expired;
+
+      {
+        Concurrency::ScopedCondition jl(m_jobs);
+        Concurrency::ScopedCondition wl(m_wheel_cond);
+
+        uint64_t now = static_cast<uint64_t>(std::floor(Time::Clock::get() / c_tick));
+        uint64_t first = m_tick + 1;
+        if (now >= m_tick + c_slots)
+          first = now - c_slots + 1;
+
+        for (uint64_t tick = first; tick <= now; ++tick)
+        {
+          std::vector<Timer>& slot = m_wheel[tick % c_slots];
+          for (size_t i = 0; i < slot.size(); )
+          {
+            if (slot[i].tick <= now)
+            {
+              expired.push_back(slot[i]);
+              slot[i] = slot.back();
+              slot.pop_back();
+              --m_armed;
+            }
+            else
+            {
+              ++i;
+            }
+          }
+        }
+
+        if (now > m_tick)
+          m_tick = now;
+
+        // Sleep until the next slot holding timers, at most one
+        // revolution of the wheel, or until a timer is set if the
+        // wheel is empty.
+        m_next_tick = (m_armed == 0) ? c_no_tick : m_tick + c_slots;
+        for (uint64_t tick = m_tick + 1; m_armed > 0 && tick < m_tick + c_slots; ++tick)
+        {
+          if (!m_wheel[tick % c_slots].empty())
+          {
+            m_next_tick = tick;
+            break;
+          }
+        }
+
+        for (size_t i = 0; i < expired.size(); ++i)
+        {
+          Job* job = expired[i].job;
+          if (job->m_timer == expired[i].generation)
+            wakeJob(job);
+        }
+      }
+
+      Concurrency::ScopedCondition l(m_wheel_cond);
+      if (m_stopping)
+        return false;
+
+      if (m_next_tick == c_no_tick)
+      {
+        m_wheel_cond.wait();
+        return !m_stopping;
+      }
+
+      double delay = m_next_tick * c_tick - Time::Clock::get();
+      if (delay > 0)
+        m_wheel_cond.wait(delay);
+
+      return !m_stopping;
+    }
+  }
+}
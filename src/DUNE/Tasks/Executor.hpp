@@ -0,0 +1,235 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_EXECUTOR_HPP_INCLUDED_
+#define DUNE_TASKS_EXECUTOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <deque>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Executor;
+
+    // Forward declarations.
+    class ExecutorWorker;
+    class ExecutorTimer;
+
+    //! M:N executor: runs many schedulable units (jobs) on a fixed
+    //! number of worker threads. A job is run when it is woken, by
+    //! another thread or by its timer, and never runs concurrently
+    //! with itself. Each worker keeps its own queue of runnable jobs
+    //! and idle workers steal from the queues of busy ones. Timers
+    //! are kept in a hashed timer wheel served by a dedicated thread
+    //! that only wakes up when a slot holds timers.
+    class Executor
+    {
+    public:
+      //! Schedulable unit.
+      class Job
+      {
+      public:
+        //! Constructor.
+        Job(void);
+
+        //! Destructor.
+        virtual
+        ~Job(void)
+        { }
+
+        //! Request the job to run as soon as possible. If the job
+        //! is running it will run again when it returns. Has no
+        //! effect if the job is not attached to an executor.
+        void
+        wake(void);
+
+      protected:
+        //! Run one step of the job.
+        //! @return monotonic time (see Time::Clock::get()) at which
+        //! the job must run again or a negative value to run only
+        //! when woken.
+        virtual double
+        onStep(void) = 0;
+
+      private:
+        //! Job states.
+        enum State
+        {
+          //! Waiting to be woken.
+          JS_IDLE,
+          //! Waiting in a worker queue.
+          JS_QUEUED,
+          //! Being run by a worker.
+          JS_RUNNING
+        };
+
+        //! Executor running this job.
+        Executor* m_executor;
+        //! Current state.
+        State m_state;
+        //! True if woken while running.
+        bool m_again;
+        //! True if the job was removed from the executor.
+        bool m_removed;
+        //! Timer generation, stale timers are ignored.
+        unsigned m_timer;
+        //! Preferred worker.
+        unsigned m_home;
+
+        friend class Executor;
+      };
+
+      //! Constructor. Starts the worker threads.
+      //! @param[in] threads number of worker threads.
+      Executor(unsigned threads);
+
+      //! Destructor. Jobs must have been removed.
+      ~Executor(void);
+
+      //! Attach a job and run it as soon as possible.
+      //! @param[in] job job, which must outlive its attachment.
+      void
+      add(Job* job);
+
+      //! Detach a job, waiting for it to finish if it is running.
+      //! Afterwards the job is not run again.
+      //! @param[in] job job.
+      void
+      remove(Job* job);
+
+      //! Retrieve the number of worker threads.
+      //! @return number of worker threads.
+      unsigned
+      getThreadCount(void) const
+      {
+        return m_workers.size();
+      }
+
+    private:
+      //! Timer wheel entry.
+      struct Timer
+      {
+        //! Job.
+        Job* job;
+        //! Job timer generation when the timer was set.
+        unsigned generation;
+        //! Absolute tick at which the timer expires.
+        uint64_t tick;
+      };
+
+      //! Worker threads.
+      std::vector<ExecutorWorker*> m_workers;
+      //! Timer thread.
+      ExecutorTimer* m_timer;
+      //! Queues of runnable jobs, one per worker.
+      std::vector<std::deque<Job*> > m_queues;
+      //! Locks of the queues of runnable jobs.
+      std::vector<Concurrency::Mutex*> m_queue_locks;
+      //! Number of runnable jobs not yet claimed by a worker.
+      unsigned m_pending;
+      //! True when the threads must exit, protected by both
+      //! m_idle and m_wheel_cond.
+      bool m_stopping;
+      //! Signals idle workers, protects m_pending.
+      Concurrency::Condition m_idle;
+      //! Protects the state of every job.
+      Concurrency::Condition m_jobs;
+      //! Timer wheel slots.
+      std::vector<std::vector<Timer> > m_wheel;
+      //! Last processed tick.
+      uint64_t m_tick;
+      //! Tick at which the timer thread wakes up, or c_no_tick while
+      //! the wheel is empty.
+      uint64_t m_next_tick;
+      //! Number of timers in the wheel.
+      size_t m_armed;
+      //! Signals the timer thread, protects the timer wheel.
+      Concurrency::Condition m_wheel_cond;
+      //! Next worker to receive a new job.
+      unsigned m_next_home;
+
+      //! Stop and destroy all threads.
+      void
+      stopThreads(void);
+
+      //! Wake a job. The job state lock must be held.
+      //! @param[in] job job.
+      void
+      wakeJob(Job* job);
+
+      //! Hand a runnable job to a worker queue.
+      //! @param[in] job job.
+      void
+      submit(Job* job);
+
+      //! Claim a runnable job, blocking until one is available.
+      //! @param[in] worker index of the calling worker.
+      //! @return job or NULL if the executor is stopping.
+      Job*
+      take(unsigned worker);
+
+      //! Run one step of a job.
+      //! @param[in] job job.
+      //! @param[in] worker index of the calling worker.
+      void
+      run(Job* job, unsigned worker);
+
+      //! Arm the timer of a job. The job state lock must be held.
+      //! @param[in] job job.
+      //! @param[in] deadline monotonic time of expiration.
+      void
+      setTimer(Job* job, double deadline);
+
+      //! Wake jobs whose timers expired and wait for the next
+      //! non-empty slot. Called by the timer thread only.
+      //! @return false if the executor is stopping.
+      bool
+      serviceTimers(void);
+
+      //! Non - copyable.
+      Executor(const Executor&);
+
+      //! Non - assignable.
+      Executor&
+      operator=(const Executor&);
+
+      friend class ExecutorWorker;
+      friend class ExecutorTimer;
+    };
+  }
+}
+
+#endif
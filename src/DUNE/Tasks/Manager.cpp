@@ -35,11 +35,13 @@
 #include <cstddef>
 
 // DUNE headers.
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Tasks/Task.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Factory.hpp>
 #include <DUNE/Tasks/Exceptions.hpp>
+#include <DUNE/Tasks/Executor.hpp>
 #include <DUNE/Tasks/Manager.hpp>
 
 namespace DUNE
@@ -47,6 +49,8 @@ namespace DUNE
   namespace Tasks
   {
     static const int c_high_task_cpu_usage = 10;
+    //! Time to wait for a task thread to apply its scheduling settings.
+    static const double c_scheduling_timeout = 5.0;
 
     struct TaskCpuUsage
     {
@@ -63,8 +67,16 @@ namespace DUNE
     };
 
     Manager::Manager(Context& ctx):
-      m_ctx(ctx)
+      m_ctx(ctx),
+      m_executor(NULL)
     {
+      // Tasks configured with 'Execution Model' set to 'Pool' share
+      // these threads, zero to give every task a dedicated thread.
+      unsigned pool_threads = 0;
+      m_ctx.config.get("General", "Task Pool Threads", "0", pool_threads);
+      if (pool_threads > 0)
+        m_executor = new Executor(pool_threads);
+
       // Get all sections.
       std::vector<std::string> vec = m_ctx.config.sections();
 
@@ -100,6 +112,10 @@ namespace DUNE
       {
         task->loadConfig();
         task->reserveEntities();
+
+        if (m_executor != NULL && task->setExecutor(m_executor))
+          task->debug(DTR("running in the task pool"));
+
         m_tasks[section] = task;
         m_list.push_back(section);
       }
@@ -134,6 +150,8 @@ namespace DUNE
         delete m_tasks[m_list[i]];
         m_tasks[m_list[i]] = NULL;
       }
+
+      delete m_executor;
     }
 
     void
@@ -162,9 +180,19 @@ namespace DUNE
     Manager::start(void)
     {
       std::map<std::string, Task*>::iterator itr;
+      std::vector<Task*> started;
 
       for (itr = m_tasks.begin(); itr != m_tasks.end(); ++itr)
-        start(itr->first);
+      {
+        if (startTask(itr->second))
+          started.push_back(itr->second);
+      }
+
+      // Task threads apply their settings concurrently, so a single
+      // deadline bounds the wait for all of them.
+      double deadline = Time::Clock::get() + c_scheduling_timeout;
+      for (size_t i = 0; i < started.size(); ++i)
+        reportScheduling(started[i], deadline);
     }
 
     void
@@ -174,12 +202,18 @@ namespace DUNE
       if (itr == m_tasks.end())
         throw InvalidTaskName(section);
 
-      Task* task = itr->second;
+      if (startTask(itr->second))
+        reportScheduling(itr->second, Time::Clock::get() + c_scheduling_timeout);
+    }
 
+    bool
+    Manager::startTask(Task* task)
+    {
       try
       {
         task->inf(DTR("starting"));
         task->start();
+        return true;
       }
       catch (std::exception& e)
       {
@@ -189,6 +223,21 @@ namespace DUNE
       {
         task->err(DTR("unknown exception"));
       }
+
+      return false;
+    }
+
+    void
+    Manager::reportScheduling(Task* task, double deadline)
+    {
+      std::string info = task->getSchedulingInfo(std::max(0.0, deadline - Time::Clock::get()));
+
+      if (info.empty())
+        task->war(DTR("scheduling settings were not applied"));
+      else if (task->isSchedulingConfigured())
+        task->inf(DTR("scheduling: %s"), info.c_str());
+      else
+        task->debug(DTR("scheduling: %s"), info.c_str());
     }
 
     std::string
@@ -234,6 +283,25 @@ namespace DUNE
       }
     }
 
+    void
+    Manager::reportStatistics(void)
+    {
+      TaskStatistics stats;
+      IMC::Event event;
+      event.topic = TaskStatistics::c_topic;
+
+      std::map<std::string, Task*>::const_iterator itr = m_tasks.begin();
+      for ( ; itr != m_tasks.end(); ++itr)
+      {
+        Task* task = itr->second;
+        task->getStatistics(stats);
+
+        event.setSourceEntity(task->getEntityId());
+        event.data = stats.toTupleList();
+        task->dispatch(event);
+      }
+    }
+
     void
     Manager::adjustPriorities(void)
     {
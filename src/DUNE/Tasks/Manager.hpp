@@ -48,6 +48,7 @@ namespace DUNE
     // Forward declarations
     struct Context;
     class Task;
+    class Executor;
 
     class Manager
     {
@@ -110,6 +111,12 @@ namespace DUNE
       void
       adjustPriorities(void);
 
+      //! Dispatch the message queue statistics of every task as an
+      //! Event message with topic 'Task Statistics'. Statistics are
+      //! reset after being reported.
+      void
+      reportStatistics(void);
+
     private:
       struct TaskCpuUsage
       {
@@ -131,6 +138,8 @@ namespace DUNE
       std::map<std::string, Task*> m_tasks;
       //! Task context.
       Context& m_ctx;
+      //! Shared task pool.
+      Executor* m_executor;
       //! Task CPU usage queue.
       std::priority_queue<TaskCpuUsage> m_cpu_usage_hogs;
       //! Buffer message to dispatch CPU usage of tasks.
@@ -141,6 +150,20 @@ namespace DUNE
 
       void
       lowerHogPriority(Task* task, int cpu_usage);
+
+      //! Start a task.
+      //! @param[in] task task.
+      //! @return true if the task was started, false otherwise.
+      bool
+      startTask(Task* task);
+
+      //! Report the effective scheduling settings of a task that
+      //! was just started.
+      //! @param[in] task task.
+      //! @param[in] deadline time until which to wait for the task
+      //! thread to apply its settings.
+      void
+      reportScheduling(Task* task, double deadline);
     };
   }
 }
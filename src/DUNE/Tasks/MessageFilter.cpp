@@ -90,6 +90,30 @@ namespace DUNE
       return false;
     }
 
+    //! Build a bus subscription equivalent to the filter of a
+    //! given message, so that filtered messages are discarded
+    //! before being queued.
+    //! @param[in] id message identifier.
+    //! @return subscription.
+    IMC::Subscription
+    MessageFilter::getSubscription(uint32_t id) const
+    {
+      IMC::Subscription sub;
+
+      std::map<uint32_t, Entities>::const_iterator eitr = m_filtered.find(id);
+      if (eitr != m_filtered.end())
+      {
+        for (unsigned i = 0; i < eitr->second.size(); ++i)
+          sub.sourceEntity(eitr->second[i]);
+      }
+
+      RateMap::const_iterator ritr = m_rates.find(id);
+      if (ritr != m_rates.end())
+        sub.minimumPeriod(ritr->second);
+
+      return sub;
+    }
+
     //! Setup rate filters.
     //! @param[in] spec String specification.
     void
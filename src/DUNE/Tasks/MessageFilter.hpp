@@ -37,6 +37,7 @@
 // DUNE headers.
 #include <DUNE/Tasks/Task.hpp>
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/Subscription.hpp>
 
 namespace DUNE
 {
@@ -58,6 +59,9 @@ namespace DUNE
       bool
       filter(const IMC::Message* msg);
 
+      IMC::Subscription
+      getSubscription(uint32_t id) const;
+
     private:
       // Rate limiters.
       typedef std::map<uint32_t, double> RateMap;
@@ -45,7 +45,8 @@ namespace DUNE
     Periodic::Periodic(const std::string& name, Context& ctx):
       Task(name, ctx),
       m_run_count(0),
-      m_run_time(0)
+      m_run_time(0),
+      m_next_run(0)
     {
       param(DTR_RT("Execution Frequency"), m_frequency)
       .units(Units::Hertz)
@@ -83,5 +84,35 @@ namespace DUNE
         now = Time::Clock::get();
       }
     }
+
+    double
+    Periodic::onStep(bool first)
+    {
+      double now = Time::Clock::get();
+
+      if (first)
+      {
+        m_next_run = now + 1.0 / m_frequency;
+        m_run_time = now;
+        return m_next_run;
+      }
+
+      if (now < m_next_run)
+        return m_next_run;
+
+      m_next_run += 1.0 / m_frequency;
+      m_run_time = now;
+
+      // Perform job.
+      consumeMessages();
+
+      if (!stopping())
+      {
+        task();
+        ++m_run_count;
+      }
+
+      return m_next_run;
+    }
   }
 }
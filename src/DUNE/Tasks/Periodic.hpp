@@ -49,7 +49,10 @@ namespace DUNE
     // Forward declarations
     struct Context;
 
-    //! Periodic task.
+    //! Periodic task. Periodic tasks run in a dedicated thread, unless
+    //! they opt in to the shared task pool by calling
+    //! Task::paramExecutionModel(false) and are configured to use
+    //! it. In the pool, each run of the job performs one step.
     class Periodic: public Task
     {
     public:
@@ -106,10 +109,16 @@ namespace DUNE
       double m_run_time;
       //! Task frequency (Hz).
       double m_frequency;
+      //! Time of next run in the task pool.
+      double m_next_run;
 
       //! Task entry point.
       void
       onMain(void);
+
+      //! Task step, in the task pool.
+      double
+      onStep(bool first);
     };
   }
 }
@@ -32,6 +32,9 @@
 
 // DUNE headers.
 #include <DUNE/IMC/Bus.hpp>
+#include <DUNE/Concurrency/RawTLS.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
@@ -40,47 +43,88 @@ namespace DUNE
 {
   namespace Tasks
   {
+    //! Minimum interval between queue overflow reports.
+    static const double c_overflow_report_period = 5.0;
+    //! Recipient whose callbacks are running in the calling thread.
+    static Concurrency::RawTLS s_consumer;
+
     Recipient::Recipient(AbstractTask* task, Context& ctx):
       m_task(task),
-      m_ctx(ctx)
+      m_ctx(ctx),
+      m_mqueue(1024, Queue::OVERFLOW_GROW),
+      m_notifier(NULL),
+      m_job(NULL),
+      m_dropped(0),
+      m_dropped_time(0.0)
     { }
 
     Recipient::~Recipient(void)
     {
+      // Release producers blocked on a full queue before the
+      // bindings are removed.
+      m_mqueue.close();
       unbindAll();
-
-      while (!m_mqueue.empty())
-      {
-        IMC::Message* msg = m_mqueue.pop();
-        if (msg)
-          delete msg;
-      }
+      m_mqueue.setNotifier(NULL);
+      delete m_notifier;
     }
 
     void
     Recipient::unbindAll(void)
     {
-      std::map<uint32_t, std::vector<AbstractConsumer*> >::iterator itr = m_cbacks.begin();
+      std::map<uint32_t, Binding>::iterator itr = m_cbacks.begin();
 
       for (; itr != m_cbacks.end(); ++itr)
       {
         m_ctx.mbus.unregisterRecipient(m_task, itr->first);
 
-        for (size_t i = 0; i < itr->second.size(); ++i)
-          delete itr->second[i];
+        for (size_t i = 0; i < itr->second.consumers.size(); ++i)
+        {
+          delete itr->second.consumers[i];
+          delete itr->second.subscriptions[i];
+        }
 
-        itr->second.clear();
+        itr->second.consumers.clear();
+        itr->second.subscriptions.clear();
       }
     }
 
     void
     Recipient::bind(uint32_t id, AbstractConsumer* consumer)
     {
-      std::map<uint32_t, std::vector<AbstractConsumer*> >::iterator itr = m_cbacks.find(id);
+      std::map<uint32_t, Binding>::iterator itr = m_cbacks.find(id);
       if (itr == m_cbacks.end())
         m_ctx.mbus.registerRecipient(m_task, id);
+      else if (itr->second.consumers.size() == 1)
+        m_ctx.mbus.registerRecipient(m_task, id, NULL);
+
+      Binding& binding = m_cbacks[id];
+      binding.consumers.push_back(consumer);
+      binding.subscriptions.push_back(NULL);
+    }
+
+    void
+    Recipient::setSubscription(uint32_t id, const AbstractConsumer* consumer,
+                               const IMC::Subscription& sub)
+    {
+      std::map<uint32_t, Binding>::iterator itr = m_cbacks.find(id);
+      if (itr == m_cbacks.end())
+        return;
+
+      Binding& binding = itr->second;
+      for (size_t i = 0; i < binding.consumers.size(); ++i)
+      {
+        if (binding.consumers[i] != consumer)
+          continue;
 
-      m_cbacks[id].push_back(consumer);
+        delete binding.subscriptions[i];
+        binding.subscriptions[i] = sub.empty() ? NULL : new IMC::Subscription(sub);
+
+        // A single consumer is filtered by the bus, otherwise every
+        // message is queued and filtered before each consumer.
+        if (binding.consumers.size() == 1)
+          m_ctx.mbus.registerRecipient(m_task, id, binding.subscriptions[i]);
+        return;
+      }
     }
 
     void
@@ -93,25 +137,165 @@ namespace DUNE
     void
     Recipient::put(const IMC::Message* msg)
     {
-      m_mqueue.push(msg->clone());
+      m_mqueue.push(IMC::SharedMessage(msg->clone()), s_consumer.get() != this);
+
+      if (m_job != NULL)
+        m_job->wake();
+    }
+
+    void
+    Recipient::put(const IMC::SharedMessage& msg)
+    {
+      // A task dispatching to itself would wait for its own thread.
+      m_mqueue.push(msg, s_consumer.get() != this);
+
+      if (m_job != NULL)
+        m_job->wake();
+    }
+
+    IO::NativeHandle
+    Recipient::getNotificationHandle(void)
+    {
+      if (m_notifier == NULL)
+      {
+        m_notifier = new IO::Notifier;
+        m_mqueue.setNotifier(m_notifier);
+      }
+
+      return m_notifier->getNative();
     }
 
     void
     Recipient::runCallBacks(void)
     {
-      unsigned int size = m_mqueue.size();
+      // Clear before draining, messages queued afterwards signal
+      // the notifier again.
+      if (m_notifier != NULL)
+        m_notifier->clear();
+
+      m_mqueue.pop(m_batch);
 
-      for (unsigned int i = 0; i < size; ++i)
+      void* previous = s_consumer.get();
+      s_consumer.set(this);
+
+      for (size_t i = 0; i < m_batch.size(); ++i)
       {
-        const IMC::Message* msg = m_mqueue.pop();
+        const IMC::Message* msg = m_batch[i].get();
         if (msg)
         {
           uint32_t id = msg->getId();
-          for (size_t j = 0; j < m_cbacks[id].size(); ++j)
-            m_cbacks[id][j]->consume(msg);
-          delete msg;
+          double start = Time::Clock::get();
+
+          std::map<uint32_t, Binding>::iterator itr = m_cbacks.find(id);
+          if (itr == m_cbacks.end())
+          {
+            m_batch[i] = IMC::SharedMessage();
+            continue;
+          }
+
+          Binding& binding = itr->second;
+          if (binding.consumers.size() == 1)
+          {
+            binding.consumers[0]->consume(msg);
+          }
+          else
+          {
+            for (size_t j = 0; j < binding.consumers.size(); ++j)
+            {
+              if (binding.subscriptions[j] == NULL || binding.subscriptions[j]->matches(msg))
+                binding.consumers[j]->consume(msg);
+            }
+          }
+
+          double latency = start - m_batch[i].getDispatchTime();
+          double execution = Time::Clock::get() - start;
+
+          m_pending.latency.add(latency);
+          m_pending.execution.add(execution);
+          binding.pending.latency.add(latency);
+          binding.pending.execution.add(execution);
+
+          if (!binding.touched)
+          {
+            binding.touched = true;
+            m_touched.push_back(id);
+          }
         }
+
+        // Release the message as soon as it is consumed.
+        m_batch[i] = IMC::SharedMessage();
+      }
+
+      s_consumer.set(previous);
+      m_batch.clear();
+      publishStatistics();
+      reportOverflow();
+    }
+
+    void
+    Recipient::publishStatistics(void)
+    {
+      if (m_touched.empty())
+        return;
+
+      Concurrency::ScopedMutex l(m_stats_lock);
+      m_stats.latency.merge(m_pending.latency);
+      m_stats.execution.merge(m_pending.execution);
+      m_pending.latency.reset();
+      m_pending.execution.reset();
+
+      for (size_t i = 0; i < m_touched.size(); ++i)
+      {
+        Binding& binding = m_cbacks[m_touched[i]];
+        MessageStatistics& ms = m_stats_ids[m_touched[i]];
+        ms.latency.merge(binding.pending.latency);
+        ms.execution.merge(binding.pending.execution);
+        binding.pending.latency.reset();
+        binding.pending.execution.reset();
+        binding.touched = false;
       }
+
+      m_touched.clear();
+    }
+
+    void
+    Recipient::getStatistics(TaskStatistics& stats)
+    {
+      Queue::Counters counters = m_mqueue.getCounters();
+      m_mqueue.resetHighWater();
+
+      stats.queue_size = m_mqueue.size();
+      stats.queue_capacity = m_mqueue.getCapacity();
+      stats.queue_high_water = counters.high_water;
+      stats.dropped = counters.dropped;
+      stats.blocked = counters.blocked;
+
+      Concurrency::ScopedMutex l(m_stats_lock);
+      stats.latency = m_stats.latency;
+      stats.execution = m_stats.execution;
+      stats.messages.clear();
+      stats.messages.insert(m_stats_ids.begin(), m_stats_ids.end());
+
+      m_stats.latency.reset();
+      m_stats.execution.reset();
+      m_stats_ids.clear();
+    }
+
+    void
+    Recipient::reportOverflow(void)
+    {
+      Queue::Counters counters = m_mqueue.getCounters();
+      if (counters.dropped == m_dropped)
+        return;
+
+      double now = Time::Clock::get();
+      if (now - m_dropped_time < c_overflow_report_period)
+        return;
+
+      m_task->war(DTR("message queue overflow: %lu messages dropped"),
+                  counters.dropped - m_dropped);
+      m_dropped = counters.dropped;
+      m_dropped_time = now;
     }
   }
 }
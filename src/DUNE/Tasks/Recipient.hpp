@@ -35,9 +35,15 @@
 #include <vector>
 
 // DUNE headers.
-#include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Concurrency/RingBuffer.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
+#include <DUNE/IMC/Subscription.hpp>
+#include <DUNE/IO/Notifier.hpp>
 #include <DUNE/Tasks/Consumer.hpp>
 #include <DUNE/Tasks/AbstractTask.hpp>
+#include <DUNE/Tasks/Executor.hpp>
+#include <DUNE/Tasks/Statistics.hpp>
 
 namespace DUNE
 {
@@ -52,6 +58,9 @@ namespace DUNE
     class Recipient
     {
     public:
+      //! Message queue type.
+      typedef Concurrency::RingBuffer<IMC::SharedMessage> Queue;
+
       //! Constructor.
       Recipient(AbstractTask* task, Context& ctx);
 
@@ -61,27 +70,148 @@ namespace DUNE
       void
       unbindAll(void);
 
+      //! Queue a private copy of a message.
+      //! @param msg message object.
+      void
+      put(const IMC::Message* msg);
+
+      //! Queue a shared message without copying it.
+      //! @param msg message handle.
       void
-      put(const IMC::Message*);
+      put(const IMC::SharedMessage& msg);
 
       void
       bind(uint32_t id, AbstractConsumer* c);
 
+      //! Set the subscription that selects which messages of a given
+      //! identifier are delivered to a consumer. If it is the only
+      //! consumer the bus applies the subscription before queueing,
+      //! otherwise all messages are queued and each consumer only
+      //! receives those its subscription accepts.
+      //! @param id message identification number.
+      //! @param consumer consumer bound to the message.
+      //! @param sub subscription.
+      void
+      setSubscription(uint32_t id, const AbstractConsumer* consumer,
+                      const IMC::Subscription& sub);
+
       void
       waitForMessages(double timeout);
 
       void
       runCallBacks(void);
 
+      //! Retrieve a native I/O handle that becomes readable when
+      //! messages are waiting in the queue and is cleared by
+      //! runCallBacks(). The handle is created on first use.
+      //! @return native I/O handle.
+      IO::NativeHandle
+      getNotificationHandle(void);
+
+      //! Set a job to be woken whenever a message is queued. Must be
+      //! called before messages are delivered.
+      //! @param[in] job job or NULL.
+      void
+      setJob(Executor::Job* job)
+      {
+        m_job = job;
+      }
+
+      //! Set the maximum number of messages waiting to be consumed.
+      //! @param capacity queue capacity.
+      void
+      setQueueCapacity(unsigned capacity)
+      {
+        m_mqueue.setCapacity(capacity);
+      }
+
+      //! Set the action taken when a message arrives and the queue
+      //! is full. With the blocking policy, messages the task
+      //! dispatches to itself while consuming are dropped instead.
+      //! @param policy overflow policy.
+      void
+      setQueueOverflowPolicy(Queue::OverflowPolicy policy)
+      {
+        m_mqueue.setOverflowPolicy(policy);
+      }
+
+      //! Stop consuming messages. Producers blocked on a full queue
+      //! are released and messages that do not fit are dropped.
+      void
+      close(void)
+      {
+        m_mqueue.close();
+      }
+
+      //! Retrieve message queue statistics.
+      //! @return queue counters.
+      Queue::Counters
+      getQueueCounters(void)
+      {
+        return m_mqueue.getCounters();
+      }
+
+      //! Retrieve message latency, execution time and queue
+      //! statistics gathered since the previous call.
+      //! @param stats statistics object.
+      void
+      getStatistics(TaskStatistics& stats);
+
     private:
+      //! Consumers of a message identifier.
+      struct Binding
+      {
+        //! Callbacks.
+        std::vector<AbstractConsumer*> consumers;
+        //! Subscription of each callback or NULL.
+        std::vector<IMC::Subscription*> subscriptions;
+        //! Statistics not yet published.
+        MessageStatistics pending;
+        //! True if pending statistics have samples.
+        bool touched;
+
+        Binding(void):
+          touched(false)
+        { }
+      };
+
       //! Task.
       AbstractTask* m_task;
       //! Context.
       Context& m_ctx;
       //! Callbacks.
-      std::map<uint32_t, std::vector<AbstractConsumer*> > m_cbacks;
+      std::map<uint32_t, Binding> m_cbacks;
       //! Message queue.
-      Concurrency::TSQueue<IMC::Message*> m_mqueue;
+      Queue m_mqueue;
+      //! Messages being consumed.
+      std::vector<IMC::SharedMessage> m_batch;
+      //! Queue notifier.
+      IO::Notifier* m_notifier;
+      //! Job woken when messages are queued.
+      Executor::Job* m_job;
+      //! Dropped messages already reported.
+      unsigned long m_dropped;
+      //! Time of the last overflow report.
+      double m_dropped_time;
+      //! Statistics of all messages not yet published.
+      MessageStatistics m_pending;
+      //! Bindings with statistics not yet published.
+      std::vector<uint32_t> m_touched;
+      //! Statistics of all messages.
+      MessageStatistics m_stats;
+      //! Statistics per message identifier.
+      std::map<uint32_t, MessageStatistics> m_stats_ids;
+      //! Statistics lock.
+      Concurrency::Mutex m_stats_lock;
+
+      //! Warn about messages dropped since the last report.
+      void
+      reportOverflow(void);
+
+      //! Make the statistics gathered while consuming a batch of
+      //! messages available to getStatistics().
+      void
+      publishStatistics(void);
     };
   }
 }
@@ -27,6 +27,9 @@
 // Author: Eduardo Marques                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <algorithm>
+
 // DUNE headers.
 #include <DUNE/Tasks/SimpleTransport.hpp>
 #include <DUNE/Time/Clock.hpp>
@@ -60,15 +63,36 @@ namespace DUNE
       .description("Enable verbose output regarding outgoing messages");
     }
 
+    //! Polling period when no I/O handles are registered.
+    static const double c_poll_period = 0.005;
+    //! Maximum time to wait for I/O before checking for stop requests.
+    static const double c_wait_timeout = 1.0;
+
     SimpleTransport::~SimpleTransport(void)
     { }
 
     void
-    SimpleTransport::consume(const IMC::Message* msg)
+    SimpleTransport::addHandle(const IO::Handle& handle)
+    {
+      m_handles.push_back(handle.getNative());
+      m_events.add(handle);
+    }
+
+    void
+    SimpleTransport::removeHandle(const IO::Handle& handle)
     {
-      if (m_rl.filter(msg))
+      std::vector<IO::NativeHandle>::iterator itr;
+      itr = std::find(m_handles.begin(), m_handles.end(), handle.getNative());
+      if (itr == m_handles.end())
         return;
 
+      m_handles.erase(itr);
+      m_events.remove(handle);
+    }
+
+    void
+    SimpleTransport::consume(const IMC::Message* msg)
+    {
       unsigned int n = msg->getSerializationSize();
 
       m_buf.grow(n);
@@ -88,32 +112,54 @@ namespace DUNE
     {
       m_rl.setupRates(m_gargs.rlim);
       m_rl.setupEntities(m_gargs.entities_flt, this);
-      bind(this, m_gargs.transports);
+
+      // Rate and entity filters are applied before consumption.
+      for (unsigned i = 0; i < m_gargs.transports.size(); ++i)
+      {
+        uint32_t id = IMC::Factory::getIdFromAbbrev(m_gargs.transports[i]);
+        bind(id, new Consumer<SimpleTransport, IMC::Message>(*this, &SimpleTransport::consume),
+             m_rl.getSubscription(id));
+      }
+
+      IO::NativeHandle messages = getMessagesHandle();
+      m_events.add(messages);
 
       while (!stopping())
       {
         consumeMessages();
 
-        onDataReception(m_buf.getBuffer(), m_buf.getCapacity(), 0.005);
+        if (m_handles.empty())
+        {
+          onDataReception(m_buf.getBuffer(), m_buf.getCapacity(), c_poll_period);
+          continue;
+        }
+
+        if (!m_events.poll(c_wait_timeout))
+          continue;
+
+        // Only messages to transmit.
+        if (m_events.getTriggered().size() == 1 && m_events.wasTriggered(messages))
+          continue;
+
+        onDataReception(m_buf.getBuffer(), m_buf.getCapacity(), 0.0);
       }
+
+      m_events.remove(messages);
     }
 
     void
     SimpleTransport::handleData(IMC::Parser& parser, const uint8_t* p, unsigned int n)
     {
-      for (const uint8_t* e = p + n; p != e; ++p)
-      {
-        IMC::Message* m = parser.parse(*p);
+      const uint8_t* e = p + n;
 
-        if (m)
-        {
-          dispatch(m, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+      while (IMC::Message* m = parser.parse(p, e))
+      {
+        dispatch(m, DF_KEEP_TIME | DF_KEEP_SRC_EID);
 
-          if (m_gargs.trace_in)
-            inf(DTR("incoming: %s"), m->getName());
+        if (m_gargs.trace_in)
+          inf(DTR("incoming: %s"), m->getName());
 
-          delete m;
-        }
+        delete m;
       }
     }
   }
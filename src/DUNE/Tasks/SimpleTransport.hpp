@@ -37,6 +37,8 @@
 #include <DUNE/Config.hpp>
 #include <DUNE/Utils/ByteBuffer.hpp>
 #include <DUNE/IMC/Parser.hpp>
+#include <DUNE/IO/Handle.hpp>
+#include <DUNE/IO/Poll.hpp>
 #include <DUNE/Tasks/Task.hpp>
 #include <DUNE/Tasks/MessageFilter.hpp>
 
@@ -70,6 +72,23 @@ namespace DUNE
       void
       handleData(IMC::Parser& parser, const uint8_t* p, unsigned int n);
 
+    protected:
+      //! Add an I/O handle to the set of handles that wake up the
+      //! main loop. When at least one handle is registered the main
+      //! loop sleeps until there are messages to transmit or one of
+      //! the handles is readable, and onDataReception() is then
+      //! called with a null timeout. Otherwise onDataReception() is
+      //! polled periodically.
+      //! @param[in] handle I/O handle.
+      void
+      addHandle(const IO::Handle& handle);
+
+      //! Remove an I/O handle from the set of handles that wake up
+      //! the main loop.
+      //! @param[in] handle I/O handle.
+      void
+      removeHandle(const IO::Handle& handle);
+
     private:
       struct GArguments
       {
@@ -87,6 +106,10 @@ namespace DUNE
       GArguments m_gargs;
       Utils::ByteBuffer m_buf;
       MessageFilter m_rl;
+      // Handles waited on by the main loop.
+      IO::Poll m_events;
+      // Transport I/O handles.
+      std::vector<IO::NativeHandle> m_handles;
     };
   }
 }
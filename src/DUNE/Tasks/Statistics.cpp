@@ -0,0 +1,155 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <sstream>
+
+// DUNE headers.
+#include <DUNE/IMC/Factory.hpp>
+#include <DUNE/Tasks/Statistics.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    const char* TaskStatistics::c_topic = "Task Statistics";
+
+    //! Convert seconds to integer microseconds.
+    static long
+    toMicroseconds(double value)
+    {
+      return static_cast<long>(value * 1e6 + 0.5);
+    }
+
+    void
+    LatencyHistogram::reset(void)
+    {
+      for (unsigned i = 0; i < c_bins; ++i)
+        m_bins[i] = 0;
+
+      m_count = 0;
+      m_sum = 0.0;
+      m_max = 0.0;
+    }
+
+    void
+    LatencyHistogram::add(double value)
+    {
+      if (value < 0.0)
+        value = 0.0;
+
+      unsigned bin = 0;
+      double us = value * 1e6;
+      if (us >= 1.0)
+      {
+        int exp = 0;
+        std::frexp(us, &exp);
+        bin = static_cast<unsigned>(exp - 1);
+        if (bin >= c_bins)
+          bin = c_bins - 1;
+      }
+
+      ++m_bins[bin];
+      ++m_count;
+      m_sum += value;
+
+      if (value > m_max)
+        m_max = value;
+    }
+
+    void
+    LatencyHistogram::merge(const LatencyHistogram& other)
+    {
+      for (unsigned i = 0; i < c_bins; ++i)
+        m_bins[i] += other.m_bins[i];
+
+      m_count += other.m_count;
+      m_sum += other.m_sum;
+
+      if (other.m_max > m_max)
+        m_max = other.m_max;
+    }
+
+    double
+    LatencyHistogram::getPercentile(double fraction) const
+    {
+      if (m_count == 0)
+        return 0.0;
+
+      double target = fraction * m_count;
+      unsigned long accum = 0;
+      for (unsigned i = 0; i < c_bins; ++i)
+      {
+        accum += m_bins[i];
+        if (accum >= target)
+        {
+          double bound = std::ldexp(1.0, i + 1) / 1e6;
+          return (bound < m_max) ? bound : m_max;
+        }
+      }
+
+      return m_max;
+    }
+
+    std::string
+    TaskStatistics::toTupleList(void) const
+    {
+      std::ostringstream os;
+      os << "queue=" << queue_size
+         << ";capacity=" << queue_capacity
+         << ";high_water=" << queue_high_water
+         << ";dropped=" << dropped
+         << ";blocked=" << blocked
+         << ";count=" << latency.getCount()
+         << ";latency_mean=" << toMicroseconds(latency.getMean())
+         << ";latency_p50=" << toMicroseconds(latency.getPercentile(0.50))
+         << ";latency_p99=" << toMicroseconds(latency.getPercentile(0.99))
+         << ";latency_max=" << toMicroseconds(latency.getMaximum())
+         << ";execution_mean=" << toMicroseconds(execution.getMean())
+         << ";execution_max=" << toMicroseconds(execution.getMaximum());
+
+      std::map<unsigned, MessageStatistics>::const_iterator itr = messages.begin();
+      for (; itr != messages.end(); ++itr)
+      {
+        const MessageStatistics& ms = itr->second;
+        if (ms.latency.getCount() == 0)
+          continue;
+
+        os << ";" << IMC::Factory::getAbbrevFromId(itr->first)
+           << "=" << ms.latency.getCount()
+           << ":" << toMicroseconds(ms.latency.getMean())
+           << ":" << toMicroseconds(ms.latency.getPercentile(0.99))
+           << ":" << toMicroseconds(ms.latency.getMaximum())
+           << ":" << toMicroseconds(ms.execution.getMean())
+           << ":" << toMicroseconds(ms.execution.getMaximum());
+      }
+
+      return os.str();
+    }
+  }
+}
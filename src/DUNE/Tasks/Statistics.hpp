@@ -0,0 +1,164 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_STATISTICS_HPP_INCLUDED_
+#define DUNE_TASKS_STATISTICS_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LatencyHistogram;
+
+    //! Histogram of time intervals. Samples are counted in bins whose
+    //! width doubles from one bin to the next, starting with [0, 2[
+    //! microseconds, so that percentiles can be estimated cheaply
+    //! over a very wide range of values.
+    class LatencyHistogram
+    {
+    public:
+      //! Number of bins.
+      static const unsigned c_bins = 24;
+
+      //! Constructor.
+      LatencyHistogram(void)
+      {
+        reset();
+      }
+
+      //! Discard all samples.
+      void
+      reset(void);
+
+      //! Add a sample.
+      //! @param[in] value time interval in seconds.
+      void
+      add(double value);
+
+      //! Add all samples of another histogram.
+      //! @param[in] other histogram.
+      void
+      merge(const LatencyHistogram& other);
+
+      //! Retrieve the number of samples.
+      //! @return number of samples.
+      unsigned long
+      getCount(void) const
+      {
+        return m_count;
+      }
+
+      //! Retrieve the mean of all samples.
+      //! @return mean value in seconds.
+      double
+      getMean(void) const
+      {
+        return (m_count == 0) ? 0.0 : m_sum / m_count;
+      }
+
+      //! Retrieve the largest sample.
+      //! @return maximum value in seconds.
+      double
+      getMaximum(void) const
+      {
+        return m_max;
+      }
+
+      //! Estimate a percentile. The result is the upper bound of the
+      //! bin where the percentile falls, limited by the largest
+      //! sample.
+      //! @param[in] fraction percentile as a fraction in [0, 1].
+      //! @return percentile estimate in seconds.
+      double
+      getPercentile(double fraction) const;
+
+    private:
+      //! Bin counts.
+      unsigned long m_bins[c_bins];
+      //! Number of samples.
+      unsigned long m_count;
+      //! Sum of all samples.
+      double m_sum;
+      //! Largest sample.
+      double m_max;
+    };
+
+    //! Statistics of a message identifier consumed by a task.
+    struct MessageStatistics
+    {
+      //! Time between dispatch and consumption.
+      LatencyHistogram latency;
+      //! Time spent in the consumers.
+      LatencyHistogram execution;
+    };
+
+    //! Statistics of the message queue of a task.
+    struct TaskStatistics
+    {
+      //! Topic of the Event messages carrying task statistics.
+      static const char* c_topic;
+
+      //! Number of messages waiting to be consumed.
+      unsigned queue_size;
+      //! Maximum number of messages waiting to be consumed.
+      unsigned queue_capacity;
+      //! Highest number of messages waiting to be consumed.
+      unsigned queue_high_water;
+      //! Number of messages dropped due to queue overflow.
+      unsigned long dropped;
+      //! Number of times a dispatching task was blocked.
+      unsigned long blocked;
+      //! Time between dispatch and consumption (all messages).
+      LatencyHistogram latency;
+      //! Time spent in the consumers (all messages).
+      LatencyHistogram execution;
+      //! Statistics per message identifier.
+      std::map<unsigned, MessageStatistics> messages;
+
+      //! Serialize statistics as a list of tuples (see
+      //! Utils::TupleList). Times are given in microseconds, the
+      //! statistics of each message identifier are given in a tuple
+      //! named after the message abbreviation whose value is a colon
+      //! separated list with the number of samples, mean, 99th
+      //! percentile and maximum latency, and mean and maximum
+      //! execution time.
+      //! @return list of tuples.
+      std::string
+      toTupleList(void) const;
+    };
+  }
+}
+
+#endif
@@ -29,6 +29,7 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <sstream>
 #include <cstddef>
 
@@ -42,6 +43,9 @@
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Exceptions.hpp>
 #include <DUNE/Tasks/Task.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/System/Resources.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
 #include <DUNE/Utils/XML.hpp>
 #include <DUNE/Entities/BasicEntity.hpp>
 #include <DUNE/Entities/EntityUtils.hpp>
@@ -57,15 +61,43 @@ namespace DUNE
     //! Maximum size of a log book entry message.
     const static size_t c_log_message_max_size = 1024;
 
+    //! Job running a task in the task pool.
+    class Task::Job: public Executor::Job
+    {
+    public:
+      Job(Task& task):
+        m_task(task)
+      { }
+
+    private:
+      //! Task.
+      Task& m_task;
+
+      double
+      onStep(void)
+      {
+        return m_task.step();
+      }
+    };
+
     Task::Task(const std::string& n, Context& ctx):
       m_ctx(ctx),
       m_recipient(0),
       m_name(n),
       m_entity(NULL),
       m_debug_level(DEBUG_LEVEL_NONE),
-      m_honours_active(false)
+      m_honours_active(false),
+      m_job_allowed(false),
+      m_job_on_message(false),
+      m_executor(NULL),
+      m_job(NULL),
+      m_job_state(JOB_SETUP),
+      m_job_restart(0),
+      m_sched_applied(false)
     {
       m_args.priority = 10;
+      m_args.lock_memory = false;
+      m_args.stack_prefault = 0;
       m_args.act_time = 0;
       m_args.deact_time = 0;
       m_args.active = false;
@@ -76,7 +108,33 @@ namespace DUNE
 
       param(DTR_RT("Execution Priority"), m_args.priority)
       .defaultValue("10")
-      .description(DTR("Execution priority"));
+      .description(DTR("Execution priority, used with real-time execution policies"));
+
+      param(DTR_RT("Execution Policy"), m_args.policy)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue("Default")
+      .values("Default, FIFO, RR")
+      .description(DTR("Scheduling policy of the task thread. 'Default' keeps"
+                       " the default time-sharing policy of the system"));
+
+      param(DTR_RT("CPU Affinity"), m_args.affinity)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue("")
+      .description(DTR("Processors the task thread may run on, all if empty"));
+
+      param(DTR_RT("Lock Memory"), m_args.lock_memory)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue("false")
+      .description(DTR("Lock the memory of the process when the task starts,"
+                       " avoiding page faults in time-critical code"));
+
+      param(DTR_RT("Stack Prefault"), m_args.stack_prefault)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .units(Units::Kibibyte)
+      .defaultValue("0")
+      .maximumValue("64")
+      .description(DTR("Amount of stack touched when the task thread starts,"
+                       " so that its pages are resident before they are needed"));
 
       param(DTR_RT("Activation Time"), m_args.act_time)
       .defaultValue("0");
@@ -88,6 +146,21 @@ namespace DUNE
       .defaultValue("None")
       .values("None, Debug, Trace, Spew");
 
+      param(DTR_RT("Message Queue - Capacity"), m_args.queue_capacity)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue("1024")
+      .minimumValue("1")
+      .description(DTR("Maximum number of messages waiting to be consumed."
+                       " With the 'Unbounded' policy, initial queue size"));
+
+      param(DTR_RT("Message Queue - Overflow Policy"), m_args.queue_policy)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue("Unbounded")
+      .values("Unbounded, Drop Oldest, Drop Newest, Block")
+      .description(DTR("Action taken when a message arrives and the queue is full."
+                       " 'Block' stalls the dispatching task until there is room"
+                       " and deadlocks if two blocking tasks dispatch to each other"));
+
       m_recipient = new Recipient(this, ctx);
       m_entity = new Entities::StatefulEntity(this, m_ctx);
       m_entities.push_back(m_entity);
@@ -220,6 +293,196 @@ namespace DUNE
       .description(DTR("True to activate task, false otherwise"));
     }
 
+    void
+    Task::paramExecutionModel(bool on_message)
+    {
+      m_job_allowed = true;
+      m_job_on_message = on_message;
+
+      param(DTR_RT("Execution Model"), m_args.exec_model)
+      .visibility(Parameter::VISIBILITY_DEVELOPER)
+      .defaultValue("Thread")
+      .values("Thread, Pool")
+      .description(DTR("Run the task in a dedicated thread or in the shared"
+                       " task pool. Latency-critical tasks should keep"
+                       " a dedicated thread"));
+    }
+
+    bool
+    Task::setExecutor(Executor* executor)
+    {
+      if (!m_job_allowed || m_args.exec_model != "Pool")
+        return false;
+
+      m_executor = executor;
+      return true;
+    }
+
+    void
+    Task::startImpl(void)
+    {
+      if (m_executor == NULL)
+      {
+        Thread::startImpl();
+        return;
+      }
+
+      if (m_job == NULL)
+        m_job = new Job(*this);
+
+      if (m_job_on_message)
+        m_recipient->setJob(m_job);
+
+      if (isSchedulingConfigured())
+        war(DTR("scheduling settings are ignored in the task pool"));
+
+      m_job_state = JOB_SETUP;
+      setStateImpl(StateRunning);
+      m_executor->add(m_job);
+    }
+
+    bool
+    Task::isSchedulingConfigured(void) const
+    {
+      return m_args.policy != "Default" || !m_args.affinity.empty()
+      || m_args.lock_memory || m_args.stack_prefault > 0;
+    }
+
+    std::string
+    Task::getSchedulingInfo(double timeout)
+    {
+      if (m_executor != NULL)
+        return "task pool";
+
+      double deadline = Time::Clock::get() + timeout;
+
+      Concurrency::ScopedCondition l(m_sched_cond);
+      while (!m_sched_applied)
+      {
+        double remaining = deadline - Time::Clock::get();
+        if (remaining <= 0)
+          break;
+
+        m_sched_cond.wait(remaining);
+      }
+
+      return m_sched_info;
+    }
+
+    void
+    Task::applyScheduling(void)
+    {
+      bool locked = false;
+      if (m_args.lock_memory)
+      {
+        locked = System::Resources::lockMemory();
+        if (!locked)
+          war(DTR("failed to lock memory"));
+      }
+
+      if (m_args.stack_prefault > 0)
+        System::Resources::prefaultStack(m_args.stack_prefault * 1024);
+
+      if (!m_args.affinity.empty())
+      {
+        try
+        {
+          setAffinity(m_args.affinity);
+        }
+        catch (std::exception& e)
+        {
+          war(DTR("failed to set CPU affinity: %s"), e.what());
+        }
+      }
+
+      if (m_args.policy != "Default")
+      {
+        Concurrency::Scheduler::Policy policy = Concurrency::Scheduler::POLICY_RR;
+        if (m_args.policy == "FIFO")
+          policy = Concurrency::Scheduler::POLICY_FIFO;
+
+        try
+        {
+          Runnable::setPriority(policy, m_args.priority);
+        }
+        catch (std::exception& e)
+        {
+          war(DTR("failed to set scheduling policy: %s"), e.what());
+        }
+      }
+
+      std::string info;
+      try
+      {
+        const char* policy = "other";
+        switch (getPolicy())
+        {
+          case Concurrency::Scheduler::POLICY_FIFO:
+            policy = "FIFO";
+            break;
+          case Concurrency::Scheduler::POLICY_RR:
+            policy = "RR";
+            break;
+          default:
+            break;
+        }
+
+        std::vector<unsigned> cpus;
+        getAffinity(cpus);
+
+        std::string cpu_list;
+        for (size_t i = 0; i < cpus.size(); ++i)
+          cpu_list += Utils::String::str(i == 0 ? "%u" : ",%u", cpus[i]);
+
+        info = Utils::String::str("policy %s, priority %u, CPUs %s", policy,
+                           Runnable::getPriority(), cpu_list.c_str());
+      }
+      catch (std::exception& e)
+      {
+        info = e.what();
+      }
+
+      if (locked)
+        info += ", memory locked";
+
+      if (m_args.stack_prefault > 0)
+        info += Utils::String::str(", %u KiB of stack prefaulted", m_args.stack_prefault);
+
+      Concurrency::ScopedCondition l(m_sched_cond);
+      m_sched_info = info;
+      m_sched_applied = true;
+      m_sched_cond.broadcast();
+    }
+
+    void
+    Task::joinImpl(void)
+    {
+      if (m_executor == NULL)
+      {
+        Thread::joinImpl();
+        return;
+      }
+
+      m_executor->remove(m_job);
+
+      // Messages are no longer consumed.
+      m_recipient->close();
+
+      if (m_job_state == JOB_INIT || m_job_state == JOB_RUN)
+      {
+        try
+        {
+          releaseResources();
+        }
+        catch (std::exception& e)
+        {
+          reportFailure(e);
+        }
+      }
+
+      setStateImpl(StateDead);
+    }
+
     void
     Task::updateParameters(bool act_deact)
     {
@@ -239,6 +502,16 @@ namespace DUNE
       else
         m_debug_level = DEBUG_LEVEL_NONE;
 
+      m_recipient->setQueueCapacity(m_args.queue_capacity);
+      if (m_args.queue_policy == "Block")
+        m_recipient->setQueueOverflowPolicy(Recipient::Queue::OVERFLOW_BLOCK);
+      else if (m_args.queue_policy == "Drop Newest")
+        m_recipient->setQueueOverflowPolicy(Recipient::Queue::OVERFLOW_DROP_NEWEST);
+      else if (m_args.queue_policy == "Drop Oldest")
+        m_recipient->setQueueOverflowPolicy(Recipient::Queue::OVERFLOW_DROP_OLDEST);
+      else
+        m_recipient->setQueueOverflowPolicy(Recipient::Queue::OVERFLOW_GROW);
+
       onUpdateParameters();
 
       if (m_honours_active)
@@ -356,12 +629,7 @@ namespace DUNE
       prctl(PR_SET_NAME, getName(), 0, 0, 0);
 #endif
 
-      try
-      {
-        setPriority(m_args.priority);
-      }
-      catch (...)
-      { }
+      applyScheduling();
 
       while (!stopping())
       {
@@ -384,19 +652,9 @@ namespace DUNE
         }
         catch (RestartNeeded& e)
         {
-          unsigned delay = e.getDelay();
-
-          if (e.isError())
-          {
-            setEntityState(IMC::EntityState::ESTA_FAILURE, DTR("restarting"));
+          reportRestart(e);
 
-            if (delay == 0)
-              err(DTR("restarting immediately due to error: %s"), e.getError());
-            else
-              err(DTR("restarting in %u seconds due to error: %s"), delay, e.getError());
-          }
-
-          Time::Counter<double> counter(static_cast<double>(delay));
+          Time::Counter<double> counter(static_cast<double>(e.getDelay()));
           while (!stopping() && !counter.overflow())
           {
             double remaining = counter.getRemaining();
@@ -415,12 +673,118 @@ namespace DUNE
         }
         catch (std::exception& e)
         {
-          IMC::EntityState estate;
-          setEntityState(IMC::EntityState::ESTA_FAILURE, e.what());
-          dispatch(estate);
-          err(DTR("task died with uncaught exception: %s: restarting"), e.what());
+          reportFailure(e);
+        }
+      }
+
+      // Messages are no longer consumed.
+      m_recipient->close();
+    }
+
+    double
+    Task::step(void)
+    {
+      double now = Time::Clock::get();
+
+      try
+      {
+        switch (m_job_state)
+        {
+          case JOB_SETUP:
+            resolveEntities();
+            releaseResources();
+            acquireResources();
+            m_job_state = JOB_INIT;
+            // Fall through.
+
+          case JOB_INIT:
+            try
+            {
+              onResourceInitialization();
+            }
+            catch (std::exception& e)
+            {
+              err("%s", e.what());
+              return now + 1.0;
+            }
+
+            if (m_honours_active)
+            {
+              Parameter::Scope active_scope = Parameter::scopeFromString(m_args.active_scope);
+              if (m_args.active && ((active_scope == Parameter::SCOPE_GLOBAL) || (active_scope == Parameter::SCOPE_IDLE)))
+                requestActivation();
+            }
+
+            m_job_state = JOB_RUN;
+            return onStep(true);
+
+          case JOB_RUN:
+            return onStep(false);
+
+          case JOB_RESTART:
+            if (now < m_job_restart)
+            {
+              reportEntityState();
+              return std::min(m_job_restart, now + 1.0);
+            }
+
+            try
+            {
+              updateParameters();
+            }
+            catch (std::runtime_error& pe)
+            {
+              err(DTR("failed to update parameters: %s"), pe.what());
+            }
+
+            m_job_state = JOB_SETUP;
+            return now;
         }
       }
+      catch (RestartNeeded& e)
+      {
+        reportRestart(e);
+        m_job_restart = now + e.getDelay();
+        m_job_state = JOB_RESTART;
+        return now;
+      }
+      catch (std::exception& e)
+      {
+        reportFailure(e);
+        m_job_state = JOB_SETUP;
+        return now;
+      }
+      catch (...)
+      {
+        reportFailure(std::runtime_error(DTR("unknown exception")));
+        m_job_state = JOB_SETUP;
+        return now + 1.0;
+      }
+
+      return -1.0;
+    }
+
+    void
+    Task::reportRestart(RestartNeeded& e)
+    {
+      if (!e.isError())
+        return;
+
+      setEntityState(IMC::EntityState::ESTA_FAILURE, DTR("restarting"));
+
+      if (e.getDelay() == 0)
+        err(DTR("restarting immediately due to error: %s"), e.getError());
+      else
+        err(DTR("restarting in %u seconds due to error: %s"), e.getDelay(), e.getError());
+    }
+
+    void
+    Task::reportFailure(const std::exception& e)
+    {
+      IMC::EntityState estate;
+      setEntityState(IMC::EntityState::ESTA_FAILURE, e.what());
+      dispatch(estate);
+      err(DTR("task died with uncaught exception: %s: restarting"), e.what());
     }
 
     void
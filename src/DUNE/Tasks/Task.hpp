@@ -54,6 +54,8 @@
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/BasicParameterParser.hpp>
 #include <DUNE/Tasks/ParameterTable.hpp>
+#include <DUNE/Tasks/Executor.hpp>
+#include <DUNE/Tasks/Exceptions.hpp>
 #include <DUNE/Entities/BasicEntity.hpp>
 #include <DUNE/Entities/StatefulEntity.hpp>
 
@@ -126,6 +128,7 @@ namespace DUNE
         }
 
         delete m_recipient;
+        delete m_job;
       }
 
       //! Retrieve the task's name.
@@ -245,6 +248,24 @@ namespace DUNE
         return m_args.priority;
       }
 
+      //! Test if the task is configured with scheduling settings
+      //! other than the defaults ('Execution Policy', 'CPU
+      //! Affinity', 'Lock Memory' or 'Stack Prefault').
+      //! @return true if scheduling settings are configured, false
+      //! otherwise.
+      bool
+      isSchedulingConfigured(void) const;
+
+      //! Retrieve a description of the effective scheduling settings
+      //! of the task thread, which are applied when the thread
+      //! starts.
+      //! @param[in] timeout maximum amount of time to wait for the
+      //! thread to apply the settings.
+      //! @return description or an empty string if the settings
+      //! were not applied within the timeout.
+      std::string
+      getSchedulingInfo(double timeout);
+
       //! Send an human-readable informational message to all
       //! configured output channels and files.
       //! @param format string format (similar to printf(3)).
@@ -336,6 +357,23 @@ namespace DUNE
         m_recipient->put(msg);
       }
 
+      //! Queue a shared message for later consumption.
+      //! @param msg message handle.
+      void
+      receive(const IMC::SharedMessage& msg)
+      {
+        m_recipient->put(msg);
+      }
+
+      //! Retrieve message queue statistics gathered since the
+      //! previous call.
+      //! @param[out] stats statistics object.
+      void
+      getStatistics(TaskStatistics& stats)
+      {
+        m_recipient->getStatistics(stats);
+      }
+
       //! Instruct task to reserve all entity identifiers that it
       //! needs for normal execution.
       void
@@ -371,6 +409,16 @@ namespace DUNE
       void
       writeParamsXML(std::ostream& os) const;
 
+      //! Run the task as a job of a shared executor instead of a
+      //! dedicated thread, if the task supports it and its
+      //! 'Execution Model' parameter is 'Pool' (see
+      //! paramExecutionModel()). Must be called before start().
+      //! @param[in] executor executor.
+      //! @return true if the task will run on the executor, false
+      //! otherwise.
+      bool
+      setExecutor(Executor* executor);
+
       //! Retrieve the main entity label of the task.
       //! @return main entity label.
       const char*
@@ -504,6 +552,18 @@ namespace DUNE
         m_recipient->runCallBacks();
       }
 
+      //! Retrieve a native I/O handle that becomes readable when
+      //! there are messages waiting to be consumed. This allows a
+      //! task to wait for messages and other I/O handles at the same
+      //! time using IO::Poll. The handle is cleared by
+      //! consumeMessages().
+      //! @return native I/O handle.
+      IO::NativeHandle
+      getMessagesHandle(void)
+      {
+        return m_recipient->getNotificationHandle();
+      }
+
       //! Declare a configuration parameter that can be parsed using
       //! the basic parameter parser.
       //! @tparam T type of the destination variable.
@@ -551,6 +611,18 @@ namespace DUNE
                   Parameter::Visibility def_visibility,
                   bool def_value = false);
 
+      //! Declare parameter 'Execution Model', which allows the task
+      //! to run as a job of the shared task pool (see Executor)
+      //! instead of a dedicated thread. In that case onMain() is not
+      //! called: the task is driven by onStep(), which must never
+      //! block. The default implementation of onStep() consumes
+      //! pending messages, so tasks whose onMain() only waits for
+      //! and consumes messages need no further changes.
+      //! @param[in] on_message true to run a step whenever messages
+      //! are queued, false if steps are scheduled by onStep() only.
+      void
+      paramExecutionModel(bool on_message);
+
       //! Set the name of the parameter editor that should be used to
       //! interact with the parameters of the task.
       //! @param[in] name editor name (free-form string).
@@ -619,6 +691,33 @@ namespace DUNE
         m_recipient->bind(message_id, consumer);
       }
 
+      //! Register a consumer for a given message identifier and
+      //! select which messages are delivered to it.
+      //! @param[in] message_id message identifier.
+      //! @param[in] consumer consumer object.
+      //! @param[in] sub subscription.
+      void
+      bind(unsigned int message_id, AbstractConsumer* consumer, const IMC::Subscription& sub)
+      {
+        bind(message_id, consumer);
+        setSubscription(message_id, consumer, sub);
+      }
+
+      //! Select which messages of a bound message identifier are
+      //! delivered to a consumer. When it is the only consumer of
+      //! the message, messages not matching the subscription are
+      //! discarded by the bus before being queued. Has no effect if
+      //! the consumer is not bound to the message.
+      //! @param[in] message_id message identifier.
+      //! @param[in] consumer consumer object.
+      //! @param[in] sub subscription.
+      void
+      setSubscription(unsigned int message_id, const AbstractConsumer* consumer,
+                      const IMC::Subscription& sub)
+      {
+        m_recipient->setSubscription(message_id, consumer, sub);
+      }
+
       //! Request task to start/resume normal execution.
       void
       requestActivation(void);
@@ -768,6 +867,26 @@ namespace DUNE
       virtual void
       onMain(void) = 0;
 
+      //! Called by the task pool, in place of onMain(), when the task
+      //! runs as a job of the pool (see paramExecutionModel()).
+      //! @param[in] first true on the first step after the resources
+      //! are initialized.
+      //! @return monotonic time (see Time::Clock::get()) of the next
+      //! step or a negative value to wait for messages.
+      virtual double
+      onStep(bool first)
+      {
+        (void)first;
+        consumeMessages();
+        return -1.0;
+      }
+
+      void
+      startImpl(void);
+
+      void
+      joinImpl(void);
+
     private:
       struct BasicArguments
       {
@@ -779,14 +898,44 @@ namespace DUNE
         uint16_t deact_time;
         //! Scheduling priority.
         unsigned int priority;
+        //! Scheduling policy.
+        std::string policy;
+        //! Processors the task may run on.
+        std::vector<unsigned> affinity;
+        //! True to lock the process memory.
+        bool lock_memory;
+        //! Amount of stack to prefault (KiB).
+        unsigned stack_prefault;
         //! True if task is active.
         bool active;
         //! Scope of 'Active' parameter.
         std::string active_scope;
         //! Visibility of 'Active' parameter.
         std::string active_visibility;
+        //! Message queue capacity.
+        unsigned queue_capacity;
+        //! Message queue overflow policy.
+        std::string queue_policy;
+        //! Execution model.
+        std::string exec_model;
+      };
+
+      //! States of a task running in the task pool.
+      enum JobState
+      {
+        //! Acquiring resources.
+        JOB_SETUP,
+        //! Initializing resources.
+        JOB_INIT,
+        //! Running.
+        JOB_RUN,
+        //! Waiting to restart.
+        JOB_RESTART
       };
 
+      // Forward declaration.
+      class Job;
+
       //! Message recipient (queue).
       Recipient* m_recipient;
       //! Task name.
@@ -807,6 +956,24 @@ namespace DUNE
       bool m_honours_active;
       //! Name of parameter section editor.
       std::string m_param_editor;
+      //! True if the task may run in the task pool.
+      bool m_job_allowed;
+      //! True to run a step whenever messages are queued.
+      bool m_job_on_message;
+      //! Executor running the task, NULL for a dedicated thread.
+      Executor* m_executor;
+      //! Job of the task in the executor.
+      Executor::Job* m_job;
+      //! State of the job.
+      JobState m_job_state;
+      //! Time at which the job restarts.
+      double m_job_restart;
+      //! Signals that scheduling settings were applied.
+      Concurrency::Condition m_sched_cond;
+      //! True if scheduling settings were applied.
+      bool m_sched_applied;
+      //! Description of the effective scheduling settings.
+      std::string m_sched_info;
 
       //! Report current entity states by dispatching EntityState
       //! messages. This function will at least report the state of
@@ -820,6 +987,26 @@ namespace DUNE
       void
       run(void);
 
+      //! Apply scheduling settings to the calling (task) thread.
+      void
+      applyScheduling(void);
+
+      //! Run one step of the task in the task pool.
+      //! @return monotonic time of the next step or a negative value
+      //! to wait for messages.
+      double
+      step(void);
+
+      //! Report a restart request.
+      //! @param[in] e restart request.
+      void
+      reportRestart(RestartNeeded& e);
+
+      //! Report an uncaught exception.
+      //! @param[in] e exception.
+      void
+      reportFailure(const std::exception& e);
+
       //! Consume QueryEntityState messages and reply accordingly.
       //! @param[in] msg QueryEntityState message.
       void
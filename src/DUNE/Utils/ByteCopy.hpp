@@ -568,10 +568,17 @@ namespace DUNE
     inline void
     reverseCopy4b(char* dest, const char* src)
     {
+#if defined(DUNE_CXX_GNU) || defined(DUNE_CXX_CLANG)
+      uint32_t tmp;
+      std::memcpy(&tmp, src, 4);
+      tmp = __builtin_bswap32(tmp);
+      std::memcpy(dest, &tmp, 4);
+#else
       dest[0] = src[3];
       dest[1] = src[2];
       dest[2] = src[1];
       dest[3] = src[0];
+#endif
     }
 
     //! Copy eight bytes of a memory area while reversing the order of
@@ -581,6 +588,12 @@ namespace DUNE
     inline void
     reverseCopy8b(char* dest, const char* src)
     {
+#if defined(DUNE_CXX_GNU) || defined(DUNE_CXX_CLANG)
+      uint64_t tmp;
+      std::memcpy(&tmp, src, 8);
+      tmp = __builtin_bswap64(tmp);
+      std::memcpy(dest, &tmp, 8);
+#else
       dest[0] = src[7];
       dest[1] = src[6];
       dest[2] = src[5];
@@ -589,6 +602,7 @@ namespace DUNE
       dest[5] = src[2];
       dest[6] = src[1];
       dest[7] = src[0];
+#endif
     }
 
     //! Copy a 16 bit unsigned integer to a memory area while reversing
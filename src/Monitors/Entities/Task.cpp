@@ -127,6 +127,8 @@ namespace Monitors
         .minimumValue("0")
         .description("Maximum number of consecutive transitions before starting to ignore");
 
+        paramExecutionModel(true);
+
         bind<IMC::EntityState>(this);
         bind<IMC::MonitorEntityState>(this);
       }
@@ -215,6 +215,8 @@ namespace Monitors
         m_ctx.config.get("General", "Battery Capacity", "700.0", m_args.filter_args.full_capacity);
         m_ctx.config.get("General", "Battery Packs", "4", m_args.battery_packs);
 
+        paramExecutionModel(false);
+
         // Register listeners.
         bind<IMC::Voltage>(this);
         bind<IMC::Current>(this);
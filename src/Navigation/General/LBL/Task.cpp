@@ -167,6 +167,10 @@ namespace Navigation
                             IMC::GpsFix::GFV_VALID_HDOP |
                             IMC::GpsFix::GFV_VALID_HACC);
 
+          // Measurement noise is diagonal, update without allocations.
+          m_kal.setUpdateMethod(KalmanFilter::UPDATE_SEQUENTIAL);
+          m_kal.setJosephForm(true);
+
           // Register callbacks.
           bind<IMC::EstimatedState>(this);
           bind<IMC::EulerAngles>(this);
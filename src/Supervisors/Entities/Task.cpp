@@ -86,6 +86,8 @@ namespace Supervisors
         .defaultValue("")
         .description("List of entity labels that should be enabled on remote operation mode");
 
+        paramExecutionModel(false);
+
         // Register listeners.
         bind<IMC::VehicleState>(this);
       }
@@ -0,0 +1,193 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Connection.hpp"
+
+namespace Transports
+{
+  namespace HTTP
+  {
+    using DUNE_NAMESPACES;
+
+    //! Size of the read buffer.
+    static const size_t c_read_size = 4096;
+    //! Maximum amount of received data waiting to be handled.
+    static const size_t c_max_input_size = 1024 * 1024;
+    //! Maximum number of file bytes sent per write.
+    static const int64_t c_max_file_write = 1024 * 1024;
+
+    Connection::Connection(TCPSocket* sock):
+      m_sock(sock),
+      m_output_size(0),
+      m_keep_alive(true),
+      m_activity(Clock::get())
+    { }
+
+    Connection::~Connection(void)
+    {
+      for (size_t i = 0; i < m_output.size(); ++i)
+      {
+        if (m_output[i].file != NULL)
+          std::fclose(m_output[i].file);
+      }
+
+      delete m_sock;
+    }
+
+    bool
+    Connection::receive(void)
+    {
+      char bfr[c_read_size];
+
+      try
+      {
+        while (true)
+        {
+          size_t rv = m_sock->read(bfr, sizeof(bfr));
+          if (rv == 0)
+            return true;
+
+          m_input.append(bfr, rv);
+          m_activity = Clock::get();
+
+          // Clients that keep sending without reading the responses
+          // are dropped.
+          if (m_input.size() > c_max_input_size)
+            return false;
+
+          // Short read, the socket has been drained.
+          if (rv < sizeof(bfr))
+            return true;
+        }
+      }
+      catch (Network::ConnectionClosed&)
+      {
+        return false;
+      }
+    }
+
+    void
+    Connection::write(const char* data, size_t size)
+    {
+      if (size == 0)
+        return;
+
+      // Consecutive writes are merged to send them in one call.
+      if (m_output.empty() || !m_output.back().path.empty())
+      {
+        Chunk chunk;
+        chunk.file = NULL;
+        chunk.offset = 0;
+        chunk.size = 0;
+        m_output.push_back(chunk);
+      }
+
+      m_output.back().data.append(data, size);
+      m_output_size += size;
+    }
+
+    void
+    Connection::writeFile(const std::string& file, int64_t offset, int64_t size)
+    {
+      if (size <= 0)
+        return;
+
+      Chunk chunk;
+      chunk.path = file;
+      chunk.file = NULL;
+      chunk.offset = offset;
+      chunk.size = size;
+      m_output.push_back(chunk);
+      m_output_size += size;
+    }
+
+    bool
+    Connection::flush(void)
+    {
+      while (!m_output.empty())
+      {
+        Chunk& chunk = m_output.front();
+        size_t rv = 0;
+
+        if (chunk.path.empty())
+        {
+          rv = m_sock->write(chunk.data.c_str() + chunk.offset,
+                             chunk.data.size() - chunk.offset);
+        }
+        else
+        {
+          if (chunk.file == NULL)
+          {
+            chunk.file = std::fopen(chunk.path.c_str(), "rb");
+            if (chunk.file == NULL)
+              throw std::runtime_error(String::str("failed to open %s: %s", chunk.path.c_str(),
+                                                   System::Error::getLastMessage().c_str()));
+          }
+
+          rv = m_sock->writeFile(chunk.file, chunk.offset,
+                                 (size_t)std::min(chunk.size, c_max_file_write));
+        }
+
+        // Socket buffer is full.
+        if (rv == 0)
+          return false;
+
+        m_activity = Clock::get();
+        m_output_size -= rv;
+        chunk.offset += rv;
+
+        if (chunk.path.empty())
+        {
+          if ((size_t)chunk.offset < chunk.data.size())
+            continue;
+        }
+        else
+        {
+          chunk.size -= rv;
+          if (chunk.size > 0)
+            continue;
+
+          std::fclose(chunk.file);
+        }
+
+        m_output.pop_front();
+      }
+
+      return true;
+    }
+  }
+}
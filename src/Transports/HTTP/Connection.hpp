@@ -0,0 +1,202 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef TRANSPORTS_HTTP_CONNECTION_HPP_INCLUDED_
+#define TRANSPORTS_HTTP_CONNECTION_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <deque>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace HTTP
+  {
+    //! Client connection of the HTTP server. Incoming data is
+    //! buffered until complete requests are available and responses
+    //! are queued and written without blocking, so that several
+    //! requests can be served over the same connection.
+    class Connection
+    {
+    public:
+      //! Constructor.
+      //! @param[in] sock connected socket, the connection takes
+      //! ownership of it.
+      Connection(DUNE::Network::TCPSocket* sock);
+
+      //! Destructor.
+      ~Connection(void);
+
+      //! Retrieve the native handle of the connection's socket.
+      //! @return native I/O handle.
+      DUNE::IO::NativeHandle
+      getNative(void) const
+      {
+        return m_sock->getNative();
+      }
+
+      //! Read all data available on the socket.
+      //! @return false if the peer closed the connection, true
+      //! otherwise.
+      bool
+      receive(void);
+
+      //! Retrieve the data received but not yet consumed.
+      //! @return input buffer.
+      const std::string&
+      getInput(void) const
+      {
+        return m_input;
+      }
+
+      //! Discard data from the beginning of the input buffer.
+      //! @param[in] size number of bytes to discard.
+      void
+      consumeInput(size_t size)
+      {
+        m_input.erase(0, size);
+      }
+
+      //! Retrieve the content of the request being handled.
+      //! @return request content.
+      const std::string&
+      getContent(void) const
+      {
+        return m_content;
+      }
+
+      //! Set the content of the request being handled.
+      //! @param[in] content request content.
+      void
+      setContent(const std::string& content)
+      {
+        m_content = content;
+      }
+
+      //! Test if the connection is kept open after the current
+      //! response.
+      //! @return true if the connection is persistent, false
+      //! otherwise.
+      bool
+      getKeepAlive(void) const
+      {
+        return m_keep_alive;
+      }
+
+      //! Select if the connection is kept open after the current
+      //! response.
+      //! @param[in] enabled true to keep the connection open, false
+      //! to close it once all responses are sent.
+      void
+      setKeepAlive(bool enabled)
+      {
+        m_keep_alive = enabled;
+      }
+
+      //! Queue data for transmission.
+      //! @param[in] data data buffer.
+      //! @param[in] size number of bytes to send.
+      void
+      write(const char* data, size_t size);
+
+      //! Queue part of a file for transmission. The file is only
+      //! opened when the data before it has been sent.
+      //! @param[in] file file name.
+      //! @param[in] offset offset of the first byte to send.
+      //! @param[in] size number of bytes to send.
+      void
+      writeFile(const std::string& file, int64_t offset, int64_t size);
+
+      //! Retrieve the number of bytes queued for transmission.
+      //! @return number of bytes.
+      int64_t
+      getOutputSize(void) const
+      {
+        return m_output_size;
+      }
+
+      //! Send as much of the queued data as possible without
+      //! blocking.
+      //! @return true if all data was sent, false otherwise.
+      //! @throw std::runtime_error if a queued file cannot be opened.
+      bool
+      flush(void);
+
+      //! Retrieve the time of the last data transfer.
+      //! @return time in seconds.
+      double
+      getLastActivity(void) const
+      {
+        return m_activity;
+      }
+
+    private:
+      //! Queued output.
+      struct Chunk
+      {
+        //! Data to send, if this is not a file.
+        std::string data;
+        //! Name of the file to send, empty if this is not a file.
+        std::string path;
+        //! File being sent, opened when the chunk is reached.
+        std::FILE* file;
+        //! Offset of the next byte to send.
+        int64_t offset;
+        //! Number of bytes left to send.
+        int64_t size;
+      };
+
+      //! Connected socket.
+      DUNE::Network::TCPSocket* m_sock;
+      //! Received data.
+      std::string m_input;
+      //! Content of the request being handled.
+      std::string m_content;
+      //! Queued output.
+      std::deque<Chunk> m_output;
+      //! Number of bytes queued for transmission.
+      int64_t m_output_size;
+      //! True if the connection is persistent.
+      bool m_keep_alive;
+      //! Time of the last data transfer.
+      double m_activity;
+
+      // Non-copyable.
+      Connection(const Connection&);
+
+      // Non-assignable.
+      Connection&
+      operator=(const Connection&);
+    };
+  }
+}
+
+#endif
@@ -39,6 +39,17 @@ namespace Transports
   {
     using DUNE_NAMESPACES;
 
+    //! Escape a string to be used as a JSON string value.
+    //! @param[in] str string.
+    //! @return escaped string.
+    static std::string
+    escapeJSON(const std::string& str)
+    {
+      std::string val = String::replace(str, '\\', "\\\\");
+      val = String::replace(val, '"', "\\\"");
+      return String::escape(val);
+    }
+
     MessageMonitor::MessageMonitor(const std::string& system, uint64_t uid):
       m_uid(uid),
       m_last_msgs_json(0),
@@ -214,6 +225,71 @@ namespace Transports
       m_logbook.push_back(new IMC::LogBookEntry(*msg));
     }
 
+    void
+    MessageMonitor::updateTaskStatistics(const IMC::Event* msg)
+    {
+      ScopedMutex l(m_mutex);
+      m_task_stats[msg->getSourceEntity()] = msg->data;
+    }
+
+    std::string
+    MessageMonitor::tasksJSON(void)
+    {
+      ScopedMutex l(m_mutex);
+
+      std::ostringstream os;
+      os << "{\n  \"tasks\": [";
+
+      std::map<unsigned, std::string>::const_iterator itr = m_task_stats.begin();
+      for (; itr != m_task_stats.end(); ++itr)
+      {
+        if (itr != m_task_stats.begin())
+          os << ",";
+
+        std::string label;
+        EntityMap::const_iterator eitr = m_entities.find(itr->first);
+        if (eitr != m_entities.end())
+          label = eitr->second;
+
+        os << "\n    {\"entity\": \"" << escapeJSON(label) << "\"";
+
+        std::map<std::string, std::string> tuples = TupleList(itr->second).getMap();
+        std::ostringstream msgs;
+        std::map<std::string, std::string>::const_iterator titr = tuples.begin();
+        for (; titr != tuples.end(); ++titr)
+        {
+          std::vector<std::string> fields;
+          String::split(titr->second, ":", fields);
+
+          if (fields.size() == 1)
+          {
+            os << ", \"" << titr->first << "\": " << fields[0];
+            continue;
+          }
+
+          if (fields.size() != 6)
+            continue;
+
+          if (!msgs.str().empty())
+            msgs << ", ";
+
+          msgs << "\"" << titr->first << "\": {"
+               << "\"count\": " << fields[0]
+               << ", \"latency_mean\": " << fields[1]
+               << ", \"latency_p99\": " << fields[2]
+               << ", \"latency_max\": " << fields[3]
+               << ", \"execution_mean\": " << fields[4]
+               << ", \"execution_max\": " << fields[5]
+               << "}";
+        }
+
+        os << ", \"messages\": {" << msgs.str() << "}}";
+      }
+
+      os << "\n  ]\n}\n";
+      return os.str();
+    }
+
     void
     MessageMonitor::updatePowerChannel(const IMC::PowerChannelState* msg)
     {
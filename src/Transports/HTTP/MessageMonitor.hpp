@@ -63,6 +63,16 @@ namespace Transports
       void
       updateMessage(const DUNE::IMC::Message* msg);
 
+      //! Store the latest task statistics of an entity.
+      //! @param[in] msg task statistics event.
+      void
+      updateTaskStatistics(const DUNE::IMC::Event* msg);
+
+      //! Retrieve the latest task statistics in JSON format.
+      //! @return JSON document.
+      std::string
+      tasksJSON(void);
+
       void
       readLock(void)
       {
@@ -104,6 +114,8 @@ namespace Transports
       uint64_t m_last_logbook_json;
       // Number of logbook messages to show.
       unsigned int m_log_entry;
+      //! Latest task statistics (list of tuples) by entity.
+      std::map<unsigned, std::string> m_task_stats;
 
       void
       updatePowerChannel(const DUNE::IMC::PowerChannelState* msg);
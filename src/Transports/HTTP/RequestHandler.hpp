@@ -38,6 +38,9 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "Connection.hpp"
+
 namespace Transports
 {
   namespace HTTP
@@ -57,61 +60,80 @@ namespace Transports
       { }
 
       virtual void
-      handleGET(TCPSocket* sock, Utils::TupleList& headers, const char* uri);
+      handleGET(Connection* conn, Utils::TupleList& headers, const char* uri);
 
       virtual void
-      handlePOST(TCPSocket* sock, Utils::TupleList& headers, const char* uri);
+      handlePOST(Connection* conn, Utils::TupleList& headers, const char* uri);
 
       virtual void
-      handlePUT(TCPSocket* sock, Utils::TupleList& headers, const char* uri);
+      handlePUT(Connection* conn, Utils::TupleList& headers, const char* uri);
+
+      void
+      sendHeader(Connection* conn, const char* status_line, int64_t length, HeaderFieldsMap* hdr_fields = 0);
 
       void
-      sendHeader(TCPSocket* sock, const char* status_line, int64_t length, HeaderFieldsMap* hdr_fields = 0);
+      sendResponse100(Connection* conn);
 
       void
-      sendResponse100(TCPSocket* sock);
+      sendResponse201(Connection* conn);
 
       void
-      sendResponse201(TCPSocket* sock);
+      sendResponse200(Connection* conn);
 
       void
-      sendResponse200(TCPSocket* sock);
+      sendResponse400(Connection* conn);
 
       void
-      sendResponse403(TCPSocket* sock);
+      sendResponse403(Connection* conn);
 
       void
-      sendResponse404(TCPSocket* sock, const std::string& message);
+      sendResponse404(Connection* conn, const std::string& message);
 
       inline void
-      sendResponse404(TCPSocket* sock)
+      sendResponse404(Connection* conn)
       {
-        sendResponse404(sock, "Not Found");
+        sendResponse404(conn, "Not Found");
       }
 
       void
-      sendResponse416(TCPSocket* sock);
+      sendResponse416(Connection* conn);
 
       void
-      sendResponse500(TCPSocket* sock);
+      sendResponse500(Connection* conn);
 
       void
-      sendResponse503(TCPSocket* sock);
+      sendResponse501(Connection* conn);
 
       void
-      sendData(TCPSocket* sock, const char* data, int size, HeaderFieldsMap* hdr_fields = 0);
+      sendResponse503(Connection* conn);
+
+      void
+      sendData(Connection* conn, const char* data, int size, HeaderFieldsMap* hdr_fields = 0);
 
       inline void
-      sendData(TCPSocket* sock, const std::string& data, HeaderFieldsMap* hdr_fields = 0)
+      sendData(Connection* conn, const std::string& data, HeaderFieldsMap* hdr_fields = 0)
       {
-        sendData(sock, data.c_str(), (int)data.size(), hdr_fields);
+        sendData(conn, data.c_str(), (int)data.size(), hdr_fields);
       }
 
       void
-      sendFile(TCPSocket* sock, const std::string& file, HeaderFieldsMap& hdr_fields, int64_t off_beg = -1, int64_t off_end = -1);
-
+      sendFile(Connection* conn, const std::string& file, HeaderFieldsMap& hdr_fields, int64_t off_beg = -1, int64_t off_end = -1);
+
+      //! Handle the next request received by a connection. The
+      //! response is queued in the connection, which is marked to be
+      //! closed after it if the client does not keep it alive or the
+      //! request is invalid.
+      //! @param[in] conn client connection.
+      //! @return true if a request was handled, false if no complete
+      //! request was received yet.
+      bool
+      handleRequest(Connection* conn);
+
+    private:
+      //! Answer a malformed request and close the connection.
+      //! @param[in] conn client connection.
       void
-      handleRequest(TCPSocket* sock);
+      rejectRequest(Connection* conn);
     };
   }
 }
@@ -28,121 +28,282 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
-#include <sstream>
-#include <fstream>
-#include <queue>
-#include <iostream>
+#include <algorithm>
+#include <map>
+#include <vector>
 
 // DUNE headers.
-#include <DUNE/Streams/Terminal.hpp>
-#include <DUNE/Concurrency/TSQueue.hpp>
-#include <DUNE/Concurrency/Condition.hpp>
-#include <DUNE/Concurrency/Mutex.hpp>
-#include <DUNE/Network.hpp>
+#include <DUNE/DUNE.hpp>
 
 // Local headers.
+#include "Connection.hpp"
 #include "Server.hpp"
 
 namespace Transports
 {
   namespace HTTP
   {
-    class Handler: public Concurrency::Thread
+    //! Polling period.
+    static const double c_poll_period = 1.0;
+    //! Time after which idle connections are closed.
+    static const double c_idle_timeout = 15.0;
+    //! Time to stop accepting connections after an accept error.
+    static const double c_accept_backoff = 0.5;
+    //! Amount of queued output above which requests are not parsed.
+    static const int64_t c_max_output_size = 64 * 1024;
+
+    class Worker: public Concurrency::Thread
     {
     public:
-      Handler(RequestHandler& hdler, Concurrency::TSQueue<TCPSocket*>& queue):
-        m_handler(hdler),
-        m_queue(queue)
-      { }
+      Worker(RequestHandler& handler, TCPSocket& listener):
+        m_handler(handler),
+        m_listener(listener),
+        m_accept_resume(-1.0)
+      {
+        m_poll.add(m_listener);
+      }
+
+      ~Worker(void)
+      {
+        ConnectionMap::iterator itr = m_conns.begin();
+        for (; itr != m_conns.end(); ++itr)
+          delete itr->second;
+      }
 
     private:
+      typedef std::map<IO::NativeHandle, Connection*> ConnectionMap;
+
+      //! HTTP request handler.
       RequestHandler& m_handler;
-      Concurrency::TSQueue<TCPSocket*>& m_queue;
+      //! Listening socket.
+      TCPSocket& m_listener;
+      //! I/O multiplexing.
+      IO::Poll m_poll;
+      //! Open connections.
+      ConnectionMap m_conns;
+      //! Time at which the listening socket is watched again, if
+      //! accepting was suspended.
+      double m_accept_resume;
 
+      //! Accept pending connections. Workers compete for the
+      //! listening socket, so there may be none left.
       void
-      run(void)
+      accept(void)
       {
-        while (!isStopping())
+        while (true)
         {
-          if (!m_queue.waitForItems(1.0))
-            continue;
-
-          if (m_queue.closed())
-            break;
-
-          TCPSocket* sock = m_queue.pop();
-          if (!sock)
-            continue;
+          TCPSocket* sock = NULL;
 
           try
           {
-            m_handler.handleRequest(sock);
+            sock = m_listener.accept();
+            if (sock == NULL)
+              return;
+
+            sock->setNonBlocking(true);
+            sock->setNoDelay(true);
+          }
+          catch (std::runtime_error& e)
+          {
+            DUNE_ERR("Server", e.what());
+
+            // Errors such as running out of file descriptors persist
+            // while the connection stays queued, and the listener
+            // would be reported again by every poll.
+            if (sock == NULL)
+              suspendAccept();
+
+            delete sock;
+            return;
           }
-          catch (...)
-          { }
 
-          delete sock;
+          Connection* conn = new Connection(sock);
+          m_conns[conn->getNative()] = conn;
+          m_poll.add(conn->getNative());
         }
       }
-    };
 
-    Server::Server(int port, unsigned threads, RequestHandler& handler):
-      m_handler(handler)
-    {
-      m_sock.bind(port);
-      m_sock.listen(1024);
-      m_poll.add(m_sock);
+      //! Stop watching the listening socket for a while.
+      void
+      suspendAccept(void)
+      {
+        m_poll.remove(m_listener);
+        m_accept_resume = Clock::get() + c_accept_backoff;
+      }
 
-      for (unsigned int i = 0; i < threads; ++i)
+      //! Watch the listening socket again once the suspension
+      //! expires.
+      void
+      resumeAccept(void)
       {
-        Concurrency::Thread* t = new Handler(handler, m_queue);
-        m_pool.push_back(t);
-        t->start();
+        if (m_accept_resume < 0 || Clock::get() < m_accept_resume)
+          return;
+
+        m_poll.add(m_listener);
+        m_accept_resume = -1.0;
       }
-    }
 
-    Server::~Server(void)
-    {
-      m_queue.close();
+      //! Close a connection.
+      //! @param[in] itr connection.
+      void
+      close(ConnectionMap::iterator itr)
+      {
+        m_poll.remove(itr->first);
+        delete itr->second;
+        m_conns.erase(itr);
+      }
 
-      for (unsigned i = 0; i < m_pool.size(); ++i)
+      //! Handle the requests received by a connection and send the
+      //! responses.
+      //! @param[in] conn connection.
+      //! @param[in] readable true if there is data to be read.
+      //! @return false if the connection must be closed, true
+      //! otherwise.
+      bool
+      serve(Connection* conn, bool readable)
       {
         try
         {
-          m_pool[i]->stopAndJoin();
+          if (readable && !conn->receive())
+            return false;
+
+          // Pipelined requests are answered in order, but only while
+          // few responses are queued. The remaining requests stay
+          // buffered until the client reads what was sent.
+          bool flushed = false;
+          while (true)
+          {
+            while (conn->getKeepAlive()
+                   && conn->getOutputSize() < c_max_output_size
+                   && m_handler.handleRequest(conn))
+            { }
+
+            bool full = conn->getOutputSize() >= c_max_output_size;
+            flushed = conn->flush();
+            if (!flushed || !full || !conn->getKeepAlive())
+              break;
+          }
+
+          if (flushed && !conn->getKeepAlive())
+            return false;
+
+          m_poll.watchWrite(conn->getNative(), !flushed);
+          return true;
+        }
+        catch (std::exception& e)
+        {
+          DUNE_DBG("Server", e.what());
         }
         catch (...)
         { }
 
-        delete m_pool[i];
+        return false;
+      }
+
+      //! Serve the handles reported by the last poll.
+      void
+      dispatch(void)
+      {
+        // Copies are needed since closing connections changes the
+        // lists.
+        std::vector<IO::NativeHandle> readable = m_poll.getTriggered();
+        std::vector<IO::NativeHandle> writable = m_poll.getWritable();
+
+        for (size_t i = 0; i < readable.size(); ++i)
+        {
+          if (readable[i] == m_listener.getNative())
+          {
+            accept();
+            continue;
+          }
+
+          ConnectionMap::iterator itr = m_conns.find(readable[i]);
+          if (itr != m_conns.end() && !serve(itr->second, true))
+            close(itr);
+        }
+
+        for (size_t i = 0; i < writable.size(); ++i)
+        {
+          ConnectionMap::iterator itr = m_conns.find(writable[i]);
+          if (itr != m_conns.end() && !serve(itr->second, false))
+            close(itr);
+        }
       }
 
-      while (!m_queue.empty())
+      //! Close connections without activity.
+      void
+      expire(void)
       {
-        TCPSocket* sock = m_queue.pop();
-        if (sock)
-          delete sock;
+        double now = Clock::get();
+
+        ConnectionMap::iterator itr = m_conns.begin();
+        while (itr != m_conns.end())
+        {
+          ConnectionMap::iterator cur = itr++;
+          if (now - cur->second->getLastActivity() > c_idle_timeout)
+            close(cur);
+        }
       }
-    }
 
-    void
-    Server::poll(double timeout)
-    {
-      if (m_poll.poll(timeout))
+      void
+      run(void)
       {
-        if (m_poll.wasTriggered(m_sock))
+        double last_expire = Clock::get();
+
+        while (!isStopping())
         {
+          double timeout = c_poll_period;
+          if (m_accept_resume >= 0)
+            timeout = std::max(0.0, std::min(timeout, m_accept_resume - Clock::get()));
+
           try
           {
-            TCPSocket* nc = m_sock.accept();
-            m_queue.push(nc);
+            if (m_poll.poll(timeout))
+              dispatch();
           }
           catch (std::runtime_error& e)
           {
             DUNE_ERR("Server", e.what());
           }
+
+          resumeAccept();
+
+          if (Clock::get() - last_expire >= c_poll_period)
+          {
+            expire();
+            last_expire = Clock::get();
+          }
         }
       }
+    };
+
+    Server::Server(int port, unsigned threads, RequestHandler& handler)
+    {
+      m_sock.bind(port);
+      m_sock.listen(1024);
+      m_sock.setNonBlocking(true);
+
+      for (unsigned int i = 0; i < threads; ++i)
+      {
+        Concurrency::Thread* t = new Worker(handler, m_sock);
+        m_pool.push_back(t);
+        t->start();
+      }
+    }
+
+    Server::~Server(void)
+    {
+      for (unsigned i = 0; i < m_pool.size(); ++i)
+      {
+        try
+        {
+          m_pool[i]->stopAndJoin();
+        }
+        catch (...)
+        { }
+
+        delete m_pool[i];
+      }
     }
   }
 }
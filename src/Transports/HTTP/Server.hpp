@@ -43,6 +43,10 @@ namespace Transports
 {
   namespace HTTP
   {
+    //! Event driven HTTP server. Each worker thread accepts
+    //! connections from the shared listening socket and serves them
+    //! from its own polling loop, keeping connections open between
+    //! requests.
     class Server
     {
     public:
@@ -55,20 +59,11 @@ namespace Transports
       //! Destructor.
       ~Server(void);
 
-      void
-      poll(double timeout);
-
     private:
-      //! HTTP request handler.
-      RequestHandler& m_handler;
       //! Server socket.
       TCPSocket m_sock;
       //! Worker threads pool.
       std::vector<Concurrency::Thread*> m_pool;
-      //! Socket queue.
-      Concurrency::TSQueue<TCPSocket*> m_queue;
-      //! I/O multiplexing.
-      IO::Poll m_poll;
     };
   }
 }
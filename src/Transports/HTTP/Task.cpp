@@ -104,6 +104,7 @@ namespace Transports
         m_agent = getSystemName();
 
         bind<IMC::LogBookEntry>(this);
+        bind<IMC::Event>(this);
       }
 
       void
@@ -173,6 +174,16 @@ namespace Transports
         m_msg_mon.addLogEntry(msg);
       }
 
+      void
+      consume(const IMC::Event* msg)
+      {
+        if (msg->getSource() != getSystemId())
+          return;
+
+        if (msg->topic == Tasks::TaskStatistics::c_topic)
+          m_msg_mon.updateTaskStatistics(msg);
+      }
+
       static bool
       isSpecialURI(const char* uri)
       {
@@ -192,26 +203,28 @@ namespace Transports
       }
 
       void
-      handleGET(TCPSocket* sock, TupleList& headers, const char* uri)
+      handleGET(Connection* conn, TupleList& headers, const char* uri)
       {
         debug("GET request: %s", uri);
 
         if (isSpecialURI(uri))
         {
           if (matchURL(uri, "/dune/time/set", true))
-            setTime(sock, headers, uri);
+            setTime(conn, headers, uri);
           else if (matchURL(uri, "/dune/version.js"))
-            sendVersionJSON(sock, headers, uri);
+            sendVersionJSON(conn, headers, uri);
           else if (matchURL(uri, "/dune/agent.js"))
-            sendAgentJSON(sock, headers, uri);
+            sendAgentJSON(conn, headers, uri);
           else if (matchURL(uri, "/dune/state/messages.js"))
-            showMessages(sock, headers, uri);
+            showMessages(conn, headers, uri);
           else if (matchURL(uri, "/dune/power/channel/", true))
-            handlePowerChannel(sock, headers, uri);
+            handlePowerChannel(conn, headers, uri);
           else if (matchURL(uri, "/dune/state/logbook.js", true))
-            showLogBook(sock, headers, uri);
+            showLogBook(conn, headers, uri);
+          else if (matchURL(uri, "/dune/state/tasks.json"))
+            showTasks(conn, headers, uri);
           else
-            sendResponse404(sock);
+            sendResponse404(conn);
         }
         else
         {
@@ -221,30 +234,30 @@ namespace Transports
           else
             path = m_ctx.dir_www / uri;
 
-          sendStaticFile(sock, headers, path);
+          sendStaticFile(conn, headers, path);
         }
       }
 
       void
-      handlePOST(TCPSocket* sock, TupleList& headers, const char* uri)
+      handlePOST(Connection* conn, TupleList& headers, const char* uri)
       {
         debug("POST request: %s", uri);
 
         if (isSpecialURI(uri))
         {
           if (matchURL(uri, "/dune/messages/imc/", true))
-            getMessage(sock, headers, uri);
+            getMessage(conn, headers, uri);
           else
-            sendResponse403(sock);
+            sendResponse403(conn);
         }
         else
         {
-          sendResponse403(sock);
+          sendResponse403(conn);
         }
       }
 
       void
-      handlePUT(TCPSocket* sock, TupleList& headers, const char* uri)
+      handlePUT(Connection* conn, TupleList& headers, const char* uri)
       {
         debug("PUT request: %s", uri);
 
@@ -252,16 +265,16 @@ namespace Transports
 
         if (isSpecialURI(uri))
         {
-          sendResponse403(sock);
+          sendResponse403(conn);
         }
         else
         {
-          sendResponse403(sock);
+          sendResponse403(conn);
         }
       }
 
       void
-      sendStaticFile(TCPSocket* sock, TupleList& headers, const Path& file)
+      sendStaticFile(Connection* conn, TupleList& headers, const Path& file)
       {
         int64_t beg = -1;
         int64_t end = -1;
@@ -288,26 +301,27 @@ namespace Transports
         else if (ext == "js")
           hdr["Content-Type"] = "text/javascript";
 
-        sendFile(sock, file.str(), hdr, beg, end);
+        sendFile(conn, file.str(), hdr, beg, end);
       }
 
       void
-      getMessage(TCPSocket* sock, TupleList& headers, const char* uri)
+      getMessage(Connection* conn, TupleList& headers, const char* uri)
       {
         (void)uri;
 
-        unsigned int size = headers.get("content-length", 0);
-        char* bfr = new char[size];
-        sock->read(bfr, size);
-        IMC::Message* msg = IMC::Packet::deserialize((uint8_t*)bfr, size);
+        (void)headers;
+
+        const std::string& data = conn->getContent();
+        IMC::Message* msg = IMC::Packet::deserialize((const uint8_t*)data.data(), (uint16_t)data.size());
         dispatch(msg, DF_KEEP_TIME);
         std::ostringstream ss;
         msg->toText(ss);
-        sendData(sock, ss.str());
+        delete msg;
+        sendData(conn, ss.str());
       }
 
       void
-      setTime(TCPSocket* sock, TupleList& headers, const char* uri)
+      setTime(Connection* conn, TupleList& headers, const char* uri)
       {
         (void)headers;
 
@@ -318,16 +332,16 @@ namespace Transports
         ss >> secs;
         if (ss.fail())
         {
-          sendResponse500(sock);
+          sendResponse500(conn);
           return;
         }
 
-        sendResponse200(sock);
+        sendResponse200(conn);
         Clock::set(secs);
       }
 
       void
-      showMessages(TCPSocket* sock, TupleList& headers, const char* uri)
+      showMessages(Connection* conn, TupleList& headers, const char* uri)
       {
         (void)headers;
         (void)uri;
@@ -337,11 +351,11 @@ namespace Transports
         hdr["Content-Encoding"] = "gzip";
 
         ByteBuffer* bfr = m_msg_mon.messagesJSON();
-        sendData(sock, bfr->getBufferSigned(), bfr->getSize(), &hdr);
+        sendData(conn, bfr->getBufferSigned(), bfr->getSize(), &hdr);
       }
 
       void
-      showLogBook(TCPSocket* sock, TupleList& headers, const char* uri)
+      showLogBook(Connection* conn, TupleList& headers, const char* uri)
       {
         (void)headers;
         (void)uri;
@@ -351,11 +365,22 @@ namespace Transports
         hdr["Content-Encoding"] = "gzip";
 
         ByteBuffer* bfr = m_msg_mon.logbookJSON();
-        sendData(sock, bfr->getBufferSigned(), bfr->getSize(), &hdr);
+        sendData(conn, bfr->getBufferSigned(), bfr->getSize(), &hdr);
+      }
+
+      void
+      showTasks(Connection* conn, TupleList& headers, const char* uri)
+      {
+        (void)headers;
+        (void)uri;
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "application/json";
+        sendData(conn, m_msg_mon.tasksJSON(), &hdr);
       }
 
       void
-      sendVersionJSON(TCPSocket* sock, TupleList& headers, const char* uri)
+      sendVersionJSON(Connection* conn, TupleList& headers, const char* uri)
       {
         (void)headers;
         (void)uri;
@@ -364,11 +389,11 @@ namespace Transports
         os << "var systemVersion = '" << getFullVersion() << " - " << getCompileDate() << "';";
         RequestHandler::HeaderFieldsMap hdr;
         hdr["Content-Type"] = "text/javascript";
-        sendData(sock, os.str(), &hdr);
+        sendData(conn, os.str(), &hdr);
       }
 
       void
-      sendAgentJSON(TCPSocket* sock, TupleList& headers, const char* uri)
+      sendAgentJSON(Connection* conn, TupleList& headers, const char* uri)
       {
         (void)headers;
         (void)uri;
@@ -377,11 +402,11 @@ namespace Transports
         os << "var systemName = '" << m_agent << "';";
         RequestHandler::HeaderFieldsMap hdr;
         hdr["Content-Type"] = "text/javascript";
-        sendData(sock, os.str(), &hdr);
+        sendData(conn, os.str(), &hdr);
       }
 
       void
-      handlePowerChannel(TCPSocket* sock, TupleList& headers, const char* uri)
+      handlePowerChannel(Connection* conn, TupleList& headers, const char* uri)
       {
         (void)headers;
 
@@ -391,7 +416,7 @@ namespace Transports
 
         if (parts.size() != 2 && parts.size() != 5)
         {
-          sendResponse500(sock);
+          sendResponse500(conn);
           return;
         }
 
@@ -401,7 +426,7 @@ namespace Transports
           unsigned t = 0;
           if (!castLexical(parts[2], t))
           {
-            sendResponse500(sock);
+            sendResponse500(conn);
             return;
           }
           else
@@ -409,7 +434,7 @@ namespace Transports
 
           if (!castLexical(parts[3], t))
           {
-            sendResponse500(sock);
+            sendResponse500(conn);
             return;
           }
           else
@@ -417,7 +442,7 @@ namespace Transports
 
           if (!castLexical(parts[4], t))
           {
-            sendResponse500(sock);
+            sendResponse500(conn);
             return;
           }
           else
@@ -444,7 +469,7 @@ namespace Transports
           pcc.sched_time = sched_time;
         }
 
-        sendResponse200(sock);
+        sendResponse200(conn);
         dispatch(pcc);
       }
 
@@ -454,8 +479,7 @@ namespace Transports
         while (!stopping())
         {
           setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
-          m_server->poll(1.0);
-          consumeMessages();
+          waitForMessages(1.0);
         }
       }
     };
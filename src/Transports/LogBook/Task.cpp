@@ -61,6 +61,8 @@ namespace Transports
         m_reply.command = IMC::LogBookControl::LBC_REPLY;
         m_start_time = Time::Clock::getSinceEpoch();
 
+        paramExecutionModel(true);
+
         bind<IMC::LogBookEntry>(this);
         bind<IMC::LogBookControl>(this);
       }
@@ -37,6 +37,9 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "Writer.hpp"
+
 namespace Transports
 {
   namespace Logging
@@ -58,6 +61,20 @@ namespace Transports
       unsigned lsf_volume_size;
       // Compression method.
       std::string lsf_compression;
+      // Size of each write buffer.
+      unsigned lsf_buffer_size;
+      // Number of write buffers.
+      unsigned lsf_buffer_count;
+      // Compress in independent blocks.
+      bool lsf_blocks;
+      // Number of compression threads.
+      unsigned lsf_threads;
+      // Maximum amount of data being compressed.
+      unsigned lsf_memory;
+      // Write LSF index.
+      bool lsf_index;
+      // Time span of each index entry.
+      double lsf_index_interval;
     };
 
     struct Task: public Tasks::Task
@@ -72,10 +89,14 @@ namespace Transports
       std::string m_volume_dir;
       // Compression format.
       Compression::Methods m_compression;
-      // Output file stream for LSF/LSF_GZ formats.
-      std::ostream* m_lsf;
+      // Asynchronous writer for LSF/LSF_GZ formats.
+      Writer* m_lsf;
+      // Writer stalls already reported.
+      unsigned long m_stalls;
       // Path to LSF file.
       Path m_lsf_file;
+      // LSF index writer.
+      IMC::LsfIndex::Writer* m_index;
       // Serialization buffer.
       ByteBuffer m_buffer;
       // Logging control message.
@@ -89,6 +110,8 @@ namespace Transports
         Tasks::Task(name, ctx),
         m_last_flush(0),
         m_lsf(NULL),
+        m_stalls(0),
+        m_index(NULL),
         m_active(true)
       {
         // Define configuration parameters.
@@ -99,8 +122,55 @@ namespace Transports
 
         param("LSF Compression Method", m_args.lsf_compression)
         .defaultValue("none")
+        .values("none, zlib, gzip, bzip2, lz4")
         .description("Compression method");
 
+        param("LSF Buffer Size", m_args.lsf_buffer_size)
+        .units(Units::Kibibyte)
+        .defaultValue("1024")
+        .minimumValue("4")
+        .visibility(Tasks::Parameter::VISIBILITY_DEVELOPER)
+        .description("Size of each buffer used to hand data to the writer thread");
+
+        param("LSF Buffer Count", m_args.lsf_buffer_count)
+        .defaultValue("4")
+        .minimumValue("2")
+        .visibility(Tasks::Parameter::VISIBILITY_DEVELOPER)
+        .description("Number of buffers used to hand data to the writer thread");
+
+        param("LSF Compression Blocks", m_args.lsf_blocks)
+        .defaultValue("false")
+        .description("Write compressed logs as a sequence of independently"
+                     " compressed blocks of 'LSF Buffer Size', which can be"
+                     " located, decompressed in parallel and recovered"
+                     " individually after a crash");
+
+        param("LSF Compression Threads", m_args.lsf_threads)
+        .defaultValue("1")
+        .minimumValue("1")
+        .description("Number of threads compressing the log. With more than"
+                     " one thread, chunks are compressed concurrently and"
+                     " written in order");
+
+        param("LSF Compression Memory", m_args.lsf_memory)
+        .units(Units::Kibibyte)
+        .defaultValue("4096")
+        .minimumValue("128")
+        .visibility(Tasks::Parameter::VISIBILITY_DEVELOPER)
+        .description("Maximum amount of uncompressed data handed to the"
+                     " compression threads at any time");
+
+        param("LSF Index", m_args.lsf_index)
+        .defaultValue("false")
+        .description("Write an index next to the LSF file so that readers can"
+                     " seek by time and skip blocks without given messages");
+
+        param("LSF Index Interval", m_args.lsf_index_interval)
+        .units(Units::Second)
+        .defaultValue("10.0")
+        .minimumValue("0.1")
+        .description("Time span of each index entry");
+
         param("LSF Volume Size", m_args.lsf_volume_size)
         .units(Units::Mebibyte)
         .defaultValue("0");
@@ -136,6 +206,12 @@ namespace Transports
       void
       onResourceRelease(void)
       {
+        // The index of a block container log needs every block to
+        // be written before its last entries.
+        if (m_lsf != NULL)
+          m_lsf->close();
+
+        Memory::clear(m_index);
         Memory::clear(m_lsf);
       }
 
@@ -283,16 +359,21 @@ namespace Transports
       void
       logFile(const std::string& file)
       {
-        std::ifstream ifs(file.c_str(), std::ios::binary);
-
-        if (!ifs.is_open())
+        if (!Path(file).isFile())
           return;
 
-        char bfr[16 * 1024];
-        while (!ifs.eof())
+        // Copy record by record so that the index is kept.
+        IMC::LsfReader reader(file);
+
+        try
         {
-          ifs.read(bfr, sizeof(bfr));
-          m_lsf->write(bfr, ifs.gcount());
+          while (reader.next())
+            logRecord(reader.getHeader().mgid, reader.getHeader().timestamp,
+                      (const char*)reader.getData(), reader.getSize());
+        }
+        catch (std::exception& e)
+        {
+          war(DTR("failed to log cache snapshot: %s"), e.what());
         }
       }
 
@@ -348,12 +429,30 @@ namespace Transports
         // Stop current log.
         stopLog();
 
-        m_lsf_file = m_dir / "Data.lsf" + Compression::Factory::extension(m_compression);
+        bool blocks = m_args.lsf_blocks && m_compression != METHOD_UNKNOWN;
+        m_lsf_file = m_dir / "Data.lsf" + Compression::Factory::extension(blocks ? METHOD_BLOCK : m_compression);
 
-        if (m_compression == METHOD_UNKNOWN)
-          m_lsf = new std::ofstream(m_lsf_file.c_str(), std::ios::binary);
+        size_t budget = m_args.lsf_memory * 1024;
+        std::ostream* os = NULL;
+        Compression::ParallelCompressor* com = NULL;
+        if (m_compression == METHOD_UNKNOWN || blocks)
+          os = new std::ofstream(m_lsf_file.c_str(), std::ios::binary);
         else
-          m_lsf = new Compression::FileOutput(m_lsf_file.c_str(), m_compression);
+          os = new Compression::FileOutput(m_lsf_file.c_str(), m_compression, m_args.lsf_threads, budget);
+
+        if (blocks)
+          com = new Compression::ParallelCompressor(os, m_compression, m_args.lsf_threads, budget, true);
+
+        m_lsf = new Writer(os, m_args.lsf_buffer_size * 1024, m_args.lsf_buffer_count, com);
+        m_stalls = 0;
+
+        if (m_args.lsf_index && blocks)
+          m_index = new IMC::LsfIndex::Writer(IMC::LsfIndex::getPath(m_lsf_file.str()),
+                                              m_args.lsf_index_interval, com);
+        else if (m_args.lsf_index)
+          m_index = new IMC::LsfIndex::Writer(IMC::LsfIndex::getPath(m_lsf_file.str()),
+                                              m_args.lsf_index_interval,
+                                              m_compression != METHOD_UNKNOWN);
 
         // Log LoggingControl to facilitate posterior conversion to LLF.
         m_log_ctl.op = IMC::LoggingControl::COP_STARTED;
@@ -391,6 +490,9 @@ namespace Transports
         mib /= c_bytes_per_mib;
 
         m_lsf->flush();
+        if (m_index != NULL)
+          m_index->flush();
+        reportWriter();
 
         if ((m_args.lsf_volume_size > 0) && (mib >= m_args.lsf_volume_size))
           tryStartLog(m_label);
@@ -402,6 +504,21 @@ namespace Transports
           changeVolumeDirectory();
       }
 
+      void
+      reportWriter(void)
+      {
+        Writer::Counters c = m_lsf->getCounters();
+
+        debug("writer: %llu bytes in, %llu bytes out, %lu buffers, %lu stalls (%0.3f s)",
+              (unsigned long long)c.bytes_in, (unsigned long long)c.bytes_out,
+              c.buffers, c.stalls, c.stall_time);
+
+        if (c.stalls > m_stalls)
+          war(DTR("log writer is not keeping up, %lu stalls"), c.stalls - m_stalls);
+
+        m_stalls = c.stalls;
+      }
+
       void
       tryStartLog(const std::string& label = "")
       {
@@ -425,7 +542,20 @@ namespace Transports
           return;
 
         IMC::Packet::serialize(msg, m_buffer);
-        m_lsf->write(m_buffer.getBufferSigned(), m_buffer.getSize());
+        logRecord(msg->getId(), msg->getTimeStamp(), m_buffer.getBufferSigned(), m_buffer.getSize());
+      }
+
+      void
+      logRecord(uint16_t id, double timestamp, const char* data, unsigned size)
+      {
+        // Index entries start on compressed block boundaries.
+        if (m_index != NULL && m_index->isBoundary(timestamp))
+          m_lsf->endBlock();
+
+        m_lsf->write(data, size, timestamp);
+
+        if (m_index != NULL)
+          m_index->add(id, timestamp, size);
       }
 
       void
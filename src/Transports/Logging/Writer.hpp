@@ -0,0 +1,437 @@
+//***************************************************************************
+// Copyright 2007-2019 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef TRANSPORTS_LOGGING_WRITER_HPP_INCLUDED_
+#define TRANSPORTS_LOGGING_WRITER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <deque>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace Logging
+  {
+    using DUNE_NAMESPACES;
+
+    //! Asynchronous log writer. Data is appended to one of a set of
+    //! preallocated buffers and full buffers are compressed and
+    //! written to the output stream by a dedicated thread, so a slow
+    //! storage device or compressor does not stall the logging task.
+    //! When all buffers are waiting to be written the caller blocks
+    //! until one is available (back-pressure), no data is dropped.
+    //! With a block compressor, records are never split across
+    //! buffers and each buffer is handed to it as an independently
+    //! compressed block describing the records it holds.
+    class Writer: public Concurrency::Thread
+    {
+    public:
+      //! Writer statistics.
+      struct Counters
+      {
+        //! Number of bytes accepted.
+        uint64_t bytes_in;
+        //! Number of bytes written to the stream.
+        uint64_t bytes_out;
+        //! Number of buffers written.
+        unsigned long buffers;
+        //! Number of times the caller had to wait for a free buffer.
+        unsigned long stalls;
+        //! Total time spent waiting for free buffers.
+        double stall_time;
+      };
+
+      //! Constructor. Ownership of the output stream and block
+      //! compressor is transferred to the writer.
+      //! @param[in] os output stream.
+      //! @param[in] buffer_size size of each buffer in bytes.
+      //! @param[in] buffer_count number of buffers.
+      //! @param[in] com compressor writing container blocks to the
+      //! output stream or NULL to write records unchanged.
+      Writer(std::ostream* os, unsigned buffer_size, unsigned buffer_count,
+             Compression::ParallelCompressor* com = NULL):
+        m_os(os),
+        m_com(com),
+        m_buffer_size(buffer_size),
+        m_active(NULL),
+        m_flush(false),
+        m_closing(false)
+      {
+        if (buffer_count < 2)
+          buffer_count = 2;
+
+        for (unsigned i = 0; i < buffer_count; ++i)
+        {
+          Buffer* bfr = new Buffer;
+          bfr->data.reserve(m_buffer_size);
+          m_buffers.push_back(bfr);
+          m_free.push_back(bfr);
+        }
+
+        m_active = m_free.back();
+        m_free.pop_back();
+
+        std::memset(&m_counters, 0, sizeof(m_counters));
+
+        start();
+      }
+
+      //! Destructor. Pending data is written and the output stream
+      //! is closed.
+      ~Writer(void)
+      {
+        close();
+
+        for (unsigned i = 0; i < m_buffers.size(); ++i)
+          delete m_buffers[i];
+
+        delete m_com;
+        delete m_os;
+      }
+
+      //! Append a record to the log.
+      //! @param[in] data record data.
+      //! @param[in] size record size.
+      //! @param[in] timestamp record timestamp.
+      void
+      write(const char* data, size_t size, double timestamp)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        checkError();
+
+        m_counters.bytes_in += size;
+
+        if (m_com != NULL)
+        {
+          if (m_active == NULL || (!m_active->data.empty() && m_active->data.size() + size > m_buffer_size))
+            acquireBuffer();
+
+          if (m_active->records == 0)
+            m_active->time_first = timestamp;
+
+          m_active->time_last = timestamp;
+          ++m_active->records;
+          m_active->data.insert(m_active->data.end(), data, data + size);
+          return;
+        }
+
+        while (size > 0)
+        {
+          if (m_active == NULL || m_active->data.size() == m_buffer_size)
+            acquireBuffer();
+
+          size_t n = std::min(size, (size_t)(m_buffer_size - m_active->data.size()));
+          m_active->data.insert(m_active->data.end(), data, data + n);
+          data += n;
+          size -= n;
+        }
+      }
+
+      //! Hand the data appended so far to the writer thread and
+      //! flush the output stream. This function does not wait for
+      //! the data to be written.
+      void
+      flush(void)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        checkError();
+
+        enqueueActive();
+        m_flush = true;
+        m_cond.broadcast();
+      }
+
+      //! Write pending data and stop the writer thread. No records
+      //! can be written afterwards, but the output stream and block
+      //! compressor remain available until the writer is destroyed.
+      void
+      close(void)
+      {
+        m_cond.lock();
+        enqueueActive();
+        bool closing = m_closing;
+        m_closing = true;
+        m_cond.broadcast();
+        m_cond.unlock();
+
+        if (!closing)
+          stopAndJoin();
+      }
+
+      //! End the current block, so that the next record starts a
+      //! new one. Only meaningful in block mode, where it lets
+      //! readers start decoding at given records.
+      void
+      endBlock(void)
+      {
+        if (m_com == NULL)
+          return;
+
+        Concurrency::ScopedCondition l(m_cond);
+        enqueueActive();
+      }
+
+      //! Retrieve writer statistics.
+      //! @return statistics.
+      Counters
+      getCounters(void)
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        Counters c = m_counters;
+        if (m_com != NULL)
+          c.bytes_out = m_com->getWritten();
+        return c;
+      }
+
+    private:
+      //! Data buffer.
+      struct Buffer
+      {
+        //! Data.
+        std::vector<char> data;
+        //! Timestamp of the first record (block mode only).
+        double time_first;
+        //! Timestamp of the last record (block mode only).
+        double time_last;
+        //! Number of records (block mode only).
+        unsigned records;
+
+        Buffer(void):
+          time_first(0),
+          time_last(0),
+          records(0)
+        { }
+
+        void
+        clear(void)
+        {
+          data.clear();
+          records = 0;
+        }
+      };
+
+      //! Output stream.
+      std::ostream* m_os;
+      //! Block compressor.
+      Compression::ParallelCompressor* m_com;
+      //! Size of each buffer.
+      unsigned m_buffer_size;
+      //! All buffers.
+      std::vector<Buffer*> m_buffers;
+      //! Buffers available to the caller.
+      std::vector<Buffer*> m_free;
+      //! Buffers waiting to be written.
+      std::deque<Buffer*> m_queue;
+      //! Buffer being filled.
+      Buffer* m_active;
+      //! True if a flush was requested.
+      bool m_flush;
+      //! True if the writer is being destroyed.
+      bool m_closing;
+      //! Error raised by the writer thread.
+      std::string m_error;
+      //! Statistics.
+      Counters m_counters;
+      //! Writer condition.
+      Concurrency::Condition m_cond;
+
+      //! Queue the active buffer for writing, if not empty. Must be
+      //! called with the condition locked.
+      void
+      enqueueActive(void)
+      {
+        if (m_active == NULL || m_active->data.empty())
+          return;
+
+        m_queue.push_back(m_active);
+        m_active = NULL;
+        m_cond.broadcast();
+      }
+
+      //! Queue the active buffer and wait for a free one. Must be
+      //! called with the condition locked.
+      void
+      acquireBuffer(void)
+      {
+        enqueueActive();
+
+        if (m_free.empty())
+        {
+          double start = Clock::get();
+          ++m_counters.stalls;
+
+          while (m_free.empty() && m_error.empty())
+            m_cond.wait();
+
+          m_counters.stall_time += Clock::get() - start;
+          checkError();
+        }
+
+        m_active = m_free.back();
+        m_free.pop_back();
+      }
+
+      //! Throw pending errors raised by the writer thread. Must be
+      //! called with the condition locked.
+      void
+      checkError(void)
+      {
+        if (!m_error.empty())
+          throw std::runtime_error(m_error);
+      }
+
+      //! Write a buffer to the output stream or, in block mode, hand
+      //! it to the block compressor. Called by the writer thread
+      //! only.
+      //! @param[in] bfr buffer.
+      //! @return number of bytes written to the output stream by
+      //! this call.
+      size_t
+      writeBuffer(Buffer& bfr)
+      {
+        if (m_com == NULL)
+        {
+          m_os->write(&bfr.data[0], bfr.data.size());
+          return bfr.data.size();
+        }
+
+        m_com->write(&bfr.data[0], bfr.data.size(), bfr.time_first, bfr.time_last, bfr.records);
+        return 0;
+      }
+
+      //! Flush the output stream, waiting for pending blocks in block
+      //! mode. Called by the writer thread only.
+      void
+      flushStream(void)
+      {
+        if (m_com != NULL)
+          m_com->flush();
+        else
+          m_os->flush();
+      }
+
+      //! Test the state of the output stream. In block mode the
+      //! stream is written by the compression threads and only the
+      //! block compressor may inspect it. Called by the writer thread
+      //! only.
+      //! @return true if no errors occurred, false otherwise.
+      bool
+      streamGood(void)
+      {
+        if (m_com != NULL)
+          return !m_com->failed();
+
+        return m_os->good();
+      }
+
+      void
+      run(void)
+      {
+        while (true)
+        {
+          Buffer* bfr = NULL;
+          bool flush = false;
+
+          m_cond.lock();
+
+          while (m_queue.empty() && !m_flush && !m_closing)
+            m_cond.wait();
+
+          if (m_queue.empty() && !m_flush && m_closing)
+          {
+            m_cond.unlock();
+            break;
+          }
+
+          if (!m_queue.empty())
+          {
+            bfr = m_queue.front();
+            m_queue.pop_front();
+          }
+          else
+          {
+            flush = m_flush;
+            m_flush = false;
+          }
+
+          m_cond.unlock();
+
+          // Write outside the lock so the caller can keep filling
+          // buffers in the meantime.
+          std::string error;
+          size_t written = 0;
+          try
+          {
+            if (bfr != NULL && !bfr->data.empty())
+              written = writeBuffer(*bfr);
+
+            if (flush)
+              flushStream();
+
+            if (!streamGood())
+              error = DTR("failed to write log data");
+          }
+          catch (std::exception& e)
+          {
+            error = e.what();
+          }
+
+          m_cond.lock();
+
+          if (bfr != NULL)
+          {
+            m_counters.bytes_out += written;
+            ++m_counters.buffers;
+            bfr->clear();
+            m_free.push_back(bfr);
+          }
+
+          if (!error.empty() && m_error.empty())
+            m_error = error;
+
+          m_cond.broadcast();
+          m_cond.unlock();
+        }
+
+        try
+        {
+          flushStream();
+        }
+        catch (std::exception&)
+        { }
+      }
+    };
+  }
+}
+
+#endif
@@ -72,8 +72,10 @@ namespace Transports
       double m_ts_delta;
       double m_start_time;
 
-      // Replay file handle
-      std::istream* m_is;
+      // Replay file reader
+      IMC::LsfReader* m_reader;
+      // Replay file index
+      IMC::LsfIndex m_index;
       // last state from replay file
       IMC::EstimatedState m_estate;
 
@@ -98,7 +100,7 @@ namespace Transports
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
-        m_is(0)
+        m_reader(NULL)
       {
         param("Load At Start", m_args.startup_file)
         .defaultValue("")
@@ -240,11 +242,7 @@ namespace Transports
 
         try
         {
-          Compression::Methods method = Compression::Factory::detect(file.c_str());
-          if (method == Compression::METHOD_UNKNOWN)
-            m_is = new std::ifstream(file.c_str(), std::ios::binary);
-          else
-            m_is = new Compression::FileInput(file.c_str(), method);
+          m_reader = new IMC::LsfReader(file);
         }
         catch (std::exception& e)
         {
@@ -252,11 +250,24 @@ namespace Transports
           return;
         }
 
+        m_index = IMC::LsfIndex();
+
+        try
+        {
+          if (m_index.load(IMC::LsfIndex::getPath(file)))
+            debug("using index with %u entries", (unsigned)m_index.getBlocks().size());
+        }
+        catch (std::exception& e)
+        {
+          war("%s: %s", DTR("ignoring invalid index"), e.what());
+          m_index = IMC::LsfIndex();
+        }
+
         IMC::Message* m = 0;
 
         try
         {
-          m = IMC::Packet::deserialize(*m_is);
+          m = m_reader->read();
         }
         catch (std::exception& e)
         {
@@ -320,7 +331,11 @@ namespace Transports
       {
         IMC::Message* m = 0;
         double time_origin = m_ts_delta;
-        m = IMC::Packet::deserialize(*m_is);
+
+        if (!m_index.getBlocks().empty())
+          skipIndexed(time_origin + time_to_skip);
+
+        m = m_reader->read();
         while (m)
         {
           if (m->getTimeStamp() - time_origin >= time_to_skip)
@@ -332,18 +347,61 @@ namespace Transports
           }
 
           delete m;
-          m = IMC::Packet::deserialize(*m_is);
-          if(getDebugLevel() >= DEBUG_LEVEL_SPEW)
+          m = m_reader->read();
+          if (m && getDebugLevel() >= DEBUG_LEVEL_SPEW)
             m->toText(std::cout);
         }
         return NULL;
       }
 
+      //! Move to the first index block that may hold messages after
+      //! a given time. Skipped blocks are only decoded if they hold
+      //! entity information.
+      void
+      skipIndexed(double time)
+      {
+        const std::vector<IMC::LsfIndex::Block>& blocks = m_index.getBlocks();
+        size_t target = m_index.find(time);
+
+        for (size_t i = m_index.find(0, DUNE_IMC_ENTITYINFO); i < target;
+             i = m_index.find(i + 1, DUNE_IMC_ENTITYINFO))
+        {
+          if (blocks[i].offset > m_reader->getNextOffset())
+            m_reader->seek(blocks[i]);
+
+          uint64_t end = blocks[i].offset + blocks[i].size;
+          while (m_reader->getNextOffset() < end && m_reader->next())
+          {
+            if (m_reader->getHeader().mgid != DUNE_IMC_ENTITYINFO)
+              continue;
+
+            IMC::Message* m = m_reader->decode(NULL, true);
+            updateEntityMap(m);
+            delete m;
+          }
+        }
+
+        // The index may not cover the end of the log.
+        if (target < blocks.size())
+        {
+          if (blocks[target].offset > m_reader->getNextOffset())
+            m_reader->seek(blocks[target]);
+          return;
+        }
+
+        uint64_t offset = blocks.back().offset + blocks.back().size;
+        if (offset > m_reader->getNextOffset())
+          m_reader->seek(offset);
+      }
+
       void
       stopReplay(void)
       {
         war(DTR("stopped replay"));
 
+        if (m_reader != NULL && m_reader->getCorruptedBlocks() > 0)
+          war(DTR("skipped %u damaged blocks"), m_reader->getCorruptedBlocks());
+
         displayStats();
         reset();
 
@@ -384,11 +442,7 @@ namespace Transports
       {
         requestDeactivation();
 
-        if (m_is)
-        {
-          delete m_is;
-          m_is = 0;
-        }
+        Memory::clear(m_reader);
         m_eid2eid.clear();
         m_tstats.clear();
         m_tgstats = Stats();
@@ -465,7 +519,7 @@ namespace Transports
 
           IMC::Message* m = 0;
 
-          while (!stopping() && (m = DUNE::IMC::Packet::deserialize(*m_is)) != 0 && !m_is->eof())
+          while (!stopping() && (m = m_reader->read()) != 0)
           {
             consumeMessages();
 
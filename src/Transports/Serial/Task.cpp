@@ -73,11 +73,15 @@ namespace Transports
       onResourceAcquisition(void)
       {
         m_uart = new SerialPort(m_args.device, m_args.baud_rate);
+        addHandle(*m_uart);
       }
 
       void
       onResourceRelease(void)
       {
+        if (m_uart != NULL)
+          removeHandle(*m_uart);
+
         Memory::clear(m_uart);
 
         m_parser.reset();
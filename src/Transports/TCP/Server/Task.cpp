@@ -27,6 +27,11 @@
 // Author: Eduardo Marques                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <list>
+#include <map>
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
@@ -70,6 +75,9 @@ namespace Transports
         // Client list.
         typedef std::list<Client> ClientList;
         ClientList m_clients;
+        // Client lookup by native socket handle.
+        typedef std::map<NativeHandle, ClientList::iterator> ClientIndex;
+        ClientIndex m_index;
 
         Task(const std::string& name, Tasks::Context& ctx):
           Tasks::SimpleTransport(name, ctx),
@@ -119,6 +127,7 @@ namespace Transports
 
           m_sock->listen(5);
           m_poll.add(*m_sock);
+          addHandle(*m_sock);
           inf(DTR("listening on %s:%u"), Address(Address::Any).c_str(), m_args.port);
 
           if (m_args.announce)
@@ -171,7 +180,9 @@ namespace Transports
           debug("closing connection to %s:%u (%s), client count is %lu",
                 c.address.c_str(), c.port, e.what(), client_count);
 
+          m_index.erase(c.socket->getNative());
           m_poll.remove(*c.socket);
+          removeHandle(*c.socket);
           delete c.socket;
         }
 
@@ -181,14 +192,17 @@ namespace Transports
           for (ClientList::iterator itr = m_clients.begin(); itr != m_clients.end(); ++itr)
           {
             m_poll.remove(*itr->socket);
+            removeHandle(*itr->socket);
             delete itr->socket;
           }
 
           m_clients.clear();
+          m_index.clear();
 
           if (m_sock)
           {
             m_poll.remove(*m_sock);
+            removeHandle(*m_sock);
             delete m_sock;
             m_sock = 0;
           }
@@ -243,7 +257,9 @@ namespace Transports
             c.socket->setReceiveTimeout(5);
             c.socket->setSendTimeout(5);
             m_poll.add(*c.socket);
+            addHandle(*c.socket);
             m_clients.push_back(c);
+            m_index[c.socket->getNative()] = --m_clients.end();
             updateEntityState(m_clients.size());
 
             debug("accepted connection from %s:%u, client count is %lu",
@@ -260,17 +276,18 @@ namespace Transports
         void
         handleClients(uint8_t* buf, unsigned int cap)
         {
-          // Check for new data from clients.
-          ClientList::iterator itr = m_clients.begin();
+          // Only visit clients with pending data. The list of
+          // triggered handles is copied since closing a connection
+          // removes its handle from the polling pool.
+          std::vector<NativeHandle> triggered(m_poll.getTriggered());
 
-          while (itr != m_clients.end())
+          for (unsigned i = 0; i < triggered.size(); ++i)
           {
-            if (!m_poll.wasTriggered(*itr->socket))
-            {
-              ++itr;
+            ClientIndex::iterator idx = m_index.find(triggered[i]);
+            if (idx == m_index.end())
               continue;
-            }
 
+            ClientList::iterator itr = idx->second;
             int n;
 
             try
@@ -280,14 +297,12 @@ namespace Transports
             catch (std::runtime_error& e)
             {
               closeConnection(*itr, e);
-              itr = m_clients.erase(itr);
+              m_clients.erase(itr);
               continue;
             }
 
             if (n > 0)
               handleData(itr->parser, buf, n);
-
-            ++itr;
           }
         }
       };
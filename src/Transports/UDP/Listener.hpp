@@ -80,6 +80,8 @@ namespace Transports
     private:
       // Buffer capacity.
       static const int c_bfr_size = 65535;
+      // Maximum number of datagrams received at once.
+      static const int c_batch_size = 16;
       // Poll timeout in milliseconds.
       static const int c_poll_tout = 1000;
       // Parent task.
@@ -98,8 +100,15 @@ namespace Transports
       void
       run(void)
       {
-        Address addr;
-        uint8_t* bfr = new uint8_t[c_bfr_size];
+        uint8_t* bfr = new uint8_t[c_bfr_size * c_batch_size];
+        UDPSocket::Datagram dgrams[c_batch_size];
+
+        for (int i = 0; i < c_batch_size; ++i)
+        {
+          dgrams[i].data = bfr + i * c_bfr_size;
+          dgrams[i].size = c_bfr_size;
+        }
+
         double poll_tout = c_poll_tout / 1000.0;
 
         while (!isStopping())
@@ -109,42 +118,58 @@ namespace Transports
             if (!Poll::poll(m_sock, poll_tout))
               continue;
 
-            uint16_t rv = m_sock.read(bfr, c_bfr_size, &addr);
-            IMC::Message* msg = IMC::Packet::deserialize(bfr, rv);
-
-            if (m_lcomms->isActive())
-            {
-              if (msg->getId() == DUNE_IMC_ANNOUNCE)
-              {
-                m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
-              }
-
-              if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
-              {
-                delete msg;
-                continue;
-              }
-            }
-
-            m_contacts_lock.lockWrite();
-            m_contacts.update(msg->getSource(), addr);
-            m_contacts_lock.unlock();
+            // Drain bursts of datagrams with a single system call.
+            size_t count = m_sock.readBatch(dgrams, c_batch_size);
 
-            m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
-
-            if (m_trace)
-              msg->toText(std::cerr);
-
-            delete msg;
+            for (size_t i = 0; i < count; ++i)
+              handleDatagram(dgrams[i]);
           }
           catch (std::exception & e)
           {
-            m_task.debug("error while unpacking message: %s",e.what());
+            m_task.debug("error while receiving data: %s", e.what());
           }
         }
 
         delete [] bfr;
       }
+
+      void
+      handleDatagram(const UDPSocket::Datagram& dgram)
+      {
+        try
+        {
+          IMC::Message* msg = IMC::Packet::deserialize(dgram.data, dgram.length);
+
+          if (m_lcomms->isActive())
+          {
+            if (msg->getId() == DUNE_IMC_ANNOUNCE)
+            {
+              m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
+            }
+
+            if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
+            {
+              delete msg;
+              return;
+            }
+          }
+
+          m_contacts_lock.lockWrite();
+          m_contacts.update(msg->getSource(), dgram.address);
+          m_contacts_lock.unlock();
+
+          m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+
+          if (m_trace)
+            msg->toText(std::cerr);
+
+          delete msg;
+        }
+        catch (std::exception & e)
+        {
+          m_task.debug("error while unpacking message: %s",e.what());
+        }
+      }
     };
   }
 }
@@ -33,6 +33,7 @@
 // ISO C++ 98 headers.
 #include <string>
 #include <map>
+#include <vector>
 #include <cstdio>
 
 // DUNE headers.
@@ -96,8 +97,14 @@ namespace Transports
         return m_active_count;
       }
 
+      //! Add datagrams addressed to all reachable nodes to a list
+      //! of datagrams to be sent.
+      //! @param[out] dgrams list of datagrams.
+      //! @param[in] data data to be transmitted.
+      //! @param[in] data_len length of data to be transmitted.
+      //! @param[in] msgid message identifier.
       void
-      send(UDPSocket& sock, const uint8_t* data, unsigned data_len, unsigned msgid)
+      addDatagrams(std::vector<UDPSocket::Datagram>& dgrams, uint8_t* data, unsigned data_len, unsigned msgid)
       {
         if (m_lcomms != NULL)
         {
@@ -106,7 +113,7 @@ namespace Transports
             for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
             {
               if (m_lcomms->isNodeWithinRange(itr->first, msgid))
-                itr->second.send(sock, data, data_len);
+                itr->second.addDatagram(dgrams, data, data_len);
             }
 
             return;
@@ -114,7 +121,7 @@ namespace Transports
         }
 
         for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
-          itr->second.send(sock, data, data_len);
+          itr->second.addDatagram(dgrams, data, data_len);
       }
 
       void
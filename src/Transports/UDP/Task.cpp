@@ -31,6 +31,7 @@
 #include <vector>
 #include <stdexcept>
 #include <set>
+#include <map>
 #include <algorithm>
 #include <cstddef>
 
@@ -101,6 +102,8 @@ namespace Transports
       std::set<NodeAddress> m_static_dsts;
       //! Set of destination nodes.
       NodeTable m_node_table;
+      //! Outgoing datagrams.
+      std::vector<UDPSocket::Datagram> m_dgrams;
       //! Task arguments.
       Arguments m_args;
       //! Simulate communication limitations
@@ -115,6 +118,8 @@ namespace Transports
       LimitedComms* m_lcomms;
       //! Message Filter
       MessageFilter m_filter;
+      //! Consumers of transported messages.
+      std::map<uint32_t, AbstractConsumer*> m_consumers;
 
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
@@ -229,13 +234,48 @@ namespace Transports
           debug("limited communications simulation is not active");
           m_comm_limitations = false;
         }
+
+        setupSubscriptions();
+      }
+
+      //! Discard messages that would not be sent before they are
+      //! consumed.
+      void
+      setupSubscriptions(void)
+      {
+        std::map<uint32_t, AbstractConsumer*>::const_iterator itr = m_consumers.begin();
+        for (; itr != m_consumers.end(); ++itr)
+        {
+          // Limited communications need every estimated state.
+          if (m_comm_limitations && itr->first == DUNE_IMC_ESTIMATEDSTATE)
+          {
+            setSubscription(itr->first, itr->second, IMC::Subscription());
+            continue;
+          }
+
+          IMC::Subscription sub = m_filter.getSubscription(itr->first);
+          if (m_args.only_local)
+            sub.source(getSystemId());
+
+          setSubscription(itr->first, itr->second, sub);
+        }
       }
 
       void
       onResourceAcquisition(void)
       {
         // Register normal messages.
-        bind(this, m_args.messages);
+        for (unsigned i = 0; i < m_args.messages.size(); ++i)
+        {
+          uint32_t id = IMC::Factory::getIdFromAbbrev(m_args.messages[i]);
+          if (m_consumers.find(id) != m_consumers.end())
+            continue;
+
+          m_consumers[id] = new Consumer<Task, IMC::Message>(*this, &Task::consume);
+          bind(id, m_consumers[id]);
+        }
+
+        setupSubscriptions();
 
         // Find a free port.
         unsigned port_limit = m_args.port + c_port_retries;
@@ -333,7 +373,8 @@ namespace Transports
         if (m_node_table.getActiveCount() == 0 && m_static_dsts.size() == 0)
           return;
 
-        if (m_filter.filter(msg))
+        // Not filtered by the bus (see setupSubscriptions()).
+        if (m_comm_limitations && msg->getId() == DUNE_IMC_ESTIMATEDSTATE && m_filter.filter(msg))
           return;
 
         if (m_args.trace_out)
@@ -341,23 +382,27 @@ namespace Transports
 
         uint16_t rv = IMC::Packet::serialize(msg, m_bfr, c_bfr_size);
 
+        m_dgrams.clear();
+
         // Send to static nodes.
         std::set<NodeAddress>::iterator itr = m_static_dsts.begin();
         for (; itr != m_static_dsts.end(); ++itr)
         {
-          try
-          {
-            m_sock.write(m_bfr, rv, itr->getAddress(), itr->getPort());
-          }
-          catch (...)
-          { }
+          UDPSocket::Datagram dgram;
+          dgram.data = m_bfr;
+          dgram.size = rv;
+          dgram.length = 0;
+          dgram.address = itr->getAddress();
+          dgram.port = itr->getPort();
+          m_dgrams.push_back(dgram);
         }
 
+        // Send to dynamic nodes.
         if (m_args.dynamic_nodes)
-        {
-          // Send to dynamic nodes.
-          m_node_table.send(m_sock, m_bfr, rv, msg->getId());
-        }
+          m_node_table.addDatagrams(m_dgrams, m_bfr, rv, msg->getId());
+
+        if (!m_dgrams.empty())
+          m_sock.writeBatch(&m_dgrams[0], m_dgrams.size());
       }
 
       void